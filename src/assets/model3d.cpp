@@ -27,6 +27,8 @@
 
 #include "../core/core.h"
 #include "../config/config.h"
+#include "SDL2/SDL.h"
+#include <deque>
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -43,6 +45,12 @@ struct sModel3DAsset {
     const float TriangleSizeLimit{-1.0f};
     const bool NeedTangentAndBinormal{false};
     std::weak_ptr<sModel3D> PreloadedModel3D{};
+    // requested by current mission (should not be evicted)
+    bool Requested{false};
+    // "time" of last use, in order to evict least recently used assets first
+    unsigned LastUse{0};
+    // approximate memory size (system and video memory), in bytes
+    size_t MemorySize{0};
 
     sModel3DAsset() = delete;
     [[gnu::noinline, clang::noinline, msvc::noinline]]
@@ -249,19 +257,98 @@ std::unordered_map<unsigned, sModel3DAsset> Model3DMap{
     {constexpr_hash_djb2a("models/building/bld-11.vw3d"),          sModel3DAsset{"models/building/bld-11.vw3d", -1.0f, true}}
 };
 
+// assets, that should be loaded in background (by PrefetchModel3DAssets() call)
+std::deque<unsigned> PrefetchQueue{};
+// counter for assets usage, in order to find least recently used assets
+unsigned UseCounter{0};
+// approximate memory size of all loaded assets, in bytes
+size_t TotalMemorySize{0};
+
 } // unnamed namespace
 
 
+/*
+ * Is model3d asset should be resident (loaded on startup and never evicted).
+ * Player's ship, weapons, projectiles, mines, turrets and small asteroids
+ * could be used by any mission, so, we keep them in memory all the time.
+ */
+static bool IsResidentModel3DAsset(const sModel3DAsset &Asset)
+{
+    return (Asset.Model3DFile.compare(0, 19, "models/earthfighter") == 0) ||
+           (Asset.Model3DFile.compare(0, 11, "models/mine") == 0) ||
+           (Asset.Model3DFile.compare(0, 13, "models/turret") == 0) ||
+           (Asset.Model3DFile.compare(0, 22, "models/space/asteroid-") == 0);
+}
+
+/*
+ * Calculate approximate model3d memory size (system and video memory), in bytes.
+ */
+static size_t CalculateModel3DMemorySize(const sModel3D &Model)
+{
+    size_t VertexStride = Model.Chunks.empty() ? 0 : Model.Chunks[0].VertexStride;
+    size_t tmpSize = Model.GlobalVertexArrayCount * VertexStride * sizeof(float);
+    if (Model.GlobalVBO) {
+        tmpSize *= 2;
+    }
+
+    size_t tmpIndexSize = Model.GlobalIndexArrayCount * sizeof(unsigned);
+    if (Model.GlobalIBO) {
+        tmpIndexSize *= 2;
+    }
+    tmpSize += tmpIndexSize;
+
+    size_t tmpLODIndexSize = Model.GlobalLODIndexArrayCount * sizeof(unsigned);
+    for (const auto &tmpChunk : Model.Chunks) {
+        tmpLODIndexSize += tmpChunk.LODIndexArrayCount * sizeof(unsigned);
+    }
+    tmpSize += tmpLODIndexSize * 2;
+
+    for (const auto &tmpChunk : Model.Chunks) {
+        if (tmpChunk.VertexArrayWithSmallTriangles.get() != tmpChunk.VertexArray.get()) {
+            tmpSize += tmpChunk.VertexArrayWithSmallTrianglesCount * tmpChunk.VertexStride * sizeof(float);
+        }
+    }
+
+    return tmpSize;
+}
+
+/*
+ * Load model3d asset, if it was not loaded yet.
+ */
+static void LoadModel3DAsset(sModel3DAsset &Asset)
+{
+    if (!Asset.PreloadedModel3D.expired()) {
+        return;
+    }
+
+    Asset.PreloadedModel3D = vw_LoadModel3D(Asset.Model3DFile,
+                                            Asset.TriangleSizeLimit,
+                                            Asset.NeedTangentAndBinormal && GameConfig().UseGLSL120);
+    Asset.LastUse = ++UseCounter;
+
+    if (auto sharedModel3D = Asset.PreloadedModel3D.lock()) {
+        Asset.MemorySize = CalculateModel3DMemorySize(*sharedModel3D);
+        TotalMemorySize += Asset.MemorySize;
+    }
+}
+
 /*
  * Get all model3d assets load value.
  */
 unsigned GetModel3DAssetsLoadValue()
 {
-    return Model3DMap.size() * Model3DLoadValue;
+    unsigned tmpLoadValue{0};
+    for (const auto &tmpAsset : Model3DMap) {
+        if (IsResidentModel3DAsset(tmpAsset.second)) {
+            tmpLoadValue += Model3DLoadValue;
+        }
+    }
+    return tmpLoadValue;
 }
 
 /*
- * Cycle with function callback on each model3d asset load.
+ * Cycle with function callback on each resident model3d asset load.
+ * Note, all other model3d assets are loaded on demand.
  */
 void ForEachModel3DAssetLoad(std::function<void (unsigned AssetValue)> function)
 {
@@ -281,27 +368,126 @@ void ForEachModel3DAssetLoad(std::function<void (unsigned AssetValue)> function)
 #endif // NDEBUG
 
     for (auto &tmpAsset : Model3DMap) {
-        tmpAsset.second.PreloadedModel3D =
-            vw_LoadModel3D(tmpAsset.second.Model3DFile,
-                           tmpAsset.second.TriangleSizeLimit,
-                           tmpAsset.second.NeedTangentAndBinormal && GameConfig().UseGLSL120);
+        if (!IsResidentModel3DAsset(tmpAsset.second)) {
+            continue;
+        }
+        LoadModel3DAsset(tmpAsset.second);
         function(Model3DLoadValue);
     }
 }
 
 /*
- * Get preloaded model3d asset (preloaded by ForEachModel3DAssetLoad() call).
+ * Get preloaded model3d asset (preloaded by ForEachModel3DAssetLoad() or
+ * PrefetchModel3DAssets() call). If asset was not loaded yet, load it now.
  */
 std::weak_ptr<sModel3D> GetPreloadedModel3DAsset(unsigned FileNameHash)
 {
     auto tmpAsset = Model3DMap.find(FileNameHash);
-    if (tmpAsset != Model3DMap.end() && !tmpAsset->second.PreloadedModel3D.expired()) {
-        return tmpAsset->second.PreloadedModel3D;
+    if (tmpAsset != Model3DMap.end()) {
+        LoadModel3DAsset(tmpAsset->second);
+        if (!tmpAsset->second.PreloadedModel3D.expired()) {
+            tmpAsset->second.LastUse = ++UseCounter;
+            return tmpAsset->second.PreloadedModel3D;
+        }
     }
 
     std::cerr << __func__ << "(): " << "preloaded model3d not found: " << FileNameHash << "\n";
     return std::weak_ptr<sModel3D>{};
 }
 
+/*
+ * Reset all model3d assets requests and clear prefetch queue.
+ */
+void ResetModel3DAssetsRequests()
+{
+    for (auto &tmpAsset : Model3DMap) {
+        tmpAsset.second.Requested = false;
+    }
+    PrefetchQueue.clear();
+}
+
+/*
+ * Request model3d asset, asset will be loaded by PrefetchModel3DAssets() call.
+ */
+void RequestModel3DAsset(unsigned FileNameHash)
+{
+    auto tmpAsset = Model3DMap.find(FileNameHash);
+    if (tmpAsset == Model3DMap.end() || tmpAsset->second.Requested) {
+        return;
+    }
+
+    tmpAsset->second.Requested = true;
+    if (tmpAsset->second.PreloadedModel3D.expired()) {
+        PrefetchQueue.push_back(FileNameHash);
+    }
+}
+
+/*
+ * Request all model3d assets with file name, that starts with Prefix.
+ */
+void RequestModel3DAssetsByPrefix(const std::string &Prefix)
+{
+    for (const auto &tmpAsset : Model3DMap) {
+        if (tmpAsset.second.Model3DFile.compare(0, Prefix.size(), Prefix) == 0) {
+            RequestModel3DAsset(tmpAsset.first);
+        }
+    }
+}
+
+/*
+ * Load requested model3d assets from prefetch queue.
+ * TimeLimit - time limit in milliseconds (ticks), 0 - load all requested assets.
+ * Return true, if prefetch queue is empty.
+ */
+bool PrefetchModel3DAssets(uint32_t TimeLimit)
+{
+    uint32_t StartTick = SDL_GetTicks();
+
+    while (!PrefetchQueue.empty()) {
+        if (TimeLimit && (SDL_GetTicks() - StartTick >= TimeLimit)) {
+            return false;
+        }
+
+        auto tmpAsset = Model3DMap.find(PrefetchQueue.front());
+        PrefetchQueue.pop_front();
+        if (tmpAsset != Model3DMap.end() && tmpAsset->second.Requested) {
+            LoadModel3DAsset(tmpAsset->second);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Evict least recently used model3d assets, until fit into MemoryBudget (in bytes).
+ * Resident and requested assets are never evicted.
+ * Note, caller should care, that there are no objects with evicted models.
+ */
+void EvictModel3DAssets(size_t MemoryBudget)
+{
+    while (TotalMemorySize > MemoryBudget) {
+        auto Candidate = Model3DMap.end();
+        for (auto iter = Model3DMap.begin(); iter != Model3DMap.end(); ++iter) {
+            if (iter->second.PreloadedModel3D.expired() ||
+                iter->second.Requested ||
+                IsResidentModel3DAsset(iter->second)) {
+                continue;
+            }
+            if (Candidate == Model3DMap.end() || iter->second.LastUse < Candidate->second.LastUse) {
+                Candidate = iter;
+            }
+        }
+
+        if (Candidate == Model3DMap.end()) {
+            return;
+        }
+
+        vw_ReleaseModel3D(Candidate->second.Model3DFile);
+        Candidate->second.PreloadedModel3D.reset();
+        TotalMemorySize -= Candidate->second.MemorySize;
+        Candidate->second.MemorySize = 0;
+    }
+}
+
 } // astromenace namespace
 } // viewizard namespace
@@ -40,8 +40,23 @@ namespace astromenace {
 unsigned GetModel3DAssetsLoadValue();
 // Cycle with function callback on each model3d asset load.
 void ForEachModel3DAssetLoad(std::function<void (unsigned AssetValue)> function);
-// Get preloaded model3d asset (preloaded by ForEachModel3DAssetLoad() call).
+// Get preloaded model3d asset (preloaded by ForEachModel3DAssetLoad() or
+// PrefetchModel3DAssets() call). If asset was not loaded yet, load it now.
 std::weak_ptr<sModel3D> GetPreloadedModel3DAsset(unsigned FileNameHash);
+// Reset all model3d assets requests and clear prefetch queue.
+void ResetModel3DAssetsRequests();
+// Request model3d asset, asset will be loaded by PrefetchModel3DAssets() call.
+void RequestModel3DAsset(unsigned FileNameHash);
+// Request all model3d assets with file name, that starts with Prefix.
+void RequestModel3DAssetsByPrefix(const std::string &Prefix);
+// Load requested model3d assets from prefetch queue.
+// TimeLimit - time limit in milliseconds (ticks), 0 - load all requested assets.
+// Return true, if prefetch queue is empty.
+bool PrefetchModel3DAssets(uint32_t TimeLimit);
+// Evict least recently used model3d assets, until fit into MemoryBudget (in bytes).
+// Resident and requested assets are never evicted.
+// Note, caller should care, that there are no objects with evicted models.
+void EvictModel3DAssets(size_t MemoryBudget);
 
 } // astromenace namespace
 } // viewizard namespace
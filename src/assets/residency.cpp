@@ -0,0 +1,184 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+/*
+ * Only part of all model3d assets are resident (loaded on startup), all other
+ * model3d assets are requested by mission script scan. While player is in menu,
+ * requested assets are loaded in background (time-sliced on main thread, since
+ * OpenGL context is bound to main thread), before mission start all assets that
+ * mission needs are loaded and unused assets are evicted under memory budget.
+ */
+
+#include "../core/core.h"
+#include "../config/config.h"
+#include "../script/script_program.h"
+#include "../object3d/space_ship/space_ship.h"
+#include "../object3d/ground_object/ground_object.h"
+#include "../game.h"
+#include "model3d.h"
+#include "residency.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+// time limit for background prefetch per frame, in milliseconds (ticks)
+constexpr uint32_t PrefetchTimeLimit{2};
+// mission script file name, that was scanned last time
+std::string ScannedMissionFileName{};
+
+} // unnamed namespace
+
+
+/*
+ * Request big asteroid (or planetoid) model3d asset.
+ */
+static void RequestBigAsteroidModel3DAsset(const int AsteroidNum)
+{
+    // random asteroid will be created, if AsteroidNum is out of range
+    if (AsteroidNum < 1 || AsteroidNum > 5) {
+        RequestModel3DAssetsByPrefix("models/space/bigasteroid-");
+        return;
+    }
+
+    RequestModel3DAssetsByPrefix("models/space/bigasteroid-0" + std::to_string(AsteroidNum));
+}
+
+/*
+ * Request model3d asset for script object.
+ */
+static void RequestScriptObjectModel3DAsset(const sScriptObject &ScriptObject)
+{
+    const int tmpType = ScriptObject.ObjectType.Value;
+
+    switch (ScriptObject.Type) {
+    case eScriptObject::EarthFighter:
+    case eScriptObject::Asteroid:
+        // resident assets, nothing to request
+        break;
+
+    case eScriptObject::AlienFighter:
+        RequestModel3DAsset(GetAlienSpaceFighterModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::AlienMotherShip:
+        RequestModel3DAsset(GetAlienSpaceMotherShipModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::PirateShip:
+        RequestModel3DAsset(GetPirateShipModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::MilitaryBuilding:
+        RequestModel3DAsset(GetMilitaryBuildingModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::CivilianBuilding:
+        RequestModel3DAsset(GetCivilianBuildingModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::Tracked:
+        RequestModel3DAsset(GetTrackedModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::Wheeled:
+        RequestModel3DAsset(GetWheeledModel3DHash(tmpType));
+        break;
+
+    case eScriptObject::BasePart:
+        // base part could be provided as block type (random part) or as particular part id
+        if (tmpType > 0) {
+            RequestModel3DAssetsByPrefix("models/spacebase/" +
+                                         std::to_string((tmpType < 10) ? tmpType : (tmpType / 10)) + "/");
+        }
+        break;
+
+    case eScriptObject::BigAsteroid:
+    case eScriptObject::Planetoid:
+        RequestBigAsteroidModel3DAsset(tmpType);
+        break;
+
+    case eScriptObject::Planet:
+        RequestModel3DAssetsByPrefix("models/planet/");
+        break;
+    }
+}
+
+/*
+ * Request all assets, that mission needs.
+ */
+static void RequestMissionAssets(const std::string &FileName)
+{
+    if (FileName == ScannedMissionFileName) {
+        return;
+    }
+    ScannedMissionFileName = FileName;
+
+    ResetModel3DAssetsRequests();
+    if (FileName.empty()) {
+        return;
+    }
+
+    sMissionProgram Program;
+    if (!CompileMissionScript(FileName, Program)) {
+        std::cerr << __func__ << "(): " << "mission script could not be scanned: " << FileName << "\n";
+        return;
+    }
+
+    for (const auto &tmpScriptObject : Program.Objects) {
+        RequestScriptObjectModel3DAsset(tmpScriptObject);
+    }
+}
+
+/*
+ * Request and prefetch in background assets, that next mission needs (should be called each frame in menu).
+ */
+void UpdateAssetsResidency()
+{
+    RequestMissionAssets(GetCurrentMissionFileName());
+    PrefetchModel3DAssets(PrefetchTimeLimit);
+}
+
+/*
+ * Load all assets, that mission needs, and evict unused assets under configured memory budget.
+ * Note, caller should care, that all objects are released before this call.
+ */
+void PrepareMissionAssets(const std::string &FileName)
+{
+    RequestMissionAssets(FileName);
+
+    if (GameConfig().AssetsMemoryBudget > 0) {
+        EvictModel3DAssets(static_cast<size_t>(GameConfig().AssetsMemoryBudget) * 1024 * 1024);
+    }
+
+    PrefetchModel3DAssets(0);
+}
+
+} // astromenace namespace
+} // viewizard namespace
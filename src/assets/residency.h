@@ -0,0 +1,46 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#ifndef ASSETS_RESIDENCY_H
+#define ASSETS_RESIDENCY_H
+
+#include "../core/base.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+// Request and prefetch in background assets, that next mission needs (should be called each frame in menu).
+void UpdateAssetsResidency();
+// Load all assets, that mission needs, and evict unused assets under configured memory budget.
+// Note, caller should care, that all objects are released before this call.
+void PrepareMissionAssets(const std::string &FileName);
+
+} // astromenace namespace
+} // viewizard namespace
+
+#endif // ASSETS_RESIDENCY_H
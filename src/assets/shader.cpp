@@ -26,6 +26,7 @@
 *****************************************************************************/
 
 #include "../core/core.h"
+#include "../platform/platform.h"
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -58,6 +59,9 @@ bool ForEachShaderAssetLoad(std::function<void ()> function)
         return false;
     }
 
+    // linked programs are cached in config folder, so, next launch don't need to compile them
+    vw_SetShaderBinaryCachePath(GetConfigPath());
+
     for (auto &tmpAsset : ShaderArray) {
         std::weak_ptr<cGLSL> Program = vw_CreateShader(tmpAsset.Name,
                                        tmpAsset.VertexShaderFileName,
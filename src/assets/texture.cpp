@@ -37,6 +37,10 @@ namespace {
 // empirical found "everage load value" for one texture asset
 // small value mean that asset loads fast, big value - slow
 constexpr unsigned TextureLoadValue{200};
+// texture atlas page size for 2D sprites
+constexpr int AtlasPageSize{2048};
+// 2D sprites with bigger width or height will be created as separate textures
+constexpr int AtlasMaxSpriteSize{512};
 
 struct sTextureAsset {
     std::string TextureFile{};
@@ -50,6 +54,7 @@ struct sTextureAsset {
     const bool MipMap{false};
     // preload
     GLtexture PreloadedTexture{0};
+    bool InAtlas{false};
 
     sTextureAsset() = delete;
     [[gnu::noinline, clang::noinline, msvc::noinline]]
@@ -401,9 +406,47 @@ std::unordered_map<unsigned, sTextureAsset> TextureMap{
     {constexpr_hash_djb2a("skybox/2/skybox_top3.tga"),        sTextureAsset{"skybox/2/skybox_top3.tga", false, eAlphaCreateMode::GREYSC, eTextureWrapMode::CLAMP_TO_EDGE}}
 };
 
+// 2D sprites, that used for direct rendering (not by vw_Draw2D()), should not be packed into atlas.
+const std::unordered_set<unsigned> AtlasExclusion{
+    constexpr_hash_djb2a("menu/whitepoint.tga"),
+    constexpr_hash_djb2a("game/game_num.tga"),
+    constexpr_hash_djb2a("game/game_panel_el.tga")
+};
+
 } // unnamed namespace
 
 
+/*
+ * Check, should texture asset be packed into texture atlas (2D sprites only).
+ */
+static bool IsAtlasTextureAsset(unsigned FileNameHash, const sTextureAsset &Asset)
+{
+    if (Asset.TextWrap != eTextureWrapMode::CLAMP_TO_EDGE
+        || Asset.TextFilter != eTextureBasicFilter::BILINEAR
+        || Asset.NeedAnisotropy
+        || Asset.MipMap
+        || AtlasExclusion.find(FileNameHash) != AtlasExclusion.end()) {
+        return false;
+    }
+
+    return !Asset.TextureFile.compare(0, 5, "menu/")
+           || !Asset.TextureFile.compare(0, 5, "game/")
+           || !Asset.TextureFile.compare(0, 5, "lang/")
+           || !Asset.TextureFile.compare(0, 7, "script/");
+}
+
+/*
+ * Load texture asset as separate texture.
+ */
+static void LoadTextureAsset(sTextureAsset &Asset)
+{
+    vw_SetTextureProp(sTextureFilter{Asset.TextFilter},
+                      Asset.NeedAnisotropy ? GameConfig().AnisotropyLevel : 1,
+                      sTextureWrap{Asset.TextWrap}, Asset.Alpha,
+                      Asset.AlphaMode, Asset.MipMap);
+    Asset.PreloadedTexture = vw_LoadTexture(Asset.TextureFile);
+}
+
 /*
  * Get all texture assets load value.
  */
@@ -435,13 +478,26 @@ void ForEachTextureAssetLoad(std::function<void (unsigned AssetValue)> function)
 #endif // NDEBUG
 
     for (auto &tmpAsset : TextureMap) {
-        vw_SetTextureProp(sTextureFilter{tmpAsset.second.TextFilter},
-                          tmpAsset.second.NeedAnisotropy ? GameConfig().AnisotropyLevel : 1,
-                          sTextureWrap{tmpAsset.second.TextWrap}, tmpAsset.second.Alpha,
-                          tmpAsset.second.AlphaMode, tmpAsset.second.MipMap);
-        tmpAsset.second.PreloadedTexture = vw_LoadTexture(tmpAsset.second.TextureFile);
+        tmpAsset.second.PreloadedTexture = 0;
+        tmpAsset.second.InAtlas = false;
+        if (IsAtlasTextureAsset(tmpAsset.first, tmpAsset.second)) {
+            vw_SetTextureProp(sTextureFilter{tmpAsset.second.TextFilter}, 1,
+                              sTextureWrap{tmpAsset.second.TextWrap}, tmpAsset.second.Alpha,
+                              tmpAsset.second.AlphaMode, false);
+            tmpAsset.second.InAtlas = vw_AddTextureToAtlas(tmpAsset.first, tmpAsset.second.TextureFile,
+                                                           AtlasMaxSpriteSize);
+        }
+        if (!tmpAsset.second.InAtlas) {
+            LoadTextureAsset(tmpAsset.second);
+        }
         function(TextureLoadValue);
     }
+
+    // all 2D sprites in atlas have alpha channel
+    vw_SetTextureProp(sTextureFilter{eTextureBasicFilter::BILINEAR}, 1,
+                      sTextureWrap{eTextureWrapMode::CLAMP_TO_EDGE}, true,
+                      eAlphaCreateMode::EQUAL, false);
+    vw_BuildTextureAtlas(AtlasPageSize);
 }
 
 /*
@@ -470,9 +526,32 @@ GLtexture GetPreloadedTextureAsset(unsigned FileNameHash)
         return tmpAsset->second.PreloadedTexture;
     }
 
+    // sprite was packed into texture atlas, but caller need separate texture
+    // (for example, for direct rendering), load it on first request
+    if (tmpAsset != TextureMap.end() && tmpAsset->second.InAtlas) {
+        LoadTextureAsset(tmpAsset->second);
+        if (tmpAsset->second.PreloadedTexture) {
+            return tmpAsset->second.PreloadedTexture;
+        }
+    }
+
     std::cerr << __func__ << "(): " << "preloaded texture not found, hash: " << FileNameHash << "\n";
     return 0;
 }
 
+/*
+ * Get preloaded texture asset region (texture atlas page or separate texture).
+ * Should be used for all 2D sprites rendering by vw_Draw2D().
+ */
+sTextureRegion GetPreloadedTextureRegion(unsigned FileNameHash)
+{
+    sTextureRegion tmpRegion{};
+    if (vw_FindTextureAtlasRegion(FileNameHash, tmpRegion)) {
+        return tmpRegion;
+    }
+
+    return sTextureRegion{GetPreloadedTextureAsset(FileNameHash)};
+}
+
 } // astromenace namespace
 } // viewizard namespace
@@ -45,6 +45,9 @@ void ChangeTexturesAnisotropyLevel();
 // Note, we don't validate textures, caller should care about call
 // ForEachTextureAssetLoad() each time, when this need.
 GLtexture GetPreloadedTextureAsset(unsigned FileNameHash);
+// Get preloaded texture asset region (texture atlas page or separate texture).
+// Should be used for all 2D sprites rendering by vw_Draw2D().
+sTextureRegion GetPreloadedTextureRegion(unsigned FileNameHash);
 
 } // astromenace namespace
 } // viewizard namespace
@@ -0,0 +1,447 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+/*
+Headless mission replay benchmark.
+
+Run game's simulation (same InitGameSimulation() and UpdateGameSimulation() as game use)
+with fixed step virtual clock and recorded input, without window, OpenGL context and
+audio device. Subsystems time is measured by profiler's scopes of simulation step.
+Font is not initialized and HUD's warnings drawing is skipped in headless mode, OpenGL extension functions are not loaded (buffer objects are
+not created), audio related calls are skipped, since audio is not initialized.
+
+Recorded input file format, one event per line ('#' - comment):
+<step> <key> <0|1>
+where <key> is action (left, right, up, down, primary, secondary) or SDL key name.
+*/
+
+#include "../core/core.h"
+#include "../config/config.h"
+#include "../build_config.h"
+#include "../assets/model3d.h"
+#include "../assets/residency.h"
+#include "../gfx/star_system.h"
+#include "../script/script.h"
+#include "../platform/platform.h"
+#include "../object3d/object3d.h"
+#include "../object3d/space_ship/space_ship.h"
+#include "../object3d/ground_object/ground_object.h"
+#include "../object3d/projectile/projectile.h"
+#include "../object3d/space_object/space_object.h"
+#include "../game/camera.h"
+#include "../main.h"
+#include "../enum.h"
+#include "../game.h" // FIXME "game.h" should be replaced by individual headers
+#include "SDL2/SDL.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <string.h>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+struct sInputEvent {
+    unsigned Step{0};
+    int Key{0};
+    bool Down{false};
+
+    explicit sInputEvent(unsigned _Step, int _Key, bool _Down) :
+        Step{_Step},
+        Key{_Key},
+        Down{_Down}
+    {}
+};
+
+struct sSubsystemTime {
+    // profiler's scope name (string literal)
+    const char *Name{nullptr};
+    // in milliseconds
+    double Total{0.0};
+    float Max{0.0f};
+
+    explicit sSubsystemTime(const char *_Name) :
+        Name{_Name}
+    {}
+};
+
+// simulation step's top level profiler scopes, in order of first appearance
+std::vector<sSubsystemTime> SubsystemsTime{};
+
+struct sObjectsCount {
+    unsigned SpaceShips{0};
+    unsigned GroundObjects{0};
+    unsigned Projectiles{0};
+    unsigned SpaceObjects{0};
+    unsigned ParticleSystems{0};
+};
+
+} // unnamed namespace
+
+
+/*
+ * Quit from main loop.
+ * Note, benchmark don't have main loop, nothing to do here.
+ */
+void QuitFromMainLoop()
+{
+}
+
+/*
+ * Recreate game's window.
+ * Note, benchmark don't have window, nothing to do here.
+ */
+void RecreateGameWindow()
+{
+}
+
+/*
+ * Find key code by action name or SDL key name.
+ */
+static int FindKeyByName(const std::string &Name)
+{
+    if (Name == "left") {
+        return GameConfig().KeyBoardLeft;
+    } else if (Name == "right") {
+        return GameConfig().KeyBoardRight;
+    } else if (Name == "up") {
+        return GameConfig().KeyBoardUp;
+    } else if (Name == "down") {
+        return GameConfig().KeyBoardDown;
+    } else if (Name == "primary") {
+        return GameConfig().KeyBoardPrimary;
+    } else if (Name == "secondary") {
+        return GameConfig().KeyBoardSecondary;
+    }
+
+    return SDL_GetKeyFromName(Name.c_str());
+}
+
+/*
+ * Load recorded input.
+ */
+static bool LoadRecordedInput(const std::string &FileName, std::vector<sInputEvent> &InputEvents)
+{
+    std::ifstream InputFile(FileName);
+    if (!InputFile.is_open()) {
+        std::cerr << __func__ << "(): " << "Can't open recorded input file: " << FileName << "\n";
+        return false;
+    }
+
+    std::string Line;
+    unsigned LineNumber{0};
+    while (std::getline(InputFile, Line)) {
+        LineNumber++;
+        if (Line.empty() || Line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream LineStream{Line};
+        unsigned Step{0};
+        std::string KeyName{};
+        int Down{0};
+        if (!(LineStream >> Step >> KeyName >> Down)) {
+            std::cerr << __func__ << "(): " << "Wrong recorded input, line " << LineNumber << ": " << Line << "\n";
+            return false;
+        }
+
+        int Key = FindKeyByName(KeyName);
+        if (Key == SDLK_UNKNOWN) {
+            std::cerr << __func__ << "(): " << "Unknown key, line " << LineNumber << ": " << KeyName << "\n";
+            return false;
+        }
+
+        InputEvents.emplace_back(Step, Key, Down != 0);
+    }
+
+    std::stable_sort(InputEvents.begin(), InputEvents.end(),
+                     [] (const sInputEvent &A, const sInputEvent &B) {return A.Step < B.Step;});
+    return true;
+}
+
+/*
+ * Count all objects.
+ */
+static sObjectsCount CountObjects()
+{
+    sObjectsCount Count;
+    ForEachSpaceShip([&Count] (cSpaceShip &) {Count.SpaceShips++;});
+    ForEachGroundObject([&Count] (cGroundObject &) {Count.GroundObjects++;});
+    ForEachProjectile([&Count] (cProjectile &) {Count.Projectiles++;});
+    ForEachSpaceObject([&Count] (cSpaceObject &) {Count.SpaceObjects++;});
+    Count.ParticleSystems = vw_GetParticleSystemsCount();
+    return Count;
+}
+
+/*
+ * Add simulation step's profiler results to subsystems time.
+ */
+static void AddStepProfilerResults()
+{
+    for (auto &tmpScope : vw_ProfilerGetFrameResults()) {
+        // nested scopes time already included into parent scope
+        if (tmpScope.Depth) {
+            continue;
+        }
+
+        auto Subsystem = std::find_if(SubsystemsTime.begin(), SubsystemsTime.end(),
+                                      [&tmpScope] (const sSubsystemTime &Time) {return !strcmp(Time.Name, tmpScope.Name);});
+        if (Subsystem == SubsystemsTime.end()) {
+            SubsystemsTime.emplace_back(tmpScope.Name);
+            Subsystem = SubsystemsTime.end() - 1;
+        }
+
+        Subsystem->Total += tmpScope.CPUTime;
+        Subsystem->Max = std::max(Subsystem->Max, tmpScope.CPUTime);
+    }
+}
+
+/*
+ * Initialize mission, same way as InitGame() do, but without any rendering related code.
+ */
+static bool InitMission(int Mission)
+{
+    // don't use player's config and profiles, benchmark should be reproducible
+    CurrentProfile = 0;
+    ChangeGameConfig().Profile[CurrentProfile] = sPilotProfile{};
+    ChangeGameConfig().Profile[CurrentProfile].Used = true;
+    ChangeGameConfig().MouseControl = false;
+
+    MissionListInit();
+    if (Mission < 1 || Mission > AllMission) {
+        std::cerr << __func__ << "(): " << "Wrong mission number: " << Mission << "\n";
+        return false;
+    }
+    CurrentMission = Mission - 1;
+
+    vw_InitTimeThread(0);
+    vw_InitTimeThread(1);
+    vw_SetTimeThreadSpeed(1, GameConfig().GameSpeed);
+
+    // load all mission's assets before script run, so, benchmark frames are not affected
+    PrepareMissionAssets(GetCurrentMissionFileName());
+
+    if (!InitGameSimulation()) {
+        std::cerr << __func__ << "(): " << "Can't run mission script: " << GetCurrentMissionFileName() << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Run simulation with fixed step virtual clock and recorded input.
+ */
+static void RunSimulation(unsigned Steps, unsigned StepTicks, const std::vector<sInputEvent> &InputEvents)
+{
+    sObjectsCount PeakCount;
+    uint64_t HeapAllocations{0};
+    unsigned MaxHeapAllocations{0};
+    auto NextInputEvent = InputEvents.cbegin();
+
+    for (unsigned Step = 0; Step < Steps; Step++) {
+        for (; NextInputEvent != InputEvents.cend() && NextInputEvent->Step <= Step; ++NextInputEvent) {
+            vw_KeyStatusUpdate(NextInputEvent->Key, NextInputEvent->Down);
+        }
+
+        vw_AdvanceVirtualTicks(static_cast<uint64_t>(StepTicks) * 1000);
+        vw_UpdateTimeThreads();
+
+        vw_ProfilerBeginFrame();
+        UpdateGameSimulation(vw_GetTimeThread(1));
+        vw_ProfilerEndFrame(true);
+        // close step's heap allocations counting
+        vw_ResetFrameArena();
+        HeapAllocations += vw_GetFrameHeapAllocations();
+        MaxHeapAllocations = std::max(MaxHeapAllocations, vw_GetFrameHeapAllocations());
+        AddStepProfilerResults();
+
+        sObjectsCount Count = CountObjects();
+        PeakCount.SpaceShips = std::max(PeakCount.SpaceShips, Count.SpaceShips);
+        PeakCount.GroundObjects = std::max(PeakCount.GroundObjects, Count.GroundObjects);
+        PeakCount.Projectiles = std::max(PeakCount.Projectiles, Count.Projectiles);
+        PeakCount.SpaceObjects = std::max(PeakCount.SpaceObjects, Count.SpaceObjects);
+        PeakCount.ParticleSystems = std::max(PeakCount.ParticleSystems, Count.ParticleSystems);
+    }
+
+    // report
+    double TotalTime{0.0};
+    std::cout << "\nSubsystem                       total ms      avg ms      max ms\n";
+    std::cout << std::fixed << std::setprecision(3);
+    for (auto &tmpSubsystem : SubsystemsTime) {
+        TotalTime += tmpSubsystem.Total;
+        std::cout << std::left << std::setw(28) << tmpSubsystem.Name << std::right
+                  << std::setw(12) << tmpSubsystem.Total
+                  << std::setw(12) << (Steps ? tmpSubsystem.Total / Steps : 0.0)
+                  << std::setw(12) << tmpSubsystem.Max << "\n";
+    }
+    std::cout << std::left << std::setw(28) << "Total" << std::right
+              << std::setw(12) << TotalTime
+              << std::setw(12) << (Steps ? TotalTime / Steps : 0.0) << "\n";
+    std::cout << std::left << std::setw(28) << "Heap allocations" << std::right
+              << std::setw(12) << HeapAllocations
+              << std::setw(12) << (Steps ? static_cast<double>(HeapAllocations) / Steps : 0.0)
+              << std::setw(12) << MaxHeapAllocations << "\n";
+
+    sObjectsCount FinalCount = CountObjects();
+    std::cout << "\nObjects                            final        peak\n";
+    std::cout << std::left << std::setw(28) << "Space ships" << std::right
+              << std::setw(12) << FinalCount.SpaceShips << std::setw(12) << PeakCount.SpaceShips << "\n";
+    std::cout << std::left << std::setw(28) << "Ground objects" << std::right
+              << std::setw(12) << FinalCount.GroundObjects << std::setw(12) << PeakCount.GroundObjects << "\n";
+    std::cout << std::left << std::setw(28) << "Projectiles" << std::right
+              << std::setw(12) << FinalCount.Projectiles << std::setw(12) << PeakCount.Projectiles << "\n";
+    std::cout << std::left << std::setw(28) << "Space objects" << std::right
+              << std::setw(12) << FinalCount.SpaceObjects << std::setw(12) << PeakCount.SpaceObjects << "\n";
+    std::cout << std::left << std::setw(28) << "Particle systems" << std::right
+              << std::setw(12) << FinalCount.ParticleSystems << std::setw(12) << PeakCount.ParticleSystems << "\n";
+    std::cout << "\nMission script " << (isMissionScriptRunning() ? "still running" : "finished") << ", player ship "
+              << (PlayerFighter.expired() ? "destroyed" : "alive") << ".\n";
+}
+
+} // astromenace namespace
+} // viewizard namespace
+
+/*
+ * Main.
+ */
+int main(int argc, char *argv[])
+{
+    using namespace viewizard;
+    using namespace viewizard::astromenace;
+
+    int Mission{1};
+    unsigned Steps{3600};
+    unsigned StepTicks{16};
+    unsigned Seed{0};
+    std::string InputFileName{};
+
+    // don't use getopt_long() here, since it could be not available (MSVC)
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--help")) {
+            std::cout << "AstroMenace headless benchmark launch options:\n\n"
+                      << "--dir=/folder - folder with gamedata.vfs file;\n"
+                      << "--mission=1 - mission number;\n"
+                      << "--steps=3600 - simulation steps;\n"
+                      << "--step-ms=16 - simulation step in milliseconds;\n"
+                      << "--seed=0 - random number generator seed;\n"
+                      << "--input=/folder/file.txt - recorded input (\"<step> <key> <0|1>\" per line);\n"
+                      << "--help - info about all benchmark launch options.\n";
+            return 0;
+        }
+
+        if (!strncmp(argv[i], "--dir", strlen("--dir"))) {
+            SetDataPathByParameter(argv[i], "--dir=");
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--mission=", strlen("--mission="))) {
+            Mission = atoi(argv[i] + strlen("--mission="));
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--steps=", strlen("--steps="))) {
+            Steps = static_cast<unsigned>(atoi(argv[i] + strlen("--steps=")));
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--step-ms=", strlen("--step-ms="))) {
+            StepTicks = static_cast<unsigned>(atoi(argv[i] + strlen("--step-ms=")));
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--seed=", strlen("--seed="))) {
+            Seed = static_cast<unsigned>(atoi(argv[i] + strlen("--seed=")));
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--input=", strlen("--input="))) {
+            InputFileName = argv[i] + strlen("--input=");
+        }
+    }
+
+    std::cout << "AstroMenace " << GAME_VERSION << " headless benchmark\n\n";
+
+    std::vector<sInputEvent> InputEvents{};
+    if (!InputFileName.empty() && !LoadRecordedInput(InputFileName, InputEvents)) {
+        return 1;
+    }
+
+    // no video and audio subsystems, we need timer only
+    if (SDL_Init(SDL_INIT_TIMER) != 0) {
+        std::cerr << __func__ << "(): " << "Couldn't init SDL: " << SDL_GetError() << "\n";
+        return 1;
+    }
+
+    if (vw_OpenVFS(GetDataPath() + "gamedata.vfs", GAME_VFS_BUILD) != 0) {
+        std::cerr << __func__ << "(): " << "gamedata.vfs file not found or corrupted.\n";
+        SDL_Quit();
+        return 1;
+    }
+
+    if (vw_InitText("lang/text.csv", ';', '\n') != 0) {
+        std::cout << "lang/text.csv file not found or corrupted.\n";
+    }
+    vw_SetTextLanguage(GameConfig().MenuLanguage);
+
+    // no OpenGL context, skip HUD's warnings and font related drawing
+    GameHeadlessMode = true;
+
+    vw_UseVirtualTicks(true);
+    // subsystems time measured by profiler's scopes in UpdateGameSimulation()
+    vw_ProfilerEnable(true);
+    vw_SeedRand(Seed);
+
+    // models only, textures and shaders need OpenGL context
+    ForEachModel3DAssetLoad([] (unsigned) {});
+    // VisualEffectsQuality is inverted (0 - all effects, 2 - minimum effects)
+    vw_InitParticleSystems(false, GameConfig().VisualEffectsQuality + 1.0f);
+
+    int Status{0};
+    if (InitMission(Mission)) {
+        std::cout << "Mission " << Mission << ", " << Steps << " steps, "
+                  << StepTicks << " ms per step, " << InputEvents.size() << " input events.\n";
+        RunSimulation(Steps, StepTicks, InputEvents);
+    } else {
+        Status = 1;
+    }
+
+    ReleaseMissionScript();
+    ReleaseAllObject3D();
+    StarSystemRelease();
+    vw_ReleaseAllParticleSystems();
+    vw_ReleaseAllModel3D();
+
+    vw_ReleaseText();
+    vw_ShutdownVFS();
+    vw_ReleaseAllTimeThread();
+    SDL_Quit();
+    return Status;
+}
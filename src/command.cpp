@@ -30,6 +30,7 @@
 #include "object3d/object3d.h"
 #include "gfx/star_system.h"
 #include "assets/audio.h"
+#include "assets/residency.h"
 #include "game.h" // FIXME "game.h" should be replaced by individual headers
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
@@ -108,6 +109,7 @@ void cCommand::Proceed()
 
     case eCommand::SWITCH_FROM_MENU_TO_GAME: // also used for mission restart
         PrepareToSwitchStatus();
+        PrepareMissionAssets(GetCurrentMissionFileName());
         InitGame();
         PlayMusicTheme(eMusicTheme::GAME, 2000, 2000);
         PlayVoicePhrase(eVoicePhrase::PrepareForAction, 1.0f);
@@ -36,8 +36,16 @@
 #include "config.h"
 #include "../game.h" // FIXME "game.h" should be replaced by individual headers
 #include "SDL2/SDL.h"
+#include <array>
+#include <cstdio>
+#include <cstddef>
 #include <fstream>
+#include <iterator>
 #include <string.h>
+#include <type_traits>
+#ifdef WIN32
+#include <codecvt>
+#endif // WIN32
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -48,9 +56,53 @@ namespace {
 sGameConfig Config;
 
 const std::string ConfigFileName{"config.xml"};
+// previous pilot profiles storage format, used for import only
 const std::string ProfilesFileName{std::string{"PilotProfiles_"} +
                                    std::string{CONFIG_VERSION} +
                                    std::string{".data"}};
+const std::string BinaryFileName{std::string{"Config_"} +
+                                 std::string{CONFIG_VERSION} +
+                                 std::string{".bin"}};
+
+// binary configuration file signature ('AMCF') and format version
+constexpr uint32_t BinaryMagic{0x46434d41};
+constexpr uint32_t BinaryVersion{1};
+// section 0 - game configuration (without pilot profiles), next sections - pilot profiles
+constexpr unsigned SectionsCount{1 + config::MAX_PROFILES};
+
+struct sBinaryHeader {
+    uint32_t Magic{BinaryMagic};
+    uint32_t Version{BinaryVersion};
+    uint32_t Sections{SectionsCount};
+    uint32_t XMLFileHash{0}; // exported XML configuration file hash, in order to detect manual changes
+};
+
+struct sSectionHeader {
+    uint32_t Size{0};
+    uint32_t Checksum{0};
+};
+
+// encoded sections (header and data), only changed sections are re-encoded on save
+std::array<std::vector<uint8_t>, SectionsCount> EncodedSections{};
+// XML configuration file should be exported on next save, even if game configuration was not changed
+bool NeedXMLExport{false};
+
+struct sSaveJob {
+    std::string BinaryFile{};
+    std::vector<uint8_t> Sections{};
+    // optional, XML configuration file export
+    std::string XMLFile{};
+    std::unique_ptr<cXMLDocument> XMLdoc{};
+};
+
+SDL_Thread *SaveThread{nullptr};
+SDL_mutex *SaveMutex{nullptr};
+SDL_cond *SaveCondition{nullptr};
+// only last queued job is written, previous not written job is replaced
+std::unique_ptr<sSaveJob> PendingSaveJob{};
+bool SaveQuit{false};
+// last exported XML configuration file hash, used by saving thread only after load
+uint32_t XMLFileHash{0};
 
 } // unnamed namespace
 
@@ -134,68 +186,257 @@ void ConfigVirtualInternalResolution()
 }
 
 /*
- * Pack data with XOR.
- * Since we store data in plain text, all data should be 'converted' into proper symbols.
- * In our case, we start from 97 (small 'a', see ASCII table) and store separately
- * tens (0-25, since unsigned char max is 255) and ones (0-9). So, as result we will
- * see string with small letters only.
+ * Calculate checksum (FNV-1a).
  */
-static void PackWithXOR(std::string &DataXOR, int DataSize, const unsigned char *Data)
+static uint32_t CalculateChecksum(const uint8_t *Data, size_t Size)
 {
-    // should be stored: XOR key, 'ten', 'one', and null-terminated symbol at the end of string
-    DataXOR.resize(DataSize * 3 + 1);
-    for (int i = 0; i < DataSize; i++) {
-        int tmpOffset = DataSize + i * 2;
-        // XOR key, randomize for each character
-        DataXOR[i] = static_cast<char>(97 + vw_uRandNum(25));
-        // XOR
-        unsigned char tmpDataXOR = Data[i] ^ static_cast<unsigned char>(DataXOR[i]);
-        // store 'ten'
-        DataXOR[tmpOffset] = static_cast<char>(97 + tmpDataXOR / 10.0f);
-        // store 'one'
-        DataXOR[tmpOffset + 1] = static_cast<char>(97 + (tmpDataXOR - (DataXOR[tmpOffset] - 97) * 10));
-    }
-    // we should return null-terminated string
-    DataXOR[DataSize * 3] = '\0';
+    uint32_t Hash{2166136261u};
+    for (size_t i = 0; i < Size; i++) {
+        Hash ^= Data[i];
+        Hash *= 16777619u;
+    }
+    return Hash;
 }
 
 /*
- * Save Pilot Profiles.
+ * Calculate file checksum, return false if file can't be opened.
  */
-static void SavePilotProfiles()
+static bool CalculateFileChecksum(const std::string &FileName, uint32_t &Checksum)
 {
-    std::string ProfileXOR{};
-    PackWithXOR(ProfileXOR, sizeof(sPilotProfile) * 5, reinterpret_cast<unsigned char *>(Config.Profile));
-
-    std::string FileName{GetConfigPath() + ProfilesFileName};
-    std::ofstream File(FileName);
+    std::ifstream File(FileName, std::ios::binary);
     if (File.fail()) {
-        std::cerr << __func__ << "(): " << "Can't create file " << FileName << "\n";
+        return false;
+    }
+
+    std::vector<uint8_t> Data{std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>()};
+    Checksum = CalculateChecksum(Data.data(), Data.size());
+    return true;
+}
+
+/*
+ * Replace file by temporary file (atomic on POSIX systems).
+ */
+static bool ReplaceWithTmpFile(const std::string &TmpFileName, const std::string &FileName)
+{
+#ifdef WIN32
+    // rename() can't replace existing file on Windows, MoveFileExW() replace it atomically
+    std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter_wchar;
+    if (!MoveFileExW(converter_wchar.from_bytes(TmpFileName).c_str(),
+                     converter_wchar.from_bytes(FileName).c_str(),
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+#else
+    if (std::rename(TmpFileName.c_str(), FileName.c_str()) != 0) {
+#endif // WIN32
+        std::cerr << __func__ << "(): " << "Can't replace file " << FileName << "\n";
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Write binary configuration file.
+ */
+static void WriteBinaryFile(const std::string &FileName, uint32_t ExportedXMLFileHash,
+                            const std::vector<uint8_t> &Sections)
+{
+    sBinaryHeader Header;
+    Header.XMLFileHash = ExportedXMLFileHash;
+
+    std::string TmpFileName{FileName + ".tmp"};
+    {
+        std::ofstream File(TmpFileName, std::ios::binary);
+        if (File.fail()) {
+            std::cerr << __func__ << "(): " << "Can't create file " << TmpFileName << "\n";
+            return;
+        }
+
+        File.write(reinterpret_cast<const char *>(&Header), sizeof(Header));
+        File.write(reinterpret_cast<const char *>(Sections.data()), Sections.size());
+        if (File.fail()) {
+            std::cerr << __func__ << "(): " << "Can't write file " << TmpFileName << "\n";
+            return;
+        }
+    }
+
+    ReplaceWithTmpFile(TmpFileName, FileName);
+}
+
+/*
+ * Write save job's files, XML configuration file first, since we need its hash.
+ */
+static void WriteSaveJob(sSaveJob &Job)
+{
+    if (Job.XMLdoc) {
+        std::string TmpFileName{Job.XMLFile + ".tmp"};
+        if (Job.XMLdoc->Save(TmpFileName) && ReplaceWithTmpFile(TmpFileName, Job.XMLFile)) {
+            CalculateFileChecksum(Job.XMLFile, XMLFileHash);
+        }
+    }
+
+    WriteBinaryFile(Job.BinaryFile, XMLFileHash, Job.Sections);
+}
+
+/*
+ * Saving thread, write queued job until quit requested and no job pending.
+ */
+static int SaveWorker(void */*Data*/)
+{
+    SDL_LockMutex(SaveMutex);
+    for (;;) {
+        while (!PendingSaveJob && !SaveQuit) {
+            SDL_CondWait(SaveCondition, SaveMutex);
+        }
+        if (!PendingSaveJob) {
+            break;
+        }
+
+        std::unique_ptr<sSaveJob> tmpJob{std::move(PendingSaveJob)};
+
+        SDL_UnlockMutex(SaveMutex);
+        WriteSaveJob(*tmpJob);
+        SDL_LockMutex(SaveMutex);
+    }
+    SDL_UnlockMutex(SaveMutex);
+
+    return 0;
+}
+
+/*
+ * Start saving thread, if not started yet.
+ */
+static bool StartSaveThread()
+{
+    if (SaveThread) {
+        return true;
+    }
+
+    SaveMutex = SDL_CreateMutex();
+    SaveCondition = SDL_CreateCond();
+    if (SaveMutex && SaveCondition) {
+        SaveQuit = false;
+        SaveThread = SDL_CreateThread(SaveWorker, "ConfigSave", nullptr);
+    }
+
+    if (!SaveThread) {
+        std::cerr << __func__ << "(): " << "Can't create config saving thread: " << SDL_GetError() << "\n";
+        if (SaveCondition) {
+            SDL_DestroyCond(SaveCondition);
+            SaveCondition = nullptr;
+        }
+        if (SaveMutex) {
+            SDL_DestroyMutex(SaveMutex);
+            SaveMutex = nullptr;
+        }
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Wait for background configuration files saving, should be called before exit.
+ */
+void FlushConfigFiles()
+{
+    if (!SaveThread) {
         return;
     }
 
-    File << ProfileXOR;
+    SDL_LockMutex(SaveMutex);
+    SaveQuit = true;
+    SDL_CondSignal(SaveCondition);
+    SDL_UnlockMutex(SaveMutex);
+
+    SDL_WaitThread(SaveThread, nullptr);
+    SaveThread = nullptr;
+
+    SDL_DestroyCond(SaveCondition);
+    SaveCondition = nullptr;
+    SDL_DestroyMutex(SaveMutex);
+    SaveMutex = nullptr;
 }
 
 /*
- * Save configuration file.
+ * Pass job to saving thread (or write it directly, if saving thread not available).
  */
-void SaveXMLConfigFile()
+static void QueueSaveJob(std::unique_ptr<sSaveJob> &&Job)
 {
-    if (GetConfigPath().empty()) {
-        std::cerr << __func__ << "(): config path not set.\n";
+    if (!StartSaveThread()) {
+        WriteSaveJob(*Job);
         return;
     }
 
-    SavePilotProfiles();
+    SDL_LockMutex(SaveMutex);
+    // previous job was not written yet, keep its XML export
+    if (PendingSaveJob && PendingSaveJob->XMLdoc && !Job->XMLdoc) {
+        Job->XMLFile = PendingSaveJob->XMLFile;
+        Job->XMLdoc = std::move(PendingSaveJob->XMLdoc);
+    }
+    PendingSaveJob = std::move(Job);
+    SDL_CondSignal(SaveCondition);
+    SDL_UnlockMutex(SaveMutex);
+}
+
+/*
+ * Encode section, if section data was changed since last encode.
+ * Return true, if section was re-encoded.
+ */
+static bool EncodeSection(unsigned Num, const uint8_t *Data, uint32_t Size)
+{
+    std::vector<uint8_t> &Encoded = EncodedSections[Num];
+    if ((Encoded.size() == sizeof(sSectionHeader) + Size) &&
+        !memcmp(Encoded.data() + sizeof(sSectionHeader), Data, Size)) {
+        return false;
+    }
+
+    sSectionHeader Header;
+    Header.Size = Size;
+    Header.Checksum = CalculateChecksum(Data, Size);
+
+    Encoded.resize(sizeof(sSectionHeader) + Size);
+    memcpy(Encoded.data(), &Header, sizeof(sSectionHeader));
+    memcpy(Encoded.data() + sizeof(sSectionHeader), Data, Size);
+    return true;
+}
+
+// configuration and pilot profiles are copied to/from binary file with memcpy()
+static_assert(std::is_trivially_copyable<sGameConfig>::value, "sGameConfig should be trivially copyable.");
+static_assert(std::is_trivially_copyable<sPilotProfile>::value, "sPilotProfile should be trivially copyable.");
 
+/*
+ * Encode changed sections, return true if game configuration section was changed.
+ */
+static bool EncodeSections(bool &AnySectionChanged)
+{
+    std::vector<uint8_t> tmpConfigData(sizeof(sGameConfig));
+    memcpy(tmpConfigData.data(), &Config, sizeof(sGameConfig));
+    // pilot profiles are stored in own sections
+    memset(tmpConfigData.data() + offsetof(sGameConfig, Profile), 0, sizeof(Config.Profile));
+
+    bool ConfigChanged = EncodeSection(0, tmpConfigData.data(), sizeof(sGameConfig));
+    AnySectionChanged = ConfigChanged;
+
+    for (int i = 0; i < config::MAX_PROFILES; i++) {
+        if (EncodeSection(1 + i, reinterpret_cast<const uint8_t *>(&Config.Profile[i]), sizeof(sPilotProfile))) {
+            AnySectionChanged = true;
+        }
+    }
+
+    return ConfigChanged;
+}
+
+/*
+ * Create XML configuration file document.
+ */
+static std::unique_ptr<cXMLDocument> CreateXMLConfig()
+{
     std::unique_ptr<cXMLDocument> XMLdoc{new cXMLDocument};
 
     sXMLEntry *RootXMLEntry = XMLdoc->CreateRootEntry("AstroMenaceSettings");
 
     if (!RootXMLEntry) {
         std::cerr << __func__ << "(): " << "Can't create XML root element.\n";
-        return;
+        return std::unique_ptr<cXMLDocument>{};
     }
 
     XMLdoc->AddComment(*RootXMLEntry, " AstroMenace game Settings ");
@@ -226,9 +467,12 @@ void SaveXMLConfigFile()
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "VSync"), "value", Config.VSync);
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "Brightness"), "value", Config.Brightness);
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "ShowFPS"), "value", Config.ShowFPS);
+    XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "ShowProfiler"), "value", Config.ShowProfiler);
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "WeaponPanelView"),
                               "value", static_cast<int>(Config.WeaponPanelView));
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "GameSpeed"), "value", Config.GameSpeed);
+    XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "SimulationRate"), "value", Config.SimulationRate);
+    XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "AssetsMemoryBudget"), "value", Config.AssetsMemoryBudget);
 
     XMLdoc->AddComment(*RootXMLEntry, " Control settings ");
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "KeyBoardLeft"), "value",
@@ -261,7 +505,41 @@ void SaveXMLConfigFile()
                                   Config.NeedShowHint[i]);
     }
 
-    XMLdoc->Save(GetConfigPath() + ConfigFileName);
+    return XMLdoc;
+}
+
+/*
+ * Save configuration file.
+ * Binary configuration file with pilot profiles is written in background thread,
+ * only changed sections are re-encoded. XML configuration file is exported only
+ * if game configuration was changed.
+ */
+void SaveXMLConfigFile()
+{
+    if (GetConfigPath().empty()) {
+        std::cerr << __func__ << "(): config path not set.\n";
+        return;
+    }
+
+    bool AnySectionChanged{false};
+    bool ConfigChanged = EncodeSections(AnySectionChanged);
+    if (!AnySectionChanged && !NeedXMLExport) {
+        return;
+    }
+
+    std::unique_ptr<sSaveJob> Job{new sSaveJob};
+    Job->BinaryFile = GetConfigPath() + BinaryFileName;
+    for (const auto &tmpSection : EncodedSections) {
+        Job->Sections.insert(Job->Sections.end(), tmpSection.begin(), tmpSection.end());
+    }
+
+    if (ConfigChanged || NeedXMLExport) {
+        Job->XMLFile = GetConfigPath() + ConfigFileName;
+        Job->XMLdoc = CreateXMLConfig();
+        NeedXMLExport = false;
+    }
+
+    QueueSaveJob(std::move(Job));
 }
 
 /*
@@ -339,7 +617,63 @@ static void SetupCurrentProfileAndMission()
 }
 
 /*
- * Load Pilot Profiles.
+ * Load binary configuration file, return false if file not found or corrupted.
+ * If NeedResetConfig, only pilot profiles are loaded.
+ */
+static bool LoadBinaryConfigFile(bool NeedResetConfig, uint32_t &ExportedXMLFileHash)
+{
+    std::string FileName{GetConfigPath() + BinaryFileName};
+    std::ifstream File(FileName, std::ios::binary);
+    if (File.fail()) {
+        return false;
+    }
+
+    sBinaryHeader Header;
+    File.read(reinterpret_cast<char *>(&Header), sizeof(Header));
+    if (File.fail() ||
+        Header.Magic != BinaryMagic ||
+        Header.Version != BinaryVersion ||
+        Header.Sections != SectionsCount) {
+        std::cerr << __func__ << "(): " << "Binary configuration file corrupted: " << FileName << "\n";
+        return false;
+    }
+
+    std::array<std::vector<uint8_t>, SectionsCount> tmpSections{};
+    for (unsigned i = 0; i < SectionsCount; i++) {
+        sSectionHeader SectionHeader;
+        File.read(reinterpret_cast<char *>(&SectionHeader), sizeof(SectionHeader));
+        // section size also protect us from structures layout changes
+        uint32_t ExpectedSize = (i == 0) ? sizeof(sGameConfig) : sizeof(sPilotProfile);
+        if (File.fail() || SectionHeader.Size != ExpectedSize) {
+            std::cerr << __func__ << "(): " << "Binary configuration file corrupted: " << FileName << "\n";
+            return false;
+        }
+
+        tmpSections[i].resize(sizeof(sSectionHeader) + SectionHeader.Size);
+        memcpy(tmpSections[i].data(), &SectionHeader, sizeof(sSectionHeader));
+        uint8_t *tmpData = tmpSections[i].data() + sizeof(sSectionHeader);
+        File.read(reinterpret_cast<char *>(tmpData), SectionHeader.Size);
+        if (File.fail() || CalculateChecksum(tmpData, SectionHeader.Size) != SectionHeader.Checksum) {
+            std::cerr << __func__ << "(): " << "Binary configuration file corrupted: " << FileName << "\n";
+            return false;
+        }
+    }
+
+    if (!NeedResetConfig) {
+        memcpy(&Config, tmpSections[0].data() + sizeof(sSectionHeader), sizeof(sGameConfig));
+    }
+    for (int i = 0; i < config::MAX_PROFILES; i++) {
+        memcpy(&Config.Profile[i], tmpSections[1 + i].data() + sizeof(sSectionHeader), sizeof(sPilotProfile));
+    }
+
+    // loaded sections are not changed, so, should not be re-encoded on next save
+    EncodedSections = std::move(tmpSections);
+    ExportedXMLFileHash = Header.XMLFileHash;
+    return true;
+}
+
+/*
+ * Load Pilot Profiles (previous storage format, import only).
  */
 static void LoadPilotProfiles()
 {
@@ -365,12 +699,32 @@ bool LoadXMLConfigFile(bool NeedResetConfig)
         return false;
     }
 
-    LoadPilotProfiles();
+    uint32_t ExportedXMLFileHash{0};
+    bool BinaryLoaded = LoadBinaryConfigFile(NeedResetConfig, ExportedXMLFileHash);
+    if (!BinaryLoaded) {
+        LoadPilotProfiles();
+    }
 
     // NeedResetConfig, only pilot profiles should be loaded
     if (NeedResetConfig)
         return false;
 
+    if (BinaryLoaded) {
+        XMLFileHash = ExportedXMLFileHash;
+        uint32_t tmpXMLFileHash{0};
+        bool XMLFileFound = CalculateFileChecksum(GetConfigPath() + ConfigFileName, tmpXMLFileHash);
+        // XML configuration file could be removed or changed manually, re-export it on next save
+        if (!XMLFileFound || tmpXMLFileHash != ExportedXMLFileHash) {
+            NeedXMLExport = true;
+        }
+        // import XML configuration file only if it was changed manually
+        if (!XMLFileFound || tmpXMLFileHash == ExportedXMLFileHash) {
+            CheckConfig();
+            SetupCurrentProfileAndMission();
+            return false;
+        }
+    }
+
     std::unique_ptr<cXMLDocument> XMLdoc{new cXMLDocument(GetConfigPath() + ConfigFileName)};
 
     if (!XMLdoc->GetRootEntry()) {
@@ -481,6 +835,10 @@ bool LoadXMLConfigFile(bool NeedResetConfig)
         XMLdoc->bGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "ShowFPS"), "value",
                                    Config.ShowFPS);
     }
+    if (XMLdoc->FindEntryByName(*RootXMLEntry, "ShowProfiler")) {
+        XMLdoc->bGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "ShowProfiler"), "value",
+                                   Config.ShowProfiler);
+    }
     if (XMLdoc->FindEntryByName(*RootXMLEntry, "WeaponPanelView")) {
         int tmpWeaponPanelView{static_cast<int>(eWeaponPanelView::full)};
         XMLdoc->iGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "WeaponPanelView"), "value",
@@ -495,6 +853,23 @@ bool LoadXMLConfigFile(bool NeedResetConfig)
         XMLdoc->fGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "GameSpeed"), "value",
                                    Config.GameSpeed);
     }
+    if (XMLdoc->FindEntryByName(*RootXMLEntry, "SimulationRate")) {
+        XMLdoc->iGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "SimulationRate"), "value",
+                                   Config.SimulationRate);
+        // NOTE in future, use std::clamp (since C++17)
+        if (Config.SimulationRate < 20) {
+            Config.SimulationRate = 20;
+        } else if (Config.SimulationRate > 240) {
+            Config.SimulationRate = 240;
+        }
+    }
+    if (XMLdoc->FindEntryByName(*RootXMLEntry, "AssetsMemoryBudget")) {
+        XMLdoc->iGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "AssetsMemoryBudget"), "value",
+                                   Config.AssetsMemoryBudget);
+        if (Config.AssetsMemoryBudget < 0) {
+            Config.AssetsMemoryBudget = 0;
+        }
+    }
 
     if (XMLdoc->FindEntryByName(*RootXMLEntry, "KeyBoardLeft")) {
         std::string tmpKeyBoardLeft{};
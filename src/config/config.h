@@ -130,6 +130,8 @@ struct sPilotProfile {
     sPilotProfile();
 };
 
+// This structure should be POD as well, since we store it into binary config
+// file as memory block. Don't use std::string or any containers here.
 struct sGameConfig {
     unsigned int MenuLanguage{0}; // en
     unsigned int VoiceLanguage{0}; // en
@@ -179,7 +181,10 @@ struct sGameConfig {
     int JoystickDeadZone{2};
 
     float GameSpeed{1.5f};
+    int SimulationRate{60}; // game's simulation fixed steps per second of game time [20, 240]
+    int AssetsMemoryBudget{0}; // memory budget for non-resident 3D models in MB, 0 - unlimited
     bool ShowFPS{false};
+    bool ShowProfiler{false};
     eWeaponPanelView WeaponPanelView{eWeaponPanelView::full};
 
     sPilotProfile Profile[config::MAX_PROFILES];
@@ -205,6 +210,8 @@ void ConfigVirtualInternalResolution();
 bool LoadXMLConfigFile(bool NeedResetConfig);
 // Save configuration file.
 void SaveXMLConfigFile();
+// Wait for background configuration files saving, should be called before exit.
+void FlushConfigFiles();
 
 // Game's difficulty in %, calculated by profile settings (result is cached).
 // For more speed, we don't check ProfileNumber for [0, config::MAX_PROFILES) range.
@@ -38,6 +38,7 @@ another side, in this way we can reuse already created stream buffers.
 */
 
 #include "buffer.h"
+#include "../memory/memory.h"
 
 namespace viewizard {
 
@@ -104,7 +105,8 @@ static bool ReadOggBlock(ALuint BufID, int Size, OggVorbis_File &mVF, ALsizei Fr
         return false;
     }
 
-    std::vector<char> PCM(Size);
+    cFrameArenaScope FrameArenaScope{};
+    tFrameVector<char> PCM(Size);
     int TotalRet{0};
     long ret{0};
     // read loop
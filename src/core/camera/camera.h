@@ -34,6 +34,16 @@ namespace viewizard {
 
 struct sVECTOR3D;
 
+// Frustum planes (A, B, C, D for each side), in case we need frustum, that is not camera related.
+struct sFrustum {
+    float Planes[6][4]{{0, 0, 0, 0},
+                       {0, 0, 0, 0},
+                       {0, 0, 0, 0},
+                       {0, 0, 0, 0},
+                       {0, 0, 0, 0},
+                       {0, 0, 0, 0}};
+};
+
 /* Camera related function. */
 
 // Set camera location.
@@ -63,6 +73,10 @@ void vw_CalculateFrustum();
 bool vw_SphereInFrustum(const sVECTOR3D &Point, float Radius);
 // This checks if a box is in the frustum.
 bool vw_BoxInFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint);
+// Calculate custom frustum by current projection and modelview matrices (camera's frustum not changed).
+void vw_CalculateFrustum(sFrustum &CustomFrustum);
+// This checks if a box is in the custom frustum.
+bool vw_BoxInFrustum(const sFrustum &CustomFrustum, const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint);
 
 } // viewizard namespace
 
@@ -27,17 +27,13 @@
 
 #include "../graphics/graphics.h"
 #include "../math/math.h"
+#include "camera.h"
 
 namespace viewizard {
 
 namespace {
 
-float Frustum[6][4]{{0, 0, 0, 0},
-                    {0, 0, 0, 0},
-                    {0, 0, 0, 0},
-                    {0, 0, 0, 0},
-                    {0, 0, 0, 0},
-                    {0, 0, 0, 0}};
+sFrustum CameraFrustum{};
 
 enum ePlaneData {
     A = 0,  // The X value of the plane's normal.
@@ -61,7 +57,7 @@ enum eSide {
 /*
  * This normalizes a plane (A side) from a given frustum.
  */
-static void NormalizePlane(int Side)
+static void NormalizePlane(float (&Frustum)[6][4], int Side)
 {
     // Here we calculate the magnitude of the normal to the plane (point A B C)
     // Remember that (A, B, C) is that same thing as the normal's (X, Y, Z).
@@ -79,9 +75,9 @@ static void NormalizePlane(int Side)
 }
 
 /*
- * Call this every time the camera moves to update the frustum
+ * Calculate frustum planes by current projection and modelview matrices.
  */
-void vw_CalculateFrustum()
+static void CalculateFrustum(float (&Frustum)[6][4])
 {
     float proj[16]; // This will hold our projection matrix.
     float modl[16]; // This will hold our modelview matrix.
@@ -123,37 +119,37 @@ void vw_CalculateFrustum()
     Frustum[RIGHT][B] = clip[ 7] - clip[ 4];
     Frustum[RIGHT][C] = clip[11] - clip[ 8];
     Frustum[RIGHT][D] = clip[15] - clip[12];
-    NormalizePlane(RIGHT);
+    NormalizePlane(Frustum, RIGHT);
 
     Frustum[LEFT][A] = clip[ 3] + clip[ 0];
     Frustum[LEFT][B] = clip[ 7] + clip[ 4];
     Frustum[LEFT][C] = clip[11] + clip[ 8];
     Frustum[LEFT][D] = clip[15] + clip[12];
-    NormalizePlane(LEFT);
+    NormalizePlane(Frustum, LEFT);
 
     Frustum[BOTTOM][A] = clip[ 3] + clip[ 1];
     Frustum[BOTTOM][B] = clip[ 7] + clip[ 5];
     Frustum[BOTTOM][C] = clip[11] + clip[ 9];
     Frustum[BOTTOM][D] = clip[15] + clip[13];
-    NormalizePlane(BOTTOM);
+    NormalizePlane(Frustum, BOTTOM);
 
     Frustum[TOP][A] = clip[ 3] - clip[ 1];
     Frustum[TOP][B] = clip[ 7] - clip[ 5];
     Frustum[TOP][C] = clip[11] - clip[ 9];
     Frustum[TOP][D] = clip[15] - clip[13];
-    NormalizePlane(TOP);
+    NormalizePlane(Frustum, TOP);
 
     Frustum[BACK][A] = clip[ 3] - clip[ 2];
     Frustum[BACK][B] = clip[ 7] - clip[ 6];
     Frustum[BACK][C] = clip[11] - clip[10];
     Frustum[BACK][D] = clip[15] - clip[14];
-    NormalizePlane(BACK);
+    NormalizePlane(Frustum, BACK);
 
     Frustum[FRONT][A] = clip[ 3] + clip[ 2];
     Frustum[FRONT][B] = clip[ 7] + clip[ 6];
     Frustum[FRONT][C] = clip[11] + clip[10];
     Frustum[FRONT][D] = clip[15] + clip[14];
-    NormalizePlane(FRONT);
+    NormalizePlane(Frustum, FRONT);
 }
 
 /*
@@ -164,7 +160,7 @@ bool vw_SphereInFrustum(const sVECTOR3D &Point, float Radius)
     // go through all the sides of the frustum
     for (int i = 0; i < 6; i++) {
         // if the center of the sphere is farther away from the plane than the radius
-        if (Frustum[i][A] * Point.x + Frustum[i][B] * Point.y + Frustum[i][C] * Point.z + Frustum[i][D] <= -Radius) {
+        if (CameraFrustum.Planes[i][A] * Point.x + CameraFrustum.Planes[i][B] * Point.y + CameraFrustum.Planes[i][C] * Point.z + CameraFrustum.Planes[i][D] <= -Radius) {
             // the distance was greater than the radius so the sphere is outside of the frustum
             return false;
         }
@@ -176,7 +172,7 @@ bool vw_SphereInFrustum(const sVECTOR3D &Point, float Radius)
 /*
  * This checks if a box is in the frustum.
  */
-bool vw_BoxInFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)
+static bool BoxInFrustum(const float (&Frustum)[6][4], const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)
 {
     // Go through all of the corners of the box and check then again each plane
     // in the frustum.  If all of them are behind one of the planes, then it most
@@ -202,4 +198,37 @@ bool vw_BoxInFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)
     return true;
 }
 
+/*
+ * Call this every time the camera moves to update the frustum
+ */
+void vw_CalculateFrustum()
+{
+    CalculateFrustum(CameraFrustum.Planes);
+}
+
+/*
+ * This checks if a box is in the frustum.
+ */
+bool vw_BoxInFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)
+{
+    return BoxInFrustum(CameraFrustum.Planes, MinPoint, MaxPoint);
+}
+
+/*
+ * Calculate custom frustum by current projection and modelview matrices.
+ * Camera's frustum not changed.
+ */
+void vw_CalculateFrustum(sFrustum &CustomFrustum)
+{
+    CalculateFrustum(CustomFrustum.Planes);
+}
+
+/*
+ * This checks if a box is in the custom frustum.
+ */
+bool vw_BoxInFrustum(const sFrustum &CustomFrustum, const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)
+{
+    return BoxInFrustum(CustomFrustum.Planes, MinPoint, MaxPoint);
+}
+
 } // viewizard namespace
@@ -35,10 +35,12 @@
 #include "graphics/graphics.h"
 #include "light/light.h"
 #include "math/math.h"
+#include "memory/memory.h"
 #include "model3d/model3d.h"
 #include "particle_system/particle_system.h"
 #include "particle_system2d/particle_system2d.h"
 #include "platform/platform.h"
+#include "profiler/profiler.h"
 #include "text/text.h"
 #include "texture/texture.h"
 #include "time_thread/time_thread.h"
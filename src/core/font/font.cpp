@@ -45,6 +45,7 @@
 #include "../camera/camera.h"
 #include "../math/math.h"
 #include "../vfs/vfs.h"
+#include "../memory/memory.h"
 #include "SDL2/SDL.h"
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -133,6 +134,8 @@ GLuint IndexBO{0};
 unsigned int IndexArraySize{0};
 // space character utf32 code
 constexpr char32_t SpaceUTF32{32};
+// font characters generation, changed on all font characters release
+unsigned FontCharsGeneration{0};
 
 } // unnamed namespace
 
@@ -226,6 +229,7 @@ void vw_ReleaseAllFontChars()
     }
     // reset list
     FontCharsList.clear();
+    FontCharsGeneration++;
 
     // FIXME probably, this part should be moved to separate method and call only on OpenGL context destroy
     if (IndexBO) {
@@ -233,6 +237,15 @@ void vw_ReleaseAllFontChars()
     }
 }
 
+/*
+ * Get font characters generation (changed on all font characters release).
+ * Could be used by callers, who store font characters textures (draw lists).
+ */
+unsigned vw_GetFontCharsGeneration()
+{
+    return FontCharsGeneration;
+}
+
 /*
  *  Shutdown font.
  */
@@ -435,7 +448,8 @@ static inline void AddToDrawBuffer(float CoordX, float CoordY, float TextureU, f
 /*
  * Calculate width factors.
  */
-static void CalculateWidthFactors(const std::u32string &Text, const float StrictWidth,
+template <typename T>
+static void CalculateWidthFactors(const T &Text, const float StrictWidth,
                                   float &SpaceWidthFactor, float &FontWidthFactor)
 {
     float LineWidth1{0}; // for StrictWidth > 0
@@ -527,18 +541,6 @@ static void DrawBufferOnTextEnd(GLtexture CurrentTexture)
     VertexArrayPosition = 0;
 }
 
-/*
- * vw_DrawTextUTF32 wrapper with conversion into utf32.
- */
-int vw_DrawText(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
-                const sRGBCOLOR &Color, float Transp, const std::string &Text)
-{
-    // convert from utf8 into utf32
-    const std::u32string UTF32String{ConvertUTF8.from_bytes(Text)};
-
-    return vw_DrawTextUTF32(X, Y, StrictWidth, ExpandWidth, FontScale, Color, Transp, UTF32String);
-}
-
 /*
  * Draw buffers routine (allocate memory, reset counters...).
  */
@@ -587,8 +589,9 @@ static void DrawBuffersRoutine(unsigned TextSize)
  *      if StrictWidth < 0, reduce all font character's width
  * ExpandWidth - expand width to provided parameter
  */
-int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
-                     const sRGBCOLOR &Color, float Transp, const std::u32string &Text)
+template <typename T>
+static int DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
+                         const sRGBCOLOR &Color, float Transp, const T &Text)
 {
     if (Text.empty()) {
         return ERR_PARAMETERS;
@@ -622,8 +625,14 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
     // calculate text width, all characters that we already rendered
     float LineWidth{0};
 
-    vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
-    vw_SetColor(Color.r, Color.g, Color.b, Transp);
+    // in 2D mode we collect characters into draw list, instead of immediate rendering
+    bool DrawListRecording = vw_DrawList2DRecording();
+    if (!DrawListRecording) {
+        vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
+        vw_SetColor(Color.r, Color.g, Color.b, Transp);
+        // we are safe with static_cast here, since text size will not exceed 'unsigned' in our case for sure
+        DrawBuffersRoutine(static_cast<unsigned>(Text.size()));
+    }
     GLtexture CurrentTexture{0};
     float ImageHeight{0.0f};
     float ImageWidth{0.0f};
@@ -631,9 +640,6 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
     // combine calculated width factor and global width scale
     FontWidthFactor = FontScale*FontWidthFactor;
 
-    // we are safe with static_cast here, since text size will not exceed 'unsigned' in our case for sure
-    DrawBuffersRoutine(static_cast<unsigned>(Text.size()));
-
     // draw all characters in text by blocks grouped by texture id
     for (const auto &UTF32 : Text) {
         // find current character
@@ -649,7 +655,11 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
 
         // looks like texture should be changed
         if (CurrentTexture != DrawChar->Texture) {
-            DrawBufferOnTextureChange(CurrentTexture, DrawChar);
+            if (DrawListRecording) {
+                CurrentTexture = DrawChar->Texture;
+            } else {
+                DrawBufferOnTextureChange(CurrentTexture, DrawChar);
+            }
             vw_FindTextureSizeByID(DrawChar->Texture, &ImageWidth, &ImageHeight);
         }
 
@@ -666,13 +676,22 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
             float U_Right{DrawChar->TexturePos.right / ImageWidth};
             float V_Bottom{DrawChar->TexturePos.bottom / ImageHeight};
 
-            // triangle's points (index buffer will provide proper sequence)
-            AddToDrawBuffer(DrawX, DrawY, U_Left, V_Top);
-            AddToDrawBuffer(DrawX, DrawY + DrawChar->FontMetrics.Height.f() * FontScale, U_Left, V_Bottom);
-            AddToDrawBuffer(DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor,
-                            DrawY + DrawChar->FontMetrics.Height.f() * FontScale,
-                            U_Right, V_Bottom);
-            AddToDrawBuffer(DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor, DrawY, U_Right, V_Top);
+            float DrawRight{DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor};
+            float DrawBottom{DrawY + DrawChar->FontMetrics.Height.f() * FontScale};
+
+            if (DrawListRecording) {
+                const float tmpQuad[16]{DrawX, DrawY, U_Left, V_Top,
+                                        DrawX, DrawBottom, U_Left, V_Bottom,
+                                        DrawRight, DrawBottom, U_Right, V_Bottom,
+                                        DrawRight, DrawY, U_Right, V_Top};
+                vw_AddQuadToDrawList2D(CurrentTexture, true, Color, Transp, tmpQuad);
+            } else {
+                // triangle's points (index buffer will provide proper sequence)
+                AddToDrawBuffer(DrawX, DrawY, U_Left, V_Top);
+                AddToDrawBuffer(DrawX, DrawBottom, U_Left, V_Bottom);
+                AddToDrawBuffer(DrawRight, DrawBottom, U_Right, V_Bottom);
+                AddToDrawBuffer(DrawRight, DrawY, U_Right, V_Top);
+            }
 
             Xstart += DrawChar->FontMetrics.AdvanceX * FontWidthFactor;
             LineWidth += DrawChar->FontMetrics.AdvanceX * FontWidthFactor;
@@ -687,6 +706,10 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
         }
     }
 
+    if (DrawListRecording) {
+        return 0;
+    }
+
     // text is over, draw all we have in buffer
     DrawBufferOnTextEnd(CurrentTexture);
 
@@ -698,20 +721,89 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
 }
 
 /*
- * vw_TextWidthUTF32 wrapper with conversion into utf32.
+ * Draw text with current font. Origin is upper left corner.
  */
-int vw_TextWidth(const std::string &Text)
+int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
+                     const sRGBCOLOR &Color, float Transp, const std::u32string &Text)
+{
+    return DrawTextUTF32(X, Y, StrictWidth, ExpandWidth, FontScale, Color, Transp, Text);
+}
+
+/*
+ * Convert utf8 into utf32 string, allocated in frame arena.
+ * Note, in contrast to ConvertUTF8, invalid sequences (wrong lead or continuation bytes,
+ * overlong forms, surrogates and code points above U+10FFFF) are replaced by U+FFFD.
+ */
+static void ConvertUTF8ToFrameUTF32(const std::string &Text, tFrameU32String &UTF32String)
+{
+    UTF32String.reserve(Text.size());
+
+    for (size_t i = 0; i < Text.size();) {
+        uint8_t Lead = static_cast<uint8_t>(Text[i]);
+        unsigned Length{0}; // 0 - invalid lead byte (continuation byte, 0xC0, 0xC1, 0xF5-0xFF)
+        char32_t UTF32{Lead};
+        // minimal code point for this sequence length, in order to detect overlong forms
+        char32_t Min{0};
+        if (Lead < 0x80) {
+            Length = 1;
+        } else if (Lead >= 0xC2 && Lead <= 0xDF) {
+            Length = 2;
+            UTF32 = Lead & 0x1F;
+            Min = 0x80;
+        } else if (Lead >= 0xE0 && Lead <= 0xEF) {
+            Length = 3;
+            UTF32 = Lead & 0x0F;
+            Min = 0x800;
+        } else if (Lead >= 0xF0 && Lead <= 0xF4) {
+            Length = 4;
+            UTF32 = Lead & 0x07;
+            Min = 0x10000;
+        }
+
+        bool Valid = (Length > 0) && (i + Length <= Text.size());
+        for (unsigned j = 1; Valid && j < Length; j++) {
+            uint8_t Next = static_cast<uint8_t>(Text[i + j]);
+            if ((Next & 0xC0) != 0x80) {
+                Valid = false;
+            }
+            UTF32 = (UTF32 << 6) | (Next & 0x3F);
+        }
+        if (Valid
+            && (UTF32 < Min
+                || (UTF32 >= 0xD800 && UTF32 <= 0xDFFF)
+                || UTF32 > 0x10FFFF)) {
+            Valid = false;
+        }
+
+        if (Valid) {
+            UTF32String.push_back(UTF32);
+            i += Length;
+        } else {
+            UTF32String.push_back(0xFFFD);
+            i++;
+        }
+    }
+}
+
+/*
+ * vw_DrawTextUTF32 wrapper with conversion into utf32.
+ */
+int vw_DrawText(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
+                const sRGBCOLOR &Color, float Transp, const std::string &Text)
 {
-    // convert from utf8 into utf32
-    const std::u32string UTF32String{ConvertUTF8.from_bytes(Text)};
+    // convert from utf8 into utf32, transient string allocated in frame arena
+    cFrameArenaScope FrameArenaScope{};
+    tFrameU32String UTF32String{};
+    ConvertUTF8ToFrameUTF32(Text, UTF32String);
 
-    return vw_TextWidthUTF32(UTF32String);
+    return DrawTextUTF32(X, Y, StrictWidth, ExpandWidth, FontScale, Color, Transp, UTF32String);
 }
 
 /*
  * Get string size with current font size.
  */
-int vw_TextWidthUTF32(const std::u32string &Text)
+template <typename T>
+static int TextWidthUTF32(const T &Text)
 {
     if (Text.empty()) {
         return ERR_PARAMETERS;
@@ -740,6 +832,27 @@ int vw_TextWidthUTF32(const std::u32string &Text)
     return static_cast<int>(LineWidth);
 }
 
+/*
+ * Get string size with current font size.
+ */
+int vw_TextWidthUTF32(const std::u32string &Text)
+{
+    return TextWidthUTF32(Text);
+}
+
+/*
+ * vw_TextWidthUTF32 wrapper with conversion into utf32.
+ */
+int vw_TextWidth(const std::string &Text)
+{
+    // convert from utf8 into utf32, transient string allocated in frame arena
+    cFrameArenaScope FrameArenaScope{};
+    tFrameU32String UTF32String{};
+    ConvertUTF8ToFrameUTF32(Text, UTF32String);
+
+    return TextWidthUTF32(UTF32String);
+}
+
 /*
  * Draw 3D text with current font.
  */
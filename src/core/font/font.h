@@ -45,6 +45,8 @@ int vw_GenerateFontChars(unsigned FontTextureWidth, unsigned FontTextureHeight,
 bool vw_CheckFontCharByUTF32(char32_t UTF32);
 // Release all font characters and created for this characters textures.
 void vw_ReleaseAllFontChars();
+// Get font characters generation (changed on all font characters release).
+unsigned vw_GetFontCharsGeneration();
 // Shutdown font.
 void vw_ShutdownFont();
 
@@ -41,6 +41,8 @@ PFNGLDELETEBUFFERSPROC pfn_glDeleteBuffers{nullptr};
 PFNGLGENBUFFERSPROC pfn_glGenBuffers{nullptr};
 PFNGLISBUFFERPROC pfn_glIsBuffer{nullptr};
 PFNGLBUFFERDATAPROC pfn_glBufferData{nullptr};
+PFNGLMAPBUFFERPROC pfn_glMapBuffer{nullptr};
+PFNGLUNMAPBUFFERPROC pfn_glUnmapBuffer{nullptr};
 
 // OpenGL 2.0 (only what we need or would need in future)
 PFNGLATTACHSHADERPROC pfn_glAttachShader{nullptr};
@@ -117,6 +119,18 @@ PFNGLISVERTEXARRAYPROC pfn_glIsVertexArray{nullptr};
 // OpenGL 4.2 (only what we need or would need in future)
 PFNGLTEXSTORAGE2DPROC pfn_glTexStorage2D{nullptr};
 
+// GL_ARB_timer_query (+ query objects from OpenGL 1.5)
+PFNGLGENQUERIESPROC pfn_glGenQueries{nullptr};
+PFNGLDELETEQUERIESPROC pfn_glDeleteQueries{nullptr};
+PFNGLGETQUERYOBJECTIVPROC pfn_glGetQueryObjectiv{nullptr};
+PFNGLQUERYCOUNTERPROC pfn_glQueryCounter{nullptr};
+PFNGLGETQUERYOBJECTUI64VPROC pfn_glGetQueryObjectui64v{nullptr};
+
+// GL_ARB_get_program_binary (also part of OpenGL 4.1)
+PFNGLGETPROGRAMBINARYPROC pfn_glGetProgramBinary{nullptr};
+PFNGLPROGRAMBINARYPROC pfn_glProgramBinary{nullptr};
+PFNGLPROGRAMPARAMETERIPROC pfn_glProgramParameteri{nullptr};
+
 // GL_NV_framebuffer_multisample_coverage
 PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC pfn_glRenderbufferStorageMultisampleCoverageNV{nullptr};
 
@@ -151,17 +165,23 @@ bool Initialize_OpenGL_1_5()
     pfn_glGenBuffers = reinterpret_cast<PFNGLGENBUFFERSPROC>(SDL_GL_GetProcAddress("glGenBuffers"));
     pfn_glIsBuffer = reinterpret_cast<PFNGLISBUFFERPROC>(SDL_GL_GetProcAddress("glIsBuffer"));
     pfn_glBufferData = reinterpret_cast<PFNGLBUFFERDATAPROC>(SDL_GL_GetProcAddress("glBufferData"));
+    pfn_glMapBuffer = reinterpret_cast<PFNGLMAPBUFFERPROC>(SDL_GL_GetProcAddress("glMapBuffer"));
+    pfn_glUnmapBuffer = reinterpret_cast<PFNGLUNMAPBUFFERPROC>(SDL_GL_GetProcAddress("glUnmapBuffer"));
 
     if (!pfn_glBindBuffer
         || !pfn_glDeleteBuffers
         || !pfn_glGenBuffers
         || !pfn_glIsBuffer
-        || !pfn_glBufferData) {
+        || !pfn_glBufferData
+        || !pfn_glMapBuffer
+        || !pfn_glUnmapBuffer) {
         pfn_glBindBuffer = nullptr;
         pfn_glDeleteBuffers = nullptr;
         pfn_glGenBuffers = nullptr;
         pfn_glIsBuffer = nullptr;
         pfn_glBufferData = nullptr;
+        pfn_glMapBuffer = nullptr;
+        pfn_glUnmapBuffer = nullptr;
 
         return false;
     }
@@ -422,6 +442,56 @@ bool Initialize_OpenGL_4_2()
     return pfn_glTexStorage2D;
 }
 
+/*
+ * GL_ARB_timer_query initialization.
+ */
+bool Initialize_GL_ARB_timer_query()
+{
+    pfn_glGenQueries = reinterpret_cast<PFNGLGENQUERIESPROC>(SDL_GL_GetProcAddress("glGenQueries"));
+    pfn_glDeleteQueries = reinterpret_cast<PFNGLDELETEQUERIESPROC>(SDL_GL_GetProcAddress("glDeleteQueries"));
+    pfn_glGetQueryObjectiv = reinterpret_cast<PFNGLGETQUERYOBJECTIVPROC>(SDL_GL_GetProcAddress("glGetQueryObjectiv"));
+    pfn_glQueryCounter = reinterpret_cast<PFNGLQUERYCOUNTERPROC>(SDL_GL_GetProcAddress("glQueryCounter"));
+    pfn_glGetQueryObjectui64v = reinterpret_cast<PFNGLGETQUERYOBJECTUI64VPROC>(SDL_GL_GetProcAddress("glGetQueryObjectui64v"));
+
+    if (!pfn_glGenQueries
+        || !pfn_glDeleteQueries
+        || !pfn_glGetQueryObjectiv
+        || !pfn_glQueryCounter
+        || !pfn_glGetQueryObjectui64v) {
+        pfn_glGenQueries = nullptr;
+        pfn_glDeleteQueries = nullptr;
+        pfn_glGetQueryObjectiv = nullptr;
+        pfn_glQueryCounter = nullptr;
+        pfn_glGetQueryObjectui64v = nullptr;
+
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * GL_ARB_get_program_binary initialization.
+ */
+bool Initialize_GL_ARB_get_program_binary()
+{
+    pfn_glGetProgramBinary = reinterpret_cast<PFNGLGETPROGRAMBINARYPROC>(SDL_GL_GetProcAddress("glGetProgramBinary"));
+    pfn_glProgramBinary = reinterpret_cast<PFNGLPROGRAMBINARYPROC>(SDL_GL_GetProcAddress("glProgramBinary"));
+    pfn_glProgramParameteri = reinterpret_cast<PFNGLPROGRAMPARAMETERIPROC>(SDL_GL_GetProcAddress("glProgramParameteri"));
+
+    if (!pfn_glGetProgramBinary
+        || !pfn_glProgramBinary
+        || !pfn_glProgramParameteri) {
+        pfn_glGetProgramBinary = nullptr;
+        pfn_glProgramBinary = nullptr;
+        pfn_glProgramParameteri = nullptr;
+
+        return false;
+    }
+
+    return true;
+}
+
 /*
  * GL_NV_framebuffer_multisample_coverage initialization.
  */
@@ -50,6 +50,8 @@ extern PFNGLDELETEBUFFERSPROC pfn_glDeleteBuffers;
 extern PFNGLGENBUFFERSPROC pfn_glGenBuffers;
 extern PFNGLISBUFFERPROC pfn_glIsBuffer;
 extern PFNGLBUFFERDATAPROC pfn_glBufferData;
+extern PFNGLMAPBUFFERPROC pfn_glMapBuffer;
+extern PFNGLUNMAPBUFFERPROC pfn_glUnmapBuffer;
 
 // OpenGL 2.0 (only what we need or would need in future)
 extern PFNGLATTACHSHADERPROC pfn_glAttachShader;
@@ -126,6 +128,18 @@ extern PFNGLISVERTEXARRAYPROC pfn_glIsVertexArray;
 // OpenGL 4.2 (only what we need or would need in future)
 extern PFNGLTEXSTORAGE2DPROC pfn_glTexStorage2D;
 
+// GL_ARB_timer_query (+ query objects from OpenGL 1.5)
+extern PFNGLGENQUERIESPROC pfn_glGenQueries;
+extern PFNGLDELETEQUERIESPROC pfn_glDeleteQueries;
+extern PFNGLGETQUERYOBJECTIVPROC pfn_glGetQueryObjectiv;
+extern PFNGLQUERYCOUNTERPROC pfn_glQueryCounter;
+extern PFNGLGETQUERYOBJECTUI64VPROC pfn_glGetQueryObjectui64v;
+
+// GL_ARB_get_program_binary (also part of OpenGL 4.1)
+extern PFNGLGETPROGRAMBINARYPROC pfn_glGetProgramBinary;
+extern PFNGLPROGRAMBINARYPROC pfn_glProgramBinary;
+extern PFNGLPROGRAMPARAMETERIPROC pfn_glProgramParameteri;
+
 // GL_NV_framebuffer_multisample_coverage
 extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC pfn_glRenderbufferStorageMultisampleCoverageNV;
 
@@ -136,6 +150,8 @@ bool Initialize_OpenGL_2_0();
 bool Initialize_OpenGL_2_1();
 bool Initialize_OpenGL_3_0();
 bool Initialize_OpenGL_4_2();
+bool Initialize_GL_ARB_timer_query();
+bool Initialize_GL_ARB_get_program_binary();
 bool Initialize_GL_NV_framebuffer_multisample_coverage();
 
 } // viewizard namespace
@@ -31,7 +31,10 @@
 
 #include "../math/math.h"
 #include "../texture/texture.h"
+#include "graphics_internal.h"
 #include "graphics.h"
+#include <algorithm>
+#include <cmath>
 
 namespace viewizard {
 
@@ -40,6 +43,17 @@ namespace {
 float DrawBuffer[16]; // RI_2f_XY | RI_2f_TEX = (2 + 2) * 4 vertices = 16
 unsigned int DrawBufferCurrentPosition{0};
 
+// RI_2f_XY | RI_4f_COLOR | RI_1_TEX
+constexpr unsigned DrawList2DVertexSize{2 + 4 + 2};
+// How many batches we check back for same texture and blending, before create new batch.
+constexpr unsigned DrawList2DMaxLookBack{16};
+// Frame draw list, collect all quads between vw_Start2DMode() and vw_End2DMode().
+sDrawList2D FrameDrawList{};
+// Current draw list, nullptr if we don't collect quads now.
+sDrawList2D *CurrentDrawList{nullptr};
+// Index array for draw list rendering (0, 1, 2, 0, 2, 3 for each quad).
+std::vector<unsigned> DrawList2DIndexArray{};
+
 } // unnamed namespace
 
 
@@ -48,9 +62,11 @@ unsigned int DrawBufferCurrentPosition{0};
  */
 void vw_Start2DMode(GLdouble zNear, GLdouble zFar)
 {
+    CurrentDrawList = &FrameDrawList;
+
     glPushAttrib(GL_ENABLE_BIT);
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
+    vw_CullFace(eCullFace::NONE);
+    vw_DepthTest(false, eCompareFunc::LEQUAL);
 
     // get current viewport start point and size
     float tmpViewportX, tmpViewportY, tmpViewportWidth, tmpViewportHeight;
@@ -94,6 +110,9 @@ void vw_Start2DMode(GLdouble zNear, GLdouble zFar)
  */
 void vw_End2DMode()
 {
+    vw_FlushDrawList2D();
+    CurrentDrawList = nullptr;
+
     // we don't switch to 0 unit, in 2D mode only 0 unit should be used
     glMatrixMode(GL_TEXTURE);
     glPopMatrix();
@@ -105,6 +124,7 @@ void vw_End2DMode()
     glPopMatrix();
 
     glPopAttrib();
+    StateCache_InvalidateEnables();
 }
 
 /*
@@ -128,13 +148,12 @@ void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bo
         return;
     }
 
-    // bind texture before glGetTexLevelParameterfv() call
-    vw_BindTexture(0, Texture);
-
     float ImageHeight{0.0f};
     float ImageWidth{0.0f};
     // if texture loaded via textures manager, get data from it
     if (!vw_FindTextureSizeByID(Texture, &ImageWidth, &ImageHeight)) {
+        // bind texture before glGetTexLevelParameterfv() call
+        vw_BindTexture(0, Texture);
         // get Width and Height for 0 mipmap level
         // call glGetTexLevelParameterfv() is generally not recommended,
         // since it could stall the OpenGL pipeline
@@ -153,6 +172,27 @@ void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bo
     float U_right = static_cast<float>(SrcRect.right) / ImageWidth;
     float V_bottom = static_cast<float>(SrcRect.bottom) / ImageHeight;
 
+    // collect quad into draw list, instead of immediate rendering
+    if (CurrentDrawList) {
+        float tmpQuad[16]{static_cast<float>(DstRect.left), static_cast<float>(DstRect.top), U_left, V_top,
+                          static_cast<float>(DstRect.left), static_cast<float>(DstRect.bottom), U_left, V_bottom,
+                          static_cast<float>(DstRect.right), static_cast<float>(DstRect.bottom), U_right, V_bottom,
+                          static_cast<float>(DstRect.right), static_cast<float>(DstRect.top), U_right, V_top};
+        // same as glRotatef(RotateAngle, 0, 0, 1), but on CPU side
+        if (RotateAngle != 0.0f) {
+            constexpr float DegToRadFactor = 0.0174532925f; // conversion factor to convert degrees to radians
+            float c = cosf(RotateAngle * DegToRadFactor);
+            float s = sinf(RotateAngle * DegToRadFactor);
+            for (unsigned i = 0; i < 16; i += 4) {
+                float tmpX = tmpQuad[i];
+                tmpQuad[i] = tmpX * c - tmpQuad[i + 1] * s;
+                tmpQuad[i + 1] = tmpX * s + tmpQuad[i + 1] * c;
+            }
+        }
+        vw_AddQuadToDrawList2D(Texture, Alpha, Color, Transp, tmpQuad);
+        return;
+    }
+
     // 'reset' buffer
     DrawBufferCurrentPosition = 0;
 
@@ -164,6 +204,7 @@ void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bo
     AddToDrawBuffer(static_cast<float>(DstRect.right), static_cast<float>(DstRect.bottom), U_right, V_bottom);
 
     // setup OpenGL
+    vw_BindTexture(0, Texture);
     vw_SetTextureBlend(Alpha, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
     vw_Clamp(Transp, 0.0f, 1.0f);
     vw_SetColor(Color.r, Color.g, Color.b, Transp);
@@ -179,4 +220,159 @@ void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bo
     vw_BindTexture(0, 0);
 }
 
+/*
+ * Draw texture region (SrcRect is relative to region). Origin is upper left corner.
+ */
+void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, const sTextureRegion &Region, bool Alpha,
+               float Transp, float RotateAngle, const sRGBCOLOR &Color)
+{
+    sRECT tmpSrcRect{SrcRect.left + Region.OffsetX, SrcRect.top + Region.OffsetY,
+                     SrcRect.right + Region.OffsetX, SrcRect.bottom + Region.OffsetY};
+    vw_Draw2D(DstRect, tmpSrcRect, Region.Texture, Alpha, Transp, RotateAngle, Color);
+}
+
+/*
+ * Check, are we collecting 2D quads into draw list now.
+ */
+bool vw_DrawList2DRecording()
+{
+    return CurrentDrawList != nullptr;
+}
+
+/*
+ * Find batch with same texture and blending for provided bounding box.
+ * We could move quad back to previous batch only in case it don't overlap
+ * all batches after it, so, draw order for visible pixels will be the same.
+ */
+static sDrawList2DBatch &FindDrawList2DBatch(sDrawList2D &DrawList, GLtexture Texture, bool Alpha,
+                                             float MinX, float MinY, float MaxX, float MaxY)
+{
+    for (unsigned i = DrawList.BatchesCount, LookBack = 0;
+         (i > 0) && (LookBack < DrawList2DMaxLookBack); i--, LookBack++) {
+        sDrawList2DBatch &tmpBatch = DrawList.Batches[i - 1];
+        if (tmpBatch.Texture == Texture && tmpBatch.Alpha == Alpha) {
+            tmpBatch.MinX = std::min(tmpBatch.MinX, MinX);
+            tmpBatch.MinY = std::min(tmpBatch.MinY, MinY);
+            tmpBatch.MaxX = std::max(tmpBatch.MaxX, MaxX);
+            tmpBatch.MaxY = std::max(tmpBatch.MaxY, MaxY);
+            return tmpBatch;
+        }
+        if (tmpBatch.MinX < MaxX && MinX < tmpBatch.MaxX
+            && tmpBatch.MinY < MaxY && MinY < tmpBatch.MaxY) {
+            break;
+        }
+    }
+
+    // reuse previously allocated batches memory
+    if (DrawList.BatchesCount == DrawList.Batches.size()) {
+        DrawList.Batches.emplace_back();
+    }
+    sDrawList2DBatch &tmpBatch = DrawList.Batches[DrawList.BatchesCount++];
+    tmpBatch.Texture = Texture;
+    tmpBatch.Alpha = Alpha;
+    tmpBatch.MinX = MinX;
+    tmpBatch.MinY = MinY;
+    tmpBatch.MaxX = MaxX;
+    tmpBatch.MaxY = MaxY;
+    return tmpBatch;
+}
+
+/*
+ * Add quad into current draw list. Quad is 4 vertices (X, Y, U, V) in
+ * left-top, left-bottom, right-bottom, right-top order.
+ */
+void vw_AddQuadToDrawList2D(GLtexture Texture, bool Alpha, const sRGBCOLOR &Color, float Transp,
+                            const float (&Quad)[16])
+{
+    if (!CurrentDrawList || !Texture || Transp <= 0.0f) {
+        return;
+    }
+    vw_Clamp(Transp, 0.0f, 1.0f);
+
+    float MinX{Quad[0]};
+    float MinY{Quad[1]};
+    float MaxX{Quad[0]};
+    float MaxY{Quad[1]};
+    for (unsigned i = 4; i < 16; i += 4) {
+        MinX = std::min(MinX, Quad[i]);
+        MinY = std::min(MinY, Quad[i + 1]);
+        MaxX = std::max(MaxX, Quad[i]);
+        MaxY = std::max(MaxY, Quad[i + 1]);
+    }
+
+    sDrawList2DBatch &tmpBatch = FindDrawList2DBatch(*CurrentDrawList, Texture, Alpha, MinX, MinY, MaxX, MaxY);
+    for (unsigned i = 0; i < 16; i += 4) {
+        tmpBatch.Vertices.insert(tmpBatch.Vertices.end(), {Quad[i], Quad[i + 1],
+                                                           Color.r, Color.g, Color.b, Transp,
+                                                           Quad[i + 2], Quad[i + 3]});
+    }
+}
+
+/*
+ * Start collecting vw_Draw2D() and vw_DrawTextUTF32() quads into provided draw list.
+ * Caller should store draw list and re-create it only on content change.
+ */
+void vw_BeginDrawList2D(sDrawList2D &DrawList)
+{
+    DrawList.Clear();
+    CurrentDrawList = &DrawList;
+}
+
+/*
+ * Stop collecting quads into provided draw list, switch back to frame draw list.
+ */
+void vw_EndDrawList2D()
+{
+    CurrentDrawList = &FrameDrawList;
+}
+
+/*
+ * Add stored draw list into frame draw list.
+ */
+void vw_AddDrawList2D(const sDrawList2D &DrawList)
+{
+    for (unsigned i = 0; i < DrawList.BatchesCount; i++) {
+        const sDrawList2DBatch &tmpSrcBatch = DrawList.Batches[i];
+        sDrawList2DBatch &tmpBatch = FindDrawList2DBatch(FrameDrawList, tmpSrcBatch.Texture, tmpSrcBatch.Alpha,
+                                                         tmpSrcBatch.MinX, tmpSrcBatch.MinY,
+                                                         tmpSrcBatch.MaxX, tmpSrcBatch.MaxY);
+        tmpBatch.Vertices.insert(tmpBatch.Vertices.end(), tmpSrcBatch.Vertices.begin(), tmpSrcBatch.Vertices.end());
+    }
+}
+
+/*
+ * Draw and clear frame draw list (should be called before direct rendering in 2D mode).
+ */
+void vw_FlushDrawList2D()
+{
+    if (FrameDrawList.empty()) {
+        return;
+    }
+
+    for (unsigned i = 0; i < FrameDrawList.BatchesCount; i++) {
+        sDrawList2DBatch &tmpBatch = FrameDrawList.Batches[i];
+        // we are safe with static_cast here, since vertices count will not exceed 'unsigned' for sure
+        unsigned QuadsCount = static_cast<unsigned>(tmpBatch.Vertices.size()) / (4 * DrawList2DVertexSize);
+
+        // since we know exactly, what vertex buffer will contain,
+        // generate index array with proper sequence
+        for (unsigned j = static_cast<unsigned>(DrawList2DIndexArray.size()) / 6 * 4;
+             DrawList2DIndexArray.size() < QuadsCount * 6; j += 4) {
+            DrawList2DIndexArray.insert(DrawList2DIndexArray.end(), {j + 0, j + 1, j + 2, j + 0, j + 2, j + 3});
+        }
+
+        vw_BindTexture(0, tmpBatch.Texture);
+        vw_SetTextureBlend(tmpBatch.Alpha, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
+        vw_Draw3D(ePrimitiveType::TRIANGLES, QuadsCount * 6, RI_2f_XY | RI_4f_COLOR | RI_1_TEX,
+                  tmpBatch.Vertices.data(), DrawList2DVertexSize * sizeof(tmpBatch.Vertices[0]),
+                  0, 0, DrawList2DIndexArray.data());
+    }
+    FrameDrawList.Clear();
+
+    // restore previous OpenGL states
+    vw_SetTextureBlend(false, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
+    vw_SetColor(1.0f, 1.0f, 1.0f, 1.0f);
+    vw_BindTexture(0, 0);
+}
+
 } // viewizard namespace
@@ -113,6 +113,7 @@ std::shared_ptr<sFBO> vw_BuildFBO(GLsizei Width, GLsizei Height, bool NeedColor,
         } else { // if we don't need multisamples, switch to texture
             glGenTextures(1, &FBO->ColorTexture);
             glBindTexture(GL_TEXTURE_2D, FBO->ColorTexture);
+            StateCache_InvalidateTextures();
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -149,6 +150,7 @@ std::shared_ptr<sFBO> vw_BuildFBO(GLsizei Width, GLsizei Height, bool NeedColor,
         } else { // if we don't need multisamples, switch to texture
             glGenTextures(1, &FBO->DepthTexture);
             glBindTexture(GL_TEXTURE_2D, FBO->DepthTexture);
+            StateCache_InvalidateTextures();
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -231,6 +233,24 @@ void vw_BlitFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetF
                           GL_COLOR_BUFFER_BIT, GL_LINEAR);
 }
 
+/*
+ * Blit depth part of source FBO to target FBO (FBOs should have same size and depth format).
+ */
+void vw_BlitDepthFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetFBO)
+{
+    if (!SourceFBO || !TargetFBO || !pfn_glBindFramebuffer || !pfn_glBlitFramebuffer
+        || !SourceFBO->FrameBufferObject || !TargetFBO->FrameBufferObject) {
+        return;
+    }
+
+    pfn_glBindFramebuffer(GL_READ_FRAMEBUFFER, SourceFBO->FrameBufferObject);
+    pfn_glBindFramebuffer(GL_DRAW_FRAMEBUFFER, TargetFBO->FrameBufferObject);
+    // note, only GL_NEAREST filter allowed for depth buffer blit
+    pfn_glBlitFramebuffer(0, 0, SourceFBO->Width.i(), SourceFBO->Height.i(),
+                          0, 0, TargetFBO->Width.i(), TargetFBO->Height.i(),
+                          GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+}
+
 /*
  * Draw source FBO (color texture) to target FBO (if null, to FrameBuffer).
  */
@@ -245,8 +265,8 @@ void vw_DrawColorFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &Ta
 
     glPushAttrib(GL_ENABLE_BIT);
     // disable useless flags
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
+    vw_CullFace(eCullFace::NONE);
+    vw_DepthTest(false, eCompareFunc::LEQUAL);
 
     glMatrixMode(GL_PROJECTION);    // select the projection matrix
     glPushMatrix();                 // store the projection matrix
@@ -278,6 +298,7 @@ void vw_DrawColorFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &Ta
     glPopMatrix();
 
     glPopAttrib();
+    StateCache_InvalidateEnables();
 }
 
 /*
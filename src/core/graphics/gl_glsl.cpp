@@ -35,11 +35,24 @@
 // TODO struct cGLSL should use encapsulation (switch to class)
 
 #include "../vfs/vfs.h"
+#include "graphics_internal.h"
 #include "graphics.h"
 #include "extensions.h"
+#include <fstream>
+#include <string.h>
 
 namespace viewizard {
 
+/*
+ * Delete program object.
+ * Note, driver could reuse program name, so, state cache should forget current program.
+ */
+static void DeleteProgram(GLuint Program)
+{
+    pfn_glDeleteProgram(Program);
+    StateCache().ProgramKnown = false;
+}
+
 struct cGLSL {
     friend std::weak_ptr<cGLSL> vw_CreateShader(const std::string &ShaderName,
                                                 const std::string &VertexShaderFileName,
@@ -49,6 +62,13 @@ public:
     GLuint VertexShader{0};
     GLuint FragmentShader{0};
     std::vector<GLint> UniformLocations{};
+    // last values, that was set for uniform locations (uniforms are program object's state)
+    std::unordered_map<GLint, std::array<GLint, 3>> UniformValues{};
+    // program binary cache file name and key (empty file name - cache not used)
+    std::string BinaryCacheFileName{};
+    uint64_t BinaryCacheKey{0};
+    // program already linked by glProgramBinary()
+    bool LinkedFromBinaryCache{false};
 
 private:
     // Don't allow direct new/delete usage in code, only vw_CreateShader()
@@ -64,7 +84,7 @@ private:
                 if (FragmentShader && pfn_glIsShader(FragmentShader)) {
                     pfn_glDetachShader(Program, FragmentShader);
                 }
-                pfn_glDeleteProgram(Program);
+                DeleteProgram(Program);
             }
             if (VertexShader && pfn_glIsShader(VertexShader)) {
                 pfn_glDeleteShader(VertexShader);
@@ -80,6 +100,21 @@ namespace {
 
 // all shaders
 std::unordered_map<std::string, std::shared_ptr<cGLSL>> ShadersMap{};
+// current program object, for uniform values cache
+std::weak_ptr<cGLSL> CurrentGLSL{};
+// program binary cache path (empty - cache disabled)
+std::string BinaryCachePath{};
+
+// program binary cache file header
+constexpr uint32_t BinaryCacheMagic{0x42534d41}; // "AMSB"
+constexpr uint32_t BinaryCacheVersion{1};
+struct sBinaryCacheHeader {
+    uint32_t Magic{BinaryCacheMagic};
+    uint32_t Version{BinaryCacheVersion};
+    uint64_t Key{0};
+    uint32_t Format{0};
+    uint32_t Length{0};
+};
 
 } // unnamed namespace
 
@@ -156,6 +191,146 @@ static void PrintProgramInfoLog(GLuint program)
     CheckOGLError(__func__);
 }
 
+/*
+ * Add data to 64 bits FNV-1a hash.
+ */
+static uint64_t HashFNV1a(uint64_t Hash, const uint8_t *Data, size_t Size)
+{
+    for (size_t i = 0; i < Size; i++) {
+        Hash ^= Data[i];
+        Hash *= 0x100000001b3;
+    }
+    return Hash;
+}
+
+/*
+ * Add OpenGL string to hash (with terminating null, as separator).
+ */
+static uint64_t HashGLString(uint64_t Hash, GLenum Name)
+{
+    const GLubyte *tmpString = glGetString(Name);
+    if (!tmpString) {
+        return Hash;
+    }
+    return HashFNV1a(Hash, tmpString, strlen(reinterpret_cast<const char *>(tmpString)) + 1);
+}
+
+/*
+ * Calculate program binary cache key by driver, OpenGL version and shaders sources.
+ */
+static uint64_t CalculateBinaryCacheKey(const std::unique_ptr<cFILE> &VertexFile,
+                                        const std::unique_ptr<cFILE> &FragmentFile)
+{
+    uint64_t Hash{0xcbf29ce484222325};
+    Hash = HashGLString(Hash, GL_VENDOR);
+    Hash = HashGLString(Hash, GL_RENDERER);
+    Hash = HashGLString(Hash, GL_VERSION);
+    Hash = HashGLString(Hash, GL_SHADING_LANGUAGE_VERSION);
+
+    // size first, so, sources could not be shifted between shaders with same hash
+    for (auto *tmpFile : {VertexFile.get(), FragmentFile.get()}) {
+        uint64_t tmpSize = tmpFile ? static_cast<uint64_t>(tmpFile->GetSize()) : 0;
+        Hash = HashFNV1a(Hash, reinterpret_cast<const uint8_t *>(&tmpSize), sizeof(tmpSize));
+        if (tmpFile) {
+            Hash = HashFNV1a(Hash, tmpFile->GetData(), tmpFile->GetSize());
+        }
+    }
+
+    return Hash;
+}
+
+/*
+ * Check, if program binary cache could be used.
+ */
+static bool BinaryCacheEnabled()
+{
+    return !BinaryCachePath.empty() && vw_DevCaps().ARB_get_program_binary;
+}
+
+/*
+ * Load program binary from cache.
+ */
+static bool LoadProgramBinary(cGLSL &GLSL)
+{
+    std::ifstream File(GLSL.BinaryCacheFileName, std::ios::binary);
+    if (!File) {
+        return false;
+    }
+
+    sBinaryCacheHeader tmpHeader;
+    if (!File.read(reinterpret_cast<char *>(&tmpHeader), sizeof(tmpHeader))
+        || (tmpHeader.Magic != BinaryCacheMagic)
+        || (tmpHeader.Version != BinaryCacheVersion)
+        || (tmpHeader.Key != GLSL.BinaryCacheKey)
+        || !tmpHeader.Length) {
+        return false;
+    }
+
+    std::unique_ptr<uint8_t[]> tmpBinary{new uint8_t[tmpHeader.Length]};
+    if (!File.read(reinterpret_cast<char *>(tmpBinary.get()), tmpHeader.Length)) {
+        return false;
+    }
+
+    GLSL.Program = pfn_glCreateProgram();
+    pfn_glProgramBinary(GLSL.Program, tmpHeader.Format, tmpBinary.get(), static_cast<GLsizei>(tmpHeader.Length));
+
+    // driver could reject binary (for example, after driver update), this is not an error
+    GLint Linked{false};
+    pfn_glGetProgramiv(GLSL.Program, GL_LINK_STATUS, &Linked);
+    if (!Linked) {
+        DeleteProgram(GLSL.Program);
+        GLSL.Program = 0;
+        // reset errors, if any
+        while (glGetError() != GL_NO_ERROR) {}
+        return false;
+    }
+
+    GLSL.LinkedFromBinaryCache = true;
+    return true;
+}
+
+/*
+ * Save linked program binary to cache.
+ */
+static void SaveProgramBinary(const cGLSL &GLSL)
+{
+    GLint tmpLength{0};
+    pfn_glGetProgramiv(GLSL.Program, GL_PROGRAM_BINARY_LENGTH, &tmpLength);
+    if (tmpLength <= 0) {
+        return;
+    }
+
+    std::unique_ptr<uint8_t[]> tmpBinary{new uint8_t[tmpLength]};
+    GLsizei tmpWritten{0};
+    GLenum tmpFormat{0};
+    pfn_glGetProgramBinary(GLSL.Program, tmpLength, &tmpWritten, &tmpFormat, tmpBinary.get());
+    CheckOGLError(__func__);
+    if (tmpWritten <= 0) {
+        return;
+    }
+
+    sBinaryCacheHeader tmpHeader;
+    tmpHeader.Key = GLSL.BinaryCacheKey;
+    tmpHeader.Format = tmpFormat;
+    tmpHeader.Length = static_cast<uint32_t>(tmpWritten);
+
+    std::ofstream File(GLSL.BinaryCacheFileName, std::ios::binary);
+    if (!File) {
+        std::cerr << __func__ << "(): " << "Can't open file for write: " << GLSL.BinaryCacheFileName << "\n";
+        return;
+    }
+    File.write(reinterpret_cast<const char *>(&tmpHeader), sizeof(tmpHeader));
+    File.write(reinterpret_cast<const char *>(tmpBinary.get()), tmpWritten);
+}
+
+/*
+ * Set program binary cache path (empty path - disable cache).
+ */
+void vw_SetShaderBinaryCachePath(const std::string &Path)
+{
+    BinaryCachePath = Path;
+}
+
 /*
  * Release all shaders.
  */
@@ -240,20 +415,40 @@ std::weak_ptr<cGLSL> vw_CreateShader(const std::string &ShaderName,
         return std::weak_ptr<cGLSL>{};
     }
 
-    ShadersMap.emplace(ShaderName, std::shared_ptr<cGLSL>{new cGLSL, [](cGLSL *p) {delete p;}});
-
-    // load vertex shader
+    // load shaders sources first, since we need them for program binary cache key
+    std::unique_ptr<cFILE> VertexFile{};
     if (!VertexShaderFileName.empty()) {
-        // create empty object
-        ShadersMap[ShaderName]->VertexShader = pfn_glCreateShader(GL_VERTEX_SHADER);
-
-        std::unique_ptr<cFILE> VertexFile = vw_fopen(VertexShaderFileName);
-
+        VertexFile = vw_fopen(VertexShaderFileName);
         if (!VertexFile) {
-            ShadersMap.erase(ShaderName);
             std::cerr << __func__ << "(): " << "Can't find file " << VertexShaderFileName << "\n";
             return std::weak_ptr<cGLSL>{};
         }
+    }
+    std::unique_ptr<cFILE> FragmentFile{};
+    if (!FragmentShaderFileName.empty()) {
+        FragmentFile = vw_fopen(FragmentShaderFileName);
+        if (!FragmentFile) {
+            std::cerr << __func__ << "(): " << "Can't find file " << FragmentShaderFileName << "\n";
+            return std::weak_ptr<cGLSL>{};
+        }
+    }
+
+    ShadersMap.emplace(ShaderName, std::shared_ptr<cGLSL>{new cGLSL, [](cGLSL *p) {delete p;}});
+
+    // try to restore already linked program from binary cache, compile shaders only if failed
+    if (BinaryCacheEnabled()) {
+        ShadersMap[ShaderName]->BinaryCacheFileName = BinaryCachePath + "shadercache_" + ShaderName + ".bin";
+        ShadersMap[ShaderName]->BinaryCacheKey = CalculateBinaryCacheKey(VertexFile, FragmentFile);
+        if (LoadProgramBinary(*ShadersMap[ShaderName])) {
+            std::cout << "Shader ... " << VertexShaderFileName << " " << FragmentShaderFileName << " (binary cache)\n";
+            return ShadersMap[ShaderName];
+        }
+    }
+
+    // load vertex shader
+    if (VertexFile) {
+        // create empty object
+        ShadersMap[ShaderName]->VertexShader = pfn_glCreateShader(GL_VERTEX_SHADER);
 
         const GLchar *TmpGLchar = (const GLchar *)VertexFile->GetData();
         GLint TmpGLint = (GLint)VertexFile->GetSize();
@@ -261,18 +456,10 @@ std::weak_ptr<cGLSL> vw_CreateShader(const std::string &ShaderName,
         vw_fclose(VertexFile);
     }
     // load fragment shader
-    if (!FragmentShaderFileName.empty()) {
+    if (FragmentFile) {
         // create empty object
         ShadersMap[ShaderName]->FragmentShader = pfn_glCreateShader(GL_FRAGMENT_SHADER);
 
-        std::unique_ptr<cFILE> FragmentFile = vw_fopen(FragmentShaderFileName);
-
-        if (!FragmentFile) {
-            ShadersMap.erase(ShaderName);
-            std::cerr << __func__ << "(): " << "Can't find file " << FragmentShaderFileName << "\n";
-            return std::weak_ptr<cGLSL>{};
-        }
-
         const GLchar *TmpGLchar = (const GLchar *)FragmentFile->GetData();
         GLint TmpGLint = (GLint)FragmentFile->GetSize();
         pfn_glShaderSource(ShadersMap[ShaderName]->FragmentShader, 1, &TmpGLchar, &TmpGLint);
@@ -307,6 +494,9 @@ std::weak_ptr<cGLSL> vw_CreateShader(const std::string &ShaderName,
 
     // create program
     ShadersMap[ShaderName]->Program = pfn_glCreateProgram();
+    if (!ShadersMap[ShaderName]->BinaryCacheFileName.empty()) {
+        pfn_glProgramParameteri(ShadersMap[ShaderName]->Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     if (ShadersMap[ShaderName]->VertexShader) {
         pfn_glAttachShader(ShadersMap[ShaderName]->Program, ShadersMap[ShaderName]->VertexShader);
     }
@@ -333,6 +523,14 @@ bool vw_LinkShaderProgram(std::weak_ptr<cGLSL> &GLSL)
         return false;
     }
 
+    // linking reset all uniforms to initial values
+    sharedGLSL->UniformValues.clear();
+
+    // program binary from cache already linked
+    if (sharedGLSL->LinkedFromBinaryCache) {
+        return true;
+    }
+
     pfn_glLinkProgram(sharedGLSL->Program);
     CheckOGLError(__func__);
 
@@ -340,6 +538,10 @@ bool vw_LinkShaderProgram(std::weak_ptr<cGLSL> &GLSL)
     pfn_glGetProgramiv(sharedGLSL->Program, GL_LINK_STATUS, &Linked);
     PrintProgramInfoLog(sharedGLSL->Program);
 
+    if (Linked && !sharedGLSL->BinaryCacheFileName.empty()) {
+        SaveProgramBinary(*sharedGLSL);
+    }
+
     return Linked;
 }
 
@@ -352,9 +554,19 @@ bool vw_UseShaderProgram(std::shared_ptr<cGLSL> &sharedGLSL)
         return false;
     }
 
+    sStateCache &Cache = StateCache();
+    if (Cache.ProgramKnown && Cache.Program == sharedGLSL->Program) {
+        Cache.SkippedCalls++;
+        return true;
+    }
+
     pfn_glUseProgram(sharedGLSL->Program);
     CheckOGLError(__func__);
 
+    Cache.ProgramKnown = true;
+    Cache.Program = sharedGLSL->Program;
+    CurrentGLSL = sharedGLSL;
+
     return true;
 }
 
@@ -376,9 +588,19 @@ bool vw_StopShaderProgram()
         return false;
     }
 
+    sStateCache &Cache = StateCache();
+    if (Cache.ProgramKnown && !Cache.Program) {
+        Cache.SkippedCalls++;
+        return true;
+    }
+
     pfn_glUseProgram(0);
     CheckOGLError(__func__);
 
+    Cache.ProgramKnown = true;
+    Cache.Program = 0;
+    CurrentGLSL.reset();
+
     return true;
 }
 
@@ -406,6 +628,46 @@ GLint vw_GetUniformLocation(std::weak_ptr<cGLSL> &GLSL, const std::string &Name)
     return tmpLocation;
 }
 
+/*
+ * Pack float uniform data into cache's value (bitwise, no conversion).
+ */
+static std::array<GLint, 3> UniformValue(float data1, float data2 = 0.0f, float data3 = 0.0f)
+{
+    static_assert(sizeof(GLint) == sizeof(float), "GLint and float should have same size.");
+
+    std::array<GLint, 3> tmpValue;
+    memcpy(&tmpValue[0], &data1, sizeof(float));
+    memcpy(&tmpValue[1], &data2, sizeof(float));
+    memcpy(&tmpValue[2], &data3, sizeof(float));
+    return tmpValue;
+}
+
+/*
+ * Check, if uniform location of current program object already have this value.
+ * Store new value in cache, if value should be changed.
+ */
+static bool IsUniformValueCached(GLint UniformLocation, const std::array<GLint, 3> &Value)
+{
+    sStateCache &Cache = StateCache();
+    if (UniformLocation == -1 || !Cache.ProgramKnown || !Cache.Program) {
+        return false;
+    }
+
+    auto sharedGLSL = CurrentGLSL.lock();
+    if (!sharedGLSL || sharedGLSL->Program != Cache.Program) {
+        return false;
+    }
+
+    auto iter = sharedGLSL->UniformValues.find(UniformLocation);
+    if (iter != sharedGLSL->UniformValues.end() && iter->second == Value) {
+        Cache.SkippedCalls++;
+        return true;
+    }
+
+    sharedGLSL->UniformValues[UniformLocation] = Value;
+    return false;
+}
+
 /*
  * Specify the value of a uniform variable for the current program object.
  */
@@ -415,6 +677,10 @@ bool vw_Uniform1i(GLint UniformLocation, int data)
         return false;
     }
 
+    if (IsUniformValueCached(UniformLocation, std::array<GLint, 3>{{data, 0, 0}})) {
+        return true;
+    }
+
     pfn_glUniform1i(UniformLocation, data);
     CheckOGLError(__func__);
 
@@ -430,6 +696,10 @@ bool vw_Uniform1f(GLint UniformLocation, float data)
         return false;
     }
 
+    if (IsUniformValueCached(UniformLocation, UniformValue(data))) {
+        return true;
+    }
+
     pfn_glUniform1f(UniformLocation, data);
     CheckOGLError(__func__);
 
@@ -445,6 +715,10 @@ bool vw_Uniform3f(GLint UniformLocation, float data1, float data2, float data3)
         return false;
     }
 
+    if (IsUniformValueCached(UniformLocation, UniformValue(data1, data2, data3))) {
+        return true;
+    }
+
     pfn_glUniform3f(UniformLocation, data1, data2, data3);
     CheckOGLError(__func__);
 
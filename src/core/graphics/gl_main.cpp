@@ -187,6 +187,16 @@ bool vw_CreateOpenGLContext(int VSync)
     DevCaps.ARB_texture_compression_bptc = ExtensionSupported("GL_ARB_texture_compression_bptc");
     DevCaps.ARB_texture_non_power_of_two = ExtensionSupported("GL_ARB_texture_non_power_of_two");
     DevCaps.SGIS_generate_mipmap = ExtensionSupported("GL_SGIS_generate_mipmap");
+    DevCaps.ARB_timer_query = ExtensionSupported("GL_ARB_timer_query") && Initialize_GL_ARB_timer_query();
+    DevCaps.ARB_pixel_buffer_object = DevCaps.OpenGL_1_5_supported
+                                      && (DevCaps.OpenGL_2_1_supported || ExtensionSupported("GL_ARB_pixel_buffer_object"));
+    DevCaps.ARB_get_program_binary = ExtensionSupported("GL_ARB_get_program_binary") && Initialize_GL_ARB_get_program_binary();
+    if (DevCaps.ARB_get_program_binary) {
+        // extension could be exposed, but without any binary formats supported by driver
+        GLint tmpFormatsCount{0};
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &tmpFormatsCount);
+        DevCaps.ARB_get_program_binary = (tmpFormatsCount > 0);
+    }
 
     if (ExtensionSupported("GL_EXT_texture_filter_anisotropic")) {
         glGetIntegerv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &DevCaps.MaxAnisotropyLevel);
@@ -282,6 +292,8 @@ void vw_InitOpenGLStuff(int Width, int Height, int *MSAA, int *CSAA)
     glHint(GL_POINT_SMOOTH_HINT, GL_NICEST);
     glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
     glHint(GL_POLYGON_SMOOTH_HINT, GL_NICEST);
+    // state was changed directly (or context was recreated), drop all cached state
+    vw_InvalidateStateCache();
 
     if (DevCaps.OpenGL_3_0_supported) {
         MainFBO = vw_BuildFBO(Width, Height, true, true, *MSAA, CSAA);
@@ -306,6 +318,7 @@ void vw_InitOpenGLStuff(int Width, int Height, int *MSAA, int *CSAA)
 void vw_ReleaseOpenGLStuff()
 {
     vw_ReleaseAllShaders();
+    Capture_Release();
 
     MainFBO.reset();
     ResolveFBO.reset();
@@ -396,7 +409,10 @@ void vw_EndRendering()
 
     assert(SDLWindow);
 
+    Capture_EndFrame();
     SDL_GL_SwapWindow(SDLWindow);
+
+    StateCache_EndFrame();
 }
 
 /*
@@ -500,13 +516,32 @@ void vw_GetViewport(int *x, int *y, int *width, int *height)
  */
 void vw_CullFace(eCullFace mode)
 {
-    if (mode == eCullFace::NONE) {
-        glDisable(GL_CULL_FACE);
+    sStateCache &Cache = StateCache();
+    bool tmpCullFace = (mode != eCullFace::NONE);
+    if (Cache.CullFaceKnown && Cache.CullFace == tmpCullFace) {
+        Cache.SkippedCalls++;
+    } else {
+        if (tmpCullFace) {
+            glEnable(GL_CULL_FACE);
+        } else {
+            glDisable(GL_CULL_FACE);
+        }
+        Cache.CullFaceKnown = true;
+        Cache.CullFace = tmpCullFace;
+    }
+
+    if (!tmpCullFace) {
+        return;
+    }
+
+    if (Cache.CullFaceModeKnown && Cache.CullFaceMode == static_cast<GLenum>(mode)) {
+        Cache.SkippedCalls++;
         return;
     }
 
-    glEnable(GL_CULL_FACE);
     glCullFace(static_cast<GLenum>(mode));
+    Cache.CullFaceModeKnown = true;
+    Cache.CullFaceMode = static_cast<GLenum>(mode);
 }
 
 /*
@@ -552,12 +587,31 @@ void vw_SetColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean a
  */
 void vw_DepthTest(bool mode, eCompareFunc func)
 {
-    if (mode) {
-        glEnable(GL_DEPTH_TEST);
-        glDepthFunc(static_cast<GLenum>(func));
+    sStateCache &Cache = StateCache();
+    if (Cache.DepthTestKnown && Cache.DepthTest == mode) {
+        Cache.SkippedCalls++;
     } else {
-        glDisable(GL_DEPTH_TEST);
+        if (mode) {
+            glEnable(GL_DEPTH_TEST);
+        } else {
+            glDisable(GL_DEPTH_TEST);
+        }
+        Cache.DepthTestKnown = true;
+        Cache.DepthTest = mode;
+    }
+
+    if (!mode) {
+        return;
     }
+
+    if (Cache.DepthFuncKnown && Cache.DepthFunc == static_cast<GLenum>(func)) {
+        Cache.SkippedCalls++;
+        return;
+    }
+
+    glDepthFunc(static_cast<GLenum>(func));
+    Cache.DepthFuncKnown = true;
+    Cache.DepthFunc = static_cast<GLenum>(func);
 }
 
 } // viewizard namespace
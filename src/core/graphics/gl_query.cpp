@@ -0,0 +1,93 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+#include "graphics.h"
+#include "extensions.h"
+
+namespace viewizard {
+
+/*
+ * Generate timer query objects.
+ */
+bool vw_GenTimerQueries(GLsizei Count, GLuint *Queries)
+{
+    if (!Queries || !pfn_glGenQueries) {
+        return false;
+    }
+
+    pfn_glGenQueries(Count, Queries);
+    return true;
+}
+
+/*
+ * Delete timer query objects.
+ */
+void vw_DeleteTimerQueries(GLsizei Count, const GLuint *Queries)
+{
+    if (!Queries || !pfn_glDeleteQueries) {
+        return;
+    }
+
+    pfn_glDeleteQueries(Count, Queries);
+}
+
+/*
+ * Record GPU timestamp into query object (when all previous commands are completed).
+ */
+void vw_QueryTimestamp(GLuint Query)
+{
+    if (!Query || !pfn_glQueryCounter) {
+        return;
+    }
+
+    pfn_glQueryCounter(Query, GL_TIMESTAMP);
+}
+
+/*
+ * Get GPU timestamp (in nanoseconds) from query object.
+ * Return false, if result is not available yet (and we don't wait for it).
+ */
+bool vw_GetTimestampQueryResult(GLuint Query, uint64_t &Timestamp, bool Wait)
+{
+    if (!Query || !pfn_glGetQueryObjectiv || !pfn_glGetQueryObjectui64v) {
+        return false;
+    }
+
+    if (!Wait) {
+        GLint Available{GL_FALSE};
+        pfn_glGetQueryObjectiv(Query, GL_QUERY_RESULT_AVAILABLE, &Available);
+        if (Available == GL_FALSE) {
+            return false;
+        }
+    }
+
+    GLuint64 tmpTimestamp{0};
+    pfn_glGetQueryObjectui64v(Query, GL_QUERY_RESULT, &tmpTimestamp);
+    Timestamp = static_cast<uint64_t>(tmpTimestamp);
+    return true;
+}
+
+} // viewizard namespace
@@ -0,0 +1,107 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE all cached state is changed through vw_* functions only, if some code
+//      changes OpenGL state directly, vw_InvalidateStateCache() should be called
+
+#include "graphics_internal.h"
+#include "graphics.h"
+
+namespace viewizard {
+
+namespace {
+
+sStateCache StateCacheData{};
+// skipped calls counted for previous frame
+unsigned LastFrameSkippedCalls{0};
+
+} // unnamed namespace
+
+
+/*
+ * Internal access to OpenGL state cache.
+ */
+sStateCache &StateCache()
+{
+    return StateCacheData;
+}
+
+/*
+ * Invalidate cached textures binding for all texture units.
+ */
+void StateCache_InvalidateTextures()
+{
+    for (unsigned i = 0; i < StateCacheTextureUnits; i++) {
+        StateCacheData.TextureKnown[i] = false;
+    }
+}
+
+/*
+ * Invalidate cached state, that could be changed by glPopAttrib(GL_ENABLE_BIT).
+ */
+void StateCache_InvalidateEnables()
+{
+    // GL_TEXTURE_2D status is cached together with texture binding
+    StateCache_InvalidateTextures();
+    StateCacheData.AlphaTestKnown = false;
+    StateCacheData.BlendKnown = false;
+    StateCacheData.CullFaceKnown = false;
+    StateCacheData.DepthTestKnown = false;
+}
+
+/*
+ * Finish frame's skipped calls counting.
+ */
+void StateCache_EndFrame()
+{
+    LastFrameSkippedCalls = StateCacheData.SkippedCalls;
+    StateCacheData.SkippedCalls = 0;
+}
+
+/*
+ * Invalidate OpenGL state cache.
+ */
+void vw_InvalidateStateCache()
+{
+    StateCache_InvalidateEnables();
+    StateCacheData.ActiveTextureUnitKnown = false;
+    StateCacheData.AlphaFuncKnown = false;
+    StateCacheData.BlendFuncKnown = false;
+    StateCacheData.CullFaceModeKnown = false;
+    StateCacheData.DepthFuncKnown = false;
+    StateCacheData.ProgramKnown = false;
+}
+
+/*
+ * Get number of redundant OpenGL calls, skipped by state cache during previous frame.
+ */
+unsigned vw_GetStateCacheSkippedCalls()
+{
+    return LastFrameSkippedCalls;
+}
+
+} // viewizard namespace
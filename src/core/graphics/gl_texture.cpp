@@ -138,9 +138,19 @@ GLtexture vw_BuildTexture(const std::unique_ptr<uint8_t[]> &PixelsArray,
  */
 void vw_SelectActiveTextureUnit(GLenum Unit)
 {
-    if (pfn_glActiveTexture) {
-        pfn_glActiveTexture(GL_TEXTURE0 + Unit);
+    if (!pfn_glActiveTexture) {
+        return;
+    }
+
+    sStateCache &Cache = StateCache();
+    if (Cache.ActiveTextureUnitKnown && Cache.ActiveTextureUnit == Unit) {
+        Cache.SkippedCalls++;
+        return;
     }
+
+    pfn_glActiveTexture(GL_TEXTURE0 + Unit);
+    Cache.ActiveTextureUnitKnown = true;
+    Cache.ActiveTextureUnit = Unit;
 }
 
 /*
@@ -150,6 +160,16 @@ void vw_BindTexture(GLenum Unit, GLtexture TextureID)
 {
     vw_SelectActiveTextureUnit(Unit);
 
+    sStateCache &Cache = StateCache();
+    if (Unit < StateCacheTextureUnits) {
+        if (Cache.TextureKnown[Unit] && Cache.Texture[Unit] == TextureID) {
+            Cache.SkippedCalls += 2; // glBindTexture() + glEnable()/glDisable()
+            return;
+        }
+        Cache.TextureKnown[Unit] = true;
+        Cache.Texture[Unit] = TextureID;
+    }
+
     if (TextureID) {
         glBindTexture(GL_TEXTURE_2D, TextureID);
         glEnable(GL_TEXTURE_2D);
@@ -165,6 +185,15 @@ void vw_BindTexture(GLenum Unit, GLtexture TextureID)
 void vw_DeleteTexture(GLtexture TextureID)
 {
     glDeleteTextures(1, &TextureID);
+
+    // deleted texture reverts binding to zero, but don't change GL_TEXTURE_2D status,
+    // in any case, texture name could be reused by next glGenTextures() call
+    sStateCache &Cache = StateCache();
+    for (unsigned i = 0; i < StateCacheTextureUnits; i++) {
+        if (Cache.Texture[i] == TextureID) {
+            Cache.TextureKnown[i] = false;
+        }
+    }
 }
 
 /*
@@ -236,14 +265,32 @@ void vw_SetTextureAddressMode(const sTextureWrap &wrap)
  */
 void vw_SetTextureAlphaTest(bool flag, eCompareFunc func, GLclampf ref)
 {
+    // ignore parameters and setup initial values, if alpha test disabled
+    GLenum tmpFunc = flag ? static_cast<GLenum>(func) : GL_ALWAYS;
+    GLclampf tmpRef = flag ? ref : 0.0f;
+
+    sStateCache &Cache = StateCache();
+    if (Cache.AlphaFuncKnown && Cache.AlphaFunc == tmpFunc && Cache.AlphaRef == tmpRef) {
+        Cache.SkippedCalls++;
+    } else {
+        glAlphaFunc(tmpFunc, tmpRef);
+        Cache.AlphaFuncKnown = true;
+        Cache.AlphaFunc = tmpFunc;
+        Cache.AlphaRef = tmpRef;
+    }
+
+    if (Cache.AlphaTestKnown && Cache.AlphaTest == flag) {
+        Cache.SkippedCalls++;
+        return;
+    }
+
     if (flag) {
-        glAlphaFunc(static_cast<GLenum>(func), ref);
         glEnable(GL_ALPHA_TEST);
     } else {
-        // ignore parameters and setup initial values
-        glAlphaFunc(GL_ALWAYS, 0);
         glDisable(GL_ALPHA_TEST);
     }
+    Cache.AlphaTestKnown = true;
+    Cache.AlphaTest = flag;
 }
 
 /*
@@ -251,15 +298,32 @@ void vw_SetTextureAlphaTest(bool flag, eCompareFunc func, GLclampf ref)
  */
 void vw_SetTextureBlend(bool flag, eTextureBlendFactor sfactor, eTextureBlendFactor dfactor)
 {
-    if (!flag) {
-        glDisable(GL_BLEND);
-        // ignore parameters and setup initial values
-        glBlendFunc(GL_ONE, GL_ZERO);
+    sStateCache &Cache = StateCache();
+    if (Cache.BlendKnown && Cache.Blend == flag) {
+        Cache.SkippedCalls++;
+    } else {
+        if (flag) {
+            glEnable(GL_BLEND);
+        } else {
+            glDisable(GL_BLEND);
+        }
+        Cache.BlendKnown = true;
+        Cache.Blend = flag;
+    }
+
+    // ignore parameters and setup initial values, if blending disabled
+    GLenum tmpSFactor = flag ? static_cast<GLenum>(sfactor) : GL_ONE;
+    GLenum tmpDFactor = flag ? static_cast<GLenum>(dfactor) : GL_ZERO;
+
+    if (Cache.BlendFuncKnown && Cache.BlendSFactor == tmpSFactor && Cache.BlendDFactor == tmpDFactor) {
+        Cache.SkippedCalls++;
         return;
     }
 
-    glEnable(GL_BLEND);
-    glBlendFunc(static_cast<GLenum>(sfactor), static_cast<GLenum>(dfactor));
+    glBlendFunc(tmpSFactor, tmpDFactor);
+    Cache.BlendFuncKnown = true;
+    Cache.BlendSFactor = tmpSFactor;
+    Cache.BlendDFactor = tmpDFactor;
 }
 
 /*
@@ -355,6 +355,9 @@ struct sDevCaps {
     bool ARB_texture_compression_bptc{false}; // note, bptc also part of OpenGL 4.2
     bool ARB_texture_non_power_of_two{false};
     bool SGIS_generate_mipmap{false};
+    bool ARB_timer_query{false}; // note, timer query also part of OpenGL 3.3
+    bool ARB_pixel_buffer_object{false}; // note, pixel buffer object also part of OpenGL 2.1
+    bool ARB_get_program_binary{false}; // note, program binary also part of OpenGL 4.1
 };
 
 // Buffer clear bit
@@ -445,6 +448,15 @@ void vw_DepthTest(bool mode, eCompareFunc func);
 // Set the scale and units used to calculate depth values.
 void vw_PolygonOffset(bool status, GLfloat factor, GLfloat units);
 
+/*
+ * gl_state
+ */
+
+// Invalidate OpenGL state cache, should be called if state was changed directly, not through vw_* functions.
+void vw_InvalidateStateCache();
+// Get number of redundant OpenGL calls, skipped by state cache during previous frame.
+unsigned vw_GetStateCacheSkippedCalls();
+
 /*
  * gl_texture
  */
@@ -588,6 +600,8 @@ void vw_BindFBO(std::shared_ptr<sFBO> &FBO);
 std::weak_ptr<sFBO> &vw_GetCurrentFBO();
 // Blit color part of source FBO to target FBO (need this one in order to work with multi samples).
 void vw_BlitFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetFBO);
+// Blit depth part of source FBO to target FBO (FBOs should have same size and depth format).
+void vw_BlitDepthFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetFBO);
 // Draw source FBO (color texture) to target FBO (if null, to FrameBuffer).
 void vw_DrawColorFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetFBO);
 
@@ -601,6 +615,8 @@ struct cGLSL;
 std::weak_ptr<cGLSL> vw_CreateShader(const std::string &ShaderName,
                                      const std::string &VertexShaderFileName,
                                      const std::string &FragmentShaderFileName);
+// Set program binary cache path (empty path - disable cache).
+void vw_SetShaderBinaryCachePath(const std::string &Path);
 // Release all shaders.
 void vw_ReleaseAllShaders();
 // Check, is shaders Map empty.
@@ -632,20 +648,105 @@ bool vw_Uniform3f(GLint UniformLocation, float data1, float data2, float data3);
  * gl_draw2d
  */
 
+// Texture region (sub-image in texture atlas page), origin is upper left corner.
+struct sTextureRegion {
+    GLtexture Texture{0};
+    int OffsetX{0};
+    int OffsetY{0};
+
+    sTextureRegion() = default;
+    explicit sTextureRegion(GLtexture _Texture, int _OffsetX = 0, int _OffsetY = 0) :
+        Texture{_Texture},
+        OffsetX{_OffsetX},
+        OffsetY{_OffsetY}
+    {}
+};
+
+// 2D draw list batch (quads with same texture and blending).
+struct sDrawList2DBatch {
+    GLtexture Texture{0};
+    bool Alpha{false};
+    // batch bounding box
+    float MinX{0.0f};
+    float MinY{0.0f};
+    float MaxX{0.0f};
+    float MaxY{0.0f};
+    // RI_2f_XY | RI_4f_COLOR | RI_1_TEX, 4 vertices per quad
+    std::vector<float> Vertices{};
+};
+
+// 2D draw list, could be stored by caller and replayed in next frames (retained mode).
+struct sDrawList2D {
+    std::vector<sDrawList2DBatch> Batches{};
+    // used batches count, we don't release batches memory on clear
+    unsigned BatchesCount{0};
+
+    void Clear()
+    {
+        for (unsigned i = 0; i < BatchesCount; i++) {
+            Batches[i].Vertices.clear();
+        }
+        BatchesCount = 0;
+    }
+    bool empty() const
+    {
+        return !BatchesCount;
+    }
+};
+
 // Switch to 2D rendering mode. Origin is upper left corner.
+// All vw_Draw2D() and vw_DrawTextUTF32() calls will be collected into frame draw list.
 void vw_Start2DMode(GLdouble zNear, GLdouble zFar);
-// Switch back to 3D rendering mode.
+// Switch back to 3D rendering mode (draw frame draw list).
 void vw_End2DMode();
 // Draw transparent. Origin is upper left corner.
 void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bool Alpha, float Transp = 1.0f,
                float RotateAngle = 0.0f, const sRGBCOLOR &Color = sRGBCOLOR{eRGBCOLOR::white});
+// Draw texture region (SrcRect is relative to region). Origin is upper left corner.
+void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, const sTextureRegion &Region, bool Alpha,
+               float Transp = 1.0f, float RotateAngle = 0.0f,
+               const sRGBCOLOR &Color = sRGBCOLOR{eRGBCOLOR::white});
+// Check, are we collecting 2D quads into draw list now.
+bool vw_DrawList2DRecording();
+// Add quad into current draw list. Quad is 4 vertices (X, Y, U, V) in
+// left-top, left-bottom, right-bottom, right-top order.
+void vw_AddQuadToDrawList2D(GLtexture Texture, bool Alpha, const sRGBCOLOR &Color, float Transp,
+                            const float (&Quad)[16]);
+// Start collecting vw_Draw2D() and vw_DrawTextUTF32() quads into provided draw list.
+void vw_BeginDrawList2D(sDrawList2D &DrawList);
+// Stop collecting quads into provided draw list, switch back to frame draw list.
+void vw_EndDrawList2D();
+// Add stored draw list into frame draw list.
+void vw_AddDrawList2D(const sDrawList2D &DrawList);
+// Draw and clear frame draw list (should be called before direct rendering in 2D mode).
+void vw_FlushDrawList2D();
+
+/*
+ * gl_query
+ */
+
+// Generate timer query objects.
+bool vw_GenTimerQueries(GLsizei Count, GLuint *Queries);
+// Delete timer query objects.
+void vw_DeleteTimerQueries(GLsizei Count, const GLuint *Queries);
+// Record GPU timestamp into query object (when all previous commands are completed).
+void vw_QueryTimestamp(GLuint Query);
+// Get GPU timestamp (in nanoseconds) from query object.
+bool vw_GetTimestampQueryResult(GLuint Query, uint64_t &Timestamp, bool Wait);
 
 /*
  * misc
  */
 
-// Create screenshot from current OpenGL surface.
+// Create screenshot from current OpenGL surface (captured at the end of frame,
+// file is written asynchronously).
 int vw_Screenshot(int Width, int Height, const std::string &FileName);
+// Start recording of FramesCount frames into Directory as BMP files.
+bool vw_StartFramesRecording(int Width, int Height, const std::string &Directory, unsigned FramesCount);
+// Stop frames recording.
+void vw_StopFramesRecording();
+// Check, if frames recording is active.
+bool vw_IsFramesRecording();
 
 } // viewizard namespace
 
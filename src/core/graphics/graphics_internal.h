@@ -53,6 +53,68 @@ void Draw3D_EnableStates(int DataFormat, GLvoid *VertexArray,
                          GLsizei stride, GLuint VertexBO, GLuint IndexBO);
 void Draw3D_DisableStates(int DataFormat, GLuint VertexBO, GLuint IndexBO);
 
+/*
+ * gl_state
+ */
+
+// Texture units, covered by state cache (other units are not cached).
+constexpr unsigned StateCacheTextureUnits{16};
+
+// Cached OpenGL state, each value is valid only if related "Known" flag is set.
+struct sStateCache {
+    bool ActiveTextureUnitKnown{false};
+    GLenum ActiveTextureUnit{0};
+    // texture binding and GL_TEXTURE_2D status (enabled for non zero texture)
+    bool TextureKnown[StateCacheTextureUnits]{};
+    GLtexture Texture[StateCacheTextureUnits]{};
+
+    bool AlphaTestKnown{false};
+    bool AlphaTest{false};
+    bool AlphaFuncKnown{false};
+    GLenum AlphaFunc{GL_ALWAYS};
+    GLclampf AlphaRef{0.0f};
+
+    bool BlendKnown{false};
+    bool Blend{false};
+    bool BlendFuncKnown{false};
+    GLenum BlendSFactor{GL_ONE};
+    GLenum BlendDFactor{GL_ZERO};
+
+    bool CullFaceKnown{false};
+    bool CullFace{false};
+    bool CullFaceModeKnown{false};
+    GLenum CullFaceMode{GL_BACK};
+
+    bool DepthTestKnown{false};
+    bool DepthTest{false};
+    bool DepthFuncKnown{false};
+    GLenum DepthFunc{GL_LESS};
+
+    bool ProgramKnown{false};
+    GLuint Program{0};
+
+    // redundant calls, skipped during current frame
+    unsigned SkippedCalls{0};
+};
+
+// Internal access to OpenGL state cache.
+sStateCache &StateCache();
+// Invalidate cached textures binding for all texture units.
+void StateCache_InvalidateTextures();
+// Invalidate cached state, that could be changed by glPopAttrib(GL_ENABLE_BIT).
+void StateCache_InvalidateEnables();
+// Finish frame's skipped calls counting.
+void StateCache_EndFrame();
+
+/*
+ * misc
+ */
+
+// Capture requested frame and read back previous frames (before buffers swap).
+void Capture_EndFrame();
+// Read back pending frames, release PBOs and stop worker thread.
+void Capture_Release();
+
 } // viewizard namespace
 
 #endif // CORE_GRAPHICS_GRAPHICSINTERNAL_H
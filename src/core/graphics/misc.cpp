@@ -25,50 +25,443 @@
 
 *****************************************************************************/
 
-// NOTE in future, use make_unique() to make unique_ptr-s (since C++14)
+/*
+Screenshots and frames recording.
+
+Pixels are read back asynchronously: glReadPixels() copies back buffer into one of
+the pixel buffer objects ring, and this PBO is mapped only 2 frames later, when GPU
+already finished with it, so, rendering don't stall on read back. Mapped pixels are
+copied and passed to worker thread, that write BMP files. If pixel buffer objects are
+not supported, read back is synchronous, but files are still written by worker thread.
+
+Since OpenGL read back bottom-up rows in BGR order with 4 bytes row alignment, same
+as BMP format stores pixels, we write read back data as is, without any conversion.
+*/
 
 #include "graphics.h"
+#include "graphics_internal.h"
+#include "extensions.h"
 #include "SDL2/SDL.h"
-#include <string.h>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
 
 namespace viewizard {
 
+namespace {
+
+// PBOs ring size, frame is mapped in (PBORingSize - 1) frames after read back request
+constexpr unsigned PBORingSize{3};
+// max pending jobs for worker thread, frames are dropped if disk can't keep pace
+constexpr unsigned MaxPendingJobs{64};
+// BMP file header (14 bytes) + BITMAPINFOHEADER (40 bytes)
+constexpr unsigned BMPHeadersSize{54};
+
+struct sCaptureRequest {
+    int Width{0};
+    int Height{0};
+    std::string FileName{};
+
+    sCaptureRequest() = default;
+    explicit sCaptureRequest(int _Width, int _Height, const std::string &_FileName) :
+        Width{_Width},
+        Height{_Height},
+        FileName{_FileName}
+    {}
+};
+
+struct sCaptureJob {
+    sCaptureRequest Request{};
+    std::unique_ptr<uint8_t[]> Pixels{};
+};
+
+struct sPBOSlot {
+    GLuint PBO{0};
+    GLsizeiptr Size{0};
+    bool Pending{false};
+    sCaptureRequest Request{};
+};
+
+struct sRecording {
+    bool Active{false};
+    int Width{0};
+    int Height{0};
+    std::string Directory{};
+    unsigned FramesCount{0};
+    unsigned FramesRecorded{0};
+};
+
+std::array<sPBOSlot, PBORingSize> PBORing{};
+unsigned PBORingHead{0};
+unsigned PBOPendingCount{0};
+
+bool ScreenshotRequested{false};
+sCaptureRequest ScreenshotRequest{};
+sRecording Recording{};
+// frames, dropped since recording start, because worker thread queue was full
+unsigned DroppedFrames{0};
+
+SDL_Thread *WorkerThread{nullptr};
+SDL_mutex *WorkerMutex{nullptr};
+SDL_cond *WorkerCondition{nullptr};
+std::deque<sCaptureJob> WorkerJobs{};
+bool WorkerQuit{false};
+
+} // unnamed namespace
+
+
+/*
+ * Calculate row size in bytes with 4 bytes alignment (GL_PACK_ALIGNMENT and BMP).
+ */
+static inline GLsizeiptr RowSize(int Width)
+{
+    return (3 * Width + 3) & ~3;
+}
+
+/*
+ * Write little endian value into buffer.
+ */
+static inline void WriteLE(uint8_t *Buffer, uint32_t Value, unsigned Bytes)
+{
+    for (unsigned i = 0; i < Bytes; i++) {
+        Buffer[i] = static_cast<uint8_t>(Value >> (8 * i));
+    }
+}
+
+/*
+ * Write 24 bits BMP file from bottom-up BGR pixels with aligned rows.
+ */
+static void WriteBMP(const sCaptureJob &Job)
+{
+    uint32_t ImageSize = static_cast<uint32_t>(RowSize(Job.Request.Width) * Job.Request.Height);
+
+    std::array<uint8_t, BMPHeadersSize> Headers{};
+    Headers[0] = 'B';
+    Headers[1] = 'M';
+    WriteLE(&Headers[2], BMPHeadersSize + ImageSize, 4); // file size
+    WriteLE(&Headers[10], BMPHeadersSize, 4); // pixels offset
+    WriteLE(&Headers[14], 40, 4); // BITMAPINFOHEADER size
+    WriteLE(&Headers[18], static_cast<uint32_t>(Job.Request.Width), 4);
+    WriteLE(&Headers[22], static_cast<uint32_t>(Job.Request.Height), 4); // positive, bottom-up
+    WriteLE(&Headers[26], 1, 2); // planes
+    WriteLE(&Headers[28], 24, 2); // bits per pixel
+    WriteLE(&Headers[34], ImageSize, 4);
+
+    std::ofstream File(Job.Request.FileName, std::ios::binary);
+    if (!File) {
+        std::cerr << __func__ << "(): " << "Can't open file for write: " << Job.Request.FileName << "\n";
+        return;
+    }
+
+    File.write(reinterpret_cast<const char *>(Headers.data()), Headers.size());
+    File.write(reinterpret_cast<const char *>(Job.Pixels.get()), ImageSize);
+}
+
+/*
+ * Worker thread, write queued frames until quit requested and queue is empty.
+ */
+static int CaptureWorker(void */*Data*/)
+{
+    SDL_LockMutex(WorkerMutex);
+    for (;;) {
+        while (WorkerJobs.empty() && !WorkerQuit) {
+            SDL_CondWait(WorkerCondition, WorkerMutex);
+        }
+        if (WorkerJobs.empty()) {
+            break;
+        }
+
+        sCaptureJob tmpJob{std::move(WorkerJobs.front())};
+        WorkerJobs.pop_front();
+
+        SDL_UnlockMutex(WorkerMutex);
+        WriteBMP(tmpJob);
+        SDL_LockMutex(WorkerMutex);
+    }
+    SDL_UnlockMutex(WorkerMutex);
+
+    return 0;
+}
+
+/*
+ * Start worker thread, if not started yet.
+ */
+static bool StartWorker()
+{
+    if (WorkerThread) {
+        return true;
+    }
+
+    WorkerMutex = SDL_CreateMutex();
+    WorkerCondition = SDL_CreateCond();
+    if (WorkerMutex && WorkerCondition) {
+        WorkerQuit = false;
+        WorkerThread = SDL_CreateThread(CaptureWorker, "CaptureWorker", nullptr);
+    }
+
+    if (!WorkerThread) {
+        std::cerr << __func__ << "(): " << "Can't create capture worker thread: " << SDL_GetError() << "\n";
+        if (WorkerCondition) {
+            SDL_DestroyCond(WorkerCondition);
+            WorkerCondition = nullptr;
+        }
+        if (WorkerMutex) {
+            SDL_DestroyMutex(WorkerMutex);
+            WorkerMutex = nullptr;
+        }
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Stop worker thread, all queued frames will be written before.
+ */
+static void StopWorker()
+{
+    if (!WorkerThread) {
+        return;
+    }
+
+    SDL_LockMutex(WorkerMutex);
+    WorkerQuit = true;
+    SDL_CondSignal(WorkerCondition);
+    SDL_UnlockMutex(WorkerMutex);
+
+    SDL_WaitThread(WorkerThread, nullptr);
+    WorkerThread = nullptr;
+
+    SDL_DestroyCond(WorkerCondition);
+    WorkerCondition = nullptr;
+    SDL_DestroyMutex(WorkerMutex);
+    WorkerMutex = nullptr;
+}
+
+/*
+ * Pass frame to worker thread (or write it directly, if worker thread not available).
+ */
+static void QueueJob(sCaptureJob &&Job)
+{
+    if (!StartWorker()) {
+        WriteBMP(Job);
+        return;
+    }
+
+    SDL_LockMutex(WorkerMutex);
+    if (WorkerJobs.size() < MaxPendingJobs) {
+        WorkerJobs.emplace_back(std::move(Job));
+        SDL_CondSignal(WorkerCondition);
+    } else {
+        DroppedFrames++;
+    }
+    SDL_UnlockMutex(WorkerMutex);
+}
+
+/*
+ * Check, if we could use pixel buffer objects for read back.
+ */
+static bool PBOSupported()
+{
+    return vw_DevCaps().ARB_pixel_buffer_object;
+}
+
+/*
+ * Map PBO with finished read back and pass pixels to worker thread.
+ */
+static void ReadBackSlot(sPBOSlot &Slot)
+{
+    Slot.Pending = false;
+    PBOPendingCount--;
+
+    pfn_glBindBuffer(GL_PIXEL_PACK_BUFFER, Slot.PBO);
+    const GLvoid *tmpData = pfn_glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    if (tmpData) {
+        // std::unique_ptr, we need only memory allocation without container's features
+        // don't use std::vector here, since it allocates AND value-initializes
+        sCaptureJob tmpJob{};
+        tmpJob.Pixels.reset(new uint8_t[Slot.Size]);
+        memcpy(tmpJob.Pixels.get(), tmpData, Slot.Size);
+        pfn_glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        tmpJob.Request = std::move(Slot.Request);
+        QueueJob(std::move(tmpJob));
+    } else {
+        DroppedFrames++;
+    }
+    pfn_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+/*
+ * Request read back for current frame.
+ */
+static void RequestReadBack(sCaptureRequest &&Request)
+{
+    GLsizeiptr tmpSize = RowSize(Request.Width) * Request.Height;
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+    if (!PBOSupported()) {
+        sCaptureJob tmpJob{};
+        tmpJob.Pixels.reset(new uint8_t[tmpSize]);
+        glReadPixels(0, 0, Request.Width, Request.Height, GL_BGR, GL_UNSIGNED_BYTE, tmpJob.Pixels.get());
+        tmpJob.Request = std::move(Request);
+        QueueJob(std::move(tmpJob));
+        return;
+    }
+
+    sPBOSlot &Slot = PBORing[PBORingHead];
+    // should be mapped on previous frame, but in case of ring misuse, don't lose frame
+    if (Slot.Pending) {
+        ReadBackSlot(Slot);
+    }
+
+    if (!Slot.PBO) {
+        pfn_glGenBuffers(1, &Slot.PBO);
+    }
+    pfn_glBindBuffer(GL_PIXEL_PACK_BUFFER, Slot.PBO);
+    if (Slot.Size != tmpSize) {
+        pfn_glBufferData(GL_PIXEL_PACK_BUFFER, tmpSize, nullptr, GL_STREAM_READ);
+        Slot.Size = tmpSize;
+    }
+    // with bound PBO, last parameter is offset in buffer, and call returns immediately
+    glReadPixels(0, 0, Request.Width, Request.Height, GL_BGR, GL_UNSIGNED_BYTE, nullptr);
+    pfn_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    Slot.Request = std::move(Request);
+    Slot.Pending = true;
+    PBOPendingCount++;
+}
+
+/*
+ * Capture current frame, if requested, and read back previous frames (should be
+ * called before buffers swap).
+ */
+void Capture_EndFrame()
+{
+    if (!ScreenshotRequested
+        && !Recording.Active
+        && !PBOPendingCount) {
+        return;
+    }
+
+    // slot for the next frame was requested (PBORingSize - 1) frames ago
+    if (PBOSupported()) {
+        sPBOSlot &Slot = PBORing[(PBORingHead + 1) % PBORingSize];
+        if (Slot.Pending) {
+            ReadBackSlot(Slot);
+        }
+    }
+
+    if (ScreenshotRequested) {
+        ScreenshotRequested = false;
+        RequestReadBack(std::move(ScreenshotRequest));
+    } else if (Recording.Active) {
+        std::array<char, 32> tmpBuffer;
+        snprintf(tmpBuffer.data(), tmpBuffer.size(), "frame_%06u.bmp", Recording.FramesRecorded);
+        RequestReadBack(sCaptureRequest{Recording.Width, Recording.Height,
+                                        Recording.Directory + tmpBuffer.data()});
+
+        Recording.FramesRecorded++;
+        if (Recording.FramesRecorded >= Recording.FramesCount) {
+            vw_StopFramesRecording();
+        }
+    }
+
+    PBORingHead = (PBORingHead + 1) % PBORingSize;
+}
+
+/*
+ * Read back all pending frames, release PBOs and stop worker thread.
+ */
+void Capture_Release()
+{
+    for (auto &tmpSlot : PBORing) {
+        if (tmpSlot.Pending) {
+            ReadBackSlot(tmpSlot);
+        }
+        if (tmpSlot.PBO) {
+            pfn_glDeleteBuffers(1, &tmpSlot.PBO);
+            tmpSlot.PBO = 0;
+            tmpSlot.Size = 0;
+        }
+    }
+    PBORingHead = 0;
+
+    ScreenshotRequested = false;
+    Recording.Active = false;
+
+    StopWorker();
+}
+
 /*
  * Create screenshot from current OpenGL surface.
+ * Note, screenshot is captured at the end of current frame and written to
+ * file asynchronously.
  */
 int vw_Screenshot(int Width, int Height, const std::string &FileName)
 {
-    // fixed for BMP format, supported by libSDL
-    constexpr uint8_t BitsPerPixels = 24;
-    constexpr uint8_t ChannelsNumber = 3;
+    if (Width <= 0
+        || Height <= 0
+        || FileName.empty()) {
+        return ERR_PARAMETERS;
+    }
 
-    SDL_Surface *tmpSurface = SDL_CreateRGBSurface(SDL_SWSURFACE, Width, Height, BitsPerPixels,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                                                   0x000000FF, 0x0000FF00, 0x00FF0000,
-#else
-                                                   0x00FF0000, 0x0000FF00, 0x000000FF,
-#endif
-                                                   0);
-    if (!tmpSurface) {
-        return ERR_MEM;
+    ScreenshotRequested = true;
+    ScreenshotRequest = sCaptureRequest{Width, Height, FileName};
+    return 0;
+}
+
+/*
+ * Start recording of FramesCount frames into Directory as BMP files.
+ */
+bool vw_StartFramesRecording(int Width, int Height, const std::string &Directory, unsigned FramesCount)
+{
+    if (Width <= 0
+        || Height <= 0
+        || !FramesCount) {
+        return false;
     }
 
-    // std::unique_ptr, we need only memory allocation without container's features
-    // don't use std::vector here, since it allocates AND value-initializes
-    std::unique_ptr<uint8_t[]> Pixels{new uint8_t[ChannelsNumber * Width * Height]};
+    Recording.Active = true;
+    Recording.Width = Width;
+    Recording.Height = Height;
+    Recording.Directory = Directory;
+    if (!Recording.Directory.empty()
+        && (Recording.Directory.back() != '/')
+        && (Recording.Directory.back() != '\\')) {
+        Recording.Directory += '/';
+    }
+    Recording.FramesCount = FramesCount;
+    Recording.FramesRecorded = 0;
+    DroppedFrames = 0;
 
-    glReadPixels(0, 0, Width, Height, GL_RGB, GL_UNSIGNED_BYTE, Pixels.get());
+    std::cout << "Frames recording started: " << FramesCount << " frames into "
+              << (Recording.Directory.empty() ? "current folder" : Recording.Directory) << "\n";
+    return true;
+}
 
-    // flip pixels in proper order
-    for (int i = 0; i < Height; i++) {
-        memcpy((uint8_t *)tmpSurface->pixels + tmpSurface->pitch * i,
-               Pixels.get() + ChannelsNumber * Width * (Height - i - 1),
-               Width * ChannelsNumber);
+/*
+ * Stop frames recording.
+ */
+void vw_StopFramesRecording()
+{
+    if (!Recording.Active) {
+        return;
     }
 
-    SDL_SaveBMP(tmpSurface, FileName.c_str());
-    SDL_FreeSurface(tmpSurface);
-    return 0;
+    Recording.Active = false;
+    std::cout << "Frames recording stopped: " << Recording.FramesRecorded << " frames captured, "
+              << DroppedFrames << " frames dropped\n";
+}
+
+/*
+ * Check, if frames recording is active.
+ */
+bool vw_IsFramesRecording()
+{
+    return Recording.Active;
 }
 
 } // viewizard namespace
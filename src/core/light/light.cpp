@@ -36,7 +36,9 @@ namespace {
 // no point to calculate attenuation for all scene, limit it by 10
 constexpr float AttenuationLimit{10.0f};
 // all lights, indexed by light's type
-std::unordered_multimap<eLightType, std::shared_ptr<cLight>, sEnumHash> LightsMap;
+// lights are short-lived objects (projectiles, explosions), map nodes and lights are pooled
+std::unordered_multimap<eLightType, std::shared_ptr<cLight>, sEnumHash, std::equal_to<eLightType>,
+                        cPoolAllocator<std::pair<const eLightType, std::shared_ptr<cLight>>>> LightsMap;
 
 } // unnamed namespace
 
@@ -47,7 +49,7 @@ std::unordered_multimap<eLightType, std::shared_ptr<cLight>, sEnumHash> LightsMa
  * and need for internal use only in order to activate (via OpenGL) proper lights.
  */
 int vw_CalculateAllPointLightsAttenuation(const sVECTOR3D &Location, float Radius2,
-                                          std::multimap<float, cLight*> *AffectedLightsMap)
+                                          tAffectedLightsMap *AffectedLightsMap)
 {
     int AffectedLightsCount{0};
 
@@ -107,7 +109,8 @@ void vw_CheckAndActivateAllLights(const sVECTOR3D &Location, float Radius2, int
 
     // point lights
     if (PointLimit > 0) {
-        std::multimap<float, cLight*> AffectedLightsMap;
+        cFrameArenaScope FrameArenaScope{};
+        tAffectedLightsMap AffectedLightsMap{};
         // call for std::map calculation with sorted by attenuation affected lights
         vw_CalculateAllPointLightsAttenuation(Location, Radius2, &AffectedLightsMap);
 
@@ -166,7 +169,13 @@ void vw_ReleaseAllLights()
  */
 std::weak_ptr<cLight> vw_CreateLight(eLightType Type)
 {
-    auto Light = LightsMap.emplace(Type, std::shared_ptr<cLight>{new cLight, [](cLight *p) {delete p;}});
+    // both, light object and shared_ptr's control block, are allocated from pools
+    auto Light = LightsMap.emplace(Type, std::shared_ptr<cLight>{new (cObjectPool<cLight>::Allocate()) cLight,
+                                                                 [](cLight *p) {
+                                                                     p->~cLight();
+                                                                     cObjectPool<cLight>::Deallocate(p);
+                                                                 },
+                                                                 cPoolAllocator<cLight>{}});
     Light->second->LightType = Type;
     return Light->second;
 }
@@ -32,6 +32,7 @@
 
 #include "../base.h"
 #include "../math/math.h"
+#include "../memory/memory.h"
 
 namespace viewizard {
 
@@ -90,9 +91,12 @@ private:
 // Activate proper lights for particular object (presented by location and radius^2).
 void vw_CheckAndActivateAllLights(const sVECTOR3D &Location, float Radius2, int DirLimit,
                                   int PointLimit, const float (&Matrix)[16]);
+// Affected lights sorted by attenuation, allocated in frame arena (should not outlive current frame).
+using tAffectedLightsMap = std::multimap<float, cLight*, std::less<float>,
+                                         cFrameArenaAllocator<std::pair<const float, cLight*>>>;
 // Calculate affected lights counter and create sorted map with affected lights.
 int vw_CalculateAllPointLightsAttenuation(const sVECTOR3D &Location, float Radius2,
-                                          std::multimap<float, cLight*> *AffectedLightsMap);
+                                          tAffectedLightsMap *AffectedLightsMap);
 // Deactivate all lights.
 void vw_DeActivateAllLights();
 // Release light.
@@ -204,16 +204,31 @@ inline bool vw_CheckFileExtension(const std::string &FileName, const std::string
  * Random number generator.
  */
 
+// Random number streams, each subsystem should use its own stream, in this way
+// visual effects (that depend on frame rate) don't change gameplay sequence.
+// Note, each thread has its own set of streams.
+enum class eRandStream : unsigned {
+    Default,
+    Particles,  // particle systems emission (visual only)
+    Gameplay,   // collisions, script (gameplay related)
+    Count
+};
+
+// Seed random number generator (for reproducible sequence), all streams
+// in all threads are reseeded from this global seed.
+void vw_SeedRand(unsigned Seed);
 // Generate random float in range [0.0f, 1.0f).
-float vw_fRand();
+float vw_fRand(eRandStream Stream = eRandStream::Default);
+// Fill buffer with random floats in range [0.0f, 1.0f).
+void vw_fRandFill(eRandStream Stream, float *Buffer, unsigned Count);
 // Generate random float in range [0.0f, Max) or (Max, 0.0f] in case Max is negative.
-float vw_fRandNum(float Max);
+float vw_fRandNum(float Max, eRandStream Stream = eRandStream::Default);
 // Generate random unsigned integer in range [0, Max].
-unsigned vw_uRandNum(unsigned Max);
+unsigned vw_uRandNum(unsigned Max, eRandStream Stream = eRandStream::Default);
 // Generate random float in range (-1.0f, 1.0f).
-inline float vw_fRand0()
+inline float vw_fRand0(eRandStream Stream = eRandStream::Default)
 {
-    return vw_fRand() - vw_fRand();
+    return vw_fRand(Stream) - vw_fRand(Stream);
 }
 
 /*
@@ -25,40 +25,153 @@
 
 *****************************************************************************/
 
+// NOTE xoshiro128+ generator is used (https://prng.di.unimi.it/), since it is
+//      much faster than std::default_random_engine with std::generate_canonical,
+//      and have enough quality for game's needs (lowest bits are not used for floats)
+
 #include "../base.h"
+#include "math.h"
+#include <atomic>
 #include <random> // this one should not being used in other parts of code
 
 namespace viewizard {
 
 namespace {
 
-std::random_device rd;
-std::default_random_engine gen(rd());
+constexpr unsigned StreamsCount{static_cast<unsigned>(eRandStream::Count)};
+
+struct sRandState {
+    uint32_t s[4];
+};
+
+// Note, thread_local data should be trivial, in order to avoid thread_local wrapper calls.
+struct sThreadStreams {
+    // streams seeded with GlobalSeedGeneration, 0 - not seeded yet
+    unsigned SeedGeneration;
+    unsigned ThreadIndex;
+    sRandState Streams[StreamsCount];
+};
+
+std::atomic<uint32_t> GlobalSeed{std::random_device{}()};
+std::atomic<unsigned> GlobalSeedGeneration{1};
+std::atomic<unsigned> ThreadsCounter{0};
+
+thread_local sThreadStreams ThreadStreams;
 
 } // unnamed namespace
 
+/*
+ * SplitMix64, used for xoshiro state initialization.
+ */
+static uint64_t SplitMix64(uint64_t &State)
+{
+    uint64_t z = (State += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/*
+ * Get stream for current thread, reseed streams if global seed was changed.
+ */
+static inline sRandState &GetStream(eRandStream Stream)
+{
+    unsigned Generation = GlobalSeedGeneration.load(std::memory_order_relaxed);
+    if (ThreadStreams.SeedGeneration != Generation) {
+        if (!ThreadStreams.SeedGeneration) {
+            ThreadStreams.ThreadIndex = ThreadsCounter++;
+        }
+        ThreadStreams.SeedGeneration = Generation;
+
+        // each stream in each thread has its own sequence, that depends on global seed only
+        for (unsigned i = 0; i < StreamsCount; i++) {
+            uint64_t State = (static_cast<uint64_t>(GlobalSeed.load(std::memory_order_relaxed)) << 32)
+                             | (static_cast<uint64_t>(ThreadStreams.ThreadIndex) << 8) | i;
+            uint64_t tmp = SplitMix64(State);
+            ThreadStreams.Streams[i].s[0] = static_cast<uint32_t>(tmp);
+            ThreadStreams.Streams[i].s[1] = static_cast<uint32_t>(tmp >> 32);
+            tmp = SplitMix64(State);
+            ThreadStreams.Streams[i].s[2] = static_cast<uint32_t>(tmp);
+            ThreadStreams.Streams[i].s[3] = static_cast<uint32_t>(tmp >> 32);
+        }
+    }
+
+    return ThreadStreams.Streams[static_cast<unsigned>(Stream)];
+}
+
+/*
+ * xoshiro128+ next value.
+ */
+static inline uint32_t Next(sRandState &State)
+{
+    const uint32_t Result = State.s[0] + State.s[3];
+    const uint32_t tmp = State.s[1] << 9;
+
+    State.s[2] ^= State.s[0];
+    State.s[3] ^= State.s[1];
+    State.s[1] ^= State.s[2];
+    State.s[0] ^= State.s[3];
+    State.s[2] ^= tmp;
+    State.s[3] = (State.s[3] << 11) | (State.s[3] >> 21);
+
+    return Result;
+}
+
+/*
+ * Convert to float in range [0.0f, 1.0f), upper 24 bits are used.
+ */
+static inline float ToFloat(uint32_t Value)
+{
+    return static_cast<float>(Value >> 8) * (1.0f / 16777216.0f);
+}
+
+/*
+ * Seed random number generator (for reproducible sequence).
+ */
+void vw_SeedRand(unsigned Seed)
+{
+    GlobalSeed = Seed;
+    // all threads will reseed their streams on next usage
+    GlobalSeedGeneration++;
+}
+
 /*
  * Generate random float in range [0.0f, 1.0f).
  */
-float vw_fRand()
+float vw_fRand(eRandStream Stream)
 {
-    return std::generate_canonical<float, 10>(gen);
+    return ToFloat(Next(GetStream(Stream)));
+}
+
+/*
+ * Fill buffer with random floats in range [0.0f, 1.0f).
+ */
+void vw_fRandFill(eRandStream Stream, float *Buffer, unsigned Count)
+{
+    assert(Buffer);
+
+    sRandState &State = GetStream(Stream);
+    for (unsigned i = 0; i < Count; i++) {
+        Buffer[i] = ToFloat(Next(State));
+    }
 }
 
 /*
  * Generate random float in range [0.0f, Max) or (Max, 0.0f] in case Max is negative.
  */
-float vw_fRandNum(float Max)
+float vw_fRandNum(float Max, eRandStream Stream)
 {
-    return vw_fRand() * Max;
+    return vw_fRand(Stream) * Max;
 }
 
 /*
  * Generate random unsigned integer in range [0, Max].
  */
-unsigned vw_uRandNum(unsigned Max)
+unsigned vw_uRandNum(unsigned Max, eRandStream Stream)
 {
-    return static_cast<unsigned>(std::floor(vw_fRand() * static_cast<float>(Max + 1)));
+    // multiply-shift range reduction, no division and no float conversion
+    return static_cast<unsigned>((static_cast<uint64_t>(Next(GetStream(Stream)))
+                                  * (static_cast<uint64_t>(Max) + 1)) >> 32);
 }
 
 } // viewizard namespace
@@ -0,0 +1,197 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE std::pmr::monotonic_buffer_resource (since C++17)
+//      could be used as frame arena's memory resource
+
+#include "memory.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace viewizard {
+
+namespace {
+
+// default arena's block size, oversized allocations get dedicated block
+constexpr size_t ArenaBlockSize{256 * 1024};
+// on reset, all used blocks are merged into one, if total size not exceed this limit
+constexpr size_t ArenaMaxMergedBlockSize{4 * 1024 * 1024};
+
+struct sArenaBlock {
+    std::unique_ptr<uint8_t[]> Data{};
+    size_t Size{0};
+
+    sArenaBlock() = default;
+    explicit sArenaBlock(size_t _Size) :
+        Data{new uint8_t[_Size]},
+        Size{_Size}
+    {}
+};
+
+std::vector<sArenaBlock> ArenaBlocks{};
+// current block and position in current block
+size_t CurrentBlock{0};
+size_t CurrentPosition{0};
+// total allocated from arena in current frame
+size_t FrameUsage{0};
+size_t LastFrameUsage{0};
+
+// global operator new calls counter, could be called from any thread
+std::atomic<unsigned> HeapAllocations{0};
+unsigned LastFrameHeapAllocations{0};
+
+} // unnamed namespace
+
+
+/*
+ * Allocate memory from frame arena, memory is valid until vw_ResetFrameArena() call.
+ */
+void *vw_FrameArenaAllocate(size_t Size, size_t Alignment)
+{
+    assert(Alignment && !(Alignment & (Alignment - 1)));
+
+    if (!Size) {
+        Size = 1;
+    }
+
+    while (CurrentBlock < ArenaBlocks.size()) {
+        uintptr_t tmpStart = reinterpret_cast<uintptr_t>(ArenaBlocks[CurrentBlock].Data.get());
+        uintptr_t tmpAligned = (tmpStart + CurrentPosition + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+        size_t tmpNewPosition = static_cast<size_t>(tmpAligned - tmpStart) + Size;
+        if (tmpNewPosition <= ArenaBlocks[CurrentBlock].Size) {
+            FrameUsage += tmpNewPosition - CurrentPosition;
+            CurrentPosition = tmpNewPosition;
+            return reinterpret_cast<void *>(tmpAligned);
+        }
+        // switch to next block (if any)
+        CurrentBlock++;
+        CurrentPosition = 0;
+    }
+
+    ArenaBlocks.emplace_back(std::max(ArenaBlockSize, Size + Alignment));
+    CurrentBlock = ArenaBlocks.size() - 1;
+    return vw_FrameArenaAllocate(Size, Alignment);
+}
+
+/*
+ * Reset frame arena and close heap allocations counting for frame, should be called once per frame.
+ */
+void vw_ResetFrameArena()
+{
+    // merge all blocks into one, so, next frame with same usage will not allocate new blocks
+    if (ArenaBlocks.size() > 1) {
+        size_t tmpTotalSize{0};
+        for (const auto &tmpBlock : ArenaBlocks) {
+            tmpTotalSize += tmpBlock.Size;
+        }
+        ArenaBlocks.clear();
+        ArenaBlocks.emplace_back(std::min(tmpTotalSize, ArenaMaxMergedBlockSize));
+    }
+
+    CurrentBlock = 0;
+    CurrentPosition = 0;
+    LastFrameUsage = FrameUsage;
+    FrameUsage = 0;
+
+    LastFrameHeapAllocations = HeapAllocations.exchange(0, std::memory_order_relaxed);
+}
+
+/*
+ * Remember frame arena's current position.
+ */
+cFrameArenaScope::cFrameArenaScope() :
+    Block_{CurrentBlock},
+    Position_{CurrentPosition}
+{}
+
+/*
+ * Rewind frame arena to remembered position.
+ */
+cFrameArenaScope::~cFrameArenaScope()
+{
+    CurrentBlock = Block_;
+    CurrentPosition = Position_;
+}
+
+/*
+ * Get frame arena memory usage for previous frame (in bytes).
+ */
+size_t vw_GetFrameArenaUsage()
+{
+    return LastFrameUsage;
+}
+
+/*
+ * Get heap allocations (global operator new calls) count for previous frame,
+ * always 0, if heap allocations counting is not enabled (see COUNT_HEAP_ALLOCATIONS).
+ */
+unsigned vw_GetFrameHeapAllocations()
+{
+    return LastFrameHeapAllocations;
+}
+
+} // viewizard namespace
+
+#ifdef COUNT_HEAP_ALLOCATIONS
+/*
+ * Replace global operator new/delete, in order to count heap allocations.
+ * Note, we don't use exceptions, so, allocation failure is fatal.
+ */
+static void *CountedHeapAllocate(std::size_t Size)
+{
+    viewizard::HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    void *Ptr = std::malloc(Size ? Size : 1);
+    if (!Ptr) {
+        std::cerr << __func__ << "(): " << "out of memory\n";
+        std::abort();
+    }
+    return Ptr;
+}
+
+void *operator new(std::size_t Size)
+{
+    return CountedHeapAllocate(Size);
+}
+
+void *operator new[](std::size_t Size)
+{
+    return CountedHeapAllocate(Size);
+}
+
+void operator delete(void *Ptr) noexcept
+{
+    std::free(Ptr);
+}
+
+void operator delete[](void *Ptr) noexcept
+{
+    std::free(Ptr);
+}
+#endif // COUNT_HEAP_ALLOCATIONS
@@ -0,0 +1,247 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+/*
+Frame arena is a bump allocator for transient data, that lives no longer than one frame.
+All memory, allocated from frame arena, become invalid after vw_ResetFrameArena() call.
+Note, frame arena is not thread-safe, should be used in main thread only.
+
+Object pools recycle fixed-size memory blocks of released objects, in this way
+short-lived objects (projectiles, particle systems, lights, etc.) don't hit heap
+on creation. Object pools are not thread-safe, should be used in main thread only.
+*/
+
+#ifndef CORE_MEMORY_MEMORY_H
+#define CORE_MEMORY_MEMORY_H
+
+#include "../base.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace viewizard {
+
+/*
+ * frame_arena
+ */
+
+// Heap allocations counting replace global operator new/delete for whole program,
+// so, it is enabled for debug builds and benchmark (COUNT_HEAP_ALLOCATIONS) only.
+#if !defined(NDEBUG) && !defined(COUNT_HEAP_ALLOCATIONS)
+#define COUNT_HEAP_ALLOCATIONS
+#endif
+
+// Allocate memory from frame arena, memory is valid until vw_ResetFrameArena() call.
+void *vw_FrameArenaAllocate(size_t Size, size_t Alignment);
+// Reset frame arena and close heap allocations counting for frame, should be called once per frame.
+void vw_ResetFrameArena();
+// Get frame arena memory usage for previous frame (in bytes).
+size_t vw_GetFrameArenaUsage();
+// Get heap allocations (global operator new calls) count for previous frame,
+// always 0, if heap allocations counting is not enabled (see COUNT_HEAP_ALLOCATIONS).
+unsigned vw_GetFrameHeapAllocations();
+
+// Scoped frame arena usage, rewind frame arena to initial state on scope exit.
+// Could be used for transient data outside of main loop's frames (for example, on loading).
+// Usage: cFrameArenaScope FrameArenaScope{};
+class cFrameArenaScope {
+public:
+    cFrameArenaScope();
+    ~cFrameArenaScope();
+
+    cFrameArenaScope(const cFrameArenaScope &) = delete;
+    void operator = (const cFrameArenaScope &) = delete;
+
+private:
+    size_t Block_{0};
+    size_t Position_{0};
+};
+
+// STL-compatible allocator (memory resource adapter) for frame arena.
+// Deallocation does nothing, all memory released on frame arena reset.
+template <typename T>
+class cFrameArenaAllocator {
+public:
+    using value_type = T;
+
+    cFrameArenaAllocator() = default;
+    template <typename U>
+    cFrameArenaAllocator(const cFrameArenaAllocator<U> &)
+    {}
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(vw_FrameArenaAllocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *, size_t)
+    {}
+};
+
+template <typename T, typename U>
+inline bool operator == (const cFrameArenaAllocator<T> &, const cFrameArenaAllocator<U> &)
+{
+    return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const cFrameArenaAllocator<T> &, const cFrameArenaAllocator<U> &)
+{
+    return false;
+}
+
+// Frame arena containers, should not outlive current frame.
+template <typename T>
+using tFrameVector = std::vector<T, cFrameArenaAllocator<T>>;
+using tFrameU32String = std::basic_string<char32_t, std::char_traits<char32_t>, cFrameArenaAllocator<char32_t>>;
+
+/*
+ * object_pool
+ */
+
+// Fixed-size memory blocks pool for objects of type T.
+// Released blocks are recycled for next allocations and never returned to heap.
+// Caller construct/destroy objects in pooled memory by itself:
+//     T *Object = new (cObjectPool<T>::Allocate()) T;
+//     Object->~T();
+//     cObjectPool<T>::Deallocate(Object);
+template <typename T>
+class cObjectPool {
+public:
+    static void *Allocate()
+    {
+        std::vector<void *> &FreeBlocks = GetFreeBlocks();
+        if (FreeBlocks.empty()) {
+            return ::operator new(sizeof(T));
+        }
+
+        void *Block = FreeBlocks.back();
+        FreeBlocks.pop_back();
+        return Block;
+    }
+    static void Deallocate(void *Block)
+    {
+        GetFreeBlocks().push_back(Block);
+    }
+    // Get recycled (ready for reuse) blocks count.
+    static size_t GetFreeBlocksCount()
+    {
+        return GetFreeBlocks().size();
+    }
+
+private:
+    // Note, free blocks list is never destroyed, since global containers with pooled
+    // nodes could be destroyed on program exit after function-local static objects.
+    static std::vector<void *> &GetFreeBlocks()
+    {
+        static std::vector<void *> *FreeBlocks = new std::vector<void *>;
+        return *FreeBlocks;
+    }
+};
+
+// STL-compatible allocator for cObjectPool, single object allocations are pooled
+// (container nodes, shared_ptr control blocks), arrays allocations are forwarded to heap.
+template <typename T>
+class cPoolAllocator {
+public:
+    using value_type = T;
+
+    cPoolAllocator() = default;
+    template <typename U>
+    cPoolAllocator(const cPoolAllocator<U> &)
+    {}
+
+    T *allocate(size_t n)
+    {
+        if (n == 1) {
+            return static_cast<T *>(cObjectPool<T>::Allocate());
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *p, size_t n)
+    {
+        if (n == 1) {
+            cObjectPool<T>::Deallocate(p);
+            return;
+        }
+        ::operator delete(p);
+    }
+};
+
+template <typename T, typename U>
+inline bool operator == (const cPoolAllocator<T> &, const cPoolAllocator<U> &)
+{
+    return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const cPoolAllocator<T> &, const cPoolAllocator<U> &)
+{
+    return false;
+}
+
+/*
+ * function_ref
+ */
+
+// Non-owning reference to callable object, in contrast to std::function, never allocate memory.
+// Note, referenced callable object should outlive cFunctionRef (use it for function parameters only).
+template <typename Signature>
+class cFunctionRef;
+
+template <typename R, typename... Args>
+class cFunctionRef<R (Args...)> {
+public:
+    template <typename F,
+              typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, cFunctionRef>::value>::type,
+              typename = typename std::enable_if<std::is_convertible<decltype(std::declval<F &>()(std::declval<Args>()...)),
+                                                                     R>::value>::type>
+    cFunctionRef(F &&Function) :
+        Callable_{const_cast<void *>(static_cast<const void *>(std::addressof(Function)))},
+        Invoke_{&Invoke<typename std::remove_reference<F>::type>}
+    {}
+
+    R operator () (Args... args) const
+    {
+        return Invoke_(Callable_, std::forward<Args>(args)...);
+    }
+
+private:
+    template <typename F>
+    static R Invoke(void *Callable, Args... args)
+    {
+        return (*static_cast<F *>(Callable))(std::forward<Args>(args)...);
+    }
+
+    void *Callable_{nullptr};
+    R (*Invoke_)(void *, Args...){nullptr};
+};
+
+} // viewizard namespace
+
+#endif // CORE_MEMORY_MEMORY_H
@@ -28,6 +28,7 @@
 #include "../graphics/graphics.h"
 #include "../vfs/vfs.h"
 #include "model3d.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -57,6 +58,11 @@ namespace {
 // All loaded models.
 std::unordered_map<std::string, std::shared_ptr<cModel3DWrapper>> ModelsMap;
 
+// Grid resolution (cells along the largest bounding box side) for LOD generation.
+constexpr unsigned LODGridResolution{12};
+// Don't keep LOD, if it can't remove at least 30% of triangles.
+constexpr float LODMinReduction{0.7f};
+
 } // unnamed namespace
 
 
@@ -271,6 +277,154 @@ static void CreateHardwareBuffers(cModel3DWrapper *Model)
     }
 }
 
+/*
+ * Create simplified index array (level of detail) by vertex clustering.
+ * All vertices are sorted into uniform grid cells, each cell is represented by
+ * the vertex, closest to the cell's average position, triangles collapsed into
+ * line or point are dropped. Since representative is one of the source vertices,
+ * result could be used with the same vertex array/vbo as source index array.
+ * If IndexArray is nullptr, vertex array is considered as plain triangle list.
+ * Return empty array, if we can't simplify geometry enough.
+ */
+static std::vector<unsigned> CreateLODIndexArray(const float *VertexArray, unsigned int VertexStride,
+                                                 const unsigned *IndexArray, unsigned int IndexCount)
+{
+    std::vector<unsigned> LODIndexArray{};
+    if (!VertexArray || (IndexCount < 3)) {
+        return LODIndexArray;
+    }
+
+    auto GetIndex = [&] (unsigned int i) {
+        return IndexArray ? IndexArray[i] : i;
+    };
+
+    sVECTOR3D Min{VertexArray[GetIndex(0) * VertexStride],
+                  VertexArray[GetIndex(0) * VertexStride + 1],
+                  VertexArray[GetIndex(0) * VertexStride + 2]};
+    sVECTOR3D Max{Min};
+    for (unsigned int i = 1; i < IndexCount; i++) {
+        const float *Point = VertexArray + GetIndex(i) * VertexStride;
+        Min.x = std::min(Min.x, Point[0]);
+        Min.y = std::min(Min.y, Point[1]);
+        Min.z = std::min(Min.z, Point[2]);
+        Max.x = std::max(Max.x, Point[0]);
+        Max.y = std::max(Max.y, Point[1]);
+        Max.z = std::max(Max.z, Point[2]);
+    }
+    float CellSize = std::max(std::max(Max.x - Min.x, Max.y - Min.y), Max.z - Min.z) / LODGridResolution;
+    if (CellSize <= 0.0f) {
+        return LODIndexArray;
+    }
+
+    auto GetCell = [&] (const float *Point) {
+        unsigned x = std::min(static_cast<unsigned>((Point[0] - Min.x) / CellSize), LODGridResolution - 1);
+        unsigned y = std::min(static_cast<unsigned>((Point[1] - Min.y) / CellSize), LODGridResolution - 1);
+        unsigned z = std::min(static_cast<unsigned>((Point[2] - Min.z) / CellSize), LODGridResolution - 1);
+        return x + (y + z * LODGridResolution) * LODGridResolution;
+    };
+
+    struct sCell {
+        sVECTOR3D Sum{0.0f, 0.0f, 0.0f};
+        unsigned Count{0};
+        unsigned Representative{0};
+        float Dist2{-1.0f};
+    };
+    std::unordered_map<unsigned, sCell> Cells{};
+
+    // average position for each cell
+    for (unsigned int i = 0; i < IndexCount; i++) {
+        const float *Point = VertexArray + GetIndex(i) * VertexStride;
+        sCell &Cell = Cells[GetCell(Point)];
+        Cell.Sum += sVECTOR3D{Point[0], Point[1], Point[2]};
+        Cell.Count++;
+    }
+
+    // closest to average position vertex
+    for (unsigned int i = 0; i < IndexCount; i++) {
+        const float *Point = VertexArray + GetIndex(i) * VertexStride;
+        sCell &Cell = Cells[GetCell(Point)];
+        sVECTOR3D Average = Cell.Sum ^ (1.0f / Cell.Count);
+        float Dist2 = (Point[0] - Average.x) * (Point[0] - Average.x) +
+                      (Point[1] - Average.y) * (Point[1] - Average.y) +
+                      (Point[2] - Average.z) * (Point[2] - Average.z);
+        if ((Cell.Dist2 < 0.0f) || (Dist2 < Cell.Dist2)) {
+            Cell.Dist2 = Dist2;
+            Cell.Representative = GetIndex(i);
+        }
+    }
+
+    LODIndexArray.reserve(IndexCount);
+    for (unsigned int i = 0; i + 2 < IndexCount; i += 3) {
+        unsigned A = Cells[GetCell(VertexArray + GetIndex(i) * VertexStride)].Representative;
+        unsigned B = Cells[GetCell(VertexArray + GetIndex(i + 1) * VertexStride)].Representative;
+        unsigned C = Cells[GetCell(VertexArray + GetIndex(i + 2) * VertexStride)].Representative;
+        if ((A == B) || (B == C) || (A == C)) {
+            continue;
+        }
+        LODIndexArray.push_back(A);
+        LODIndexArray.push_back(B);
+        LODIndexArray.push_back(C);
+    }
+
+    if (LODIndexArray.empty() ||
+        (LODIndexArray.size() > static_cast<size_t>(IndexCount * LODMinReduction))) {
+        LODIndexArray.clear();
+    }
+    return LODIndexArray;
+}
+
+/*
+ * Create OpenGL-related hardware buffers for LOD index array.
+ */
+static void CreateLODHardwareBuffers(const std::vector<unsigned> &LODArray, int VertexFormat,
+                                     unsigned int VertexStride, GLuint VBO,
+                                     std::shared_ptr<unsigned> &LODIndexArray, unsigned int &LODIndexArrayCount,
+                                     GLuint &LODIBO, GLuint &LODVAO)
+{
+    if (LODArray.empty()) {
+        return;
+    }
+
+    LODIndexArrayCount = static_cast<unsigned int>(LODArray.size());
+    LODIndexArray.reset(new unsigned[LODIndexArrayCount], std::default_delete<unsigned[]>());
+    memcpy(LODIndexArray.get(), LODArray.data(), LODIndexArrayCount * sizeof(LODIndexArray.get()[0]));
+
+    if (!VBO) {
+        return;
+    }
+
+    if (!vw_BuildBufferObject(eBufferObject::Index, LODIndexArrayCount * sizeof(unsigned),
+                              LODIndexArray.get(), LODIBO)) {
+        LODIBO = 0;
+    }
+
+    if (!vw_BuildVAO(LODVAO, VertexFormat, VertexStride * static_cast<GLsizei>(sizeof(float)),
+                     VBO, LODIBO)) {
+        LODVAO = 0;
+    }
+}
+
+/*
+ * Create level of detail for global and chunks' vertex arrays.
+ */
+static void CreateLevelOfDetail(cModel3DWrapper *Model)
+{
+    unsigned int GlobalCount = Model->GlobalIndexArray ? Model->GlobalIndexArrayCount : Model->GlobalVertexArrayCount;
+    CreateLODHardwareBuffers(CreateLODIndexArray(Model->GlobalVertexArray.get(), Model->Chunks[0].VertexStride,
+                                                 Model->GlobalIndexArray.get(), GlobalCount),
+                             Model->Chunks[0].VertexFormat, Model->Chunks[0].VertexStride, Model->GlobalVBO,
+                             Model->GlobalLODIndexArray, Model->GlobalLODIndexArrayCount,
+                             Model->GlobalLODIBO, Model->GlobalLODVAO);
+
+    for (auto &tmpChunk : Model->Chunks) {
+        CreateLODHardwareBuffers(CreateLODIndexArray(tmpChunk.VertexArray.get(), tmpChunk.VertexStride,
+                                                     nullptr, tmpChunk.VertexQuantity),
+                                 tmpChunk.VertexFormat, tmpChunk.VertexStride, tmpChunk.VBO,
+                                 tmpChunk.LODIndexArray, tmpChunk.LODIndexArrayCount,
+                                 tmpChunk.LODIBO, tmpChunk.LODVAO);
+    }
+}
+
 /*
  * Recursively generate/calculate limited by size triangles.
  *
@@ -516,6 +670,7 @@ std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, float Triang
     }
     CreateChunkBuffers(ModelsMap[FileName].get());
     CreateHardwareBuffers(ModelsMap[FileName].get());
+    CreateLevelOfDetail(ModelsMap[FileName].get());
     CreateVertexArrayLimitedBySizeTriangles(ModelsMap[FileName].get(), TriangleSizeLimit);
 
     std::cout << "Loaded ... " << FileName << "\n";
@@ -523,6 +678,15 @@ std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, float Triang
     return ModelsMap[FileName];
 }
 
+/*
+ * Release 3D model.
+ * Note, caller should care, that model's buffers are not in use (no objects with this model).
+ */
+void vw_ReleaseModel3D(const std::string &FileName)
+{
+    ModelsMap.erase(FileName);
+}
+
 /*
  * Release all 3D models.
  */
@@ -565,6 +729,12 @@ cModel3DWrapper::~cModel3DWrapper()
             if (tmpChunk.VAO && tmpChunk.VAO != GlobalVAO) {
                 vw_DeleteVAO(tmpChunk.VAO);
             }
+            if (tmpChunk.LODIBO) {
+                vw_DeleteBufferObject(tmpChunk.LODIBO);
+            }
+            if (tmpChunk.LODVAO) {
+                vw_DeleteVAO(tmpChunk.LODVAO);
+            }
         }
     }
     if (GlobalVBO) {
@@ -576,6 +746,12 @@ cModel3DWrapper::~cModel3DWrapper()
     if (GlobalVAO) {
         vw_DeleteVAO(GlobalVAO);
     }
+    if (GlobalLODIBO) {
+        vw_DeleteBufferObject(GlobalLODIBO);
+    }
+    if (GlobalLODVAO) {
+        vw_DeleteVAO(GlobalLODVAO);
+    }
 }
 
 /*
@@ -90,6 +90,11 @@ struct sChunk3D {
     GLuint IBO{0};
     // vao-related
     GLuint VAO{0};
+    // level of detail, simplified index array for chunk's vertex array/vbo
+    std::shared_ptr<unsigned> LODIndexArray{}; // unsigned[], make sure, that custom deleter are used
+    unsigned int LODIndexArrayCount{0}; // LODIndexArray's size, 0 if no LOD available
+    GLuint LODIBO{0};
+    GLuint LODVAO{0};
 
     // for explosion we need pre-generated vertex array with small triangles,
     // in this case, we could create cool looking effects, when enemies disintegrate
@@ -117,6 +122,11 @@ public:
     GLuint GlobalIBO{0};
     // vao-related
     GLuint GlobalVAO{0};
+    // level of detail, simplified index array for global vertex array/vbo
+    std::shared_ptr<unsigned> GlobalLODIndexArray{}; // unsigned[], make sure, that custom deleter are used
+    unsigned int GlobalLODIndexArrayCount{0}; // GlobalLODIndexArray's size, 0 if no LOD available
+    GLuint GlobalLODIBO{0};
+    GLuint GlobalLODVAO{0};
 
     // Axis-Aligned Bounding Box, coordinates are related to model's location
     bounding_box AABB{};
@@ -142,6 +152,9 @@ public:
 // Note, FileName used as a key in ModelsMap, and should not be used with different
 // TriangleSizeLimit or NeedTangentAndBinormal.
 std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, float TriangleSizeLimit, bool NeedTangentAndBinormal);
+// Release 3D model.
+// Note, caller should care, that model's buffers are not in use (no objects with this model).
+void vw_ReleaseModel3D(const std::string &FileName);
 // Release all 3D models.
 void vw_ReleaseAllModel3D();
 
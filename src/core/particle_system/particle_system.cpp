@@ -62,8 +62,9 @@ std::weak_ptr<cGLSL> ParticleSystemGLSL{};
 GLint UniformLocationParticleTexture{0};
 GLint UniformLocationCameraPoint{0};
 
-// All particle systems.
-std::forward_list<std::shared_ptr<cParticleSystem>> ParticleSystemsList{};
+// All particle systems, list nodes are pooled.
+std::forward_list<std::shared_ptr<cParticleSystem>,
+                  cPoolAllocator<std::shared_ptr<cParticleSystem>>> ParticleSystemsList{};
 
 } // unnamed namespace
 
@@ -214,7 +215,18 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
         TimeDeltaCorrection = TimeDelta / static_cast<float>(Quantity);
     }
 
+    // random numbers for one particle, generated in one batch:
+    // [0-1] lifetime, [2-7] color, [8-9] alpha, [10-15] location, [16-17] size,
+    // [18-21] direction deviation, [22-23] speed
+    // note, pairs are used for (-1.0f, 1.0f) range, same as vw_fRand0(eRandStream::Particles) does
+    float Rand[24];
+    auto Rand0 = [&Rand] (unsigned i) {
+        return Rand[i] - Rand[i + 1];
+    };
+
     while (Quantity > 0) {
+        vw_fRandFill(eRandStream::Particles, Rand, 24);
+
         // create new particle
         ParticlesList.emplace_front();
         // NOTE emplace_front() return reference to the inserted element (since C++17)
@@ -225,15 +237,15 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
 
         // setup lifetime and age
         NewParticle.Age = 0.0f;
-        NewParticle.Lifetime = Life + vw_fRand0() * LifeVar;
+        NewParticle.Lifetime = Life + Rand0(0) * LifeVar;
         if (NewParticle.Lifetime < 0.0f) {
             NewParticle.Lifetime = 0.0f;
         }
 
         // calculate color
-        NewParticle.Color.r = ColorStart.r + vw_fRand0() * ColorVar.r;
-        NewParticle.Color.g = ColorStart.g + vw_fRand0() * ColorVar.g;
-        NewParticle.Color.b = ColorStart.b + vw_fRand0() * ColorVar.b;
+        NewParticle.Color.r = ColorStart.r + Rand0(2) * ColorVar.r;
+        NewParticle.Color.g = ColorStart.g + Rand0(4) * ColorVar.g;
+        NewParticle.Color.b = ColorStart.b + Rand0(6) * ColorVar.b;
         vw_Clamp(NewParticle.Color.r, 0.0f, 1.0f);
         vw_Clamp(NewParticle.Color.g, 0.0f, 1.0f);
         vw_Clamp(NewParticle.Color.b, 0.0f, 1.0f);
@@ -242,7 +254,7 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
         NewParticle.ColorDelta.b = (ColorEnd.b - NewParticle.Color.b) / NewParticle.Lifetime;
 
         // calculate alpha
-        NewParticle.Alpha = AlphaStart + vw_fRand0() * AlphaVar;
+        NewParticle.Alpha = AlphaStart + Rand0(8) * AlphaVar;
         vw_Clamp(NewParticle.Alpha, 0.0f, 1.0f);
         NewParticle.AlphaDelta = (AlphaEnd - NewParticle.Alpha) / NewParticle.Lifetime;
         NewParticle.AlphaShowHide = AlphaShowHide;
@@ -253,24 +265,24 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
 
         switch (CreationType) {
         case eParticleCreationType::Point:
-            GenerateLocationPointType(NewParticle);
+            GenerateLocationPointType(NewParticle, &Rand[10]);
             break;
 
         case eParticleCreationType::Cube:
-            GenerateLocationCubeType(NewParticle);
+            GenerateLocationCubeType(NewParticle, &Rand[10]);
             break;
 
         case eParticleCreationType::Tube:
-            GenerateLocationTubeType(NewParticle);
+            GenerateLocationTubeType(NewParticle, &Rand[10]);
             break;
 
         case eParticleCreationType::Sphere:
-            GenerateLocationSphereType(NewParticle);
+            GenerateLocationSphereType(NewParticle, &Rand[10]);
             break;
         }
 
         // calculate size
-        NewParticle.Size = SizeStart + vw_fRand0() * SizeVar;
+        NewParticle.Size = SizeStart + Rand0(16) * SizeVar;
         if (NewParticle.Size < 0.0f) {
             NewParticle.Size = SizeStart;
         }
@@ -286,15 +298,15 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
         } else {
             // emit with deviation
             NewParticle.Velocity = Direction;
-            vw_RotatePoint(NewParticle.Velocity, sVECTOR3D{Theta * vw_fRand0() / 2.0f,
-                                                           Theta * vw_fRand0() / 2.0f,
+            vw_RotatePoint(NewParticle.Velocity, sVECTOR3D{Theta * Rand0(18) / 2.0f,
+                                                           Theta * Rand0(20) / 2.0f,
                                                            0.0f});
         }
 
         NewParticle.NeedStop = NeedStop;
 
         // calculate speed
-        float NewSpeed = Speed + vw_fRand0() * SpeedVar;
+        float NewSpeed = Speed + Rand0(22) * SpeedVar;
         if (NewSpeed < 0.0f) {
             NewSpeed = 0.0f;
         }
@@ -343,7 +355,7 @@ void cParticleSystem::SizeCorrectionByCameraDist(cParticle &NewParticle)
         float tmpEnd = SizeEnd - SizeEnd * (1.0f - CameraDistResize) * (SystDist-ParticleDist) / SystDist;
         float tmpVar = SizeVar - SizeVar * (1.0f - CameraDistResize) * (SystDist-ParticleDist) / SystDist;
 
-        NewParticle.Size = tmpStart + vw_fRand0() * tmpVar;
+        NewParticle.Size = tmpStart + vw_fRand0(eRandStream::Particles) * tmpVar;
         if (NewParticle.Size < 0.0f) {
             NewParticle.Size = 0.0f;
         }
@@ -354,24 +366,24 @@ void cParticleSystem::SizeCorrectionByCameraDist(cParticle &NewParticle)
 /*
  * Generate location for new particle (point type).
  */
-void cParticleSystem::GenerateLocationPointType(cParticle &NewParticle)
+void cParticleSystem::GenerateLocationPointType(cParticle &NewParticle, const float *Rand)
 {
     // FIXME this should be fixed, Point Type should return same location as system,
     //       if particle system need CreationSize, Sphere or Cube Type should be used
     //       since we have point type by default, not so easy now find related code
-    NewParticle.Location = Location + sVECTOR3D{vw_fRand0() * CreationSize.x,
-                                                vw_fRand0() * CreationSize.y,
-                                                vw_fRand0() * CreationSize.z};
+    NewParticle.Location = Location + sVECTOR3D{(Rand[0] - Rand[1]) * CreationSize.x,
+                                                (Rand[2] - Rand[3]) * CreationSize.y,
+                                                (Rand[4] - Rand[5]) * CreationSize.z};
 }
 
 /*
  * Generate location for new particle (cube type).
  */
-void cParticleSystem::GenerateLocationCubeType(cParticle &NewParticle)
+void cParticleSystem::GenerateLocationCubeType(cParticle &NewParticle, const float *Rand)
 {
-    sVECTOR3D CreationPos{(1.0f - vw_fRand() * 2) * CreationSize.x,
-                          (1.0f - vw_fRand() * 2) * CreationSize.y,
-                          (1.0f - vw_fRand() * 2) * CreationSize.z};
+    sVECTOR3D CreationPos{(1.0f - Rand[0] * 2) * CreationSize.x,
+                          (1.0f - Rand[1] * 2) * CreationSize.y,
+                          (1.0f - Rand[2] * 2) * CreationSize.z};
 
     vw_Matrix33CalcPoint(CreationPos, CurrentRotationMat);
     NewParticle.Location = Location + CreationPos;
@@ -380,11 +392,11 @@ void cParticleSystem::GenerateLocationCubeType(cParticle &NewParticle)
 /*
  * Generate location for new particle (tube type).
  */
-void cParticleSystem::GenerateLocationTubeType(cParticle &NewParticle)
+void cParticleSystem::GenerateLocationTubeType(cParticle &NewParticle, const float *Rand)
 {
-    sVECTOR3D CreationPos{(0.5f - vw_fRand()) * CreationSize.x,
-                          (0.5f - vw_fRand()) * CreationSize.y,
-                          (0.5f - vw_fRand()) * CreationSize.z};
+    sVECTOR3D CreationPos{(0.5f - Rand[0]) * CreationSize.x,
+                          (0.5f - Rand[1]) * CreationSize.y,
+                          (0.5f - Rand[2]) * CreationSize.z};
 
     vw_Matrix33CalcPoint(CreationPos, CurrentRotationMat);
     NewParticle.Location = Location + CreationPos;
@@ -393,13 +405,13 @@ void cParticleSystem::GenerateLocationTubeType(cParticle &NewParticle)
 /*
  * Generate location for new particle (sphere type).
  */
-void cParticleSystem::GenerateLocationSphereType(cParticle &NewParticle)
+void cParticleSystem::GenerateLocationSphereType(cParticle &NewParticle, const float *Rand)
 {
     // note, this is not really 'sphere' type, since we use
     // vector instead of radius for initial location calculation
-    sVECTOR3D CreationPos{vw_fRand0() * CreationSize.x,
-                          vw_fRand0() * CreationSize.y,
-                          vw_fRand0() * CreationSize.z};
+    sVECTOR3D CreationPos{(Rand[0] - Rand[1]) * CreationSize.x,
+                          (Rand[2] - Rand[3]) * CreationSize.y,
+                          (Rand[4] - Rand[5]) * CreationSize.z};
 
     if (DeadZone > 0.0f) {
         float ParticleDist2 = CreationPos.x * CreationPos.x
@@ -435,15 +447,15 @@ void cParticleSystem::UpdateLight(float TimeDelta)
                 LightDeviation -= LightDeviationSpeed * TimeDelta;
                 if (NextLightDeviation >= LightDeviation) {
                     LightDeviation = NextLightDeviation;
-                    LightDeviationSpeed = 3.5f + 3.5f * vw_fRand();
-                    NextLightDeviation = 0.7f + 0.3f * vw_fRand();
+                    LightDeviationSpeed = 3.5f + 3.5f * vw_fRand(eRandStream::Particles);
+                    NextLightDeviation = 0.7f + 0.3f * vw_fRand(eRandStream::Particles);
                 }
             } else {
                 LightDeviation += LightDeviationSpeed * TimeDelta;
                 if (NextLightDeviation <= LightDeviation) {
                     LightDeviation = NextLightDeviation;
-                    LightDeviationSpeed = 3.5f + 3.5f * vw_fRand();
-                    NextLightDeviation = 0.7f - 0.3f * vw_fRand();
+                    LightDeviationSpeed = 3.5f + 3.5f * vw_fRand(eRandStream::Particles);
+                    NextLightDeviation = 0.7f - 0.3f * vw_fRand(eRandStream::Particles);
                 }
             }
         } else {
@@ -822,6 +834,52 @@ void cParticleSystem::ChangeSpeed(const sVECTOR3D &Vel)
     }
 }
 
+/*
+ * Copy settings (emission, size, alpha, color, speed, etc.) from prefab.
+ */
+void cParticleSystem::CopySettings(const cParticleSystem &Prefab)
+{
+    Texture = Prefab.Texture;
+    TextureBlend = Prefab.TextureBlend;
+    Direction = Prefab.Direction;
+    ParticlesPerSec = Prefab.ParticlesPerSec;
+    NeedStop = Prefab.NeedStop;
+
+    SizeStart = Prefab.SizeStart;
+    SizeVar = Prefab.SizeVar;
+    SizeEnd = Prefab.SizeEnd;
+
+    AlphaStart = Prefab.AlphaStart;
+    AlphaVar = Prefab.AlphaVar;
+    AlphaEnd = Prefab.AlphaEnd;
+    AlphaShowHide = Prefab.AlphaShowHide;
+
+    ColorStart = Prefab.ColorStart;
+    ColorVar = Prefab.ColorVar;
+    ColorEnd = Prefab.ColorEnd;
+
+    Speed = Prefab.Speed;
+    SpeedVar = Prefab.SpeedVar;
+    SpeedOnCreation = Prefab.SpeedOnCreation;
+
+    CreationType = Prefab.CreationType;
+    CreationSize = Prefab.CreationSize;
+    DeadZone = Prefab.DeadZone;
+    CameraDistResize = Prefab.CameraDistResize;
+
+    Life = Prefab.Life;
+    LifeVar = Prefab.LifeVar;
+    Theta = Prefab.Theta;
+
+    IsMagnet = Prefab.IsMagnet;
+    MagnetFactor = Prefab.MagnetFactor;
+    IsSuppressed = Prefab.IsSuppressed;
+    DestroyIfNoParticles = Prefab.DestroyIfNoParticles;
+
+    LightNeedDeviation = Prefab.LightNeedDeviation;
+    LightDeviation = Prefab.LightDeviation;
+}
+
 /*
  * Initialization. 'Quality' is particle emission factor from 1.0f.
  * Note, in case of 'UseGLSL', caller should load "ParticleSystem" shader
@@ -860,12 +918,29 @@ bool vw_InitParticleSystems(bool UseGLSL, float Quality)
  */
 std::weak_ptr<cParticleSystem> vw_CreateParticleSystem()
 {
+    // both, particle system object and shared_ptr's control block, are allocated from pools
     // NOTE emplace_front() return reference to the inserted element (since C++17)
     //      this two lines could be combined
-    ParticleSystemsList.emplace_front(new cParticleSystem, [](cParticleSystem *p) {delete p;});
+    ParticleSystemsList.emplace_front(new (cObjectPool<cParticleSystem>::Allocate()) cParticleSystem,
+                                      [](cParticleSystem *p) {
+                                          p->~cParticleSystem();
+                                          cObjectPool<cParticleSystem>::Deallocate(p);
+                                      },
+                                      cPoolAllocator<cParticleSystem>{});
+    ParticleSystemsList.front()->NextLightDeviation = 0.7f + 0.3f * vw_fRand(eRandStream::Particles);
+    ParticleSystemsList.front()->LightDeviationSpeed = 3.5f + 3.5f * vw_fRand(eRandStream::Particles);
     return ParticleSystemsList.front();
 }
 
+/*
+ * Create particle system prefab, not updated and not drawn, could be used as settings template only.
+ * Note, prefab don't consume random numbers, since prefabs could be lazily created at any time.
+ */
+std::shared_ptr<cParticleSystem> vw_CreateParticleSystemPrefab()
+{
+    return std::shared_ptr<cParticleSystem>{new cParticleSystem, [](cParticleSystem *p) {delete p;}};
+}
+
 /*
  * Release particle system, provided by shared_ptr.
  * We remove particle system from the list (release shared_ptr), but real release
@@ -994,4 +1069,12 @@ void vw_UpdateAllParticleSystems(float Time)
     }
 }
 
+/*
+ * Get particle systems count.
+ */
+unsigned vw_GetParticleSystemsCount()
+{
+    return static_cast<unsigned>(std::distance(ParticleSystemsList.begin(), ParticleSystemsList.end()));
+}
+
 } // viewizard namespace
@@ -33,6 +33,7 @@
 #include "../base.h"
 #include "../math/math.h"
 #include "../graphics/graphics.h"
+#include "../memory/memory.h"
 
 namespace viewizard {
 
@@ -82,6 +83,7 @@ private:
 
 class cParticleSystem {
     friend std::weak_ptr<cParticleSystem> vw_CreateParticleSystem();
+    friend std::shared_ptr<cParticleSystem> vw_CreateParticleSystemPrefab();
 
 public:
     // Update all particles.
@@ -167,18 +169,23 @@ public:
     std::weak_ptr<cLight> Light{};
     bool LightNeedDeviation{false};
     float LightDeviation{100.0f};
-    float NextLightDeviation{0.7f + 0.3f * vw_fRand()};
-    float LightDeviationSpeed{3.5f + 3.5f * vw_fRand()};
+    // randomized in vw_CreateParticleSystem(), prefabs should not consume random numbers
+    float NextLightDeviation{0.7f};
+    float LightDeviationSpeed{3.5f};
 
     const sVECTOR3D &GetLocation()
     {
         return Location;
     }
 
+    // Copy settings (emission, size, alpha, color, speed, etc.) from prefab.
+    // Note, runtime state (particles, location, age) and light are not copied.
+    void CopySettings(const cParticleSystem &Prefab);
+
     // cycle for each particle in list, for external manipulations directly with particles data
-    void ForEachParticle(std::function<void (sVECTOR3D &pLocation,
-                         sVECTOR3D &pVelocity,
-                         bool &pNeedStop)> function)
+    void ForEachParticle(cFunctionRef<void (sVECTOR3D &pLocation,
+                                            sVECTOR3D &pVelocity,
+                                            bool &pNeedStop)> function)
     {
         for (auto &tmpParticle : ParticlesList) {
             function(tmpParticle.Location,
@@ -203,13 +210,13 @@ private:
     // Particle size correction by camera distance.
     void SizeCorrectionByCameraDist(cParticle &NewParticle);
     // Generate location for new particle (point type).
-    void GenerateLocationPointType(cParticle &NewParticle);
+    void GenerateLocationPointType(cParticle &NewParticle, const float *Rand);
     // Generate location for new particle (cube type).
-    void GenerateLocationCubeType(cParticle &NewParticle);
+    void GenerateLocationCubeType(cParticle &NewParticle, const float *Rand);
     // Generate location for new particle (tube type).
-    void GenerateLocationTubeType(cParticle &NewParticle);
+    void GenerateLocationTubeType(cParticle &NewParticle, const float *Rand);
     // Generate location for new particle (sphere type).
-    void GenerateLocationSphereType(cParticle &NewParticle);
+    void GenerateLocationSphereType(cParticle &NewParticle, const float *Rand);
 
     // Update light.
     void UpdateLight(float TimeDelta);
@@ -230,8 +237,8 @@ private:
                       sVECTOR3D{-1000000.0f, 1000000.0f, -1000000.0f},
                       sVECTOR3D{-1000000.0f, 1000000.0f, -1000000.0f}};
 
-    // particles
-    std::forward_list<cParticle> ParticlesList{};
+    // particles, list nodes are pooled, since particles are emitted and die all the time
+    std::forward_list<cParticle, cPoolAllocator<cParticle>> ParticlesList{};
     // we could use std::list with size(), but we don't need doubly-linked list here
     unsigned int ParticlesCountInList{0};
 
@@ -252,6 +259,8 @@ private:
 bool vw_InitParticleSystems(bool UseGLSL, float Quality);
 // Create particle system.
 std::weak_ptr<cParticleSystem> vw_CreateParticleSystem();
+// Create particle system prefab, not updated and not drawn, could be used as settings template only.
+std::shared_ptr<cParticleSystem> vw_CreateParticleSystemPrefab();
 // Release particle system, provided by shared_ptr.
 void vw_ReleaseParticleSystem(std::shared_ptr<cParticleSystem> &ParticleSystem);
 // Release particle system, provided by weak_ptr.
@@ -264,6 +273,8 @@ void vw_DrawAllParticleSystems();
 void vw_DrawParticleSystems(std::vector<std::weak_ptr<cParticleSystem>> &DrawParticleSystem);
 // Update all particle systems.
 void vw_UpdateAllParticleSystems(float Time);
+// Get particle systems count.
+unsigned vw_GetParticleSystemsCount();
 
 } // viewizard namespace
 
@@ -156,15 +156,15 @@ void cParticleSystem2D::EmitParticles(unsigned int Quantity, float TimeDelta)
         cParticle2D &NewParticle = ParticlesList.back();
 
         NewParticle.Age = 0.0f;
-        NewParticle.Lifetime = Life + vw_fRand0() * LifeVar;
+        NewParticle.Lifetime = Life + vw_fRand0(eRandStream::Particles) * LifeVar;
         if (NewParticle.Lifetime < 0.0f) {
             NewParticle.Lifetime = 0.0f;
         }
 
         // generate color
-        NewParticle.Color.r = ColorStart.r + vw_fRand0() * ColorVar.r;
-        NewParticle.Color.g = ColorStart.g + vw_fRand0() * ColorVar.g;
-        NewParticle.Color.b = ColorStart.b + vw_fRand0() * ColorVar.b;
+        NewParticle.Color.r = ColorStart.r + vw_fRand0(eRandStream::Particles) * ColorVar.r;
+        NewParticle.Color.g = ColorStart.g + vw_fRand0(eRandStream::Particles) * ColorVar.g;
+        NewParticle.Color.b = ColorStart.b + vw_fRand0(eRandStream::Particles) * ColorVar.b;
         vw_Clamp(NewParticle.Color.r, 0.0f, 1.0f);
         vw_Clamp(NewParticle.Color.g, 0.0f, 1.0f);
         vw_Clamp(NewParticle.Color.b, 0.0f, 1.0f);
@@ -175,7 +175,7 @@ void cParticleSystem2D::EmitParticles(unsigned int Quantity, float TimeDelta)
         NewParticle.ColorDelta.b = (ColorEnd.b - NewParticle.Color.b) / NewParticle.Lifetime;
 
         // generate alpha
-        NewParticle.Alpha = AlphaStart + vw_fRand0() * AlphaVar;
+        NewParticle.Alpha = AlphaStart + vw_fRand0(eRandStream::Particles) * AlphaVar;
         vw_Clamp(NewParticle.Alpha, 0.0f, 1.0f);
 
         switch (CreationType) {
@@ -192,7 +192,7 @@ void cParticleSystem2D::EmitParticles(unsigned int Quantity, float TimeDelta)
             break;
         }
 
-        NewParticle.Size = SizeStart + vw_fRand0() * SizeVar;
+        NewParticle.Size = SizeStart + vw_fRand0(eRandStream::Particles) * SizeVar;
         if (NewParticle.Size < 0.0f) {
             NewParticle.Size = 0.0f;
         }
@@ -201,7 +201,7 @@ void cParticleSystem2D::EmitParticles(unsigned int Quantity, float TimeDelta)
         SetupNewParticleDirection(NewParticle);
 
         // calculate velocity
-        float NewSpeed = Speed + vw_fRand0() * SpeedVar;
+        float NewSpeed = Speed + vw_fRand0(eRandStream::Particles) * SpeedVar;
         if (NewSpeed < 0.0f) {
             NewSpeed = 0.0f;
         }
@@ -233,9 +233,9 @@ void cParticleSystem2D::GenerateLocationPointType(cParticle2D &NewParticle)
  */
 void cParticleSystem2D::GenerateLocationQuadType(cParticle2D &NewParticle)
 {
-    NewParticle.Location = Location + sVECTOR3D{(1.0f - vw_fRand() * 2) * CreationSize.x,
-                                                (1.0f - vw_fRand() * 2) * CreationSize.y,
-                                                (1.0f - vw_fRand() * 2) * CreationSize.z};
+    NewParticle.Location = Location + sVECTOR3D{(1.0f - vw_fRand(eRandStream::Particles) * 2) * CreationSize.x,
+                                                (1.0f - vw_fRand(eRandStream::Particles) * 2) * CreationSize.y,
+                                                (1.0f - vw_fRand(eRandStream::Particles) * 2) * CreationSize.z};
 }
 
 /*
@@ -245,9 +245,9 @@ void cParticleSystem2D::GenerateLocationCircleType(cParticle2D &NewParticle)
 {
     // note, this is not really 'circle' type, since we use
     // vector instead of radius for initial location calculation
-    sVECTOR3D CreationPos{vw_fRand0() * CreationSize.x,
-                          vw_fRand0() * CreationSize.y,
-                          vw_fRand0() * CreationSize.z};
+    sVECTOR3D CreationPos{vw_fRand0(eRandStream::Particles) * CreationSize.x,
+                          vw_fRand0(eRandStream::Particles) * CreationSize.y,
+                          vw_fRand0(eRandStream::Particles) * CreationSize.z};
 
     if (DeadZone > 0.0f) {
         float ParticleDist2 = CreationPos.x * CreationPos.x
@@ -275,8 +275,8 @@ void cParticleSystem2D::SetupNewParticleDirection(cParticle2D &NewParticle)
         }
 
         // emit with deviation
-        float RandomYaw = vw_fRand0() * 3.14159f * 2.0f; // 2π = 360°
-        float RandomPitch = vw_fRand0() * Theta * 3.14159f / 180.0f; // convert Theta to radians
+        float RandomYaw = vw_fRand0(eRandStream::Particles) * 3.14159f * 2.0f; // 2π = 360°
+        float RandomPitch = vw_fRand0(eRandStream::Particles) * Theta * 3.14159f / 180.0f; // convert Theta to radians
 
         // y
         NewParticle.Velocity.y = Direction.y * cosf(RandomPitch);
@@ -296,9 +296,9 @@ void cParticleSystem2D::SetupNewParticleDirection(cParticle2D &NewParticle)
     }
 
     // emit in random direction
-    NewParticle.Velocity.y = vw_fRand0() * Theta / 360.0f;
-    NewParticle.Velocity.x = vw_fRand0() * Theta / 360.0f;
-    NewParticle.Velocity.z = vw_fRand0() * Theta / 360.0f;
+    NewParticle.Velocity.y = vw_fRand0(eRandStream::Particles) * Theta / 360.0f;
+    NewParticle.Velocity.x = vw_fRand0(eRandStream::Particles) * Theta / 360.0f;
+    NewParticle.Velocity.z = vw_fRand0(eRandStream::Particles) * Theta / 360.0f;
     NewParticle.Velocity.Normalize();
 }
 
@@ -435,6 +435,9 @@ void vw_UpdateAllParticleSystems2D(float Time)
  */
 void vw_DrawAllParticleSystems2D()
 {
+    // we use direct rendering here, draw all collected in 2D draw list first
+    vw_FlushDrawList2D();
+
     for (const auto &tmpParticleSystem : ParticleSystemsList) {
         tmpParticleSystem->Draw();
     }
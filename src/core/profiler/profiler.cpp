@@ -0,0 +1,411 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+/*
+Lightweight frame profiler. Scopes record CPU time (SDL performance counter) and,
+if requested and supported (GL_ARB_timer_query), GPU time by timestamp queries.
+Timestamp queries (instead of GL_TIME_ELAPSED) allow nested GPU scopes.
+
+GPU results are collected with few frames delay, in order to avoid pipeline stall,
+so, profiler's frame results are always few frames behind current frame.
+
+Trace could be written as Chrome trace_event JSON (chrome://tracing or Perfetto),
+or as CSV, if trace file name have ".csv" extension.
+*/
+
+#include "../graphics/graphics.h"
+#include "../math/math.h"
+#include "profiler.h"
+#include "SDL2/SDL.h"
+#include <fstream>
+
+namespace viewizard {
+
+namespace {
+
+// how many frames we keep for GPU results, GPU could be few frames behind CPU
+constexpr unsigned FramesInFlight{4};
+// how many query objects we generate at once, when frame's pool is exhausted
+constexpr unsigned QueriesPoolGrowth{32};
+
+struct sScopeRecord {
+    const char *Name{nullptr};
+    unsigned Depth{0};
+    // CPU timestamps in microseconds
+    uint64_t CPUStart{0};
+    uint64_t CPUEnd{0};
+    // first of two queries (start and end GPU timestamps) in frame's queries pool
+    int QueryIndex{-1};
+
+    explicit sScopeRecord(const char *_Name, unsigned _Depth, uint64_t _CPUStart, int _QueryIndex) :
+        Name{_Name},
+        Depth{_Depth},
+        CPUStart{_CPUStart},
+        CPUEnd{_CPUStart},
+        QueryIndex{_QueryIndex}
+    {}
+};
+
+struct sFrame {
+    std::vector<sScopeRecord> Scopes{};
+    std::vector<GLuint> Queries{};
+    unsigned UsedQueries{0};
+    // frame recorded, but results not collected yet
+    bool Pending{false};
+};
+
+struct sTraceEvent {
+    const char *Name{nullptr};
+    int ThreadID{0};
+    // in microseconds
+    uint64_t Start{0};
+    uint64_t Duration{0};
+
+    explicit sTraceEvent(const char *_Name, int _ThreadID, uint64_t _Start, uint64_t _Duration) :
+        Name{_Name},
+        ThreadID{_ThreadID},
+        Start{_Start},
+        Duration{_Duration}
+    {}
+};
+
+constexpr int TraceCPUThreadID{1};
+constexpr int TraceGPUThreadID{2};
+
+bool Enabled{false};
+bool FrameStarted{false};
+std::array<sFrame, FramesInFlight> Frames{};
+unsigned CurrentFrame{0};
+unsigned CurrentDepth{0};
+uint64_t PerformanceFrequency{0};
+uint64_t StartCounter{0};
+std::vector<sProfilerScopeTime> FrameResults{};
+
+std::string TraceFileName{};
+bool TraceActive{false};
+std::vector<sTraceEvent> TraceEvents{};
+
+} // unnamed namespace
+
+
+/*
+ * Get time from profiler start in microseconds.
+ */
+static uint64_t GetMicroseconds()
+{
+    if (!PerformanceFrequency) {
+        PerformanceFrequency = SDL_GetPerformanceFrequency();
+        StartCounter = SDL_GetPerformanceCounter();
+    }
+
+    uint64_t Counter = SDL_GetPerformanceCounter() - StartCounter;
+    // split calculation, in order to prevent overflow
+    return (Counter / PerformanceFrequency) * 1000000 +
+           (Counter % PerformanceFrequency) * 1000000 / PerformanceFrequency;
+}
+
+/*
+ * Should profiler record anything.
+ */
+static bool ProfilerActive()
+{
+    return Enabled || TraceActive;
+}
+
+/*
+ * Get two query objects (start and end timestamps) from frame's queries pool.
+ */
+static int GetQueries(sFrame &Frame)
+{
+    if (!vw_DevCaps().ARB_timer_query) {
+        return -1;
+    }
+
+    if (Frame.UsedQueries + 2 > Frame.Queries.size()) {
+        size_t OldSize = Frame.Queries.size();
+        Frame.Queries.resize(OldSize + QueriesPoolGrowth, 0);
+        if (!vw_GenTimerQueries(QueriesPoolGrowth, Frame.Queries.data() + OldSize)) {
+            Frame.Queries.resize(OldSize);
+            return -1;
+        }
+    }
+
+    int QueryIndex = static_cast<int>(Frame.UsedQueries);
+    Frame.UsedQueries += 2;
+    return QueryIndex;
+}
+
+/*
+ * Collect frame's results.
+ */
+static void CollectFrame(sFrame &Frame, bool WaitGPU)
+{
+    if (!Frame.Pending) {
+        return;
+    }
+
+    FrameResults.clear();
+    for (auto &tmpScope : Frame.Scopes) {
+        float GPUTime{-1.0f};
+        uint64_t GPUStart{0};
+        uint64_t GPUEnd{0};
+        if (tmpScope.QueryIndex >= 0
+            && vw_GetTimestampQueryResult(Frame.Queries[tmpScope.QueryIndex], GPUStart, WaitGPU)
+            && vw_GetTimestampQueryResult(Frame.Queries[tmpScope.QueryIndex + 1], GPUEnd, WaitGPU)
+            && GPUEnd >= GPUStart) {
+            GPUTime = static_cast<float>(GPUEnd - GPUStart) / 1000000.0f;
+            // GPU and CPU timestamps are not synchronized, place GPU event at CPU scope start
+            if (TraceActive) {
+                TraceEvents.emplace_back(tmpScope.Name, TraceGPUThreadID, tmpScope.CPUStart, (GPUEnd - GPUStart) / 1000);
+            }
+        }
+
+        FrameResults.emplace_back(tmpScope.Name, tmpScope.Depth,
+                                  static_cast<float>(tmpScope.CPUEnd - tmpScope.CPUStart) / 1000.0f, GPUTime);
+        if (TraceActive) {
+            TraceEvents.emplace_back(tmpScope.Name, TraceCPUThreadID, tmpScope.CPUStart,
+                                     tmpScope.CPUEnd - tmpScope.CPUStart);
+        }
+    }
+
+    Frame.Scopes.clear();
+    Frame.UsedQueries = 0;
+    Frame.Pending = false;
+}
+
+/*
+ * Constructor.
+ */
+cProfilerScope::cProfilerScope(const char *Name, bool GPUTime)
+{
+    if (!FrameStarted || !Name) {
+        return;
+    }
+
+    sFrame &Frame = Frames[CurrentFrame];
+    int QueryIndex{-1};
+    if (GPUTime) {
+        QueryIndex = GetQueries(Frame);
+        if (QueryIndex >= 0) {
+            vw_QueryTimestamp(Frame.Queries[QueryIndex]);
+        }
+    }
+
+    Index_ = static_cast<int>(Frame.Scopes.size());
+    Frame.Scopes.emplace_back(Name, CurrentDepth, GetMicroseconds(), QueryIndex);
+    CurrentDepth++;
+}
+
+/*
+ * Destructor.
+ */
+cProfilerScope::~cProfilerScope()
+{
+    if (Index_ < 0 || !FrameStarted) {
+        return;
+    }
+
+    sFrame &Frame = Frames[CurrentFrame];
+    // frame could be changed, if scope was not finished before vw_ProfilerEndFrame() call
+    if (static_cast<unsigned>(Index_) >= Frame.Scopes.size()) {
+        return;
+    }
+
+    sScopeRecord &Scope = Frame.Scopes[Index_];
+    Scope.CPUEnd = GetMicroseconds();
+    if (Scope.QueryIndex >= 0) {
+        vw_QueryTimestamp(Frame.Queries[Scope.QueryIndex + 1]);
+    }
+    if (CurrentDepth > 0) {
+        CurrentDepth--;
+    }
+}
+
+/*
+ * Enable or disable profiler (disabled profiler don't record anything).
+ */
+void vw_ProfilerEnable(bool Enable)
+{
+    Enabled = Enable;
+}
+
+/*
+ * Begin profiler's frame, should be called once per frame before any scopes.
+ */
+void vw_ProfilerBeginFrame()
+{
+    FrameStarted = false;
+    if (!ProfilerActive()) {
+        return;
+    }
+
+    CurrentFrame = (CurrentFrame + 1) % FramesInFlight;
+    // this frame slot was recorded FramesInFlight frames ago, GPU should be done with it
+    CollectFrame(Frames[CurrentFrame], false);
+
+    CurrentDepth = 0;
+    FrameStarted = true;
+}
+
+/*
+ * End profiler's frame, could collect frame's results immediately (wait for GPU results, if any).
+ */
+void vw_ProfilerEndFrame(bool CollectResults)
+{
+    if (!FrameStarted) {
+        return;
+    }
+
+    if (CurrentDepth) {
+        std::cerr << __func__ << "(): " << "Profiler's scope was not finished in frame.\n";
+    }
+
+    Frames[CurrentFrame].Pending = true;
+    FrameStarted = false;
+
+    if (CollectResults) {
+        CollectFrame(Frames[CurrentFrame], true);
+    }
+}
+
+/*
+ * Get last frame with all measured results (note, GPU results have few frames delay).
+ */
+const std::vector<sProfilerScopeTime> &vw_ProfilerGetFrameResults()
+{
+    return FrameResults;
+}
+
+/*
+ * Set file name for Chrome trace_event JSON, empty name disable tracing.
+ */
+void vw_ProfilerSetTraceFileName(const std::string &FileName)
+{
+    TraceFileName = FileName;
+}
+
+/*
+ * Start trace recording (if trace file name was set).
+ */
+void vw_ProfilerStartTrace()
+{
+    if (TraceFileName.empty()) {
+        return;
+    }
+
+    TraceEvents.clear();
+    TraceActive = true;
+}
+
+/*
+ * Write trace as Chrome trace_event JSON.
+ */
+static void WriteTraceJSON(std::ofstream &File)
+{
+    File << "{\"traceEvents\":[\n"
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << TraceCPUThreadID
+         << ",\"args\":{\"name\":\"CPU\"}},\n"
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << TraceGPUThreadID
+         << ",\"args\":{\"name\":\"GPU\"}}";
+
+    // names are string literals from code, no escape needed
+    for (auto &tmpEvent : TraceEvents) {
+        File << ",\n{\"name\":\"" << tmpEvent.Name << "\",\"cat\":\""
+             << (tmpEvent.ThreadID == TraceGPUThreadID ? "gpu" : "cpu")
+             << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tmpEvent.ThreadID
+             << ",\"ts\":" << tmpEvent.Start << ",\"dur\":" << tmpEvent.Duration << "}";
+    }
+
+    File << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+/*
+ * Write trace as CSV.
+ */
+static void WriteTraceCSV(std::ofstream &File)
+{
+    File << "thread;name;start_us;duration_us\n";
+    for (auto &tmpEvent : TraceEvents) {
+        File << (tmpEvent.ThreadID == TraceGPUThreadID ? "GPU" : "CPU") << ";"
+             << tmpEvent.Name << ";" << tmpEvent.Start << ";" << tmpEvent.Duration << "\n";
+    }
+}
+
+/*
+ * Stop trace recording and write trace file.
+ */
+void vw_ProfilerStopTrace()
+{
+    if (!TraceActive) {
+        return;
+    }
+
+    // collect all pending frames from oldest to newest
+    for (unsigned i = 1; i <= FramesInFlight; i++) {
+        CollectFrame(Frames[(CurrentFrame + i) % FramesInFlight], true);
+    }
+    TraceActive = false;
+
+    std::ofstream File(TraceFileName);
+    if (!File) {
+        std::cerr << __func__ << "(): " << "Can't open trace file for write: " << TraceFileName << "\n";
+        TraceEvents.clear();
+        return;
+    }
+
+    if (vw_CheckFileExtension(TraceFileName, ".csv")) {
+        WriteTraceCSV(File);
+    } else {
+        WriteTraceJSON(File);
+    }
+
+    std::cout << "Profiler's trace saved: " << TraceFileName << "\n";
+    TraceEvents.clear();
+    TraceEvents.shrink_to_fit();
+}
+
+/*
+ * Release profiler's OpenGL-related resources (should be called before OpenGL context release).
+ */
+void vw_ReleaseProfiler()
+{
+    vw_ProfilerStopTrace();
+
+    for (auto &tmpFrame : Frames) {
+        if (!tmpFrame.Queries.empty()) {
+            vw_DeleteTimerQueries(static_cast<GLsizei>(tmpFrame.Queries.size()), tmpFrame.Queries.data());
+        }
+        tmpFrame.Queries.clear();
+        tmpFrame.Scopes.clear();
+        tmpFrame.UsedQueries = 0;
+        tmpFrame.Pending = false;
+    }
+    FrameResults.clear();
+    FrameStarted = false;
+    CurrentDepth = 0;
+}
+
+} // viewizard namespace
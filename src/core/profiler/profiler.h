@@ -0,0 +1,86 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+#ifndef CORE_PROFILER_PROFILER_H
+#define CORE_PROFILER_PROFILER_H
+
+#include "../base.h"
+
+namespace viewizard {
+
+struct sProfilerScopeTime {
+    // scope's name (should be string literal, we don't copy it)
+    const char *Name{nullptr};
+    // nesting level
+    unsigned Depth{0};
+    // CPU time in milliseconds
+    float CPUTime{0.0f};
+    // GPU time in milliseconds (negative, if not measured or not available)
+    float GPUTime{-1.0f};
+
+    sProfilerScopeTime() = default;
+    explicit sProfilerScopeTime(const char *_Name, unsigned _Depth, float _CPUTime, float _GPUTime) :
+        Name{_Name},
+        Depth{_Depth},
+        CPUTime{_CPUTime},
+        GPUTime{_GPUTime}
+    {}
+};
+
+// Scoped timer, measure CPU time (and GPU time, if requested) from construction to destruction.
+// Usage: cProfilerScope ProfilerScope{"DrawAllObject3D", true};
+class cProfilerScope {
+public:
+    explicit cProfilerScope(const char *Name, bool GPUTime = false);
+    ~cProfilerScope();
+
+    cProfilerScope(const cProfilerScope &) = delete;
+    void operator = (const cProfilerScope &) = delete;
+
+private:
+    int Index_{-1};
+};
+
+// Enable or disable profiler (disabled profiler don't record anything).
+void vw_ProfilerEnable(bool Enable);
+// Begin profiler's frame, should be called once per frame before any scopes.
+void vw_ProfilerBeginFrame();
+// End profiler's frame, could collect frame's results immediately (wait for GPU results, if any).
+void vw_ProfilerEndFrame(bool CollectResults = false);
+// Get last frame with all measured results (note, GPU results have few frames delay).
+const std::vector<sProfilerScopeTime> &vw_ProfilerGetFrameResults();
+// Set file name for Chrome trace_event JSON, empty name disable tracing.
+void vw_ProfilerSetTraceFileName(const std::string &FileName);
+// Start trace recording (if trace file name was set).
+void vw_ProfilerStartTrace();
+// Stop trace recording and write trace file.
+void vw_ProfilerStopTrace();
+// Release profiler's OpenGL-related resources (should be called before OpenGL context release).
+void vw_ReleaseProfiler();
+
+} // viewizard namespace
+
+#endif // CORE_PROFILER_PROFILER_H
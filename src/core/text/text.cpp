@@ -25,22 +25,28 @@
 
 *****************************************************************************/
 
-// TODO since we use std::unordered_map with hashes now, work with text should be revised -
-//      TextID should be removed, and English text should be used as ID and "default" text
+// NOTE English text used as text item (ID) and "default" text
 
 #include "../math/math.h"
 #include "../vfs/vfs.h"
 #include "../font/font.h"
 #include "text.h"
+#include <deque>
 
 namespace viewizard {
 
 namespace {
 
-// Map of Maps with all sorted language data in utf8.
-std::unordered_map<unsigned int, std::unordered_map<std::string, std::string>> TextTable;
-// Map of Maps with all sorted language data in utf32.
-std::unordered_map<unsigned int, std::unordered_map<std::string, std::u32string>> TextTableUTF32;
+// Interned text items, index is text ID. Never released, so, IDs could be stored by callers.
+std::vector<std::string> TextItems{};
+// Text items hash to text ID (we could have hash collisions).
+std::unordered_multimap<unsigned, unsigned> TextItemsIDs{};
+// All language data in utf8, [Language][TextID].
+// Note, deque don't invalidate references on push_back(), since missed elements could be
+// added on any lookup, all previously returned by vw_GetText() references should stay valid.
+std::vector<std::deque<std::string>> TextTable{};
+// All language data in utf32, [Language][TextID].
+std::vector<std::deque<std::u32string>> TextTableUTF32{};
 // Current default language. English, by default.
 unsigned int CurrentLanguage{0};
 // all characters used in text for current language
@@ -49,24 +55,54 @@ std::unordered_set<char32_t> CharsSetForLanguage;
 } // unnamed namespace
 
 /*
- * Detect element in std::unordered_map<std::unordered_map<>>.
+ * Text item hash (djb2a), without temporary strings creation.
  */
-template <typename T, typename C, typename R>
-static bool isElementPresentInTable(T &Table, C Column, R &Row)
+static unsigned HashTextItem(const char *ItemID)
 {
-    return (Table.find(Column) != Table.end()
-            && Table[Column].find(Row) != Table[Column].end());
+    unsigned Hash{5381};
+    for (; *ItemID != '\0'; ItemID++) {
+        Hash = (Hash * 33) ^ static_cast<unsigned char>(*ItemID);
+    }
+    return Hash;
 }
 
 /*
- * Unconditional rehash for std::unordered_map<std::unordered_map<>>.
+ * Get text ID for ItemID (interned, stay the same until application exit).
  */
-template <typename T>
-static void UnconditionalRehash(T &Table)
+unsigned vw_GetTextID(const char *ItemID)
 {
-    Table.rehash(0);
-    for (auto &tmpColumn : Table) {
-        tmpColumn.second.rehash(0);
+    unsigned Hash = HashTextItem(ItemID);
+    auto tmpRange = TextItemsIDs.equal_range(Hash);
+    for (auto iter = tmpRange.first; iter != tmpRange.second; ++iter) {
+        if (TextItems[iter->second] == ItemID) {
+            return iter->second;
+        }
+    }
+
+    unsigned TextID = static_cast<unsigned>(TextItems.size());
+    TextItems.emplace_back(ItemID);
+    TextItemsIDs.emplace(Hash, TextID);
+    return TextID;
+}
+
+/*
+ * Add missed elements to all languages. Text for missed elements is the text item itself.
+ */
+static void CompleteTextTable()
+{
+    // make sure, we have at least one language (English)
+    if (TextTable.empty()) {
+        TextTable.resize(1);
+        TextTableUTF32.resize(1);
+    }
+
+    for (unsigned int i = 0; i < TextTable.size(); i++) {
+        for (unsigned TextID = static_cast<unsigned>(TextTable[i].size()); TextID < TextItems.size(); TextID++) {
+            TextTable[i].push_back(TextItems[TextID]);
+        }
+        for (unsigned TextID = static_cast<unsigned>(TextTableUTF32[i].size()); TextID < TextItems.size(); TextID++) {
+            TextTableUTF32[i].push_back(ConvertUTF8.from_bytes(TextTable[i][TextID]));
+        }
     }
 }
 
@@ -95,25 +131,12 @@ unsigned int vw_GetLanguageListCount()
  */
 void vw_ReleaseText()
 {
+    // note, we don't release TextItems, since text IDs could be stored by callers
     TextTable.clear();
     TextTableUTF32.clear();
     CurrentLanguage = 0; // English
 }
 
-/*
- * Create text table with utf32 data (convert TextTable data for utf8 to utf32).
- */
-static void CreateTextTableUTF32()
-{
-    for (unsigned int i = 0; i < TextTable.size(); i++) {
-        for (const auto &tmpData : TextTable[i]) {
-            TextTableUTF32[i][tmpData.first] = ConvertUTF8.from_bytes(tmpData.second);
-        }
-    }
-    // unconditional rehash, at this line we have not rehashed map
-    UnconditionalRehash(TextTableUTF32);
-}
-
 /*
  * Parse each row's block, separated by 1.SymbolSeparator, 2.SymbolEndOfLine, 3.EOF
  */
@@ -173,7 +196,9 @@ int vw_InitText(const char *FileName, const char SymbolSeparator, const char Sym
     // parse data by each byte, in order to use string as RowCode - build
     // RowCode first, only after that, initialize new TextTable row
     bool NeedBuildCurrentRowCode = true;
-    std::string CurrentRowCode;
+    unsigned CurrentRowID{0};
+    // loaded columns number for each row, also used for duplicate lines detection
+    std::vector<unsigned> LoadedColumns{};
     unsigned int CurrentColumnNumber{0};
     unsigned int LineNumber{1}; // line number for error message
     for (long i = 0; i < tmpFile->GetSize(); i++) {
@@ -191,20 +216,31 @@ int vw_InitText(const char *FileName, const char SymbolSeparator, const char Sym
                 return ERR_FILE_IO;
             }
             if (NeedBuildCurrentRowCode) {
-                CurrentRowCode = CurrentRowTextBlock;
+                CurrentRowID = vw_GetTextID(CurrentRowTextBlock.c_str());
                 // RowCode built, next blocks in this row contain data
                 NeedBuildCurrentRowCode = false;
+                // detect and skip duplicate line
+                if (CurrentRowID < LoadedColumns.size() && LoadedColumns[CurrentRowID] > 0) {
+                    std::cerr << __func__ << "(): " << "* Duplicate line detected, line number "
+                              << LineNumber << "\n";
+                    for (; (tmpFile->GetData()[i] != SymbolEndOfLine) && (i < tmpFile->GetSize()); i++) {}
+                    break;
+                }
+                if (CurrentRowID >= LoadedColumns.size()) {
+                    LoadedColumns.resize(CurrentRowID + 1, 0);
+                }
             }
             // we use column 0 with same row code, in order to make code simple and clear
             // plus, for UTF32 we need a column to store English UTF8 -> UTF32 conversion results
-            TextTable[CurrentColumnNumber][CurrentRowCode] = CurrentRowTextBlock;
-            CurrentColumnNumber++;
-            // detect and skip duplicate line (if we already have this element created => this is duplicate)
-            if (isElementPresentInTable(TextTable, CurrentColumnNumber, CurrentRowCode)) {
-                std::cerr << __func__ << "(): " << "* Duplicate line detected, line number "
-                          << LineNumber << "\n";
-                for (; (tmpFile->GetData()[i] != SymbolEndOfLine) && (i < tmpFile->GetSize()); i++) {}
+            if (CurrentColumnNumber >= TextTable.size()) {
+                TextTable.resize(CurrentColumnNumber + 1);
+            }
+            if (CurrentRowID >= TextTable[CurrentColumnNumber].size()) {
+                TextTable[CurrentColumnNumber].resize(CurrentRowID + 1);
             }
+            TextTable[CurrentColumnNumber][CurrentRowID] = CurrentRowTextBlock;
+            CurrentColumnNumber++;
+            LoadedColumns[CurrentRowID] = CurrentColumnNumber;
             // we found SymbolEndOfLine in previous cycle, in order to prevent "i" changes, break cycle
             if (tmpFile->GetData()[i] == SymbolEndOfLine) {
                 break;
@@ -213,13 +249,19 @@ int vw_InitText(const char *FileName, const char SymbolSeparator, const char Sym
         // move to next row
         CurrentColumnNumber = 0;
         NeedBuildCurrentRowCode = true;
-        CurrentRowCode.clear();
         LineNumber++;
     }
-    // unconditional rehash, at this line we have not rehashed map
-    UnconditionalRehash(TextTable);
 
-    CreateTextTableUTF32();
+    // rows could be shorter than languages list, use text item itself for missed elements
+    for (unsigned int i = 0; i < TextTable.size(); i++) {
+        for (unsigned TextID = 0; TextID < TextTable[i].size(); TextID++) {
+            if (TextID >= LoadedColumns.size() || i >= LoadedColumns[TextID]) {
+                TextTable[i][TextID] = TextItems[TextID];
+            }
+        }
+    }
+    TextTableUTF32.resize(TextTable.size());
+    CompleteTextTable();
 
     std::cout << "Detected " << vw_GetLanguageListCount() << " languages:";
     for (unsigned int i = 0; i < TextTable.size(); i++) {
@@ -232,56 +274,57 @@ int vw_InitText(const char *FileName, const char SymbolSeparator, const char Sym
 /*
  * Get UTF8 text for particular language.
  */
-const std::string &vw_GetText(const std::string &ItemID, unsigned int Language)
+const std::string &vw_GetText(unsigned TextID, unsigned int Language)
 {
-    if (Language > vw_GetLanguageListCount()) {
+    if (Language >= vw_GetLanguageListCount()) {
         Language = CurrentLanguage;
     }
 
-    auto tmpText = TextTable[Language].find(ItemID);
-    if (tmpText != TextTable[Language].end()) {
-        return tmpText->second;
+    // TextID could be created after text table was loaded
+    if (Language >= TextTable.size() || TextID >= TextTable[Language].size()) {
+        std::cout << "Added to text table for all languages: \"" << TextItems[TextID] << "\"\n";
+        CompleteTextTable();
     }
 
-    // ItemID should be added to TextTable for key and all languages, and
-    // we should return pointer to this new entry, but not ItemID
-    // make sure, vw_GetLanguageListCount() is called instead of size(),
-    // since we could have an empty table (languages was not loaded)
-    for (unsigned int i = 0; i < vw_GetLanguageListCount(); i++) {
-        TextTable[i][ItemID] = ItemID;
-    }
+    return TextTable[Language][TextID];
+}
 
-    std::cout << "Added to text table for all languages: \"" << ItemID << "\"\n";
+const std::string &vw_GetText(const char *ItemID, unsigned int Language)
+{
+    return vw_GetText(vw_GetTextID(ItemID), Language);
+}
 
-    return TextTable[Language][ItemID];
+const std::string &vw_GetText(const std::string &ItemID, unsigned int Language)
+{
+    return vw_GetText(vw_GetTextID(ItemID.c_str()), Language);
 }
 
 /*
  * Get UTF32 text for particular language.
  */
-const std::u32string &vw_GetTextUTF32(const std::string &ItemID, unsigned int Language)
+const std::u32string &vw_GetTextUTF32(unsigned TextID, unsigned int Language)
 {
-    if (Language > vw_GetLanguageListCount()) {
+    if (Language >= vw_GetLanguageListCount()) {
         Language = CurrentLanguage;
     }
 
-    auto tmpText = TextTableUTF32[Language].find(ItemID);
-    if (tmpText != TextTableUTF32[Language].end()) {
-        return tmpText->second;
+    // TextID could be created after text table was loaded
+    if (Language >= TextTableUTF32.size() || TextID >= TextTableUTF32[Language].size()) {
+        std::cout << "Added to text table for all languages: \"" << TextItems[TextID] << "\"\n";
+        CompleteTextTable();
     }
 
-    // ItemID should be converted to UTF32 and added to TextTableUTF32 for all languages,
-    // and we should return pointer to this new entry, but not TextTableUTF32Error
-    std::u32string tmpTextUTF32 = ConvertUTF8.from_bytes(ItemID);
-    // make sure, vw_GetLanguageListCount() is called instead of size(),
-    // since we could have an empty table (languages was not loaded)
-    for (unsigned int i = 0; i < vw_GetLanguageListCount(); i++) {
-        TextTableUTF32[i][ItemID] = tmpTextUTF32;
-    }
+    return TextTableUTF32[Language][TextID];
+}
 
-    std::cout << "Added to text table for all languages: \"" << ItemID << "\"\n";
+const std::u32string &vw_GetTextUTF32(const char *ItemID, unsigned int Language)
+{
+    return vw_GetTextUTF32(vw_GetTextID(ItemID), Language);
+}
 
-    return TextTableUTF32[Language][ItemID];
+const std::u32string &vw_GetTextUTF32(const std::string &ItemID, unsigned int Language)
+{
+    return vw_GetTextUTF32(vw_GetTextID(ItemID.c_str()), Language);
 }
 
 /*
@@ -307,7 +350,7 @@ std::unordered_set<char32_t> &vw_FindCharsSetForLanguage()
         }
     } else {
         for (const auto &tmpWords : TextTableUTF32[CurrentLanguage]) {
-            for (const auto &UTF32 : tmpWords.second) {
+            for (const auto &UTF32 : tmpWords) {
                 CharsSetForLanguage.insert(UTF32);
             }
         }
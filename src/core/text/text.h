@@ -36,10 +36,26 @@ namespace viewizard {
 int vw_InitText(const char *FileName, const char SymbolSeparator, const char SymbolEndOfLine);
 // Set default language.
 void vw_SetTextLanguage(unsigned int Language);
+// Get text ID for ItemID (interned, stay the same until application exit).
+unsigned vw_GetTextID(const char *ItemID);
+// Get text ID for string literal, interned on first call and cached at the call place,
+// in order to avoid string hashing for per-frame lookups (menu's labels, for example).
+#define VW_TEXT_ID(ItemID) ([] () -> unsigned { \
+    static const unsigned tmpTextID{viewizard::vw_GetTextID(ItemID)}; \
+    return tmpTextID; \
+}())
 // Get UTF8 text for particular language.
+const std::string &vw_GetText(unsigned TextID,
+                              unsigned int Language = 999999 /*should be greater than loaded languages number*/);
+const std::string &vw_GetText(const char *ItemID,
+                              unsigned int Language = 999999 /*should be greater than loaded languages number*/);
 const std::string &vw_GetText(const std::string &ItemID,
                               unsigned int Language = 999999 /*should be greater than loaded languages number*/);
 // Get UTF32 text for particular language.
+const std::u32string &vw_GetTextUTF32(unsigned TextID,
+                                      unsigned int Language = 999999 /*should be greater than loaded languages number*/);
+const std::u32string &vw_GetTextUTF32(const char *ItemID,
+                                      unsigned int Language = 999999 /*should be greater than loaded languages number*/);
 const std::u32string &vw_GetTextUTF32(const std::string &ItemID,
                                       unsigned int Language = 999999 /*should be greater than loaded languages number*/);
 // Find all used in text characters for current language.
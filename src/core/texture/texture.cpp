@@ -151,6 +151,8 @@ void vw_ReleaseTexture(GLtexture TextureID)
  */
 void vw_ReleaseAllTextures()
 {
+    vw_ReleaseTextureAtlas();
+
     for (auto &tmpTexture : TexturesIDtoDataMap) {
         vw_DeleteTexture(tmpTexture.first);
     }
@@ -394,26 +396,19 @@ void vw_ConvertImageToVW2D(const std::string &SrcName, const std::string &DestNa
 }
 
 /*
- * Load texture from file.
+ * Read texture file.
  */
-GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType CompressionType,
-                         eLoadTextureAs LoadAs, int NeedResizeW, int NeedResizeH)
+static bool ReadTextureFile(const std::string &TextureName, eLoadTextureAs LoadAs,
+                            std::unique_ptr<uint8_t[]> &PixelsArray, int &DWidth, int &DHeight, int &DChanels)
 {
     if (TextureName.empty()) {
-        return 0;
+        return false;
     }
 
-    int DWidth{0};
-    int DHeight{0};
-    int DChanels{0};
-    // std::unique_ptr, we need only memory allocation without container's features
-    // don't use std::vector here, since it allocates AND value-initializes
-    std::unique_ptr<uint8_t[]> tmpPixelsArray{};
-
     std::unique_ptr<cFILE> pFile = vw_fopen(TextureName);
     if (!pFile) {
         std::cerr << __func__ << "(): " << "Unable to found " << TextureName << "\n";
-        return 0;
+        return false;
     }
 
     // check extension
@@ -430,7 +425,7 @@ GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType
     // load texture
     switch (LoadAs) {
     case eLoadTextureAs::TGA:
-        ReadTGA(tmpPixelsArray, pFile.get(), DWidth, DHeight, DChanels);
+        ReadTGA(PixelsArray, pFile.get(), DWidth, DHeight, DChanels);
         break;
 
     case eLoadTextureAs::VW2D:
@@ -444,35 +439,93 @@ GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType
             uint32_t Sign;
             if (pFile->fread(&Sign, 4, 1) != 1 ||
                 Sign != SignVW2D) {
-                return 0;
+                return false;
             }
         }
         if (pFile->fread(&DWidth, sizeof(DWidth), 1) != 1 ||
             pFile->fread(&DHeight, sizeof(DHeight), 1) != 1 ||
             pFile->fread(&DChanels, sizeof(DChanels), 1) != 1) {
-            return 0;
+            return false;
         }
-        tmpPixelsArray.reset(new uint8_t[DWidth * DHeight * DChanels]);
-        if (pFile->fread(tmpPixelsArray.get(), DWidth * DHeight * DChanels, 1) != 1) {
-            return 0;
+        PixelsArray.reset(new uint8_t[DWidth * DHeight * DChanels]);
+        if (pFile->fread(PixelsArray.get(), DWidth * DHeight * DChanels, 1) != 1) {
+            return false;
         }
         break;
 
     default:
-        return 0;
+        return false;
     }
 
-    if (!tmpPixelsArray.get()) {
+    if (!PixelsArray.get()) {
         std::cerr << __func__ << "(): " << "Unable to load " << TextureName << "\n";
-        return 0;
+        return false;
     }
 
     vw_fclose(pFile);
+    return true;
+}
+
+/*
+ * Create or remove alpha channel, according to current texture properties.
+ */
+static void SetupAlpha(std::unique_ptr<uint8_t[]> &PixelsArray, sTexture &Texture)
+{
+    // if we have alpha channel, but don't need them - remove
+    if (Texture.Bytes == 4 && !AlphaTex) {
+        RemoveAlpha(PixelsArray, Texture);
+    // if we don't have alpha channel, but need them - create
+    } else if (Texture.Bytes == 3 && AlphaTex) {
+        CreateAlpha(PixelsArray, Texture, AFlagTex);
+    }
+}
+
+/*
+ * Load texture from file.
+ */
+GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType CompressionType,
+                         eLoadTextureAs LoadAs, int NeedResizeW, int NeedResizeH)
+{
+    int DWidth{0};
+    int DHeight{0};
+    int DChanels{0};
+    // std::unique_ptr, we need only memory allocation without container's features
+    // don't use std::vector here, since it allocates AND value-initializes
+    std::unique_ptr<uint8_t[]> tmpPixelsArray{};
+
+    if (!ReadTextureFile(TextureName, LoadAs, tmpPixelsArray, DWidth, DHeight, DChanels)) {
+        return 0;
+    }
 
     return vw_CreateTextureFromMemory(TextureName, tmpPixelsArray, DWidth, DHeight, DChanels,
                                       CompressionType, NeedResizeW, NeedResizeH);
 }
 
+/*
+ * Load texture pixels from file, alpha channel will be created or removed according
+ * to current texture properties. Result always have 4 bytes per pixel (BGRA).
+ */
+bool vw_LoadTexturePixels(const std::string &TextureName, std::unique_ptr<uint8_t[]> &PixelsArray,
+                          int &Width, int &Height)
+{
+    sTexture tmpTexture{};
+    if (!ReadTextureFile(TextureName, eLoadTextureAs::AUTO, PixelsArray,
+                         tmpTexture.Width, tmpTexture.Height, tmpTexture.Bytes)
+        || tmpTexture.Width <= 0 || tmpTexture.Height <= 0) {
+        return false;
+    }
+
+    SetupAlpha(PixelsArray, tmpTexture);
+    // texture without alpha channel, fill alpha channel with 255
+    if (tmpTexture.Bytes == 3) {
+        CreateAlpha(PixelsArray, tmpTexture, eAlphaCreateMode::NONE);
+    }
+
+    Width = tmpTexture.Width;
+    Height = tmpTexture.Height;
+    return true;
+}
+
 /*
  * Create texture from memory.
  */
@@ -490,13 +543,7 @@ GLtexture vw_CreateTextureFromMemory(const std::string &TextureName, std::unique
     newTexture.Height = ImageHeight;
     newTexture.Bytes = ImageChanels;
 
-    // if we have alpha channel, but don't need them - remove
-    if (newTexture.Bytes == 4 && !AlphaTex) {
-        RemoveAlpha(PixelsArray, newTexture);
-    // if we don't have alpha channel, but need them - create
-    } else if (newTexture.Bytes == 3 && AlphaTex) {
-        CreateAlpha(PixelsArray, newTexture, AFlagTex);
-    }
+    SetupAlpha(PixelsArray, newTexture);
 
     // Note, in case of resize, we should provide width and height (but not just one of them).
     if (NeedResizeW && NeedResizeH) {
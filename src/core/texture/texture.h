@@ -69,6 +69,22 @@ void vw_SetTextureAlpha(uint8_t nARed, uint8_t nAGreen, uint8_t nABlue);
 bool vw_FindTextureSizeByID(GLtexture TextureID, float *Width = nullptr, float *Height = nullptr);
 // Convert supported image file format to VW2D format.
 void vw_ConvertImageToVW2D(const std::string &SrcName, const std::string &DestName);
+// Load texture pixels from file (BGRA), alpha channel created according to current texture properties.
+bool vw_LoadTexturePixels(const std::string &TextureName, std::unique_ptr<uint8_t[]> &PixelsArray,
+                          int &Width, int &Height);
+
+/*
+ * texture_atlas
+ */
+
+// Load texture into texture atlas, should be called before vw_BuildTextureAtlas().
+bool vw_AddTextureToAtlas(unsigned RegionKey, const std::string &TextureName, int MaxSpriteSize);
+// Pack all added textures into atlas pages and create pages textures with current texture properties.
+void vw_BuildTextureAtlas(int PageSize);
+// Find texture atlas region by key.
+bool vw_FindTextureAtlasRegion(unsigned RegionKey, sTextureRegion &Region);
+// Release all texture atlas pages and regions.
+void vw_ReleaseTextureAtlas();
 
 } // viewizard namespace
 
@@ -0,0 +1,210 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE texture atlas pages could be created offline and stored in VFS (pages + regions
+//      description file), for now, we pack sprites on assets load, this is fast enough
+
+#include "../math/math.h"
+#include "texture.h"
+#include <algorithm>
+#include <cstring>
+
+namespace viewizard {
+
+namespace {
+
+// Sprite padding (in pixels), sprite's edge pixels duplicated into padding,
+// in order to prevent filtering artifacts from neighbor sprites.
+constexpr int SpritePadding{1};
+
+struct sAtlasSprite {
+    unsigned RegionKey{0};
+    // BGRA
+    std::unique_ptr<uint8_t[]> PixelsArray{};
+    int Width{0};
+    int Height{0};
+};
+
+// Sprites, that should be packed on vw_BuildTextureAtlas() call.
+std::vector<sAtlasSprite> PendingSprites{};
+// All created atlas regions.
+std::unordered_map<unsigned, sTextureRegion> AtlasRegions{};
+// All created atlas pages textures.
+std::vector<GLtexture> AtlasPages{};
+
+} // unnamed namespace
+
+
+/*
+ * Load texture into texture atlas, should be called before vw_BuildTextureAtlas().
+ * Return false, if texture can't be loaded or too big for atlas (caller should
+ * create separate texture in this case).
+ */
+bool vw_AddTextureToAtlas(unsigned RegionKey, const std::string &TextureName, int MaxSpriteSize)
+{
+    sAtlasSprite tmpSprite{};
+    tmpSprite.RegionKey = RegionKey;
+    if (!vw_LoadTexturePixels(TextureName, tmpSprite.PixelsArray, tmpSprite.Width, tmpSprite.Height)
+        || tmpSprite.Width > MaxSpriteSize || tmpSprite.Height > MaxSpriteSize) {
+        return false;
+    }
+
+    PendingSprites.emplace_back(std::move(tmpSprite));
+    return true;
+}
+
+/*
+ * Copy sprite into page pixels array (with edge pixels duplication into padding).
+ * X and Y - sprite's position in page's pixels array, without padding.
+ */
+static void CopySpriteToPage(const sAtlasSprite &Sprite, uint8_t *PagePixels, int PageSize, int X, int Y)
+{
+    constexpr int Bytes{4};
+    for (int i = -SpritePadding; i < Sprite.Height + SpritePadding; i++) {
+        int SrcRow = std::min(std::max(i, 0), Sprite.Height - 1);
+        uint8_t *DstLine = PagePixels + ((Y + i) * PageSize + X) * Bytes;
+        const uint8_t *SrcLine = Sprite.PixelsArray.get() + SrcRow * Sprite.Width * Bytes;
+
+        memcpy(DstLine, SrcLine, Sprite.Width * Bytes);
+        for (int j = 1; j <= SpritePadding; j++) {
+            memcpy(DstLine - j * Bytes, SrcLine, Bytes);
+            memcpy(DstLine + (Sprite.Width - 1 + j) * Bytes, SrcLine + (Sprite.Width - 1) * Bytes, Bytes);
+        }
+    }
+}
+
+/*
+ * Pack all added textures into atlas pages and create pages textures with current texture properties.
+ * Caller should care about texture properties (vw_SetTextureProp()), alpha channel should be enabled.
+ */
+void vw_BuildTextureAtlas(int PageSize)
+{
+    if (PendingSprites.empty()) {
+        return;
+    }
+
+    if (vw_DevCaps().MaxTextureWidth > 0) {
+        PageSize = std::min(PageSize, vw_DevCaps().MaxTextureWidth);
+    }
+    if (vw_DevCaps().MaxTextureHeight > 0) {
+        PageSize = std::min(PageSize, vw_DevCaps().MaxTextureHeight);
+    }
+
+    // shelf packing, sort by height first
+    std::stable_sort(PendingSprites.begin(), PendingSprites.end(),
+                     [] (const sAtlasSprite &A, const sAtlasSprite &B) {
+        return A.Height > B.Height;
+    });
+
+    std::unique_ptr<uint8_t[]> tmpPagePixels{};
+    int ShelfX{0};
+    int ShelfY{0};
+    int ShelfHeight{0};
+
+    auto CreatePage = [&] () {
+        if (!tmpPagePixels) {
+            return;
+        }
+        std::string tmpPageName{"texture atlas page " + std::to_string(AtlasPages.size())};
+        AtlasPages.push_back(vw_CreateTextureFromMemory(tmpPageName, tmpPagePixels, PageSize, PageSize, 4));
+        tmpPagePixels.reset();
+    };
+
+    for (auto &tmpSprite : PendingSprites) {
+        int tmpWidth = tmpSprite.Width + SpritePadding * 2;
+        int tmpHeight = tmpSprite.Height + SpritePadding * 2;
+        if (tmpWidth > PageSize || tmpHeight > PageSize) {
+            continue;
+        }
+
+        // move to next shelf
+        if (ShelfX + tmpWidth > PageSize) {
+            ShelfX = 0;
+            ShelfY += ShelfHeight;
+            ShelfHeight = 0;
+        }
+        // move to next page
+        if (ShelfY + tmpHeight > PageSize) {
+            CreatePage();
+            ShelfX = 0;
+            ShelfY = 0;
+            ShelfHeight = 0;
+        }
+        if (!tmpPagePixels) {
+            tmpPagePixels.reset(new uint8_t[PageSize * PageSize * 4]);
+            memset(tmpPagePixels.get(), 0, PageSize * PageSize * 4);
+        }
+
+        CopySpriteToPage(tmpSprite, tmpPagePixels.get(), PageSize, ShelfX + SpritePadding, ShelfY + SpritePadding);
+        // pixels array rows stored from bottom to top, but regions origin is upper left corner
+        AtlasRegions[tmpSprite.RegionKey] = sTextureRegion{static_cast<GLtexture>(AtlasPages.size()),
+                                                           ShelfX + SpritePadding,
+                                                           PageSize - (ShelfY + SpritePadding) - tmpSprite.Height};
+
+        ShelfX += tmpWidth;
+        ShelfHeight = std::max(ShelfHeight, tmpHeight);
+    }
+    CreatePage();
+    PendingSprites.clear();
+
+    // at this point, regions contain pages numbers instead of textures
+    for (auto &tmpRegion : AtlasRegions) {
+        tmpRegion.second.Texture = AtlasPages[tmpRegion.second.Texture];
+    }
+
+    std::cout << "Texture atlas created: " << AtlasRegions.size() << " sprites, "
+              << AtlasPages.size() << " pages " << PageSize << "x" << PageSize << "\n";
+}
+
+/*
+ * Find texture atlas region by key.
+ */
+bool vw_FindTextureAtlasRegion(unsigned RegionKey, sTextureRegion &Region)
+{
+    auto tmpRegion = AtlasRegions.find(RegionKey);
+    if (tmpRegion == AtlasRegions.end() || !tmpRegion->second.Texture) {
+        return false;
+    }
+
+    Region = tmpRegion->second;
+    return true;
+}
+
+/*
+ * Release all texture atlas pages and regions.
+ */
+void vw_ReleaseTextureAtlas()
+{
+    for (auto &tmpPage : AtlasPages) {
+        vw_ReleaseTexture(tmpPage);
+    }
+    AtlasPages.clear();
+    AtlasRegions.clear();
+    PendingSprites.clear();
+}
+
+} // viewizard namespace
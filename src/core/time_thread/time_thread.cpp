@@ -32,23 +32,15 @@ we could "pause" game by stop the time flowing, or just "slowdown" some objects.
 This code provide "time thread" mechanism that allow manipulate time inside time
 thread or even "stop" time inside time thread.
 
+Time threads work with 64-bit ticks in microseconds and sampled only once per
+main loop cycle by vw_UpdateTimeThreads() call, so, vw_GetTimeThread() is cheap
+and return same time for all calls inside one loop cycle. Since we don't accumulate
+time in float, there is no precision loss during long sessions.
+
 In common cases, if time manipulations feature not a goal, SDL_GetTicks() provide
 same functionality.
 */
 
-// TODO the main idea of time calculation should be revised for discrete time
-//      Since we don't know how expensive SDL_GetTicks() is (on different platforms),
-//      no reason call SDL_GetTicks() all the time for animation/gfx. One time update
-//      for thread peer loop cycle should be enough.
-//      * see UpdateAllObject3D() - we already use this idea for all objects update.
-//      (!) make sure, all vw_GetTimeThread() usage changed to SDL_GetTicks() where
-//      it is necessary.
-
-// TODO (?) change concept of TimeThreads from 'time' in float to 'ticks' in uint32_t, so,
-//      this will looks like SDL_GetTicks() work, but with time manipulations. From one side,
-//      we don't need float at all (with specific accuracy and other float-related issues),
-//      from another side, ticks in milliseconds that all we really need.
-
 #include "../base.h"
 #include "../math/math.h"
 #include "SDL2/SDL.h"
@@ -57,37 +49,155 @@ namespace viewizard {
 
 namespace {
 
+// time thread number should be in [0, MaxTimeThreads) range
+constexpr int MaxTimeThreads{4};
+
 struct sTimeThread {
+    bool Initialized{false};
     // current time thread pause status
     bool Paused{true};
-    // last ticks, in order to care about time thread pause
-    uint32_t LastGetTicks{0};
+    // ticks on pause, in order to care about time thread pause
+    uint64_t PauseTicks{0};
     // "time point", ticks of last speed change
-    uint32_t DiffGetTicks{0};
+    uint64_t SpeedChangeTicks{0};
     // current time thread speed
     float Speed{1.0f};
-    // all "previous time" on last speed change
-    float Buffer{0.0f};
+    // all "previous time" on last speed change, in microseconds
+    uint64_t Buffer{0};
+    // time sampled by last vw_UpdateTimeThreads() call
+    uint64_t CurrentTicks{0};
+    float CurrentTime{0.0f};
 };
 
-// std::unordered_map - caller could use any integer thread number (negative also
-// allowed), we need container with operator [], that create new element on access
-// and could use any integer number as index.
-std::unordered_map<int, sTimeThread> TimeThreadsMap;
+std::array<sTimeThread, MaxTimeThreads> TimeThreads{};
+
+// ticks sampled by last vw_UpdateTimeThreads() call
+uint64_t SampledTicks{0};
+
+// virtual ticks, in order to drive time threads by caller (headless replay, benchmark)
+bool UseVirtualTicks{false};
+uint64_t VirtualTicks{0};
+
+uint64_t PerformanceFrequency{0};
+uint64_t StartCounter{0};
 
 } // unnamed namespace
 
 
+/*
+ * Get ticks in microseconds from first call (usually, from application start).
+ */
+static uint64_t GetTicks()
+{
+    if (UseVirtualTicks) {
+        return VirtualTicks;
+    }
+
+    if (!PerformanceFrequency) {
+        PerformanceFrequency = SDL_GetPerformanceFrequency();
+        StartCounter = SDL_GetPerformanceCounter();
+    }
+
+    uint64_t Counter = SDL_GetPerformanceCounter() - StartCounter;
+    // split calculation, in order to prevent overflow
+    return (Counter / PerformanceFrequency) * 1000000 +
+           (Counter % PerformanceFrequency) * 1000000 / PerformanceFrequency;
+}
+
+/*
+ * Check time thread number.
+ */
+static bool CheckTimeThread(int TimeThread, const char *FunctionName)
+{
+    if (TimeThread < 0 || TimeThread >= MaxTimeThreads) {
+        std::cerr << FunctionName << "(): " << "TimeThread out of range: " << TimeThread << "\n";
+        return false;
+    }
+    if (!TimeThreads[TimeThread].Initialized) {
+        std::cerr << FunctionName << "(): " << "TimeThread was not initialized: " << TimeThread << "\n";
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Calculate time thread's time by ticks.
+ */
+static void CalculateTimeThread(sTimeThread &TimeThread, uint64_t Ticks)
+{
+    if (TimeThread.Paused) {
+        return;
+    }
+
+    uint64_t Elapsed{0};
+    if (Ticks > TimeThread.SpeedChangeTicks) {
+        Elapsed = Ticks - TimeThread.SpeedChangeTicks;
+    }
+    // time manipulations
+    if (TimeThread.Speed != 1.0f) {
+        Elapsed = static_cast<uint64_t>(static_cast<double>(Elapsed) * TimeThread.Speed);
+    }
+
+    TimeThread.CurrentTicks = TimeThread.Buffer + Elapsed;
+    TimeThread.CurrentTime = static_cast<float>(static_cast<double>(TimeThread.CurrentTicks) / 1000000.0);
+}
+
+/*
+ * Sample time for all time threads.
+ */
+static void SampleTimeThreads(uint64_t Ticks)
+{
+    SampledTicks = Ticks;
+
+    for (auto &TimeThread : TimeThreads) {
+        if (TimeThread.Initialized) {
+            CalculateTimeThread(TimeThread, SampledTicks);
+        }
+    }
+}
+
+/*
+ * Use virtual ticks instead of real time for all time threads.
+ * Should be called before any time thread initialization.
+ */
+void vw_UseVirtualTicks(bool Use)
+{
+    UseVirtualTicks = Use;
+    VirtualTicks = 0;
+}
+
+/*
+ * Advance virtual ticks (in microseconds).
+ */
+void vw_AdvanceVirtualTicks(uint64_t Ticks)
+{
+    VirtualTicks += Ticks;
+}
+
+/*
+ * Sample time for all time threads, should be called once per main loop cycle.
+ */
+void vw_UpdateTimeThreads()
+{
+    SampleTimeThreads(GetTicks());
+}
+
 /*
  * Initialize or re-initialize time for particular thread.
  */
 void vw_InitTimeThread(int TimeThread)
 {
-    TimeThreadsMap[TimeThread].Paused = false;
-    TimeThreadsMap[TimeThread].LastGetTicks = 0;
-    TimeThreadsMap[TimeThread].DiffGetTicks = 0;
-    TimeThreadsMap[TimeThread].Speed = 1.0f;
-    TimeThreadsMap[TimeThread].Buffer = 0.0f;
+    if (TimeThread < 0 || TimeThread >= MaxTimeThreads) {
+        std::cerr << __func__ << "(): " << "TimeThread out of range: " << TimeThread << "\n";
+        return;
+    }
+
+    TimeThreads[TimeThread] = sTimeThread{};
+    TimeThreads[TimeThread].Initialized = true;
+    TimeThreads[TimeThread].Paused = false;
+    // initialization could be called after long operations (loading, for example),
+    // sample time right now
+    SampleTimeThreads(GetTicks());
 }
 
 /*
@@ -95,34 +205,35 @@ void vw_InitTimeThread(int TimeThread)
  */
 void vw_ReleaseAllTimeThread()
 {
-    TimeThreadsMap.clear();
+    TimeThreads.fill(sTimeThread{});
 }
 
 /*
- * Get time for particular thread.
+ * Get time for particular thread in seconds.
  */
 float vw_GetTimeThread(int TimeThread)
 {
-    if (TimeThreadsMap.find(TimeThread) == TimeThreadsMap.end()) {
-        std::cerr << __func__ << "(): " << "TimeThread was not initialized: " << TimeThread << "\n";
+    if (!CheckTimeThread(TimeThread, __func__)) {
         return 0.0f;
     }
 
-    assert(!TimeThreadsMap[TimeThread].Paused);
+    assert(!TimeThreads[TimeThread].Paused);
 
-    // time manipulations
-    if (TimeThreadsMap[TimeThread].Speed != 1.0f) {
-        // calculate time from "time point" (DiffGetTicks), when speed was changed last time, till now
-        // FIXME static_cast, we could have an issue with float type value
-        float RealTimeThread = (static_cast<float>(SDL_GetTicks() - TimeThreadsMap[TimeThread].DiffGetTicks) *
-                                TimeThreadsMap[TimeThread].Speed) / 1000.0f;
-        // add "previous time" from time buffer
-        return RealTimeThread + TimeThreadsMap[TimeThread].Buffer;
+    return TimeThreads[TimeThread].CurrentTime;
+}
+
+/*
+ * Get time for particular thread in microseconds.
+ */
+uint64_t vw_GetTimeThreadTicks(int TimeThread)
+{
+    if (!CheckTimeThread(TimeThread, __func__)) {
+        return 0;
     }
 
-    // FIXME static_cast, we could have an issue with float type value
-    return TimeThreadsMap[TimeThread].Buffer +
-           static_cast<float>(SDL_GetTicks() - TimeThreadsMap[TimeThread].DiffGetTicks) / 1000.0f;
+    assert(!TimeThreads[TimeThread].Paused);
+
+    return TimeThreads[TimeThread].CurrentTicks;
 }
 
 /*
@@ -130,10 +241,11 @@ float vw_GetTimeThread(int TimeThread)
  */
 void vw_PauseTimeThreads()
 {
-    for (auto &TimeThread : TimeThreadsMap) {
-        if (!TimeThread.second.Paused) {
-            TimeThread.second.LastGetTicks = SDL_GetTicks();
-            TimeThread.second.Paused = true;
+    uint64_t Ticks = GetTicks();
+    for (auto &TimeThread : TimeThreads) {
+        if (TimeThread.Initialized && !TimeThread.Paused) {
+            TimeThread.PauseTicks = Ticks;
+            TimeThread.Paused = true;
         }
     }
 }
@@ -143,31 +255,34 @@ void vw_PauseTimeThreads()
  */
 void vw_ResumeTimeThreads()
 {
-    for (auto &TimeThread : TimeThreadsMap) {
-        if (TimeThread.second.Paused) {
-            TimeThread.second.DiffGetTicks += SDL_GetTicks() - TimeThread.second.LastGetTicks;
-            TimeThread.second.Paused = false;
+    uint64_t Ticks = GetTicks();
+    for (auto &TimeThread : TimeThreads) {
+        if (TimeThread.Initialized && TimeThread.Paused) {
+            TimeThread.SpeedChangeTicks += Ticks - TimeThread.PauseTicks;
+            TimeThread.Paused = false;
         }
     }
+    SampleTimeThreads(Ticks);
 }
 
 /*
  * Set time thread speed for particular thread.
+ * Note, we use ticks sampled by last vw_UpdateTimeThreads() call, so, time in
+ * this loop cycle is not changed.
  */
 void vw_SetTimeThreadSpeed(int TimeThread, float NewSpeed)
 {
-    if (TimeThreadsMap.find(TimeThread) == TimeThreadsMap.end()) {
-        std::cerr << __func__ << "(): " << "TimeThread was not initialized: " << TimeThread << "\n";
+    if (!CheckTimeThread(TimeThread, __func__)) {
         return;
     }
 
+    sTimeThread &tmpTimeThread = TimeThreads[TimeThread];
     // store "previous time" in the time buffer
-    // FIXME static_cast, we could have an issue with float type value
-    TimeThreadsMap[TimeThread].Buffer += (static_cast<float>(SDL_GetTicks() - TimeThreadsMap[TimeThread].DiffGetTicks) *
-                                          TimeThreadsMap[TimeThread].Speed) / 1000.0f;
+    CalculateTimeThread(tmpTimeThread, SampledTicks);
+    tmpTimeThread.Buffer = tmpTimeThread.CurrentTicks;
     // store "time point", when speed was changed
-    TimeThreadsMap[TimeThread].DiffGetTicks = SDL_GetTicks();
-    TimeThreadsMap[TimeThread].Speed = NewSpeed;
+    tmpTimeThread.SpeedChangeTicks = SampledTicks;
+    tmpTimeThread.Speed = NewSpeed;
 }
 
 } // viewizard namespace
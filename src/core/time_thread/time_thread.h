@@ -32,18 +32,26 @@
 
 namespace viewizard {
 
-// Initialize or re-initialize time for particular thread.
+// Sample time for all time threads, should be called once per main loop cycle.
+void vw_UpdateTimeThreads();
+// Initialize or re-initialize time for particular thread, TimeThread should be in [0, 3] range.
 void vw_InitTimeThread(int TimeThread);
 // Release all threads.
 void vw_ReleaseAllTimeThread();
-// Get time for particular thread.
+// Get time for particular thread in seconds.
 float vw_GetTimeThread(int TimeThread);
+// Get time for particular thread in microseconds.
+uint64_t vw_GetTimeThreadTicks(int TimeThread);
 // Pause all time threads.
 void vw_PauseTimeThreads();
 // Resume all previously paused time threads.
 void vw_ResumeTimeThreads();
 // Set time thread speed for particular thread.
 void vw_SetTimeThreadSpeed(int TimeThread, float NewSpeed = 1.0f);
+// Use virtual ticks instead of real time for all time threads.
+void vw_UseVirtualTicks(bool Use);
+// Advance virtual ticks (in microseconds).
+void vw_AdvanceVirtualTicks(uint64_t Ticks);
 
 } // viewizard namespace
 
@@ -27,12 +27,9 @@
 
 // TODO (?) add attribute names hash too, provide hash-related GetEntryAttribute() versions
 
-// TODO revise ParseTagContent() in order to use main buffer with begin/end position
-//      don't create temporary buffers string
-
 #include "../vfs/vfs.h"
 #include "xml.h"
-#include <cstring>
+#include <cstdlib>
 #include <fstream>
 
 namespace viewizard {
@@ -47,213 +44,271 @@ const std::string EndLine{"\r\n"};
 
 
 /*
- * Line number in XML file.
+ * Skip spaces, care about line number.
  */
-#ifdef NDEBUG
-static std::string::size_type GetLineNumber([[gnu::unused, maybe_unused]] const std::string &Buffer,
-                                            [[gnu::unused, maybe_unused]] std::string::size_type Pos)
+static char *SkipSpaces(char *Position, int &LineNumber)
 {
-    return 0;
+    while (*Position == ' ' || *Position == '\t' || *Position == '\r' || *Position == '\n') {
+        if (*Position == '\n') {
+            LineNumber++;
+        }
+        Position++;
+    }
+    return Position;
 }
-#else
-static std::string::size_type GetLineNumber(const std::string &Buffer, std::string::size_type Pos)
-{
-    std::string::size_type LineNumber = 1;
 
-    for (std::string::size_type i = 0; i < Pos; i++) {
-        if (Buffer[i] == '\n') {
+/*
+ * Skip till pattern, care about line number. Return pointer to pattern or nullptr.
+ */
+static char *SkipTill(char *Position, const char *Pattern, int &LineNumber)
+{
+    size_t PatternSize = strlen(Pattern);
+    while (*Position != '\0') {
+        if (!strncmp(Position, Pattern, PatternSize)) {
+            return Position;
+        }
+        if (*Position == '\n') {
             LineNumber++;
         }
+        Position++;
     }
+    return nullptr;
+}
 
-    return LineNumber;
+/*
+ * Is name's end symbol.
+ */
+static bool IsNameEnd(char Symbol)
+{
+    return Symbol == ' ' || Symbol == '\t' || Symbol == '\r' || Symbol == '\n'
+           || Symbol == '/' || Symbol == '>' || Symbol == '=' || Symbol == '\0';
+}
+
+/*
+ * Allocate entry from arena and link it to parent (or set as root).
+ */
+sXMLEntry *cXMLDocument::CreateEntry(sXMLEntry *ParentXMLEntry)
+{
+    // NOTE emplace_back() return reference to the inserted element (since C++17)
+    EntriesArena.emplace_back();
+    sXMLEntry *XMLEntry = &EntriesArena.back();
+
+    if (!ParentXMLEntry) {
+        RootXMLEntry = XMLEntry;
+    } else if (!ParentXMLEntry->ChildrenList.First) {
+        ParentXMLEntry->ChildrenList.First = ParentXMLEntry->ChildrenList.Last = XMLEntry;
+    } else {
+        ParentXMLEntry->ChildrenList.Last->NextSibling = XMLEntry;
+        ParentXMLEntry->ChildrenList.Last = XMLEntry;
+    }
+
+    XMLEntry->AttributesStart = static_cast<unsigned>(Attributes.size());
+    return XMLEntry;
 }
-#endif // NDEBUG
 
 /*
- * Parce tag line.
+ * Parse tag's name and attributes, return pointer to the tag's close symbol ('>' or "/>").
  */
-bool cXMLDocument::ParseTagLine(unsigned int LineNumber, const std::string &Buffer, sXMLEntry *XMLEntry)
+char *cXMLDocument::ParseTag(char *Position, int &LineNumber, sXMLEntry &XMLEntry)
 {
-    // 1 - tag's name (starts after '<' and ends by ' ', '>', '/' (/>), '\t')
-    std::string::size_type TagNameEnd = Buffer.find_first_of(" />\t");
-    XMLEntry->Name = Buffer.substr(1, TagNameEnd - 1);
+    // 1 - tag's name (starts after '<')
+    char *NameStart = ++Position;
+    while (!IsNameEnd(*Position)) {
+        Position++;
+    }
+    XMLEntry.Name.Data = NameStart;
+    XMLEntry.Name.Size = static_cast<size_t>(Position - NameStart);
     if (CalculateHash) {
-        XMLEntry->NameHash = hash_djb2a(XMLEntry->Name.c_str());
-        auto tmpHash = HashCheckMap.find(XMLEntry->NameHash);
+        // hash_djb2a() need null-terminated string, note, name's end could be '>' or '/'
+        char tmpSymbol = *Position;
+        *Position = '\0';
+        XMLEntry.NameHash = hash_djb2a(NameStart);
+        *Position = tmpSymbol;
+        auto tmpHash = HashCheckMap.find(XMLEntry.NameHash);
         if (tmpHash == HashCheckMap.end()) {
-            HashCheckMap.emplace(XMLEntry->NameHash, XMLEntry->Name);
-        } else if (tmpHash->second != XMLEntry->Name) {
+            HashCheckMap.emplace(XMLEntry.NameHash, XMLEntry.Name);
+        } else if (tmpHash->second != XMLEntry.Name) {
             std::cerr << "Warning! Detected hash collision for tag name: "
-                      << XMLEntry->Name << " and tag name: "
+                      << XMLEntry.Name << " and tag name: "
                       << tmpHash->second << "\n";
         }
     }
+    // name should be null-terminated, if name's end is close symbol, caller will care about it
+    char *NameEnd = Position;
+    Position = SkipSpaces(Position, LineNumber);
+    if (Position != NameEnd) {
+        *NameEnd = '\0';
+    }
 
-    // 2 - check for attributes
-    std::string::size_type i = TagNameEnd;
-    while (Buffer[i] != '>' || Buffer[i] != '\0') {
-        // skip all ' ' and '\t'
-        while ((Buffer[i] == ' ' || Buffer[i] == '\t') && Buffer[i] != '\0') {
-            i++;
-        }
-        if (Buffer[i] == '\0') {
-            std::cerr << __func__ << "(): " << "XML file corrupted, line: "
-                      << LineNumber << "\n";
-            break;
+    // 2 - attributes
+    while (true) {
+        Position = SkipSpaces(Position, LineNumber);
+        if (*Position == '>' || !strncmp(Position, "/>", strlen("/>"))) {
+            return Position;
         }
-        // check one more time for tag's close symbol
-        if (Buffer[i] == '>' || !strncmp(Buffer.data() + i, "/>", strlen("/>"))) {
-            break;
+        if (*Position == '\0' || *Position == '/' || *Position == '=') {
+            return nullptr;
         }
 
         // attribute name
-        std::string::size_type AttribNameStart = i;
-        while (Buffer[i] != '=' && Buffer[i] != '\0') {
-            i++;
+        char *AttribNameStart = Position;
+        while (!IsNameEnd(*Position)) {
+            Position++;
         }
-        if (Buffer[i] == '\0') {
-            std::cerr << __func__ << "(): " << "XML file corrupted, line: "
-                      << LineNumber << "\n";
-            break;
+        char *AttribNameEnd = Position;
+        Position = SkipSpaces(Position, LineNumber);
+        if (*Position != '=') {
+            return nullptr;
         }
-        std::string::size_type AttribNameEnd = i;
-        // skip all symbols till '\'' or '\"', should be next after '='
-        i += 2;
-        unsigned long AttribDataStart = i;
-        while (Buffer[i] != '\'' && Buffer[i] != '\"' && Buffer[i] != '\0') {
-            i++;
+        Position = SkipSpaces(Position + 1, LineNumber);
+
+        // attribute value
+        char Quote = *Position;
+        if (Quote != '\"' && Quote != '\'') {
+            return nullptr;
         }
-        if (Buffer[i] == '\0') {
-            std::cerr << __func__ << "(): " << "XML file corrupted, line: "
-                      << LineNumber << "\n";
-            break;
+        char *AttribValueStart = ++Position;
+        while (*Position != Quote && *Position != '\0') {
+            if (*Position == '\n') {
+                LineNumber++;
+            }
+            Position++;
+        }
+        if (*Position == '\0') {
+            return nullptr;
         }
-        unsigned long AttribDataEnd = i;
-        i++;
-
-        // add attribute to entry
-        std::string tmpAttrIndex = Buffer.substr(AttribNameStart, AttribNameEnd - AttribNameStart);
-        XMLEntry->Attributes[tmpAttrIndex] = Buffer.substr(AttribDataStart, AttribDataEnd - AttribDataStart);
-    }
-
-    // 3 - store current tag's line number for
-    XMLEntry->LineNumber = LineNumber;
 
-    // 4 - check tag's close symbol
-    if (Buffer.find("/>") != std::string::npos) {
-        return false;
+        *AttribNameEnd = '\0';
+        *Position = '\0';
+        Attributes.emplace_back();
+        Attributes.back().Name.Data = AttribNameStart;
+        Attributes.back().Name.Size = static_cast<size_t>(AttribNameEnd - AttribNameStart);
+        Attributes.back().Value.Data = AttribValueStart;
+        Attributes.back().Value.Size = static_cast<size_t>(Position - AttribValueStart);
+        XMLEntry.AttributesCount++;
+        Position++;
     }
-
-    return true;
 }
 
 /*
- * Parse tag content.
- * We start from root and parse all children tags recursively.
+ * Parse buffer in-situ, starting from position.
+ * Single pass, opened elements are tracked by stack instead of recursion.
  */
-bool cXMLDocument::ParseTagContent(const std::string &OriginBuffer, std::string::size_type StartPosition,
-                                   const std::string &Buffer, sXMLEntry *ParentXMLEntry)
+bool cXMLDocument::Parse(char *Position, int LineNumber)
 {
-    // 1 - text content
-    if (Buffer.find("<") == std::string::npos) {
-        ParentXMLEntry->Content = Buffer;
-        return true;
-    }
-
-    // 2 - if tag's open symbol found, parse recursively
-    std::string::size_type CurrentBufferPosition{0};
-    while (CurrentBufferPosition < Buffer.size()) {
-        // locate tag open and close symbols
-        std::string::size_type DetectTagOpenSymbol = Buffer.find("<", CurrentBufferPosition);
-
-        // if no tag's open symbols - nothing to do
-        if (DetectTagOpenSymbol == std::string::npos) {
-            return true;
+    struct sOpenedEntry {
+        sXMLEntry *XMLEntry{nullptr};
+        char *ContentStart{nullptr};
+        bool HaveMarkup{false}; // we have children or comments, no text content
+    };
+    std::vector<sOpenedEntry> OpenedEntries{};
+
+    while (*Position != '\0') {
+        if (*Position != '<') {
+            if (*Position == '\n') {
+                LineNumber++;
+            }
+            Position++;
+            // FIXME continue in the middle of the cycle
+            continue;
         }
 
-        // check for comment
-        if (!strncmp(Buffer.data() + DetectTagOpenSymbol, "<!--", strlen("<!--"))) {
-            // find tag's close symbol
-            std::string::size_type DetectCommentCloseSymbol = Buffer.find("-->", CurrentBufferPosition);
-            if (DetectCommentCloseSymbol == std::string::npos) {
+        // comment
+        if (!strncmp(Position, "<!--", strlen("<!--"))) {
+            int CommentLineNumber = LineNumber;
+            Position = SkipTill(Position, "-->", LineNumber);
+            if (!Position) {
                 std::cerr << __func__ << "(): "
                           << "XML file corrupted, can't find comment end in line "
-                          << GetLineNumber(OriginBuffer,
-                                           StartPosition + CurrentBufferPosition)
-                          << "\n";
+                          << CommentLineNumber << "\n";
+                return false;
+            }
+            Position += strlen("-->");
+            if (!OpenedEntries.empty()) {
+                OpenedEntries.back().HaveMarkup = true;
+            }
+            // FIXME continue in the middle of the cycle
+            continue;
+        }
+
+        // tag's close element - </tag>
+        if (Position[1] == '/') {
+            char *CloseElementStart = Position;
+            char *NameStart = Position + 2;
+            Position = NameStart;
+            while (!IsNameEnd(*Position)) {
+                Position++;
+            }
+            size_t NameSize = static_cast<size_t>(Position - NameStart);
+            Position = SkipSpaces(Position, LineNumber);
+            if (OpenedEntries.empty()
+                || *Position != '>'
+                || NameSize != OpenedEntries.back().XMLEntry->Name.Size
+                || strncmp(NameStart, OpenedEntries.back().XMLEntry->Name.Data, NameSize)) {
+                std::cerr << __func__ << "(): "
+                          << "XML file corrupted, can't find element end: "
+                          << (OpenedEntries.empty() ? sXMLString{} : OpenedEntries.back().XMLEntry->Name)
+                          << " in line: " << LineNumber << "\n";
                 return false;
             }
-            CurrentBufferPosition = DetectCommentCloseSymbol + strlen("-->");
+
+            // if we don't have children, all inside element is text content
+            if (!OpenedEntries.back().HaveMarkup) {
+                OpenedEntries.back().XMLEntry->Content.Data = OpenedEntries.back().ContentStart;
+                OpenedEntries.back().XMLEntry->Content.Size =
+                    static_cast<size_t>(CloseElementStart - OpenedEntries.back().ContentStart);
+                *CloseElementStart = '\0';
+            }
+            OpenedEntries.pop_back();
+            Position++;
             // FIXME continue in the middle of the cycle
             continue;
         }
 
-        std::string::size_type DetectTagCloseSymbol = Buffer.find(">", CurrentBufferPosition);
-        // something wrong, xml don't have a tag's close symbol
-        if (DetectTagCloseSymbol == std::string::npos) {
+        // new element, only one top level (root) element allowed
+        if (OpenedEntries.empty() && RootXMLEntry) {
             std::cerr << __func__ << "(): "
-                      << "XML file corrupted, can't find element end for element in line "
-                      << GetLineNumber(OriginBuffer,
-                                       StartPosition + CurrentBufferPosition)
-                      << "\n";
+                      << "XML file corrupted, more than one root element, second root element in line: "
+                      << LineNumber << "\n";
             return false;
         }
-        DetectTagCloseSymbol += strlen(">");
-
-        // create new entry
-        sXMLEntry *XMLEntry{nullptr};
-        if (!ParentXMLEntry) {
-            RootXMLEntry.reset(new sXMLEntry);
-            XMLEntry = RootXMLEntry.get();
-        } else {
-            // NOTE emplace_back() return reference to the inserted element (since C++17)
-            ParentXMLEntry->ChildrenList.emplace_back();
-            XMLEntry = &ParentXMLEntry->ChildrenList.back();
+        sXMLEntry *XMLEntry = CreateEntry(OpenedEntries.empty() ? nullptr : OpenedEntries.back().XMLEntry);
+        XMLEntry->LineNumber = LineNumber;
+        if (!OpenedEntries.empty()) {
+            OpenedEntries.back().HaveMarkup = true;
+        }
+        Position = ParseTag(Position, LineNumber, *XMLEntry);
+        if (!Position) {
+            std::cerr << __func__ << "(): " << "XML file corrupted, line: " << XMLEntry->LineNumber << "\n";
+            return false;
         }
 
-        // parce tag's line
-        std::string TagString = Buffer.substr(DetectTagOpenSymbol,
-                                              DetectTagCloseSymbol - DetectTagOpenSymbol);
-        unsigned int LineNumber = GetLineNumber(OriginBuffer,
-                                                StartPosition + DetectTagOpenSymbol);
-        bool ElementHaveContent = ParseTagLine(LineNumber, TagString, XMLEntry);
+        // close symbol not needed any more, could be used as name's terminator
+        bool ElementHaveContent = (*Position == '>');
+        *Position = '\0';
 
         // if we have tag's close element, we done here
         if (!ElementHaveContent) {
-            CurrentBufferPosition = DetectTagCloseSymbol;
+            Position += strlen("/>");
             // FIXME continue in the middle of the cycle
             continue;
         }
 
-        // tag opened, look at tag's close element - </tag>
-        std::string CloseElement{"</" + XMLEntry->Name + ">"};
-        std::string::size_type CloseElementPosition = Buffer.find(CloseElement, CurrentBufferPosition);
-        // something wrong, xml don't have tag's close element
-        if (CloseElementPosition == std::string::npos) {
-            std::cerr << __func__ << "(): "
-                      << "XML file corrupted, can't find element end: "
-                      << XMLEntry->Name
-                      << " in line: "
-                      << GetLineNumber(OriginBuffer,
-                                       StartPosition + CurrentBufferPosition)
-                      << "\n";
-            return false;
-        }
-
-        // if we have some content inside tag - parse it
-        if (DetectTagCloseSymbol < CloseElementPosition) {
-            std::string ElementContent = Buffer.substr(DetectTagCloseSymbol,
-                                                       CloseElementPosition - DetectTagCloseSymbol);
-            if (!ParseTagContent(OriginBuffer, StartPosition + DetectTagCloseSymbol, ElementContent, XMLEntry)) {
-                return false;
-            }
-        }
+        Position++;
+        OpenedEntries.emplace_back();
+        OpenedEntries.back().XMLEntry = XMLEntry;
+        OpenedEntries.back().ContentStart = Position;
+    }
 
-        CurrentBufferPosition = CloseElementPosition + CloseElement.size();
+    if (!OpenedEntries.empty()) {
+        std::cerr << __func__ << "(): "
+                  << "XML file corrupted, can't find element end: "
+                  << OpenedEntries.back().XMLEntry->Name
+                  << " for element in line: " << OpenedEntries.back().XMLEntry->LineNumber << "\n";
+        return false;
     }
 
-    return false;
+    return true;
 }
 
 /*
@@ -265,38 +320,38 @@ cXMLDocument::cXMLDocument(const std::string &XMLFileName, bool Hash)
 
     std::cout << "Open XML file: " << XMLFileName << "\n";
 
-    // just to be sure, release any previous data
-    RootXMLEntry.reset();
-
-    // read all data into buffer
+    // read all data into buffer, this is the only one copy of file's data we need
     std::unique_ptr<cFILE> File = vw_fopen(XMLFileName);
     if (!File) {
         std::cerr << __func__ << "(): " << "XML file not found: " << XMLFileName << "\n";
         return;
     }
-    std::string Buffer{};
-    Buffer.resize(File->GetSize() + 1, '\0');
-    Buffer.assign(reinterpret_cast<char*>(File->GetData()), File->GetSize());
+    size_t BufferSize = static_cast<size_t>(File->GetSize());
+    Buffer.reset(new char[BufferSize + 1]);
+    memcpy(Buffer.get(), File->GetData(), BufferSize);
+    Buffer[BufferSize] = '\0';
     vw_fclose(File);
 
     // check header
-    if (Buffer.find("<?xml") == std::string::npos) {
+    char *XMLHeader = strstr(Buffer.get(), "<?xml");
+    if (!XMLHeader) {
         std::cerr << __func__ << "(): " << "XML file corrupted: " << XMLFileName << "\n";
         return;
     }
-    if (Buffer.find("?>") == std::string::npos) {
+    int LineNumber{1};
+    char *Position = SkipTill(Buffer.get(), "?>", LineNumber);
+    if (!Position) {
         std::cerr << __func__ << "(): " << "XML file corrupted: " << XMLFileName << "\n";
         return;
     }
 
-    // start recursive load
-    std::string tmpBuffer{Buffer.substr(Buffer.find("?>") + strlen("?>"))};
-    if (!ParseTagContent(Buffer, Buffer.find("?>") + strlen("?>"), tmpBuffer, nullptr)) {
+    if (!Parse(Position + strlen("?>"), LineNumber)) {
         std::cerr << __func__ << "(): " << "XML file corrupted: " << XMLFileName << "\n";
+        RootXMLEntry = nullptr;
         return;
     }
 
-    if (!RootXMLEntry.get()) {
+    if (!RootXMLEntry) {
         std::cerr << __func__ << "(): " << "XML file corrupted, root element not found: " << XMLFileName << "\n";
     }
 
@@ -331,9 +386,10 @@ void cXMLDocument::SaveRecursive(const sXMLEntry &XMLEntry, std::ofstream &File,
         File << "<" << XMLEntry.Name;
 
         // attributes
-        if (!XMLEntry.Attributes.empty()) {
-            for (const auto &TmpAttrib : XMLEntry.Attributes) {
-                File << " " << TmpAttrib.first << "=\"" << TmpAttrib.second << "\"";
+        if (XMLEntry.AttributesCount) {
+            for (unsigned i = 0; i < XMLEntry.AttributesCount; i++) {
+                const sXMLAttribute &tmpAttrib = Attributes[XMLEntry.AttributesStart + i];
+                File << " " << tmpAttrib.Name << "=\"" << tmpAttrib.Value << "\"";
             }
             File << " ";
         }
@@ -341,7 +397,7 @@ void cXMLDocument::SaveRecursive(const sXMLEntry &XMLEntry, std::ofstream &File,
         // data
         if (!XMLEntry.ChildrenList.empty() || !XMLEntry.Content.empty()) {
             if (!XMLEntry.Content.empty()) {
-                File << ">" << XMLEntry.Content << "</" << XMLEntry.Name << ">" << EndLine.data();
+                File << ">" << XMLEntry.Content << "</" << XMLEntry.Name << ">" << EndLine;
             } else {
                 File << ">" << EndLine;
                 for (auto &tmpEntry : XMLEntry.ChildrenList) {
@@ -374,34 +430,46 @@ bool cXMLDocument::Save(const std::string &XMLFileName)
     // XML header
     File << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>" << EndLine;
 
-    if (!RootXMLEntry.get()) {
+    if (!RootXMLEntry) {
         return true;
     }
 
     // save all data recursively
-    SaveRecursive(*RootXMLEntry.get(), File, 0);
+    SaveRecursive(*RootXMLEntry, File, 0);
 
     return true;
 }
 
+/*
+ * Store string, created by application (not loaded from file).
+ */
+sXMLString cXMLDocument::StoreString(const std::string &String)
+{
+    // deque don't move elements on growth, so, views will be valid
+    StringsArena.emplace_back(String);
+    sXMLString tmpString{};
+    tmpString.Data = StringsArena.back().c_str();
+    tmpString.Size = StringsArena.back().size();
+    return tmpString;
+}
+
 sXMLEntry *cXMLDocument::CreateRootEntry(const std::string &EntryName)
 {
-    RootXMLEntry.reset(new sXMLEntry);
-    RootXMLEntry->Name = EntryName;
-    return RootXMLEntry.get();
+    RootXMLEntry = CreateEntry(nullptr);
+    RootXMLEntry->Name = StoreString(EntryName);
+    return RootXMLEntry;
 }
 
 sXMLEntry *cXMLDocument::GetRootEntry()
 {
-    return RootXMLEntry.get();
+    return RootXMLEntry;
 }
 
 sXMLEntry *cXMLDocument::AddEntry(sXMLEntry &ParentXMLEntry, const std::string &EntryName)
 {
-    // NOTE emplace_back() return reference to the inserted element (since C++17)
-    ParentXMLEntry.ChildrenList.emplace_back();
-    ParentXMLEntry.ChildrenList.back().Name = EntryName;
-    return &ParentXMLEntry.ChildrenList.back();
+    sXMLEntry *XMLEntry = CreateEntry(&ParentXMLEntry);
+    XMLEntry->Name = StoreString(EntryName);
+    return XMLEntry;
 }
 
 void cXMLDocument::AddEntryContent(sXMLEntry *XMLEntry, const std::string &EntryData)
@@ -410,7 +478,7 @@ void cXMLDocument::AddEntryContent(sXMLEntry *XMLEntry, const std::string &Entry
         return;
     }
 
-    XMLEntry->Content = EntryData;
+    XMLEntry->Content = StoreString(EntryData);
 }
 
 void cXMLDocument::AddEntryAttribute(sXMLEntry *XMLEntry, const std::string &AttributeName, const std::string &AttributeData)
@@ -419,7 +487,29 @@ void cXMLDocument::AddEntryAttribute(sXMLEntry *XMLEntry, const std::string &Att
         return;
     }
 
-    XMLEntry->Attributes[AttributeName] = AttributeData;
+    for (unsigned i = 0; i < XMLEntry->AttributesCount; i++) {
+        if (Attributes[XMLEntry->AttributesStart + i].Name == AttributeName) {
+            Attributes[XMLEntry->AttributesStart + i].Value = StoreString(AttributeData);
+            return;
+        }
+    }
+
+    // entry's attributes should be contiguous, move them to the end of array if we can't grow in place
+    if (XMLEntry->AttributesCount
+        && XMLEntry->AttributesStart + XMLEntry->AttributesCount != Attributes.size()) {
+        unsigned NewAttributesStart = static_cast<unsigned>(Attributes.size());
+        for (unsigned i = 0; i < XMLEntry->AttributesCount; i++) {
+            Attributes.push_back(Attributes[XMLEntry->AttributesStart + i]);
+        }
+        XMLEntry->AttributesStart = NewAttributesStart;
+    } else if (!XMLEntry->AttributesCount) {
+        XMLEntry->AttributesStart = static_cast<unsigned>(Attributes.size());
+    }
+
+    Attributes.emplace_back();
+    Attributes.back().Name = StoreString(AttributeName);
+    Attributes.back().Value = StoreString(AttributeData);
+    XMLEntry->AttributesCount++;
 }
 
 void cXMLDocument::AddEntryAttribute(sXMLEntry *XMLEntry, const std::string &AttributeName, const char *AttributeData)
@@ -428,7 +518,7 @@ void cXMLDocument::AddEntryAttribute(sXMLEntry *XMLEntry, const std::string &Att
         return;
     }
 
-    XMLEntry->Attributes[AttributeName] = AttributeData;
+    AddEntryAttribute(XMLEntry, AttributeName, std::string{AttributeData});
 }
 
 void cXMLDocument::AddEntryAttribute(sXMLEntry *XMLEntry, const std::string &AttributeName, int AttributeData)
@@ -464,10 +554,9 @@ void cXMLDocument::AddEntryAttribute(sXMLEntry *XMLEntry, const std::string &Att
 
 void cXMLDocument::AddComment(sXMLEntry &ParentXMLEntry, const std::string &Text)
 {
-    // NOTE emplace_back() return reference to the inserted element (since C++17)
-    ParentXMLEntry.ChildrenList.emplace_back();
-    ParentXMLEntry.ChildrenList.back().Name = Text;
-    ParentXMLEntry.ChildrenList.back().EntryType = eEntryType::Comment;
+    sXMLEntry *XMLEntry = CreateEntry(&ParentXMLEntry);
+    XMLEntry->Name = StoreString(Text);
+    XMLEntry->EntryType = eEntryType::Comment;
 }
 
 // find first children element by name
@@ -482,51 +571,68 @@ sXMLEntry *cXMLDocument::FindEntryByName(sXMLEntry &ParentXMLEntry, const std::s
     return nullptr;
 }
 
+/*
+ * Find attribute, last one wins if attribute duplicated.
+ */
+const sXMLAttribute *cXMLDocument::FindAttribute(const sXMLEntry &XMLEntry, const std::string &AttributeName) const
+{
+    for (unsigned i = XMLEntry.AttributesCount; i > 0; i--) {
+        const sXMLAttribute &tmpAttr = Attributes[XMLEntry.AttributesStart + i - 1];
+        if (tmpAttr.Name == AttributeName) {
+            return &tmpAttr;
+        }
+    }
+
+    return nullptr;
+}
+
 bool cXMLDocument::GetEntryAttribute(const sXMLEntry &XMLEntry, const std::string &AttributeName, std::string &Result)
 {
-    auto tmpAttr = XMLEntry.Attributes.find(AttributeName);
-    if (tmpAttr == XMLEntry.Attributes.end()) {
+    const sXMLAttribute *tmpAttr = FindAttribute(XMLEntry, AttributeName);
+    if (!tmpAttr) {
         return false;
     }
 
-    Result = tmpAttr->second;
+    Result = tmpAttr->Value;
     return true;
 }
 
 bool cXMLDocument::iGetEntryAttribute(const sXMLEntry &XMLEntry, const std::string &AttributeName, int &Result)
 {
-    auto tmpAttr = XMLEntry.Attributes.find(AttributeName);
-    if (tmpAttr == XMLEntry.Attributes.end()) {
+    const sXMLAttribute *tmpAttr = FindAttribute(XMLEntry, AttributeName);
+    if (!tmpAttr) {
         return false;
     }
 
-    Result = std::stoi(tmpAttr->second); // NOTE check exceptions std::invalid_argument and std::out_of_range
+    // values are null-terminated, no temporary strings needed
+    Result = static_cast<int>(strtol(tmpAttr->Value.c_str(), nullptr, 10));
     return true;
 }
 
 bool cXMLDocument::fGetEntryAttribute(const sXMLEntry &XMLEntry, const std::string &AttributeName, float &Result)
 {
-    auto tmpAttr = XMLEntry.Attributes.find(AttributeName);
-    if (tmpAttr == XMLEntry.Attributes.end()) {
+    const sXMLAttribute *tmpAttr = FindAttribute(XMLEntry, AttributeName);
+    if (!tmpAttr) {
         return false;
     }
 
-    Result = std::stof(tmpAttr->second); // NOTE check exceptions std::invalid_argument and std::out_of_range
+    // values are null-terminated, no temporary strings needed
+    Result = strtof(tmpAttr->Value.c_str(), nullptr);
     return true;
 }
 
 bool cXMLDocument::bGetEntryAttribute(const sXMLEntry &XMLEntry, const std::string &AttributeName, bool &Result)
 {
-    auto tmpAttr = XMLEntry.Attributes.find(AttributeName);
-    if (tmpAttr == XMLEntry.Attributes.end()) {
+    const sXMLAttribute *tmpAttr = FindAttribute(XMLEntry, AttributeName);
+    if (!tmpAttr) {
         return false;
     }
 
     Result = false;
-    if (tmpAttr->second == "on"
-        || tmpAttr->second == "true"
-        || tmpAttr->second == "yes"
-        || tmpAttr->second == "1") {
+    if (tmpAttr->Value == "on"
+        || tmpAttr->Value == "true"
+        || tmpAttr->Value == "yes"
+        || tmpAttr->Value == "1") {
         Result = true;
     }
 
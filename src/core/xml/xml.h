@@ -31,17 +31,21 @@
 #define CORE_XML_XML_H
 
 #include "../base.h"
+#include <cstring>
+#include <deque>
 
 /*
  * This is not a full featured XML parser, only features AstoMenace needs are supported.
- * This is not the fast one XML parser, we don't use this code for time-critical parts.
  * The main reason for this XML parser code - reduce external dependencies and avoid
  * license-related issues for included code.
  *
+ * File loaded into one buffer and parsed in-situ, in single pass. All names, attributes
+ * and contents are views into this buffer (null-terminated), entries are allocated from
+ * document's arena, attributes of each entry are stored in document's flat array.
+ *
  * Limitations:
  * 1. Only ascii are supported (utf8 for comments).
- * 2. Tags between '<' and '>' characters could not be wrapped.
- * 3. CDATA are not supported.
+ * 2. CDATA and entities are not supported.
  *
  * Special features:
  * 1. For game scripts debug, XML will care about lines numbers and open tag.
@@ -51,33 +55,149 @@
 
 namespace viewizard {
 
+// Null-terminated string view, owned by cXMLDocument.
+// NOTE in future, use std::string_view (since C++17)
+struct sXMLString {
+    const char *Data{""};
+    size_t Size{0};
+
+    const char *c_str() const
+    {
+        return Data;
+    }
+    size_t size() const
+    {
+        return Size;
+    }
+    bool empty() const
+    {
+        return !Size;
+    }
+    operator std::string() const
+    {
+        return std::string{Data, Size};
+    }
+};
+
+inline bool operator == (const sXMLString &A, const char *B)
+{
+    return !strncmp(A.Data, B, A.Size) && B[A.Size] == '\0';
+}
+inline bool operator == (const char *A, const sXMLString &B)
+{
+    return B == A;
+}
+inline bool operator == (const sXMLString &A, const std::string &B)
+{
+    return A.Size == B.size() && !B.compare(0, B.size(), A.Data, A.Size);
+}
+inline bool operator == (const std::string &A, const sXMLString &B)
+{
+    return B == A;
+}
+inline bool operator != (const sXMLString &A, const char *B)
+{
+    return !(A == B);
+}
+inline bool operator != (const char *A, const sXMLString &B)
+{
+    return !(B == A);
+}
+inline bool operator != (const sXMLString &A, const std::string &B)
+{
+    return !(A == B);
+}
+inline bool operator != (const std::string &A, const sXMLString &B)
+{
+    return !(B == A);
+}
+inline std::ostream &operator << (std::ostream &Stream, const sXMLString &String)
+{
+    return Stream.write(String.Data, static_cast<std::streamsize>(String.Size));
+}
+
 enum class eEntryType {
     Regular,    // regular, could contain attributes and sub-entries
     Comment     // <--! comment -->
 };
 
-struct sXMLEntry {
-    [[gnu::noinline, clang::noinline, msvc::noinline]]
-    sXMLEntry() = default;
-    [[gnu::noinline, clang::noinline, msvc::noinline]]
-    ~sXMLEntry() = default;
+struct sXMLEntry;
+
+// Intrusive list of entry's children, iterate with range-based for.
+struct sXMLChildrenList {
+    class iterator {
+    public:
+        explicit iterator(sXMLEntry *Entry) :
+            Entry_{Entry}
+        {}
+        sXMLEntry &operator * () const
+        {
+            return *Entry_;
+        }
+        sXMLEntry *operator -> () const
+        {
+            return Entry_;
+        }
+        iterator &operator ++ ();
+        bool operator != (const iterator &Iter) const
+        {
+            return Entry_ != Iter.Entry_;
+        }
+
+    private:
+        sXMLEntry *Entry_{nullptr};
+    };
+
+    iterator begin() const
+    {
+        return iterator{First};
+    }
+    iterator end() const
+    {
+        return iterator{nullptr};
+    }
+    bool empty() const
+    {
+        return !First;
+    }
+
+    sXMLEntry *First{nullptr};
+    sXMLEntry *Last{nullptr};
+};
 
+struct sXMLAttribute {
+    sXMLString Name{};
+    sXMLString Value{};
+};
+
+struct sXMLEntry {
     eEntryType EntryType{eEntryType::Regular};
-    std::string Name{}; // name, if entry type is comment - comment's text
+    sXMLString Name{}; // name, if entry type is comment - comment's text
     unsigned NameHash{0}; // name's hash
-    std::string Content{};
-    std::unordered_map<std::string, std::string> Attributes{};
-    std::list<sXMLEntry> ChildrenList{};
+    sXMLString Content{};
+    unsigned AttributesStart{0}; // first attribute in document's attributes array
+    unsigned AttributesCount{0};
+    sXMLChildrenList ChildrenList{};
+    sXMLEntry *NextSibling{nullptr};
 
     int LineNumber{0}; // line number in file (for new created, 0)
 };
 
+inline sXMLChildrenList::iterator &sXMLChildrenList::iterator::operator ++ ()
+{
+    Entry_ = Entry_->NextSibling;
+    return *this;
+}
+
 class cXMLDocument
 {
 public:
     cXMLDocument() = default;
     // Load XML from file.
     explicit cXMLDocument(const std::string &XMLFileName, bool Hash = false);
+    // all entries are views into document's own buffers
+    cXMLDocument(const cXMLDocument&) = delete;
+    cXMLDocument &operator = (const cXMLDocument&) = delete;
 
     // Save XML to file (libSDL RWops).
     bool Save(const std::string &XMLFileName);
@@ -106,15 +226,29 @@ public:
 private:
     // Save XML elements to file recursively.
     void SaveRecursive(const sXMLEntry &XMLEntry, std::ofstream &File, unsigned int Level);
-    // Parce tag line.
-    bool ParseTagLine(unsigned int LineNumber, const std::string &Buffer, sXMLEntry *XMLEntry);
-    // Parse tag content.
-    bool ParseTagContent(const std::string &OriginBuffer, std::string::size_type StartPosition,
-                         const std::string &Buffer, sXMLEntry *ParentXMLEntry);
+    // Parse buffer in-situ, starting from position.
+    bool Parse(char *Position, int LineNumber);
+    // Parse tag's name and attributes, return pointer to the tag's close symbol.
+    char *ParseTag(char *Position, int &LineNumber, sXMLEntry &XMLEntry);
+    // Allocate entry from arena and link it to parent (or set as root).
+    sXMLEntry *CreateEntry(sXMLEntry *ParentXMLEntry);
+    // Store string, created by application (not loaded from file).
+    sXMLString StoreString(const std::string &String);
+    // Find attribute, last one wins if attribute duplicated.
+    const sXMLAttribute *FindAttribute(const sXMLEntry &XMLEntry, const std::string &AttributeName) const;
+
+    // file data, parsed in-situ
+    std::unique_ptr<char[]> Buffer{};
+    // entries arena, deque don't move elements on growth
+    std::deque<sXMLEntry> EntriesArena{};
+    // attributes of all entries, each entry's attributes are contiguous
+    std::vector<sXMLAttribute> Attributes{};
+    // strings, created by application
+    std::deque<std::string> StringsArena{};
 
     // Accordinately to https://www.w3schools.com/XML/xml_syntax.asp
     // "XML documents must contain one root element that is the parent of all other elements".
-    std::unique_ptr<sXMLEntry> RootXMLEntry{};
+    sXMLEntry *RootXMLEntry{nullptr};
     // calculate hash for tags names
     bool CalculateHash{false};
     // hash check for collisions
@@ -329,12 +329,18 @@ extern int GamePowerSystem;
 extern int GameTargetingMechanicSystem;
 extern eGameMenuStatus GameMenuStatus;
 extern float GameContentTransp;
+// headless mode (benchmark), no OpenGL context, HUD and font related drawing should be skipped
+extern bool GameHeadlessMode;
 extern float GameButton1Transp;
 extern float LastGameButton1UpdateTime;
 extern bool NeedShowGameMenu;
 extern bool NeedHideGameMenu;
 extern bool GameMissionCompleteStatus;
 
+bool InitGameSimulation();
+void UpdateGameSimulation(float Time);
+bool isMissionScriptRunning();
+void ReleaseMissionScript();
 void InitGame();
 void DrawGame();
 void ExitGame(eCommand Command);
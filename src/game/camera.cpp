@@ -67,6 +67,8 @@ float CameraLastUpdate{0.0f};
 float CameraSpeed{10.0f};
 sVECTOR3D CameraCoveredDistance{0.0f, 0.0f, 0.0f};
 sVECTOR3D CameraMovementDirection{0.0f, 0.0f, 1.0f};
+// camera movement in last simulation step (for rendering interpolation)
+sVECTOR3D CameraLastStepDistance{0.0f, 0.0f, 0.0f};
 // camera shake on explosion related variables
 float CameraCurrentShake{0.0f};
 float CameraNeedShake{0.0f};
@@ -83,6 +85,7 @@ float CameraShakePower{0.0f};
 void ResetCamera()
 {
     CameraCoveredDistance(0.0f, 0.0f, 0.0f);
+    CameraLastStepDistance(0.0f, 0.0f, 0.0f);
     CameraLastUpdate = 0.0f;
 
     CameraCurrentShake = 0.0f;
@@ -180,6 +183,7 @@ void CameraUpdate(float Time)
     CameraLastUpdate = Time;
 
     sVECTOR3D tmpDistance = CameraMovementDirection ^ (CameraSpeed * TimeDelta);
+    CameraLastStepDistance = tmpDistance;
     CameraCoveredDistance += tmpDistance;
     vw_IncCameraLocation(tmpDistance);
 
@@ -190,6 +194,18 @@ void CameraUpdate(float Time)
     UpdateCameraShake(TimeDelta);
 }
 
+/*
+ * Camera setup with location interpolated between previous and current simulation steps.
+ */
+void CameraLookAt(float InterpolationFactor)
+{
+    // move camera back for rendering only, simulation should use current location
+    sVECTOR3D tmpCorrection = CameraLastStepDistance ^ (InterpolationFactor - 1.0f);
+    vw_IncCameraLocation(tmpCorrection);
+    vw_CameraLookAt();
+    vw_IncCameraLocation(tmpCorrection ^ -1.0f);
+}
+
 /*
  * Get camera shake.
  */
@@ -45,6 +45,8 @@ void ResetCamera();
 void SetupCameraShake(const sVECTOR3D &Location, float Power);
 // Update camera.
 void CameraUpdate(float Time);
+// Camera setup with location interpolated between previous and current simulation steps.
+void CameraLookAt(float InterpolationFactor);
 // Get camera shake.
 float GetCameraShake();
 // Get camera speed.
@@ -58,6 +58,11 @@ std::unique_ptr<cMissionScript> MissionScript{};
 
 eCommand GameExitCommand{eCommand::DO_NOTHING};
 
+// limit simulation steps per frame, in order to prevent "spiral of death" on slow machines
+constexpr unsigned MaxSimulationStepsPerFrame{8};
+// last fixed simulation step time in ticks (time thread 1)
+uint64_t SimulationTicks{0};
+
 } // unnamed namespace
 
 
@@ -117,6 +122,7 @@ std::weak_ptr<cSpaceShip> PlayerFighter{};
 // in-game menu related variable
 bool GameMenu = false;
 float GameContentTransp = 0.0f;
+bool GameHeadlessMode{false};
 float LastGameUpdateTime = 0.0f;
 eGameMenuStatus GameMenuStatus = eGameMenuStatus::GAME_MENU;
 
@@ -140,6 +146,7 @@ extern float CurrentTime;
 // player ship related stuff
 void InitGamePlayerShip();
 void GamePlayerShip();
+void DrawGamePlayerShipWarnings();
 float GetShipMaxEnergy(int Num);
 extern float CurrentPlayerShipEnergy;
 extern int LastMouseX;
@@ -164,20 +171,11 @@ bool NeedOffGame = false;
 
 
 //------------------------------------------------------------------------------------
-// game initialization
+// game simulation initialization, without any rendering related code
+// (shared with headless benchmark)
 //------------------------------------------------------------------------------------
-void InitGame()
+bool InitGameSimulation()
 {
-    ShadowMap_SizeSetup(eShadowMapSetup::Game);
-
-    if (CurrentProfile < 0 || CurrentProfile > 4) {
-        CurrentProfile = 0;
-    }
-    if (CurrentMission == -1) {
-        CurrentMission = 0;
-    }
-
-
     GameEnemyWeaponPenalty = GameConfig().Profile[CurrentProfile].EnemyWeaponPenalty;
     GameEnemyArmorPenalty = GameConfig().Profile[CurrentProfile].EnemyArmorPenalty;
     GameEnemyTargetingSpeedPenalty = GameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty;
@@ -200,6 +198,55 @@ void InitGame()
 
     GameExperience = (GameConfig().Profile[CurrentProfile].Experience - GameConfig().Profile[CurrentProfile].ByMissionExperience[CurrentMission]) * 1.0f;
 
+    // camera initialization, must be before script
+    InitCamera();
+    SimulationTicks = vw_GetTimeThreadTicks(1);
+    SetObject3DInterpolationFactor(1.0f);
+
+    InitGamePlayerShip();
+
+    StarSystemInitByType(eDrawType::GAME); // should be before RunScript()
+
+    MissionScript.reset(new cMissionScript);
+    if (!MissionScript->RunScript(GetCurrentMissionFileName(), vw_GetTimeThread(1))) {
+        MissionScript.reset();
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------
+// is mission script still running
+//------------------------------------------------------------------------------------
+bool isMissionScriptRunning()
+{
+    return static_cast<bool>(MissionScript);
+}
+
+//------------------------------------------------------------------------------------
+// release mission script
+//------------------------------------------------------------------------------------
+void ReleaseMissionScript()
+{
+    MissionScript.reset();
+}
+
+//------------------------------------------------------------------------------------
+// game initialization
+//------------------------------------------------------------------------------------
+void InitGame()
+{
+    ShadowMap_SizeSetup(eShadowMapSetup::Game);
+    vw_ProfilerStartTrace();
+
+    if (CurrentProfile < 0 || CurrentProfile > 4) {
+        CurrentProfile = 0;
+    }
+    if (CurrentMission == -1) {
+        CurrentMission = 0;
+    }
+
     // grab mouse control for both - windows and fullscreen mode (need this for multi-monitor systems)
     SDL_SetWindowGrab(reinterpret_cast<SDL_Window*>(vw_GetSDLWindow()), SDL_TRUE);
 
@@ -222,19 +269,7 @@ void InitGame()
 
 
 
-    // camera initialization, must be before script
-    InitCamera();
-
-    InitGamePlayerShip();
-
-
-
-    StarSystemInitByType(eDrawType::GAME); // should be before RunScript()
-
-    MissionScript.reset(new cMissionScript);
-    if (!MissionScript->RunScript(GetCurrentMissionFileName(), vw_GetTimeThread(1))) {
-        MissionScript.reset();
-    }
+    InitGameSimulation();
 
 
     SetupMissionNumberText(3.0f, CurrentMission + 1);
@@ -332,6 +367,8 @@ void ExitGame(eCommand Command)
 }
 void RealExitGame()
 {
+    vw_ProfilerStopTrace();
+
     ReleaseSpaceShip(PlayerFighter);
 
     vw_ReleaseAllParticleSystems2D();
@@ -341,6 +378,9 @@ void RealExitGame()
 
     // release mouse control
     SDL_SetWindowGrab(reinterpret_cast<SDL_Window*>(vw_GetSDLWindow()), SDL_FALSE);
+
+    // menu don't use fixed simulation steps, render current objects location
+    SetObject3DInterpolationFactor(1.0f);
 }
 
 //------------------------------------------------------------------------------------
@@ -432,6 +472,57 @@ void SetGameMissionComplete()
 
 
 
+//------------------------------------------------------------------------------------
+// one fixed simulation step (shared with headless benchmark)
+//------------------------------------------------------------------------------------
+void UpdateGameSimulation(float Time)
+{
+    BeginObject3DSimulationStep();
+
+    {
+        cProfilerScope ProfilerScope{"CameraUpdate"};
+        CameraUpdate(Time);
+    }
+
+    // update 3D objects data + particle systems data
+    {
+        cProfilerScope ProfilerScope{"UpdateAllObject3D"};
+        UpdateAllObject3D(Time);
+    }
+    {
+        cProfilerScope ProfilerScope{"UpdateAllParticleSystems"};
+        vw_UpdateAllParticleSystems(Time);
+    }
+
+    // collision detection
+    if (GameContentTransp < 0.99f) {
+        cProfilerScope ProfilerScope{"DetectCollisionAllObject3D"};
+        DetectCollisionAllObject3D();
+    }
+
+
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // script
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    if (MissionScript) {
+        cProfilerScope ProfilerScope{"MissionScript"};
+        if (!MissionScript->Update(Time)) {
+            MissionScript.reset();
+        }
+    }
+
+    // handling the state of the player's ship
+    {
+        cProfilerScope ProfilerScope{"GamePlayerShip"};
+        GamePlayerShip();
+    }
+}
+
+
+
+
+
+
 //------------------------------------------------------------------------------------
 // draw game, main method
 //------------------------------------------------------------------------------------
@@ -455,34 +546,51 @@ void DrawGame()
 
 
 
-    CameraUpdate(vw_GetTimeThread(1));
-    vw_CameraLookAt();
+    // fixed step simulation, render frame rate don't change simulation steps
+    float InterpolationFactor{1.0f};
+    {
+        cProfilerScope ProfilerScope{"Simulation"};
 
+        // integer ticks don't accumulate rounding error, convert to float only for step time
+        uint64_t SimulationStepTicks = 1000000 / GameConfig().SimulationRate;
+        uint64_t CurrentGameTicks = vw_GetTimeThreadTicks(1);
+        if (CurrentGameTicks < SimulationTicks) {
+            SimulationTicks = CurrentGameTicks;
+        }
+        unsigned StepsCount{0};
+        while (SimulationTicks + SimulationStepTicks <= CurrentGameTicks) {
+            // we can't catch up, drop the time we can't simulate
+            if (StepsCount >= MaxSimulationStepsPerFrame) {
+                SimulationTicks = CurrentGameTicks;
+                break;
+            }
+            SimulationTicks += SimulationStepTicks;
+            UpdateGameSimulation(static_cast<float>(static_cast<double>(SimulationTicks) / 1000000.0));
+            StepsCount++;
+        }
 
-    // skybox + far-far away space first
-    StarSystemDraw(eDrawType::GAME);
+        InterpolationFactor = static_cast<float>(CurrentGameTicks - SimulationTicks) /
+                              static_cast<float>(SimulationStepTicks);
+        SetObject3DInterpolationFactor(InterpolationFactor);
+    }
 
+    CameraLookAt(InterpolationFactor);
 
-    // render 3D objets
-    DrawAllObject3D(eDrawType::GAME);
 
+    // skybox + far-far away space first
+    {
+        cProfilerScope ProfilerScope{"StarSystemDraw", true};
+        StarSystemDraw(eDrawType::GAME);
+    }
 
-    // update 3D objects data + particle systems data
-    UpdateAllObject3D(vw_GetTimeThread(1));
-    vw_UpdateAllParticleSystems(vw_GetTimeThread(1));
 
-    // collision detection
-    if (GameContentTransp < 0.99f) {
-        DetectCollisionAllObject3D();
+    // render 3D objets
+    {
+        cProfilerScope ProfilerScope{"DrawAllObject3D", true};
+        DrawAllObject3D(eDrawType::GAME);
     }
 
 
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // script
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    if (MissionScript && !MissionScript->Update(vw_GetTimeThread(1))) {
-        MissionScript.reset();
-    }
 
 
 
@@ -494,15 +602,16 @@ void DrawGame()
     // 2d part
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     vw_Start2DMode(-1,1);
+    cProfilerScope ProfilerScopeHUD{"HUD", true};
 
 
 
 
 
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // handling the state of the player's ship
+    // player's ship warning messages
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    GamePlayerShip();
+    DrawGamePlayerShipWarnings();
 
 
     UpdateHUD(PlayerFighter,
@@ -563,36 +672,36 @@ void DrawGame()
             sRECT SrcRect(2, 2, 564-2, 564-2);
             sRECT DstRect(GameConfig().InternalWidth / 2 - 256 - 26, 128 - 28, GameConfig().InternalWidth / 2 - 256 + 534, 128 + 532);
             constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/dialog512_512.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1),
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1),
                       true, GameContentTransp);
             // title
-            int Size = vw_TextWidthUTF32(vw_GetTextUTF32("Mission Complete"));
+            int Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Mission Complete")));
             float WScale = 0;
             if (Size > 190) {
                 Size = 190;
                 WScale = -190;
             }
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 123 - Size / 2, 128+21, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.7f * GameContentTransp, vw_GetTextUTF32("Mission Complete"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 123 - Size / 2, 128+21, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.7f * GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Mission Complete")));
 
 
             int Y = 128+90;
             int Prir = 36;
 
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.5f * GameContentTransp, vw_GetTextUTF32("Type"));
-            Size = vw_TextWidthUTF32(vw_GetTextUTF32("Killed"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.5f * GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type")));
+            Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Killed")));
             WScale = 0;
             if (Size > 70) {
                 Size = 70;
                 WScale = -70;
             }
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 31 + Size / 2, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.5f * GameContentTransp, vw_GetTextUTF32("Killed"));
-            Size = vw_TextWidthUTF32(vw_GetTextUTF32("Bonus"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 31 + Size / 2, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.5f * GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Killed")));
+            Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Bonus")));
             WScale = 0;
             if (Size > 70) {
                 Size = 70;
                 WScale = -70;
             }
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 + 97 + Size / 2, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.5f * GameContentTransp, vw_GetTextUTF32("Bonus"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 + 97 + Size / 2, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.5f * GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Bonus")));
             Y += Prir;
 
             WScale = -210;
@@ -666,39 +775,39 @@ void DrawGame()
             tmpStream.clear();
             tmpStream.str(std::string{});
 
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp,  vw_GetTextUTF32("Alien Spaceships"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp,  vw_GetTextUTF32(VW_TEXT_ID("Alien Spaceships")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, AlienShipsKillQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2 + 126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, AlienShipsKillBonusString);
             Y += Prir;
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32("Alien Motherships"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Alien Motherships")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, AlienMotherShipsKillQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2 + 126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, AlienMotherShipsKillBonusString);
             Y += Prir;
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32("Pirate Spaceships"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirate Spaceships")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, PirateShipsKillQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2 + 126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, PirateShipsKillBonusString);
             Y += Prir;
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32("Pirate Vehicles"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirate Vehicles")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, PirateVehiclesKillQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2 + 126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, PirateVehiclesKillBonusString);
             Y += Prir;
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32("Pirate Buildings"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirate Buildings")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, PirateBuildingsKillQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2 + 126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, PirateBuildingsKillBonusString);
             Y += Prir;
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32("Asteroids"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Asteroids")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, AsteroidsKillQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2 + 126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, AsteroidsKillBonusString);
 
             Y += (int)(Prir*1.5);
-            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, GameContentTransp, vw_GetTextUTF32("Total"));
+            vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256+38, Y, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Total")));
             vw_DrawText(GameConfig().InternalWidth / 2 + 10, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, SummaryQuantString);
             vw_DrawText(GameConfig().InternalWidth / 2+126, Y, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, GameContentTransp, SummaryBonusString);
 
             // button
             int X = GameConfig().InternalWidth / 2 - 192;
             Y = 545;
-            if (DrawButton384(X,Y, vw_GetTextUTF32("NEXT"), GameContentTransp, GameButton4Transp, LastGameButton4UpdateTime)) {
+            if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("NEXT")), GameContentTransp, GameButton4Transp, LastGameButton4UpdateTime)) {
                 ExitGameWithSave(eCommand::SWITCH_FROM_GAME_TO_MISSION_MENU);
             }
         } else {
@@ -709,11 +818,11 @@ void DrawGame()
                 sRECT SrcRect(2, 2, 564-2, 564-2);
                 sRECT DstRect(GameConfig().InternalWidth / 2 - 256+4-30, 128+2-30, GameConfig().InternalWidth / 2 - 256+564-30, 128+564-2-30);
                 constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/dialog512_512.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2),
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2),
                           true, GameContentTransp);
                 // title
-                int SizeI = 17 + (234-vw_TextWidthUTF32(vw_GetTextUTF32("GAME MENU")))/2;
-                vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256 + SizeI, 128+22, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.7f * GameContentTransp, vw_GetTextUTF32("GAME MENU"));
+                int SizeI = 17 + (234-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("GAME MENU"))))/2;
+                vw_DrawTextUTF32(GameConfig().InternalWidth / 2 - 256 + SizeI, 128+22, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, 0.7f * GameContentTransp, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")));
 
                 // buttons
 
@@ -722,7 +831,7 @@ void DrawGame()
                 int Y = 225;
                 int Prir = 100;
 
-                if (DrawButton384(X,Y, vw_GetTextUTF32("RESUME"), GameContentTransp, GameButton1Transp, LastGameButton1UpdateTime)) {
+                if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("RESUME")), GameContentTransp, GameButton1Transp, LastGameButton1UpdateTime)) {
                     GameMenu = false;
                     NeedShowGameMenu = false;
                     NeedHideGameMenu = true;
@@ -737,13 +846,13 @@ void DrawGame()
                 }
 
                 Y = Y+Prir;
-                if (DrawButton384(X,Y, vw_GetTextUTF32("OPTIONS"), GameContentTransp, GameButton2Transp, LastGameButton2UpdateTime)) {
+                if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("OPTIONS")), GameContentTransp, GameButton2Transp, LastGameButton2UpdateTime)) {
                     SetOptionsMenu(eMenuStatus::OPTIONS);
                     GameMenuStatus = eGameMenuStatus::OPTIONS;
                 }
 
                 Y = Y+Prir;
-                if (DrawButton384(X,Y, vw_GetTextUTF32("RESTART"), GameContentTransp, GameButton3Transp, LastGameButton3UpdateTime)) {
+                if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("RESTART")), GameContentTransp, GameButton3Transp, LastGameButton3UpdateTime)) {
                     if (PlayerFighter.expired()) {
                         ExitGame(eCommand::SWITCH_FROM_MENU_TO_GAME);
                     } else {
@@ -752,7 +861,7 @@ void DrawGame()
                 }
 
                 Y = Y+Prir;
-                if (DrawButton384(X,Y, vw_GetTextUTF32("QUIT"), GameContentTransp, GameButton4Transp, LastGameButton4UpdateTime)) {
+                if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("QUIT")), GameContentTransp, GameButton4Transp, LastGameButton4UpdateTime)) {
                     if (PlayerFighter.expired()) {
                         ExitGame(eCommand::SWITCH_FROM_GAME_TO_MAIN_MENU);
                     } else {
@@ -784,9 +893,9 @@ void DrawGame()
             sRECT SrcRect(0, 0, 256, 64);
             sRECT DstRect(GameConfig().InternalWidth - 256 + 60, 768 - 54, GameConfig().InternalWidth + 60, 768 + 10);
             if (GameContentTransp == 1.0f) {
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(hash_djb2a(vw_GetText("lang/en/game/pause.tga").c_str())), true, CurrentAlert2*GameContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(hash_djb2a(vw_GetText(VW_TEXT_ID("lang/en/game/pause.tga")).c_str())), true, CurrentAlert2*GameContentTransp);
             } else {
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(hash_djb2a(vw_GetText("lang/en/game/pause.tga").c_str())), true, GameContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(hash_djb2a(vw_GetText(VW_TEXT_ID("lang/en/game/pause.tga")).c_str())), true, GameContentTransp);
             }
 
         }
@@ -864,7 +973,7 @@ void DrawGame()
         sRECT SrcRect(0, 0, 2, 2);
         sRECT DstRect(0, 0, GameConfig().InternalWidth, 768);
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/blackpoint.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, GameBlackTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, GameBlackTransp);
     }
 
     // fade-out
@@ -882,7 +991,7 @@ void DrawGame()
         sRECT SrcRect(0, 0, 2, 2);
         sRECT DstRect(0, 0, GameConfig().InternalWidth, 768);
         constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/blackpoint.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, GameBlackTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, GameBlackTransp);
     }
 
 
@@ -79,6 +79,9 @@ unsigned int VoiceWarningCollisionDetected{0};
 // voice (index in voice array) with warning about missile detected
 unsigned int VoiceMissileDetected{0};
 bool VoiceMissileDetectedStatus{false};
+// warning messages status, updated by simulation step, drawn each frame
+bool MissileDetectedWarning{false};
+bool CollisionCourseWarning{false};
 // voice (index in voice array) with weapon malfunction + no ammo
 unsigned int VoiceWeaponMalfunction{0};
 // sound that player have low life (armor)
@@ -218,6 +221,21 @@ float GetShipEngineSystemEnergyUse(int Num)
 
 
 
+/*
+ * Draw warning message text (skipped in headless mode, since we don't have OpenGL context).
+ */
+static void DrawWarningMessage(const std::u32string &Text, int WarningMessagesCount, const sRGBCOLOR &Color)
+{
+    if (GameHeadlessMode) {
+        return;
+    }
+
+    vw_SetFontSize(24);
+    int TmpFontSize = (GameConfig().InternalWidth - vw_TextWidthUTF32(Text)) / 2;
+    vw_DrawTextUTF32(TmpFontSize, 720 - 40*WarningMessagesCount, 0, 0, 1.0f, Color, CurrentAlert3, Text);
+    ResetFontSize();
+}
+
 //------------------------------------------------------------------------------------
 // Player ship initialization at each game start/restart
 //------------------------------------------------------------------------------------
@@ -226,6 +244,8 @@ void InitGamePlayerShip()
     //create ship
     VoiceMissileDetected = 0;
     VoiceMissileDetectedStatus = false;
+    MissileDetectedWarning = false;
+    CollisionCourseWarning = false;
     VoiceWeaponMalfunction = 0;
     SoundLowLife = 0;
 
@@ -410,10 +430,46 @@ void InitGamePlayerShip()
 
 
 //------------------------------------------------------------------------------------
-// Main loop for player ship
+// Draw player ship's warning messages, called each rendered frame
+//------------------------------------------------------------------------------------
+void DrawGamePlayerShipWarnings()
+{
+    if (PlayerFighter.expired()
+        || GameContentTransp >= 0.99f
+        || GameMissionCompleteStatus) {
+        return;
+    }
+
+    int WarningMessagesCount = 0;
+
+    if (MissileDetectedWarning) {
+        // draw "Missile Detected" text
+        DrawWarningMessage(vw_GetTextUTF32(VW_TEXT_ID("Missile Detected")), WarningMessagesCount, sRGBCOLOR{eRGBCOLOR::orange});
+        WarningMessagesCount++;
+    } else {
+        if (CurrentAlert3 == 1.0f) {
+            VoiceMissileDetectedStatus = false;
+        } else if (VoiceMissileDetectedStatus) {
+            // draw "Missile Detected" text
+            DrawWarningMessage(vw_GetTextUTF32(VW_TEXT_ID("Missile Detected")), WarningMessagesCount, sRGBCOLOR{eRGBCOLOR::orange});
+            WarningMessagesCount++;
+        }
+    }
+
+    if (CollisionCourseWarning) {
+        // draw "Collision Course Detected" text
+        DrawWarningMessage(vw_GetTextUTF32(VW_TEXT_ID("Collision Course Detected")), WarningMessagesCount, sRGBCOLOR{eRGBCOLOR::red});
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Main loop for player ship, called each fixed simulation step
 //------------------------------------------------------------------------------------
 void GamePlayerShip()
 {
+    MissileDetectedWarning = false;
+    CollisionCourseWarning = false;
+
     auto sharedPlayerFighter = PlayerFighter.lock();
     if (!sharedPlayerFighter) {
         return;
@@ -440,8 +496,6 @@ void GamePlayerShip()
 
     // play voice only in game (not in menu) and only in case mission not complete yet
     if (GameContentTransp < 0.99f && !GameMissionCompleteStatus) {
-        int WarningMessagesCount = 0;
-
         //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // Check is we have some missile that targeted on player ship
         //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -463,23 +517,7 @@ void GamePlayerShip()
                 VoiceMissileDetectedStatus = true;
             }
 
-            // draw "Missile Detected" text
-            vw_SetFontSize(24);
-            int TmpFontSize = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32("Missile Detected"))) / 2;
-            vw_DrawTextUTF32(TmpFontSize, 720 - 40*WarningMessagesCount, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, CurrentAlert3, vw_GetTextUTF32("Missile Detected"));
-            ResetFontSize();
-            WarningMessagesCount++;
-        } else {
-            if (CurrentAlert3 == 1.0f) {
-                VoiceMissileDetectedStatus = false;
-            } else if (VoiceMissileDetectedStatus) {
-                // draw "Missile Detected" text
-                vw_SetFontSize(24);
-                int TmpFontSize = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32("Missile Detected"))) / 2;
-                vw_DrawTextUTF32(TmpFontSize, 720 - 40*WarningMessagesCount, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, CurrentAlert3, vw_GetTextUTF32("Missile Detected"));
-                ResetFontSize();
-                WarningMessagesCount++;
-            }
+            MissileDetectedWarning = true;
         }
 
 
@@ -519,12 +557,7 @@ void GamePlayerShip()
                 VoiceWarningCollisionDetected = PlayVoicePhrase(eVoicePhrase::Warning, 1.0f);
             }
 
-            // draw "Collision Course Detected" text
-            vw_SetFontSize(24);
-            int TmpFontSize = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32("Collision Course Detected"))) / 2;
-            vw_DrawTextUTF32(TmpFontSize, 720 - 40*WarningMessagesCount, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3, vw_GetTextUTF32("Collision Course Detected"));
-            ResetFontSize();
-            WarningMessagesCount++;
+            CollisionCourseWarning = true;
         }
 
 
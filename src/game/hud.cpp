@@ -49,7 +49,7 @@ std::weak_ptr<cParticleSystem2D> ArmorEmblemCircle{};
 std::weak_ptr<cParticleSystem2D> ArmorEmblemHoriz{};
 std::weak_ptr<cParticleSystem2D> ArmorEmblemVert{};
 
-GLtexture HUDBorderTexture{0};
+sTextureRegion HUDBorderTexture{};
 
 int CurrentExperience{0};
 int CurrentMoney{0};
@@ -283,10 +283,10 @@ static void InitHUDBorder()
 {
     if (GameConfig().InternalWidth == config::VirtualWidth_Standard) {
         constexpr unsigned tmpHash = constexpr_hash_djb2a("game/game_panel.tga");
-        HUDBorderTexture = GetPreloadedTextureAsset(tmpHash);
+        HUDBorderTexture = GetPreloadedTextureRegion(tmpHash);
     } else {
         constexpr unsigned tmpHash = constexpr_hash_djb2a("game/game_panel2.tga");
-        HUDBorderTexture = GetPreloadedTextureAsset(tmpHash);
+        HUDBorderTexture = GetPreloadedTextureRegion(tmpHash);
     }
 }
 
@@ -295,7 +295,7 @@ static void InitHUDBorder()
  */
 static void DrawHUDBorder()
 {
-    if (!HUDBorderTexture) {
+    if (!HUDBorderTexture.Texture) {
         return;
     }
 
@@ -667,6 +667,8 @@ void InitHUD(std::weak_ptr<cSpaceShip> &SpaceShip, float EnergyStatus, const int
 void DrawHUD()
 {
     DrawHUDBorder();
+    // particle systems, progress bars and text use direct rendering
+    vw_FlushDrawList2D();
     DrawHUDParticleSystems();
     DrawHUDProgressBars();
     DrawHUDText();
@@ -118,7 +118,7 @@ static void DrawSlimWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
                   X + SlimBorder * 2 + SlimSeparator + ProgressBarWidth * 2,
                   Y + SlimBorder * 2 + ProgressBarHeight);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    GLtexture tmpBlackPoint = GetPreloadedTextureAsset(tmpHash1);
+    sTextureRegion tmpBlackPoint = GetPreloadedTextureRegion(tmpHash1);
     vw_Draw2D(DstRect, SrcRect, tmpBlackPoint, true, 0.2f);
 
     DstRect(X + SlimBorder + AmmoOffsetX,
@@ -145,7 +145,7 @@ static void DrawSlimWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + SlimBorder + AmmoOffsetX + ProgressBarWidth,
             Y + SlimBorder + ProgressBarHeight);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("game/ammo.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 1.0f);
 
     int ReloadProgressBar = WeaponReloadProgress(sharedWeapon, TimeLastUpdate, ProgressBarHeight);
     SrcRect(0, ReloadProgressBar, ProgressBarWidth, ProgressBarHeight);
@@ -154,7 +154,7 @@ static void DrawSlimWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + SlimBorder + ReloadOffsetX + ProgressBarWidth,
             Y + SlimBorder + ProgressBarHeight);
     constexpr unsigned tmpHash3 = constexpr_hash_djb2a("game/energy.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, 1.0f);
 }
 
 /*
@@ -169,7 +169,7 @@ static void DrawFlatWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
                   X + FlatBorder * 2 + FlatSeparator * 2 + ProgressBarWidth * 2 + WeaponIconWidth,
                   Y + FlatBorder * 2 + WeaponIconHeight);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    GLtexture tmpBlackPoint = GetPreloadedTextureAsset(tmpHash1);
+    sTextureRegion tmpBlackPoint = GetPreloadedTextureRegion(tmpHash1);
     vw_Draw2D(DstRect, SrcRect, tmpBlackPoint, true, 0.2f);
 
     DstRect(X + FlatBorder + AmmoOffsetX,
@@ -192,12 +192,12 @@ static void DrawFlatWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
 
     SrcRect(0, 0, WeaponIconWidth, WeaponIconHeight);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/weapon_on_icon.tga");
-    GLtexture tmpWeaponStatus = GetPreloadedTextureAsset(tmpHash2);
+    sTextureRegion tmpWeaponStatus = GetPreloadedTextureRegion(tmpHash2);
 
     bool WeaponDestroyed = (sharedWeapon->ArmorCurrentStatus <= 0.0f);
     if (WeaponDestroyed) {
         vw_Draw2D(DstRect, SrcRect, tmpWeaponStatus, true, WeaponStatusBlinking, 0.0f, sRGBCOLOR{eRGBCOLOR::red});
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
         return;
     }
 
@@ -209,7 +209,7 @@ static void DrawFlatWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
         vw_Draw2D(DstRect, SrcRect, tmpWeaponStatus, true, 1.0f, 0.0f, sRGBCOLOR{eRGBCOLOR::green});
     }
 
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
 
     int AmmoProgressBar = WeaponAmmoProgress(sharedWeapon, ProgressBarHeight);
     SrcRect(0, AmmoProgressBar, ProgressBarWidth, ProgressBarHeight);
@@ -218,7 +218,7 @@ static void DrawFlatWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + FlatBorder + AmmoOffsetX + ProgressBarWidth,
             Y + FlatBorder + ProgressBarHeight);
     constexpr unsigned tmpHash3 = constexpr_hash_djb2a("game/ammo.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, 1.0f);
 
     int ReloadProgressBar = WeaponReloadProgress(sharedWeapon, TimeLastUpdate, ProgressBarHeight);
     SrcRect(0, ReloadProgressBar, ProgressBarWidth, ProgressBarHeight);
@@ -227,14 +227,14 @@ static void DrawFlatWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + FlatBorder + ReloadOffsetX + ProgressBarWidth,
             Y + FlatBorder + ProgressBarHeight);
     constexpr unsigned tmpHash4 = constexpr_hash_djb2a("game/energy.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, 1.0f);
 }
 
 /*
  * Draw full weapon panel.
  */
 static void DrawFullWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX, int IconOffsetX,
-                                GLtexture PanelBorder,
+                                const sTextureRegion &PanelBorder,
                                 std::shared_ptr<cWeapon> &sharedWeapon, float TimeLastUpdate)
 {
     sRECT SrcRect(0, 0, FullPanelWidth, FullPanelHeight);
@@ -250,12 +250,12 @@ static void DrawFullWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + IconOffsetX + WeaponIconWidth,
             Y + 12 + WeaponIconHeight);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/weapon_on_icon.tga");
-    GLtexture tmpWeaponStatus = GetPreloadedTextureAsset(tmpHash1);
+    sTextureRegion tmpWeaponStatus = GetPreloadedTextureRegion(tmpHash1);
 
     bool WeaponDestroyed = (sharedWeapon->ArmorCurrentStatus <= 0.0f);
     if (WeaponDestroyed) {
         vw_Draw2D(DstRect, SrcRect, tmpWeaponStatus, true, WeaponStatusBlinking, 0.0f, sRGBCOLOR{eRGBCOLOR::red});
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
         return;
     }
 
@@ -267,7 +267,7 @@ static void DrawFullWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
         vw_Draw2D(DstRect, SrcRect, tmpWeaponStatus, true, 1.0f, 0.0f, sRGBCOLOR{eRGBCOLOR::green});
     }
 
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, 1.0f);
 
     int AmmoProgressBar = WeaponAmmoProgress(sharedWeapon, FullProgressBarHeight);
     SrcRect(0, AmmoProgressBar, ProgressBarWidth, FullProgressBarHeight);
@@ -276,7 +276,7 @@ static void DrawFullWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + AmmoOffsetX + ProgressBarWidth,
             Y + 16 + FullProgressBarHeight);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("game/weapon_ammo.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 1.0f);
 
     int ReloadProgressBar = WeaponReloadProgress(sharedWeapon, TimeLastUpdate, FullProgressBarHeight);
     SrcRect(0, ReloadProgressBar, ProgressBarWidth, FullProgressBarHeight);
@@ -285,7 +285,7 @@ static void DrawFullWeaponPanel(int X, int Y, int AmmoOffsetX, int ReloadOffsetX
             X + ReloadOffsetX + ProgressBarWidth,
             Y + 16 + FullProgressBarHeight);
     constexpr unsigned tmpHash3 = constexpr_hash_djb2a("game/weapon_energy.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, 1.0f);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, 1.0f);
 
 }
 
@@ -301,7 +301,7 @@ static void DrawLeftWeaponPanel(std::shared_ptr<cSpaceShip> &sharedSpaceShip,
             constexpr unsigned tmpHash = constexpr_hash_djb2a("game/weapon_panel_left.tga");
             DrawFullWeaponPanel(0, 70 + DrawLevelPos * 85,
                                 2, 12, 24,
-                                GetPreloadedTextureAsset(tmpHash),
+                                GetPreloadedTextureRegion(tmpHash),
                                 sharedWeapon, sharedSpaceShip->TimeLastUpdate);
         }
         break;
@@ -342,7 +342,7 @@ static void DrawRightWeaponPanel(std::shared_ptr<cSpaceShip> &sharedSpaceShip,
             DrawFullWeaponPanel(GameConfig().InternalWidth - 164,
                                 70 + DrawLevelPos * 85,
                                 154, 144, 12,
-                                GetPreloadedTextureAsset(tmpHash),
+                                GetPreloadedTextureRegion(tmpHash),
                                 sharedWeapon, sharedSpaceShip->TimeLastUpdate);
         }
         break;
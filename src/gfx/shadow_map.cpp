@@ -25,13 +25,20 @@
 
 *****************************************************************************/
 
-// TODO ShadowMap_StartRenderToFBO() should be fixed in order to automatically
+// TODO ShadowMap_StartRenderToFBO() with manual setup should be fixed in order to automatically
 //      calculate focus point, probably not a good idea setup gluLookAt() to point,
 //      that based on camera focus point and 'magic' FocusPointCorrection
+//      (for now, used in menu only, game switched to ShadowMap_FitLightFrustum())
+
+// NOTE we use perspective projection for light, since shadow map shader care about
+//      ShadowTexCoord.w (see light_shadowmap.frag), so, tight fit calculate field of view
+//      and near/far clip planes instead of orthographic box
 
 #include "../core/core.h"
 #include "../config/config.h"
 #include "shadow_map.h"
+#include <cmath>
+#include <cstring>
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -49,6 +56,29 @@ float yPixelOffset{0};
 std::weak_ptr<sFBO> CurrentSystemFBO{};
 int ShadowMapViewPort_x, ShadowMapViewPort_y, ShadowMapViewPort_width, ShadowMapViewPort_height;
 
+// light's frustum, for shadow casters culling
+sFrustum LightFrustum{};
+
+// tight fit related
+// padding for fitted bounds (part of bounds diagonal), in order to prevent refit on each frame
+constexpr float FitPaddingFactor{0.1f};
+constexpr float FitMinPadding{5.0f};
+// minimal distance from light position to fitted bounds center
+constexpr float FitMinLightDistance{100.0f};
+bool LightFrustumFitted{false};
+unsigned LightFrustumRevision{0};
+sVECTOR3D FittedMinPoint{};
+sVECTOR3D FittedMaxPoint{};
+sVECTOR3D FittedLightDirection{};
+float FittedLightProjectionMatrix[16];
+float FittedLightModelViewMatrix[16];
+
+// static shadow casters depth cache
+std::shared_ptr<sFBO> StaticCastersFBO{};
+bool StaticCastersCacheValid{false};
+unsigned StaticCastersRevision{0};
+unsigned StaticCastersLightFrustumRevision{0};
+
 } // unnamed namespace
 
 
@@ -82,6 +112,12 @@ bool ShadowMap_Init(int Width, int Height)
 
     ShadowMapFBO = vw_BuildFBO(Width, Height, false, true);
     if (ShadowMapFBO && ShadowMapFBO->DepthSize >= 24) { // we need at least 24 bits
+        // depth cache for static shadow casters, should have same depth format,
+        // since we blit it into shadow map, if failed - just render all casters each frame
+        StaticCastersFBO = vw_BuildFBO(Width, Height, false, true);
+        if (StaticCastersFBO && StaticCastersFBO->DepthSize != ShadowMapFBO->DepthSize) {
+            StaticCastersFBO.reset();
+        }
         return true;
     }
 
@@ -100,6 +136,9 @@ void ShadowMap_Release()
     }
 
     ShadowMapFBO.reset();
+    StaticCastersFBO.reset();
+    StaticCastersCacheValid = false;
+    LightFrustumFitted = false;
 }
 
 /*
@@ -187,10 +226,252 @@ void ShadowMap_StartRenderToFBO(sVECTOR3D FocusPointCorrection, float Distance,
               0.0f, 1.0f, 0.0f);
 
     vw_GetMatrix(eMatrixPname::MODELVIEW, ShadowMap_LightModelViewMatrix);
+    vw_CalculateFrustum(LightFrustum);
+    vw_CullFace(eCullFace::FRONT);
+    vw_PolygonOffset(true, 2.0f, 2.0f);
+}
+
+/*
+ * Get main direct light direction.
+ */
+static bool GetLightDirection(sVECTOR3D &LightDirection)
+{
+    std::weak_ptr<cLight> CurrentDirectLight;
+    if (!vw_GetMainDirectLight(CurrentDirectLight)) {
+        return false;
+    }
+
+    auto sharedCurrentDirectLight = CurrentDirectLight.lock();
+    if (!sharedCurrentDirectLight) {
+        return false;
+    }
+
+    LightDirection = sharedCurrentDirectLight->Direction;
+    if (LightDirection.Length() <= 0.0f) {
+        return false;
+    }
+    LightDirection.Normalize();
+    return true;
+}
+
+/*
+ * Check, is box (MinPoint, MaxPoint) inside of box (OuterMinPoint, OuterMaxPoint).
+ */
+static bool BoxInsideBox(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint,
+                         const sVECTOR3D &OuterMinPoint, const sVECTOR3D &OuterMaxPoint)
+{
+    return MinPoint.x >= OuterMinPoint.x && MinPoint.y >= OuterMinPoint.y && MinPoint.z >= OuterMinPoint.z &&
+           MaxPoint.x <= OuterMaxPoint.x && MaxPoint.y <= OuterMaxPoint.y && MaxPoint.z <= OuterMaxPoint.z;
+}
+
+/*
+ * Fit light's frustum to shadow receivers bounds (world space AABB).
+ * Prediction - how bounds will move (for example, camera movement for next few seconds),
+ * in order to prevent light's frustum refit (and static casters cache update) on each frame.
+ * Return false, if shadow map should not be rendered (no shadow map or no direct light).
+ */
+bool ShadowMap_FitLightFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint,
+                               const sVECTOR3D &Prediction)
+{
+    if (!ShadowMapFBO || !ShadowMapFBO->DepthTexture
+        || MinPoint.x > MaxPoint.x || MinPoint.y > MaxPoint.y || MinPoint.z > MaxPoint.z) {
+        return false;
+    }
+
+    sVECTOR3D LightDirection;
+    if (!GetLightDirection(LightDirection)) {
+        return false;
+    }
+
+    // padded bounds with prediction
+    float Padding = (MaxPoint - MinPoint).Length() * FitPaddingFactor;
+    if (Padding < FitMinPadding) {
+        Padding = FitMinPadding;
+    }
+    sVECTOR3D NeedMinPoint = MinPoint - sVECTOR3D{Padding, Padding, Padding};
+    sVECTOR3D NeedMaxPoint = MaxPoint + sVECTOR3D{Padding, Padding, Padding};
+    NeedMinPoint += sVECTOR3D{std::min(Prediction.x, 0.0f), std::min(Prediction.y, 0.0f), std::min(Prediction.z, 0.0f)};
+    NeedMaxPoint += sVECTOR3D{std::max(Prediction.x, 0.0f), std::max(Prediction.y, 0.0f), std::max(Prediction.z, 0.0f)};
+
+    // current fit still good enough, if receivers inside fitted bounds and fitted bounds
+    // not too big for them (in this case, we lose shadow map resolution)
+    if (LightFrustumFitted
+        && (LightDirection * FittedLightDirection) > 0.9999f
+        && BoxInsideBox(MinPoint, MaxPoint, FittedMinPoint, FittedMaxPoint)
+        && (FittedMaxPoint - FittedMinPoint).Length() < (NeedMaxPoint - NeedMinPoint).Length() * 2.0f) {
+        return true;
+    }
+
+    FittedMinPoint = NeedMinPoint;
+    FittedMaxPoint = NeedMaxPoint;
+    FittedLightDirection = LightDirection;
+
+    sVECTOR3D Center = (FittedMinPoint + FittedMaxPoint) ^ 0.5f;
+    float Radius = (FittedMaxPoint - FittedMinPoint).Length() * 0.5f;
+    // the more distance, the less perspective distortion, but the worse depth precision
+    float Distance = Radius * 2.0f;
+    if (Distance < FitMinLightDistance) {
+        Distance = FitMinLightDistance;
+    }
+    // for directional light, we should move eyes point
+    sVECTOR3D LightPosition = Center - (LightDirection ^ Distance);
+    // up vector should not be collinear with light direction
+    sVECTOR3D Up{0.0f, 1.0f, 0.0f};
+    if (fabsf(LightDirection.y) > 0.99f) {
+        Up(0.0f, 0.0f, 1.0f);
+    }
+
+    vw_PushMatrix();
+    vw_LoadIdentity();
+    gluLookAt(LightPosition.x, LightPosition.y, LightPosition.z,
+              Center.x, Center.y, Center.z,
+              Up.x, Up.y, Up.z);
+    vw_GetMatrix(eMatrixPname::MODELVIEW, FittedLightModelViewMatrix);
+    vw_PopMatrix();
+
+    // find field of view and depth range by bounds corners in light's view space
+    float AspectRatio = ShadowMapFBO->Width.f() / ShadowMapFBO->Height.f();
+    float MaxTanX{0.0f};
+    float MaxTanY{0.0f};
+    float MinDepth{Distance + Radius};
+    float MaxDepth{0.0f};
+    for (int i = 0; i < 8; i++) {
+        sVECTOR3D Corner{(i & 1) ? FittedMaxPoint.x : FittedMinPoint.x,
+                         (i & 2) ? FittedMaxPoint.y : FittedMinPoint.y,
+                         (i & 4) ? FittedMaxPoint.z : FittedMinPoint.z};
+        vw_Matrix44CalcPoint(Corner, FittedLightModelViewMatrix);
+        // note, camera looks along -z in view space
+        float Depth = -Corner.z;
+        if (Depth < 1.0f) {
+            Depth = 1.0f;
+        }
+        MaxTanX = std::max(MaxTanX, fabsf(Corner.x) / Depth);
+        MaxTanY = std::max(MaxTanY, fabsf(Corner.y) / Depth);
+        MinDepth = std::min(MinDepth, Depth);
+        MaxDepth = std::max(MaxDepth, Depth);
+    }
+    float TanHalfFOV = std::max(MaxTanY, MaxTanX / AspectRatio);
+    // shadow casters could be located between light and receivers, don't cut them
+    float NearClip = MinDepth - Radius;
+    if (NearClip < 1.0f) {
+        NearClip = 1.0f;
+    }
+    float FarClip = MaxDepth + FitMinPadding;
+
+    // same as gluPerspective() matrix, but we don't touch current matrices
+    float Focal = 1.0f / TanHalfFOV;
+    memset(FittedLightProjectionMatrix, 0, sizeof(FittedLightProjectionMatrix));
+    FittedLightProjectionMatrix[0] = Focal / AspectRatio;
+    FittedLightProjectionMatrix[5] = Focal;
+    FittedLightProjectionMatrix[10] = (FarClip + NearClip) / (NearClip - FarClip);
+    FittedLightProjectionMatrix[11] = -1.0f;
+    FittedLightProjectionMatrix[14] = 2.0f * FarClip * NearClip / (NearClip - FarClip);
+
+    LightFrustumFitted = true;
+    LightFrustumRevision++;
+    return true;
+}
+
+/*
+ * Setup shadow map rendering with fitted light's frustum.
+ */
+static void StartRenderToFBOWithFittedLight(std::shared_ptr<sFBO> &FBO)
+{
+    vw_PushMatrix(); // push MODELVIEW matrix
+
+    vw_GetViewport(&ShadowMapViewPort_x, &ShadowMapViewPort_y, &ShadowMapViewPort_width, &ShadowMapViewPort_height);
+    vw_SetViewport(0, 0, FBO->Width.i(), FBO->Height.i(), eOrigin::bottom_left);
+    vw_DepthRange(0.005f, 1.0f);
+
+    CurrentSystemFBO = vw_GetCurrentFBO();
+    vw_BindFBO(FBO);
+    vw_SetColorMask(false, false, false, false);
+
+    vw_MatrixMode(eMatrixMode::PROJECTION);
+    vw_PushMatrix();
+    vw_LoadIdentity();
+    vw_MultMatrix(FittedLightProjectionMatrix);
+    vw_MatrixMode(eMatrixMode::MODELVIEW);
+    vw_LoadIdentity();
+    vw_MultMatrix(FittedLightModelViewMatrix);
+
+    memcpy(ShadowMap_LightProjectionMatrix, FittedLightProjectionMatrix, sizeof(ShadowMap_LightProjectionMatrix));
+    memcpy(ShadowMap_LightModelViewMatrix, FittedLightModelViewMatrix, sizeof(ShadowMap_LightModelViewMatrix));
+    vw_CalculateFrustum(LightFrustum);
     vw_CullFace(eCullFace::FRONT);
     vw_PolygonOffset(true, 2.0f, 2.0f);
 }
 
+/*
+ * Check, should static shadow casters depth cache be updated.
+ * Revision - static shadow casters revision, should be changed by caller
+ * on any static shadow casters changes (add, remove, move, etc).
+ */
+bool ShadowMap_NeedUpdateStaticCasters(unsigned Revision)
+{
+    if (!StaticCastersFBO || !LightFrustumFitted) {
+        return false;
+    }
+
+    return !StaticCastersCacheValid
+           || StaticCastersRevision != Revision
+           || StaticCastersLightFrustumRevision != LightFrustumRevision;
+}
+
+/*
+ * Start static shadow casters rendering into depth cache (with fitted light's frustum).
+ * Should be finished by ShadowMap_EndRenderToFBO() call.
+ */
+void ShadowMap_StartRenderStaticCastersToFBO(unsigned Revision)
+{
+    if (!StaticCastersFBO || !LightFrustumFitted) {
+        return;
+    }
+
+    StartRenderToFBOWithFittedLight(StaticCastersFBO);
+    vw_Clear(RI_DEPTH_BUFFER);
+
+    StaticCastersCacheValid = true;
+    StaticCastersRevision = Revision;
+    StaticCastersLightFrustumRevision = LightFrustumRevision;
+}
+
+/*
+ * Is static shadow casters depth cache available.
+ */
+bool ShadowMap_StaticCastersCached()
+{
+    return StaticCastersFBO && StaticCastersCacheValid && LightFrustumFitted;
+}
+
+/*
+ * Start shadow map rendering (depth map) with fitted light's frustum.
+ * If static shadow casters depth cache available, it will be used instead of depth clear.
+ */
+void ShadowMap_StartRenderToFBO()
+{
+    if (!ShadowMapFBO || !ShadowMapFBO->DepthTexture || !LightFrustumFitted) {
+        return;
+    }
+
+    if (ShadowMap_StaticCastersCached()) {
+        vw_BlitDepthFBO(StaticCastersFBO, ShadowMapFBO);
+        StartRenderToFBOWithFittedLight(ShadowMapFBO);
+    } else {
+        StartRenderToFBOWithFittedLight(ShadowMapFBO);
+        vw_Clear(RI_DEPTH_BUFFER);
+    }
+}
+
+/*
+ * Check, is box in light's frustum (for shadow casters culling).
+ * Note, light's frustum calculated in shadow map rendering start call.
+ */
+bool ShadowMap_BoxInLightFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)
+{
+    return vw_BoxInFrustum(LightFrustum, MinPoint, MaxPoint);
+}
+
 /*
  * End shadow map rendering (depth map).
  */
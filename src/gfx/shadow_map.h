@@ -47,8 +47,21 @@ void ShadowMap_Release();
 void ShadowMap_SizeSetup(eShadowMapSetup ShadowMapSetup);
 // Start shadow map rendering (depth map).
 void ShadowMap_StartRenderToFBO(sVECTOR3D FocusPointCorrection, float Distance, float fFarClip);
+// Fit light's frustum to shadow receivers bounds (world space AABB).
+bool ShadowMap_FitLightFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint,
+                               const sVECTOR3D &Prediction);
+// Check, should static shadow casters depth cache be updated.
+bool ShadowMap_NeedUpdateStaticCasters(unsigned Revision);
+// Start static shadow casters rendering into depth cache (with fitted light's frustum).
+void ShadowMap_StartRenderStaticCastersToFBO(unsigned Revision);
+// Is static shadow casters depth cache available.
+bool ShadowMap_StaticCastersCached();
+// Start shadow map rendering (depth map) with fitted light's frustum.
+void ShadowMap_StartRenderToFBO();
 // End shadow map rendering (depth map).
 void ShadowMap_EndRenderToFBO();
+// Check, is box in light's frustum (for shadow casters culling).
+bool ShadowMap_BoxInLightFrustum(const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint);
 // Start scene rendering with shadows (color).
 void ShadowMap_StartFinalRender();
 // End scene rendering with shadows (color).
@@ -71,9 +71,20 @@ float StarsTileEndTransparentLayer2{0.0f};
 
 sVECTOR3D InGameInitialLocation{0, 10, 250};
 
-// vertex array for rendering
-float VertexArray[36]; // 4 * 9 = 4 vertices * (RI_3f_XYZ | RI_4f_COLOR | RI_1_TEX);
-unsigned int VertexArrayPosition{0};
+// space dust layers geometry, built once in local coordinates (layers moved by matrix,
+// tile animation by texture matrix), rebuilt only in case layers setup changed
+enum class eSpaceDustLayer : unsigned {
+    Clouds,
+    Stars,
+    Close,
+    size
+};
+constexpr unsigned SpaceDustLayerStride{9}; // RI_3f_XYZ | RI_4f_COLOR | RI_1_TEX
+constexpr unsigned SpaceDustLayerVertices{4};
+float SpaceDustVertexArray[static_cast<unsigned>(eSpaceDustLayer::size) * SpaceDustLayerVertices * SpaceDustLayerStride];
+GLuint SpaceDustVBO{0};
+bool SpaceDustNeedRebuild{true};
+eDrawType SpaceDustDrawType{eDrawType::MENU};
 
 } // unnamed namespace
 
@@ -140,6 +151,7 @@ void StarSystemInitByType(eDrawType DrawType)
     StarsTileEndTransparentLayer1 = 0.7f;
     StarsTileStartTransparentLayer2 = 0.9f;
     StarsTileEndTransparentLayer2 = 0.7f;
+    SpaceDustNeedRebuild = true;
 
     switch (DrawType) {
     case eDrawType::MENU:
@@ -230,6 +242,7 @@ void StarSystemLayer1Transp(float Start, float End)
 {
     StarsTileStartTransparentLayer1 = Start;
     StarsTileEndTransparentLayer1 = End;
+    SpaceDustNeedRebuild = true;
 }
 
 /*
@@ -239,6 +252,7 @@ void StarSystemLayer3Transp(float Start, float End)
 {
     StarsTileStartTransparentLayer2 = Start;
     StarsTileEndTransparentLayer2 = End;
+    SpaceDustNeedRebuild = true;
 }
 
 /*
@@ -249,35 +263,110 @@ void StarSystemRelease()
     for (unsigned i = 0; i < static_cast<unsigned>(eSide::size); i++)
         SkyBoxSetTexture(0, static_cast<eSide>(i));
 
+    if (SpaceDustVBO) {
+        vw_DeleteBufferObject(SpaceDustVBO);
+    }
+    SpaceDustNeedRebuild = true;
+
     StarSystem_Inited = false;
 }
 
 /*
- * Draw local vertex array.
+ * Add space dust layer's quad into local vertex array.
  */
-static inline void DrawVertexArray()
+static void AddSpaceDustLayer(eSpaceDustLayer Layer, float width_2, float heigh_2, float length_2,
+                              float StartTransparent, float EndTransparent,
+                              float TextureUStart, float TextureUEnd, float TextureV)
 {
-    vw_Draw3D(ePrimitiveType::TRIANGLE_STRIP, 4,
-              RI_3f_XYZ | RI_4f_COLOR | RI_1_TEX,
-              VertexArray, 9 * sizeof(VertexArray[0]));
+    struct sVertex {
+        float x, y, z, Alpha, u, v;
+    };
+    const sVertex Vertices[SpaceDustLayerVertices]{
+        {width_2, heigh_2, length_2 + length_2 / 2.0f, StartTransparent, TextureUEnd, 0.0f},
+        {width_2, heigh_2, -length_2 / 2.0f, EndTransparent, TextureUEnd, TextureV},
+        {-width_2, -heigh_2, length_2 + length_2 / 2.0f, StartTransparent, TextureUStart, 0.0f},
+        {-width_2, -heigh_2, -length_2 / 2.0f, EndTransparent, TextureUStart, TextureV}
+    };
+
+    unsigned Position = static_cast<unsigned>(Layer) * SpaceDustLayerVertices * SpaceDustLayerStride;
+    for (const auto &tmpVertex : Vertices) {
+        SpaceDustVertexArray[Position++] = tmpVertex.x;
+        SpaceDustVertexArray[Position++] = tmpVertex.y;
+        SpaceDustVertexArray[Position++] = tmpVertex.z;
+        SpaceDustVertexArray[Position++] = 1.0f;
+        SpaceDustVertexArray[Position++] = 1.0f;
+        SpaceDustVertexArray[Position++] = 1.0f;
+        SpaceDustVertexArray[Position++] = tmpVertex.Alpha;
+        SpaceDustVertexArray[Position++] = tmpVertex.u;
+        SpaceDustVertexArray[Position++] = tmpVertex.v;
+    }
 }
 
 /*
- * Add vertex to  to local vertex array.
+ * Build space dust layers geometry (if need).
  */
-static inline void AddToVertexArray(float CoordX, float CoordY, float CoordZ,
-                                    sRGBCOLOR Color, float Alpha,
-                                    float TextureU, float TextureV)
+static void PrepareSpaceDustLayers(eDrawType DrawType)
 {
-    VertexArray[VertexArrayPosition++] = CoordX;
-    VertexArray[VertexArrayPosition++] = CoordY;
-    VertexArray[VertexArrayPosition++] = CoordZ;
-    VertexArray[VertexArrayPosition++] = Color.r;
-    VertexArray[VertexArrayPosition++] = Color.g;
-    VertexArray[VertexArrayPosition++] = Color.b;
-    VertexArray[VertexArrayPosition++] = Alpha;
-    VertexArray[VertexArrayPosition++] = TextureU;
-    VertexArray[VertexArrayPosition++] = TextureV;
+    if (!SpaceDustNeedRebuild && SpaceDustDrawType == DrawType) {
+        return;
+    }
+
+    float width_2{0.0f};
+    float heigh_2{110.0f};
+    float length_2{110.0f};
+    float StartTransparentLayer1{0.7f};
+    float EndTransparentLayer1{0.7f};
+    float StartTransparentLayer2{0.9f};
+    float EndTransparentLayer2{0.7f};
+
+    if (DrawType == eDrawType::GAME) {
+        width_2 = length_2 = 175.0f;
+        heigh_2 = 0.0f;
+
+        StartTransparentLayer1 = StarsTileStartTransparentLayer1;
+        EndTransparentLayer1 = StarsTileEndTransparentLayer1;
+        StartTransparentLayer2 = StarsTileStartTransparentLayer2;
+        EndTransparentLayer2 = StarsTileEndTransparentLayer2;
+    }
+
+    AddSpaceDustLayer(eSpaceDustLayer::Clouds, width_2, heigh_2, length_2,
+                      StartTransparentLayer1, EndTransparentLayer1, 0.0f, 1.0f, 1.0f);
+    AddSpaceDustLayer(eSpaceDustLayer::Stars, width_2, heigh_2, length_2,
+                      StartTransparentLayer1, EndTransparentLayer1, 0.0f, 3.0f, 3.0f);
+    AddSpaceDustLayer(eSpaceDustLayer::Close, width_2, heigh_2, length_2,
+                      StartTransparentLayer2, EndTransparentLayer2, 0.2f, 3.2f, 3.0f);
+
+    if (SpaceDustVBO) {
+        vw_DeleteBufferObject(SpaceDustVBO);
+    }
+    if (!vw_BuildBufferObject(eBufferObject::Vertex, sizeof(SpaceDustVertexArray),
+                              SpaceDustVertexArray, SpaceDustVBO)) {
+        SpaceDustVBO = 0;
+    }
+
+    SpaceDustNeedRebuild = false;
+    SpaceDustDrawType = DrawType;
+}
+
+/*
+ * Draw space dust layer with tile animation.
+ */
+static void DrawSpaceDustLayer(eSpaceDustLayer Layer, float TileOffset)
+{
+    // tile animation by texture matrix, instead of texture coordinates change
+    vw_MatrixMode(eMatrixMode::TEXTURE);
+    vw_LoadIdentity();
+    vw_Translate(sVECTOR3D{0.0f, TileOffset, 0.0f});
+    vw_MatrixMode(eMatrixMode::MODELVIEW);
+
+    vw_Draw3D(ePrimitiveType::TRIANGLE_STRIP, SpaceDustLayerVertices,
+              RI_3f_XYZ | RI_4f_COLOR | RI_1_TEX,
+              SpaceDustVertexArray, SpaceDustLayerStride * sizeof(SpaceDustVertexArray[0]), SpaceDustVBO,
+              static_cast<unsigned>(Layer) * SpaceDustLayerVertices);
+
+    vw_MatrixMode(eMatrixMode::TEXTURE);
+    vw_LoadIdentity();
+    vw_MatrixMode(eMatrixMode::MODELVIEW);
 }
 
 /*
@@ -308,81 +397,48 @@ void StarSystemDraw(eDrawType DrawType)
         vw_DepthTest(true, eCompareFunc::LEQUAL);
     }
 
-    // FIXME should be moved to 'space_object' code
     // planets and big asteroids should be rendered before 'space dust'
-    ForEachSpaceObject([&] (cSpaceObject &tmpSpace) {
-        if (tmpSpace.ObjectType == eObjectType::Planet) {
-            if (DrawType == eDrawType::GAME) {
-                vw_PushMatrix();
-                vw_Translate(sVECTOR3D{CurrentCameraLocation.x * 0.90f - GetCameraShake() * 4.0f,
-                                       GetCameraShake() * 2.0f,
-                                       0.0f});
-            }
-            tmpSpace.Draw(false);
-            if (DrawType == eDrawType::GAME) {
-                vw_PopMatrix();
-            }
+    ForEachPlanet([&] (cSpaceObject &tmpSpace) {
+        if (DrawType == eDrawType::GAME) {
+            vw_PushMatrix();
+            vw_Translate(sVECTOR3D{CurrentCameraLocation.x * 0.90f - GetCameraShake() * 4.0f,
+                                   GetCameraShake() * 2.0f,
+                                   0.0f});
+        }
+        tmpSpace.Draw(false);
+        if (DrawType == eDrawType::GAME) {
+            vw_PopMatrix();
         }
     });
 
     // planetoids much more closer to player, than planets, clear the depth buffer
     vw_Clear(RI_DEPTH_BUFFER);
 
-    ForEachSpaceObject([&] (cSpaceObject &tmpSpace) {
-        if (tmpSpace.ObjectType == eObjectType::Planetoid) {
-            if (DrawType == eDrawType::GAME) {
-                vw_PushMatrix();
-                vw_Translate(sVECTOR3D{CurrentCameraLocation.x * 0.70f - GetCameraShake() * 4.0f,
-                                       GetCameraShake() * 2.0f,
-                                       0.0f});
-            }
-            tmpSpace.Draw(false);
-            if (DrawType == eDrawType::GAME) {
-                vw_PopMatrix();
-            }
+    ForEachPlanetoid([&] (cSpaceObject &tmpSpace) {
+        if (DrawType == eDrawType::GAME) {
+            vw_PushMatrix();
+            vw_Translate(sVECTOR3D{CurrentCameraLocation.x * 0.70f - GetCameraShake() * 4.0f,
+                                   GetCameraShake() * 2.0f,
+                                   0.0f});
+        }
+        tmpSpace.Draw(false);
+        if (DrawType == eDrawType::GAME) {
+            vw_PopMatrix();
         }
     });
 
     // 'space dust' much more closer to player, than planets and planetoids, clear the depth buffer
     vw_Clear(RI_DEPTH_BUFFER);
 
-    float width_2{0.0f};
-    float heigh_2{110.0f};
-    float length_2{110.0f};
-    float x{GetCameraCoveredDistance().x};
-    float y{GetCameraCoveredDistance().y};
-    float z{GetCameraCoveredDistance().z};
-    float StartTransparentLayer1{0.7f};
-    float EndTransparentLayer1{0.7f};
-    sRGBCOLOR Color{1.0f, 1.0f, 1.0f};
+    PrepareSpaceDustLayers(DrawType);
 
+    sVECTOR3D LayersLocation{GetCameraCoveredDistance()};
     if (DrawType == eDrawType::GAME) {
-        width_2 = length_2 = 175.0f;
-        heigh_2 = 0.0f;
-
-        x = GetCameraCoveredDistance().x + GetCameraShake() + CurrentCameraLocation.x * 0.8f;
-        y = GetCameraCoveredDistance().y - GetCameraShake() * 0.5f;
-        z = GetCameraCoveredDistance().z + 25.0f;
-
-        StartTransparentLayer1 = StarsTileStartTransparentLayer1;
-        EndTransparentLayer1 = StarsTileEndTransparentLayer1;
+        LayersLocation.x += GetCameraShake() + CurrentCameraLocation.x * 0.8f;
+        LayersLocation.y -= GetCameraShake() * 0.5f;
+        LayersLocation.z += 25.0f;
     }
 
-    // first 'space dust' layer (clouds)
-    VertexArrayPosition = 0;
-    AddToVertexArray(x + width_2, y + heigh_2, z + length_2 + length_2 / 2.0f,
-                     Color, StartTransparentLayer1,
-                     1.0f, 0.0f + StarsTile / 3.0f);
-    AddToVertexArray(x + width_2, y + heigh_2, z - length_2 / 2.0f,
-                     Color, EndTransparentLayer1,
-                     1.0f, 1.0f + StarsTile / 3.0f);
-    AddToVertexArray(x - width_2, y - heigh_2, z + length_2 + length_2 / 2.0f,
-                     Color, StartTransparentLayer1,
-                     0.0f, 0.0f + StarsTile / 3.0f);
-    AddToVertexArray(x - width_2, y - heigh_2, z - length_2/2,
-                     Color, EndTransparentLayer1,
-                     0.0f, 1.0f + StarsTile / 3.0f);
-
     if (DrawType == eDrawType::MENU) {
         StarsTile -= 0.015f * (vw_GetTimeThread(0) - StarsTileUpdateTime);
         StarsTileUpdateTime = vw_GetTimeThread(0);
@@ -402,38 +458,24 @@ void StarSystemDraw(eDrawType DrawType)
 
     vw_DepthTest(false, eCompareFunc::LESS);
 
+    vw_PushMatrix();
     if (DrawType == eDrawType::MENU) {
-        vw_PushMatrix();
         vw_Rotate(-20.0f, 0.0f, 0.0f, 1.0f);
         vw_Rotate(-45.0f, 0.0f, 1.0f, 0.0f);
         vw_Rotate(30.0f, 1.0f, 0.0f, 0.0f);
     }
+    vw_Translate(LayersLocation);
 
-    DrawVertexArray();
+    // first 'space dust' layer (clouds)
+    DrawSpaceDustLayer(eSpaceDustLayer::Clouds, StarsTile / 3.0f);
 
     // second 'space dust' layer
-    VertexArrayPosition = 0;
-    AddToVertexArray(x + width_2, y + heigh_2, z + length_2 + length_2 / 2.0f,
-                     Color, StartTransparentLayer1,
-                     3.0f, 0.0f + StarsTile);
-    AddToVertexArray(x + width_2, y + heigh_2, z - length_2 / 2.0f,
-                     Color, EndTransparentLayer1,
-                     3.0f, 3.0f + StarsTile);
-    AddToVertexArray(x - width_2, y - heigh_2, z + length_2 + length_2 / 2.0f,
-                     Color, StartTransparentLayer1,
-                     0.0f, 0.0f + StarsTile);
-    AddToVertexArray(x - width_2, y - heigh_2, z - length_2/2,
-                     Color, EndTransparentLayer1,
-                     0.0f, 3.0f + StarsTile);
-
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("skybox/tile_stars.tga");
     vw_BindTexture(0, GetPreloadedTextureAsset(tmpHash2));
 
-    DrawVertexArray();
+    DrawSpaceDustLayer(eSpaceDustLayer::Stars, StarsTile);
 
-    if (DrawType == eDrawType::MENU) {
-        vw_PopMatrix();
-    }
+    vw_PopMatrix();
 
     vw_DepthTest(true, eCompareFunc::LEQUAL);
 
@@ -459,45 +501,18 @@ void StarSystemDrawThirdLayer(eDrawType DrawType)
         return;
     }
 
-    float width_2{0.0f};
-    float heigh_2{110.0f};
-    float length_2{110.0f};
-    float x{GetCameraCoveredDistance().x};
-    float y{GetCameraCoveredDistance().y};
-    float z{GetCameraCoveredDistance().z};
-    float StartTransparentLayer2{0.9f};
-    float EndTransparentLayer2{0.7f};
-    sRGBCOLOR Color{1.0f, 1.0f, 1.0f};
+    PrepareSpaceDustLayers(DrawType);
 
+    sVECTOR3D LayersLocation{GetCameraCoveredDistance()};
     if (DrawType == eDrawType::GAME) {
-        width_2 = length_2 = 175.0f;
-        heigh_2 = 0.0f;
-
         sVECTOR3D CurrentCameraLocation;
         vw_GetCameraLocation(&CurrentCameraLocation);
 
-        x = GetCameraCoveredDistance().x + GetCameraShake() * 2.0f + CurrentCameraLocation.x * 0.5f;
-        y = GetCameraCoveredDistance().y - GetCameraShake();
-        z = GetCameraCoveredDistance().z + 25.0f;
-
-        StartTransparentLayer2 = StarsTileStartTransparentLayer2;
-        EndTransparentLayer2 = StarsTileEndTransparentLayer2;
+        LayersLocation.x += GetCameraShake() * 2.0f + CurrentCameraLocation.x * 0.5f;
+        LayersLocation.y -= GetCameraShake();
+        LayersLocation.z += 25.0f;
     }
 
-    VertexArrayPosition = 0;
-    AddToVertexArray(x + width_2, y + heigh_2, z + length_2 + length_2/ 2.0f,
-                     Color, StartTransparentLayer2,
-                     3.2f, 0.0f + StarsTile2);
-    AddToVertexArray(x + width_2, y + heigh_2, z - length_2 / 2.0f,
-                     Color, EndTransparentLayer2,
-                     3.2f, 3.0f + StarsTile2);
-    AddToVertexArray(x - width_2, y - heigh_2, z + length_2 + length_2 / 2.0f,
-                     Color, StartTransparentLayer2,
-                     0.2f, 0.0f + StarsTile2);
-    AddToVertexArray(x - width_2, y - heigh_2, z - length_2 / 2.0f,
-                     Color, EndTransparentLayer2,
-                     0.2f, 3.0f + StarsTile2);
-
     if (DrawType == eDrawType::MENU) {
         StarsTile2 -= 0.04f * (vw_GetTimeThread(0) - StarsTileUpdateTime2);
         StarsTileUpdateTime2 = vw_GetTimeThread(0);
@@ -515,18 +530,17 @@ void StarSystemDrawThirdLayer(eDrawType DrawType)
     vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE);
     vw_DepthTest(false, eCompareFunc::LESS);
 
+    vw_PushMatrix();
     if (DrawType == eDrawType::MENU) {
-        vw_PushMatrix();
         vw_Rotate(-20.0f, 0.0f, 0.0f, 1.0f);
         vw_Rotate(-45.0f, 0.0f, 1.0f, 0.0f);
         vw_Rotate(30.0f, 1.0f, 0.0f, 0.0f);
     }
+    vw_Translate(LayersLocation);
 
-    DrawVertexArray();
+    DrawSpaceDustLayer(eSpaceDustLayer::Close, StarsTile2);
 
-    if (DrawType == eDrawType::MENU) {
-        vw_PopMatrix();
-    }
+    vw_PopMatrix();
 
     vw_DepthTest(true, eCompareFunc::LEQUAL);
     vw_SetTextureBlend(false, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
@@ -30,9 +30,11 @@
 #include "platform/platform.h"
 #include "ui/cursor.h"
 #include "ui/fps_counter.h"
+#include "ui/profiler_overlay.h"
 #include "ui/game_speed.h"
 #include "gfx/star_system.h"
 #include "game/weapon_panel.h"
+#include "assets/residency.h"
 #include "command.h"
 #include "enum.h"
 #include "game.h" // FIXME "game.h" should be replaced by individual headers
@@ -47,6 +49,8 @@ namespace astromenace {
  */
 void Loop_Proc()
 {
+    cProfilerScope ProfilerScope{"Frame", true};
+
     CursorUpdate();
 
     vw_BeginRendering(RI_COLOR_BUFFER | RI_DEPTH_BUFFER);
@@ -63,23 +67,36 @@ void Loop_Proc()
     case eMenuStatus::PROFILE:
     case eMenuStatus::DIFFICULTY:
     case eMenuStatus::MISSION:
-    case eMenuStatus::WORKSHOP:
-        DrawMenu();
+    case eMenuStatus::WORKSHOP: {
+        {
+            cProfilerScope ProfilerScopeMenu{"DrawMenu", true};
+            DrawMenu();
+        }
+        // prefetch in background assets, that next mission needs
+        cProfilerScope ProfilerScopeAssets{"AssetsResidency"};
+        UpdateAssetsResidency();
         break;
+    }
 
-    case eMenuStatus::GAME:
+    case eMenuStatus::GAME: {
+        cProfilerScope ProfilerScopeGame{"DrawGame", true};
         DrawGame();
         break;
     }
+    }
 
     vw_Start2DMode(-1,1);
 
     DrawDialogBox();
     CursorDraw();
     cFPS::GetInstance().Draw();
+    cProfilerOverlay::GetInstance().Draw();
 
     vw_End2DMode();
-    vw_EndRendering();
+    {
+        cProfilerScope ProfilerScopeSwap{"EndRendering", true};
+        vw_EndRendering();
+    }
 
     if (vw_GetKeyStatus(SDLK_ESCAPE)) {
         SetCurrentDialogBox(eDialogBox::QuitFromGame);
@@ -89,6 +106,7 @@ void Loop_Proc()
     cCommand::GetInstance().Proceed();
     cGameSpeed::GetInstance().Update();
     cFPS::GetInstance().Update();
+    cProfilerOverlay::GetInstance().Update();
 
     // switch active menu element by keyboard (TAB key)
     if (vw_GetKeyStatus(SDLK_TAB)) {
@@ -44,6 +44,7 @@
 #include "game.h" // FIXME "game.h" should be replaced by individual headers
 #include "SDL2/SDL.h"
 #include <algorithm>
+#include <stdlib.h>
 #include <string.h>
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
@@ -344,9 +345,18 @@ static void Loop()
         }
 
         if (!NeedPause) {
+            // all transient data from previous frame should not be used any more
+            vw_ResetFrameArena();
+            // time threads are sampled once per loop cycle
+            vw_UpdateTimeThreads();
+            vw_ProfilerBeginFrame();
             JoystickEmulateMouseMovement(vw_GetTimeThread(0));
             Loop_Proc();
-            AudioLoop();
+            {
+                cProfilerScope ProfilerScope{"AudioLoop"};
+                AudioLoop();
+            }
+            vw_ProfilerEndFrame();
         } else {
             // turn off music
             if (vw_IsAnyMusicPlaying()) {
@@ -383,6 +393,8 @@ int main(int argc, char *argv[])
     bool NeedShowSystemCursor{false};
     bool NeedResetConfig{false};
     bool NeedPack{false};
+    unsigned RecordFramesCount{0};
+    std::string RecordFramesDirectory{};
 
     // don't use getopt_long() here, since it could be not available (MSVC)
     for (int i = 1; i < argc; i++) {
@@ -393,6 +405,10 @@ int main(int argc, char *argv[])
                       << "--pack - pack data to gamedata.vfs file;\n"
                       << "--mouse - launch the game without system cursor hiding;\n"
                       << "--reset-config - reset all settings except Pilot Profiles;\n"
+                      << "--profile-trace=/folder/file.json - write profiler's trace for each played mission\n"
+                      << "                                    (Chrome trace_event JSON, or CSV for \".csv\" file);\n"
+                      << "--record-frames=N - record first N frames as BMP files (Desktop folder by default);\n"
+                      << "--record-dir=/folder - folder for recorded frames;\n"
                       << "--help - info about all game launch options.\n";
             return 0;
         }
@@ -417,6 +433,21 @@ int main(int argc, char *argv[])
             continue;
         }
 
+        if (!strncmp(argv[i], "--profile-trace=", strlen("--profile-trace="))) {
+            vw_ProfilerSetTraceFileName(argv[i] + strlen("--profile-trace="));
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--record-frames=", strlen("--record-frames="))) {
+            RecordFramesCount = static_cast<unsigned>(strtoul(argv[i] + strlen("--record-frames="), nullptr, 10));
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--record-dir=", strlen("--record-dir="))) {
+            RecordFramesDirectory = argv[i] + strlen("--record-dir=");
+            continue;
+        }
+
         if (!strcmp(argv[i], "--reset-config")) {
             NeedResetConfig = true;
         }
@@ -456,6 +487,7 @@ int main(int argc, char *argv[])
     bool FirstStart = LoadXMLConfigFile(NeedResetConfig);
 
     if (!VideoConfig(FirstStart)) {
+        FlushConfigFiles();
         vw_ReleaseText();
         vw_ShutdownVFS();
         SDL_Quit();
@@ -497,6 +529,7 @@ RecreateWindow:
         vw_ShutdownVFS();
         JoystickClose();
         vw_ReleaseAllTimeThread();
+        FlushConfigFiles();
         SDL_Quit();
         return 1;
     }
@@ -524,6 +557,12 @@ RecreateWindow:
     CursorInit(NeedShowSystemCursor); // should be called after vw_InitTimeThread(0) and LoadAllGameAssets()
     InitMenu(eMenuStatus::MAIN_MENU);
 
+    if (RecordFramesCount) {
+        vw_StartFramesRecording(GameConfig().Width, GameConfig().Height,
+                                RecordFramesDirectory.empty() ? GetDesktopPath() : RecordFramesDirectory,
+                                RecordFramesCount);
+    }
+
     // Main loop.
     Loop();
 
@@ -540,6 +579,7 @@ RecreateWindow:
     vw_ReleaseAllFontChars();
     vw_ReleaseAllTextures();
     ShadowMap_Release();
+    vw_ReleaseProfiler();
 
     // gl stuff -> gl context -> window
     vw_ReleaseOpenGLStuff();
@@ -563,6 +603,7 @@ RecreateWindow:
     vw_ShutdownVFS();
     JoystickClose();
     vw_ReleaseAllTimeThread();
+    FlushConfigFiles();
     SDL_Quit();
     return 0;
 }
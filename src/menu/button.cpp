@@ -116,16 +116,16 @@ bool DrawButton384(int X, int Y, const std::u32string &Text, float Transp, float
     SrcRect(2,2,512-2,96-2 );
     DstRect(X-64+2,Y-17+2,X-64+512-2,Y-17+96-2);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/button384_back.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, IntTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, IntTransp);
     // draw button
     SrcRect(0,0,384,64 );
     DstRect(X,Y,X+384,Y+64);
     if (!ON) {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/button384_out.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, Transp);
     } else {
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/button384_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, Transp);
     }
 
 
@@ -186,12 +186,12 @@ bool DrawButton256(int X, int Y, const std::u32string &Text, float Transp, float
         SrcRect(2,2,512-2,96-2 );
         DstRect(X-125+2,Y-16+2,X-125+512-2,Y-16+96-2);
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/button256_back.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, Transp);
 
         SrcRect(0,0,256,64 );
         DstRect(X,Y,X+256,Y+64);
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/button256_off.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, Transp);
 
 
         int Size = vw_TextWidthUTF32(Text);
@@ -271,16 +271,16 @@ bool DrawButton256(int X, int Y, const std::u32string &Text, float Transp, float
     SrcRect(2,2,512-2,96-2 );
     DstRect(X-125+2,Y-16+2,X-125+512-2,Y-16+96-2);
     constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/button256_back.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, IntTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, IntTransp);
     // draw button
     SrcRect(0,0,256,64 );
     DstRect(X,Y,X+256,Y+64);
     if (!ON) {
         constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/button256_out.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, Transp);
     } else {
         constexpr unsigned tmpHash5 = constexpr_hash_djb2a("menu/button256_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash5), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash5), true, Transp);
     }
 
 
@@ -341,7 +341,7 @@ bool DrawButton200_2(int X, int Y, const std::u32string &Text, float Transp, boo
 
     if (Off || DragWeapon) {
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/button_dialog200_off.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, Transp);
 
         vw_DrawTextUTF32(SizeI, Y+6, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, (0.7f*Transp)/2.0f, Text);
 
@@ -394,10 +394,10 @@ bool DrawButton200_2(int X, int Y, const std::u32string &Text, float Transp, boo
 
     if (!ON) {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/button_dialog200_out.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, Transp);
     } else {
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/button_dialog200_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, Transp);
     }
 
     // draw text
@@ -446,7 +446,7 @@ bool DrawButton128_2(int X, int Y, const std::u32string &Text, float Transp, boo
 
     if (Off || DragWeapon) {
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/button_dialog128_off.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, Transp);
 
         vw_DrawTextUTF32(SizeI, Y+6, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, (0.7f*Transp)/2.0f, Text);
 
@@ -500,10 +500,10 @@ bool DrawButton128_2(int X, int Y, const std::u32string &Text, float Transp, boo
 
     if (!ON) {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/button_dialog128_out.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, Transp);
     } else {
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/button_dialog128_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, Transp);
     }
 
     // draw text
@@ -583,10 +583,10 @@ void DrawCheckBox(int X, int Y, bool &CheckBoxStatus, const std::u32string &Text
     }
 
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/checkbox_main.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, Transp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, Transp);
     if (CheckBoxStatus) {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/checkbox_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, Transp);
     }
 
 
@@ -621,7 +621,7 @@ bool DrawListUpButton(int X, int Y, float Transp, bool Off)
     if (Off || DragWeapon) {
         DstRect(X+2,Y+2,X+32-2,Y+32-2);
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/arrow_list_up.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.3f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.3f*Transp);
 
         if  (vw_MouseOverRect(MouseRect) && !isDialogBoxDrawing() && Transp == 1.0f && !DragWeapon) {
             SetCursorStatus(eCursorStatus::ActionProhibited);
@@ -673,10 +673,10 @@ bool DrawListUpButton(int X, int Y, float Transp, bool Off)
     if (!ON) {
         DstRect(X+2,Y+2,X+32-2,Y+32-2);
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/arrow_list_up.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.3f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.3f*Transp);
     } else {
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/arrow_list_up.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, Transp);
     }
 
 
@@ -710,7 +710,7 @@ bool DrawListDownButton(int X, int Y, float Transp, bool Off)
     if (Off || DragWeapon) {
         DstRect(X+2,Y+2,X+32-2,Y+32-2);
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/arrow_list_down.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.3f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.3f*Transp);
 
         if (vw_MouseOverRect(MouseRect) && !isDialogBoxDrawing() && Transp == 1.0f && !DragWeapon) {
             SetCursorStatus(eCursorStatus::ActionProhibited);
@@ -762,10 +762,10 @@ bool DrawListDownButton(int X, int Y, float Transp, bool Off)
     if (!ON) {
         DstRect(X+2,Y+2,X+32-2,Y+32-2);
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/arrow_list_down.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.3f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.3f*Transp);
     } else {
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/arrow_list_down.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, Transp);
     }
 
 
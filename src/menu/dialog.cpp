@@ -163,10 +163,10 @@ static bool DrawDialogButton200(int X, int Y, const std::u32string &Text, float
     DstRect(X-14+2,Y-14+2,X+230-14-2,Y+64-14-2);
     if (!ON) {
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/button_dialog200_out.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.8f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.8f*Transp);
     } else {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/button_dialog200_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.8f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.8f*Transp);
     }
 
 
@@ -249,10 +249,10 @@ static bool DrawDialogButton128(int X, int Y, const std::u32string &Text, float
     DstRect(X-14+2,Y-14+2,X+158-14-2,Y+64-14-2);
     if (!ON) {
         constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/button_dialog128_out.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.8f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.8f*Transp);
     } else {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/button_dialog128_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.8f*Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.8f*Transp);
     }
 
 
@@ -337,10 +337,10 @@ static void DrawCheckBox_2(int X, int Y, bool &CheckBoxStatus, const std::u32str
     }
 
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/checkbox_main.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, Transp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, Transp);
     if (CheckBoxStatus) {
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/checkbox_in.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, Transp);
     }
 
 
@@ -503,7 +503,7 @@ void DrawDialogBox()
     SrcRect(0, 0, 2, 2);
     DstRect(0, 0, GameConfig().InternalWidth, 768);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.6f*DialogContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.6f*DialogContentTransp);
 
 
 
@@ -517,7 +517,7 @@ void DrawDialogBox()
         DstRect(X+2-30,Y+2-30,X+572-2-30,Y+316-2-30);
         {
             constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/dialog512_256.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, DialogContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, DialogContentTransp);
         }
         break;
     case eDialogTypeBySize::w512h512:
@@ -525,14 +525,14 @@ void DrawDialogBox()
         DstRect(X+4-30,Y+2-30,X+564-30,Y+564-2-30);
         {
             constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/dialog512_512.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, DialogContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, DialogContentTransp);
         }
         break;
     case eDialogTypeBySize::w768h600:
         SrcRect(2,2,828-2,659-2 );
         DstRect(X+2-30,Y+2-30,X+828-2-30,Y+659-2-30);
         constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/dialog768_600.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, DialogContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, DialogContentTransp);
         break;
     }
 
@@ -564,98 +564,98 @@ void DrawDialogBox()
     switch (CurrentDialogBox) {
     case eDialogBox::QuitFromGame:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("QUIT")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("QUIT"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("QUIT"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("QUIT")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Are you sure you want to quit?"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to quit?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to quit?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: all game data will be saved."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: all game data will be saved.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: all game data will be saved."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: all game data will be saved.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: all game data will be saved."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: all game data will be saved.")));
         }
 
         // buttons
-        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32("YES"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("YES")), DialogContentTransp)) {
             QuitFromMainLoop();
             CloseDialog();
         }
-        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32("NO"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("NO")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
 
     case eDialogBox::ProfileCreationError:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("ERROR")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("ERROR"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("ERROR"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("ERROR")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Cannot create a Pilot Profile."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Cannot create a Pilot Profile.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Cannot create a Pilot Profile."));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Cannot create a Pilot Profile.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Cannot create a Pilot Profile."));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Cannot create a Pilot Profile.")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tip: you should clear one line first."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tip: you should clear one line first.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Tip: you should clear one line first."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tip: you should clear one line first.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Tip: you should clear one line first."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tip: you should clear one line first.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton200(X+128+64-72/2,Y+ButtonOffset, vw_GetTextUTF32("CLOSE"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+128+64-72/2,Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("CLOSE")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
 
     case eDialogBox::DeleteProfile:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("DELETE")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("DELETE"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("DELETE"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("DELETE")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Are you sure you want to delete the Profile?"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to delete the Profile?")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to delete the Profile?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to delete the Profile?")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to delete the Profile?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to delete the Profile?")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: all Pilot Profile data will be lost."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: all Pilot Profile data will be lost.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: all Pilot Profile data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: all Pilot Profile data will be lost.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: all Pilot Profile data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: all Pilot Profile data will be lost.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32("YES"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("YES")), DialogContentTransp)) {
             DeleteRecord();
             if (CurrentProfile != -1) {
                 CurrentMission = GameConfig().Profile[CurrentProfile].LastMission;
             }
             CloseDialog();
         }
-        if (DrawDialogButton128(X+256+34,Y+ButtonOffset, vw_GetTextUTF32("NO"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+256+34,Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("NO")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
@@ -663,29 +663,29 @@ void DrawDialogBox()
 
     case eDialogBox::RepairShip:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("REPAIR")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("REPAIR"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("REPAIR"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("REPAIR")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Not enough money for a full hull repair."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not enough money for a full hull repair.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Not enough money for a full hull repair."));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not enough money for a full hull repair.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Not enough money for a full hull repair."));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not enough money for a full hull repair.")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: Repair has been limited by money."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: Repair has been limited by money.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: Repair has been limited by money."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: Repair has been limited by money.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: Repair has been limited by money."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: Repair has been limited by money.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton128(X+192,Y+ButtonOffset, vw_GetTextUTF32("OK"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+192,Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("OK")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
@@ -693,98 +693,98 @@ void DrawDialogBox()
 
     case eDialogBox::QuitNoSave:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("QUIT")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("QUIT"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("QUIT"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("QUIT")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Are you sure you want to quit?"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to quit?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to quit?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: the current game data will be lost."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32("YES"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("YES")), DialogContentTransp)) {
             QuitFromMainLoop();
             CloseDialog();
         }
-        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32("NO"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("NO")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
     case eDialogBox::QuiToMenuNoSave: // quit from game to main menu
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("QUIT")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("QUIT"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("QUIT"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("QUIT")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Are you sure you want to quit?"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to quit?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to quit?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to quit?")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: the current game data will be lost."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32("YES"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("YES")), DialogContentTransp)) {
             ExitGame(eCommand::SWITCH_FROM_GAME_TO_MAIN_MENU);
             CloseDialog();
         }
-        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32("NO"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("NO")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
 
     case eDialogBox::RestartLevelNoSave:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("RESTART")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("RESTART"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("RESTART"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("RESTART")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Are you sure you want to restart the game?"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to restart the game?")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to restart the game?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to restart the game?")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to restart the game?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to restart the game?")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: the current game data will be lost."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32("YES"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("YES")), DialogContentTransp)) {
             ExitGame(eCommand::SWITCH_FROM_MENU_TO_GAME);
             CloseDialog();
         }
-        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32("NO"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("NO")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
@@ -807,17 +807,17 @@ void DrawDialogBox()
             float WScale = -200;
             int X1 = X+45;
 
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Space Ship"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Space Ship")));
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Ship Type:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ship Type:")));
             vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(GetShipGroupTitle(sharedDialogSpaceShip->InternalType)));
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Width:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
             sRGBCOLOR tmpColor{eRGBCOLOR::white};
             std::ostringstream tmpStream;
             tmpStream << std::fixed << std::setprecision(1);
@@ -832,11 +832,11 @@ void DrawDialogBox()
 
                 tmpStream << sharedDialogSpaceShip->Width << " (" << sharedWorkshopFighterGame->Width << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Length:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
             tmpColor = sRGBCOLOR{eRGBCOLOR::white};
             tmpStream.clear();
             tmpStream.str(std::string{});
@@ -851,11 +851,11 @@ void DrawDialogBox()
 
                 tmpStream << sharedDialogSpaceShip->Length << " (" << sharedWorkshopFighterGame->Length << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Height:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
             tmpColor = sRGBCOLOR{eRGBCOLOR::white};
             tmpStream.clear();
             tmpStream.str(std::string{});
@@ -870,18 +870,18 @@ void DrawDialogBox()
 
                 tmpStream << sharedDialogSpaceShip->Height << " (" << sharedWorkshopFighterGame->Height << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Engines:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Engines:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
-            tmpStream << sharedDialogSpaceShip->Engines.size() << " " << vw_GetText("units");
+            tmpStream << sharedDialogSpaceShip->Engines.size() << " " << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Armor:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
             tmpColor = sRGBCOLOR{eRGBCOLOR::white};
             tmpStream.clear();
             tmpStream.str(std::string{});
@@ -897,13 +897,13 @@ void DrawDialogBox()
 
                 tmpStream << GetShipArmor(sharedDialogSpaceShip->InternalType) << " (" << GetShipArmor(sharedWorkshopFighterGame->InternalType) << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             // FIXME for "Upgrade"s are only difference with "Armor" is multiplier, remove code duplication here
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Upgrade Mk2:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Upgrade Mk2:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             if (GetShipArmor(sharedDialogSpaceShip->InternalType) == GetShipArmor(sharedWorkshopFighterGame->InternalType)) {
@@ -911,11 +911,11 @@ void DrawDialogBox()
             } else {
                 tmpStream << GetShipArmor(sharedDialogSpaceShip->InternalType) * 2 << " (" << GetShipArmor(sharedWorkshopFighterGame->InternalType) * 2 << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Upgrade Mk3:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Upgrade Mk3:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             if (GetShipArmor(sharedDialogSpaceShip->InternalType) == GetShipArmor(sharedWorkshopFighterGame->InternalType)) {
@@ -923,11 +923,11 @@ void DrawDialogBox()
             } else {
                 tmpStream << GetShipArmor(sharedDialogSpaceShip->InternalType) * 3 << " (" << GetShipArmor(sharedWorkshopFighterGame->InternalType) * 3 << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Upgrade Mk4:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Upgrade Mk4:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             if (GetShipArmor(sharedDialogSpaceShip->InternalType) == GetShipArmor(sharedWorkshopFighterGame->InternalType)) {
@@ -935,18 +935,18 @@ void DrawDialogBox()
             } else {
                 tmpStream << GetShipArmor(sharedDialogSpaceShip->InternalType) * 4 << " (" << GetShipArmor(sharedWorkshopFighterGame->InternalType) * 4 << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Weapon Slots:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Slots:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
-            tmpStream << sharedDialogSpaceShip->WeaponSlots.size() << " " << vw_GetText("units");
+            tmpStream << sharedDialogSpaceShip->WeaponSlots.size() << " " << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Slot Levels:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Slot Levels:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             if (!sharedDialogSpaceShip->WeaponSlots.empty()) {
@@ -976,54 +976,54 @@ void DrawDialogBox()
         float WScale = -200;
         int X1 = X+45;
 
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
         if (DialogWeapon->InternalType < 16) {
-            vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Weapon, Cannon"));
+            vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon, Cannon")));
         } else {
-            vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Weapon, Launcher"));
+            vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon, Launcher")));
         }
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
         vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(GetWeaponGroupTitle(DialogWeapon->InternalType)));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << DialogWeapon->ArmorInitialStatus << " " << vw_GetText("units");
+                  << DialogWeapon->ArmorInitialStatus << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << DialogWeapon->Width << " " << vw_GetText("units");
+                  << DialogWeapon->Width << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << DialogWeapon->Length << " " << vw_GetText("units");
+                  << DialogWeapon->Length << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << DialogWeapon->Height << " " << vw_GetText("units");
+                  << DialogWeapon->Height << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Damage, Kinetic:"));
+        vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, Kinetic:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
@@ -1031,14 +1031,14 @@ void DrawDialogBox()
         if (DialogWeapon->InternalType == 11
             || DialogWeapon->InternalType == 12
             || DialogWeapon->InternalType == 14) {
-            tmpStream << vw_GetText("units/sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/sec"));
         } else {
-            tmpStream << vw_GetText("units/shot");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/shot"));
         }
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Damage, EM:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, EM:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
@@ -1046,42 +1046,42 @@ void DrawDialogBox()
         if (DialogWeapon->InternalType == 11
             || DialogWeapon->InternalType == 12
             || DialogWeapon->InternalType == 14) {
-            tmpStream << vw_GetText("units/sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/sec"));
         } else {
-            tmpStream << vw_GetText("units/shot");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/shot"));
         }
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Energy Use:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Use:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << DialogWeapon->EnergyUse << " " << vw_GetText("units per shot");
+                  << DialogWeapon->EnergyUse << " " << vw_GetText(VW_TEXT_ID("units per shot"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Ammo:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ammo:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
-                  << DialogWeapon->AmmoStart << " " << vw_GetText("units");
+                  << DialogWeapon->AmmoStart << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Reload:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Reload:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << DialogWeapon->NextFireTime << " " << vw_GetText("seconds");
+                  << DialogWeapon->NextFireTime << " " << vw_GetText(VW_TEXT_ID("seconds"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Range:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Range:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << GetProjectileRange(DialogWeapon->InternalType) << " " << vw_GetText("units");
+                  << GetProjectileRange(DialogWeapon->InternalType) << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
         if (vw_GetMouseLeftClick(true) || vw_GetMouseRightClick(true)) {
@@ -1113,19 +1113,19 @@ void DrawDialogBox()
         case 2:
         case 3:
         case 4:
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Type:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Spaceship Engine"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Spaceship Engine")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Energy Use:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Use:")));
             if (NeedMoreEnergyDialog
                 && GameConfig().Profile[CurrentProfile].SpaceShipControlMode != 1) {
                 tmpColor = sRGBCOLOR{eRGBCOLOR::red};
@@ -1143,11 +1143,11 @@ void DrawDialogBox()
                 tmpStream << GetShipEngineSystemEnergyUse(DialogSystem) << " ("
                           << GetShipEngineSystemEnergyUse(GameConfig().Profile[CurrentProfile].EngineSystem) << ") ";
             }
-            tmpStream << vw_GetText("units per sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units per sec"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Engine Power:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Engine Power:")));
             tmpColor = sRGBCOLOR{eRGBCOLOR::white};
             tmpTransp = DialogContentTransp;
             tmpStream.clear();
@@ -1164,11 +1164,11 @@ void DrawDialogBox()
                 tmpStream << GetEnginePower(DialogSystem) << " ("
                           << GetEnginePower(GameConfig().Profile[CurrentProfile].EngineSystem) << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Acceleration:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Acceleration:")));
             tmpColor = sRGBCOLOR{eRGBCOLOR::white};
             tmpTransp = DialogContentTransp;
             tmpStream.clear();
@@ -1185,24 +1185,24 @@ void DrawDialogBox()
                 tmpStream << GetEngineAcceleration(DialogSystem) << " ("
                           << GetEngineAcceleration(GameConfig().Profile[CurrentProfile].EngineSystem) << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Relations/Dependencies:"));
+            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Relations/Dependencies:")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32("Power Source"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
 
             if (GameConfig().Profile[CurrentProfile].SpaceShipControlMode == 1) {
                 Y1 += Offset;
                 Y1 += Offset;
                 Y1 += Offset;
-                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32("Useless with Arcade")))/2-45;
-                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32("Useless with Arcade"));
+                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Useless with Arcade"))))/2-45;
+                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Useless with Arcade")));
                 Y1 += Offset;
-                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32("SpaceShip Control Mode.")))/2-45;
-                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32("SpaceShip Control Mode."));
+                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("SpaceShip Control Mode."))))/2-45;
+                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("SpaceShip Control Mode.")));
             }
 
             break;
@@ -1211,19 +1211,19 @@ void DrawDialogBox()
         case 6:
         case 7:
         case 8:
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Type:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Power Source"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Energy Capacity:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Capacity:")));
 
             if (GameConfig().Profile[CurrentProfile].PowerSystem == DialogSystem - 4
                 || GameConfig().Profile[CurrentProfile].PowerSystem == 0) {
@@ -1237,11 +1237,11 @@ void DrawDialogBox()
                 tmpStream << GetShipMaxEnergy(DialogSystem - 4) << " ("
                           << GetShipMaxEnergy(GameConfig().Profile[CurrentProfile].PowerSystem) << ") ";
             }
-            tmpStream << vw_GetText("units");
+            tmpStream << vw_GetText(VW_TEXT_ID("units"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Recharge Rate:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Recharge Rate:")));
             tmpColor = sRGBCOLOR{eRGBCOLOR::white};
             tmpTransp = DialogContentTransp;
             tmpStream.clear();
@@ -1262,26 +1262,26 @@ void DrawDialogBox()
                 tmpStream << GetShipRechargeEnergy(DialogSystem - 4) << " ("
                           << GetShipRechargeEnergy(GameConfig().Profile[CurrentProfile].PowerSystem) << ") ";
             }
-            tmpStream << vw_GetText("units per sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units per sec"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Relations/Dependencies:"));
+            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Relations/Dependencies:")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Weapon Recharge Rate"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Recharge Rate")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Spaceship Engine"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Spaceship Engine")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Optical Computer"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Optical Computer")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Targeting System"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Targeting System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Advanced System"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Advanced System")));
 
             break;
 
@@ -1290,24 +1290,24 @@ void DrawDialogBox()
         case 11:
         case 12:
 
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Type:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Optical Computer"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Optical Computer")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Energy Use:"));
-            tmpStream << 0.1f << " " << vw_GetText("units per sec");
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Use:")));
+            tmpStream << 0.1f << " " << vw_GetText(VW_TEXT_ID("units per sec"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Target Tracing:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Target Tracing:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             tmpStream << std::setprecision(0);
@@ -1316,34 +1316,34 @@ void DrawDialogBox()
             } else if (DialogSystem == 11 || DialogSystem == 12) {
                 tmpStream << 6 << " ";
             }
-            tmpStream << vw_GetText("object(s)");
+            tmpStream << vw_GetText(VW_TEXT_ID("object(s)"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Auto Adjustment:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Auto Adjustment:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             if (DialogSystem == 9 || DialogSystem == 11) {
-                tmpStream << vw_GetText("No");
+                tmpStream << vw_GetText(VW_TEXT_ID("No"));
             } else if (DialogSystem == 10 || DialogSystem == 12) {
-                tmpStream << vw_GetText("Yes");
+                tmpStream << vw_GetText(VW_TEXT_ID("Yes"));
             }
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Relations/Dependencies:"));
+            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Relations/Dependencies:")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32("Power Source"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32("Weapon Fire Range"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Fire Range")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Weapon Orientation"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Orientation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Targeting System"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Targeting System")));
 
             break;
 
@@ -1351,24 +1351,24 @@ void DrawDialogBox()
         case 14:
         case 15:
         case 16:
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Type:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Targeting System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Targeting System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Energy Use:"));
-            tmpStream << 0.1f << " " << vw_GetText("units per sec");
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Use:")));
+            tmpStream << 0.1f << " " << vw_GetText(VW_TEXT_ID("units per sec"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Orientation Speed:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Orientation Speed:")));
             tmpStream.clear();
             tmpStream.str(std::string{});
             tmpStream << std::setprecision(0);
@@ -1384,30 +1384,30 @@ void DrawDialogBox()
                 tmpStream << 40.0f * (DialogSystem - 12) << " ("
                           << 40.0f * GameConfig().Profile[CurrentProfile].TargetingMechanicSystem << ") ";
             }
-            tmpStream << vw_GetText("deg per sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("deg per sec"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Relations/Dependencies:"));
+            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Relations/Dependencies:")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32("Power Source"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32("Optical Computer"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Optical Computer")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Weapon Orientation"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Orientation")));
 
             if (GameConfig().Profile[CurrentProfile].WeaponTargetingMode == 1) {
                 Y1 += Offset;
                 Y1 += Offset;
                 Y1 += Offset;
-                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32("Useless with Arcade")))/2-45;
-                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32("Useless with Arcade"));
+                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Useless with Arcade"))))/2-45;
+                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Useless with Arcade")));
                 Y1 += Offset;
-                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32("Weapon Targeting Mode.")))/2-45;
-                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32("Weapon Targeting Mode."));
+                SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Weapon Targeting Mode."))))/2-45;
+                vw_DrawTextUTF32(X1+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Targeting Mode.")));
             }
 
             break;
@@ -1416,24 +1416,24 @@ void DrawDialogBox()
         case 18:
         case 19:
         case 20:
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Object Class:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Type:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Advanced System"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Advanced System")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Developer:"));
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Earth Federation"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Energy Use:"));
+            vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Use:")));
             if (NeedMoreEnergyDialog) {
                 tmpTransp = DialogContentTransp * CurrentAlert3;
                 tmpColor = sRGBCOLOR{eRGBCOLOR::red};
             }
-            tmpStream << GetShipProtectionSystemEnergyUse(DialogSystem - 16) << " " << vw_GetText("units per sec");
+            tmpStream << GetShipProtectionSystemEnergyUse(DialogSystem - 16) << " " << vw_GetText(VW_TEXT_ID("units per sec"));
             vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
             tmpTransp = DialogContentTransp;
@@ -1443,54 +1443,54 @@ void DrawDialogBox()
 
             Y1 += Offset;
             if (DialogSystem == 17) {
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Hull Repair Rate:"));
-                tmpStream << 0.5f << "% " << vw_GetText("per sec");
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Hull Repair Rate:")));
+                tmpStream << 0.5f << "% " << vw_GetText(VW_TEXT_ID("per sec"));
                 vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
             } else if (DialogSystem == 18) {
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Resistance, Hull:"));
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Resistance, Hull:")));
                 vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, "x4");
 
                 Y1 += Offset;
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Resistance, System:"));
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Resistance, System:")));
                 vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, "x5");
             } else if (DialogSystem == 19) {
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Shield Power:"));
-                tmpStream << 100.0f << " " << vw_GetText("units");
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Shield Power:")));
+                tmpStream << 100.0f << " " << vw_GetText(VW_TEXT_ID("units"));
                 vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
                 Y1 += Offset;
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Recharge Rate:"));
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Recharge Rate:")));
                 tmpStream.clear();
                 tmpStream.str(std::string{});
-                tmpStream << 2 << "% " << vw_GetText("per sec");
+                tmpStream << 2 << "% " << vw_GetText(VW_TEXT_ID("per sec"));
                 vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
             } else if (DialogSystem == 20) {
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Shield Power:"));
-                tmpStream << 150.0f << " " << vw_GetText("units");
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Shield Power:")));
+                tmpStream << 150.0f << " " << vw_GetText(VW_TEXT_ID("units"));
                 vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
 
                 Y1 += Offset;
-                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Recharge Rate:"));
+                vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Recharge Rate:")));
                 tmpStream.clear();
                 tmpStream.str(std::string{});
-                tmpStream << 3 << "% " << vw_GetText("per sec");
+                tmpStream << 3 << "% " << vw_GetText(VW_TEXT_ID("per sec"));
                 vw_DrawText(X1 + Size, Y1, WScale, 0, 1.0f, tmpColor, tmpTransp, tmpStream.str());
             }
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Relations/Dependencies:"));
+            vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Relations/Dependencies:")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32("Power Source"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Hull Resistance"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Hull Resistance")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("Systems Resistance"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Systems Resistance")));
 
             Y1 += Offset;
-            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32("SpaceShip Vitality"));
+            vw_DrawTextUTF32(X1+Size2, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("SpaceShip Vitality")));
 
             break;
         }
@@ -1504,175 +1504,175 @@ void DrawDialogBox()
 
     case eDialogBox::ProfileTipsAndTricks: { // hint for profile menu
         // dialog title
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tips and hints"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         SizeI = SizeI1 > 210 ? 17 + (WTitle-210)/2 : 17 + (WTitle-SizeI1)/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Tips and hints"));
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         // dialog text
 
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("It is possible to create five Pilot Profiles in the game in"));
-        vw_DrawTextUTF32(X+25, Y+ 80, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("It is possible to create five Pilot Profiles in the game in"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("order to store personal data. You can set an individual"));
-        vw_DrawTextUTF32(X+25, Y+115, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("order to store personal data. You can set an individual"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("difficulty level for each profile or delete the current"));
-        vw_DrawTextUTF32(X+25, Y+150, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("difficulty level for each profile or delete the current"));
-        vw_DrawTextUTF32(X+25, Y+185, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("profile to free space for a new profile."));
-
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Note that the current difficulty level is displayed in percent"));
-        vw_DrawTextUTF32(X+25, Y+240, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Note that the current difficulty level is displayed in percent"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("for each profile. This value influences the increase of"));
-        vw_DrawTextUTF32(X+25, Y+275, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("for each profile. This value influences the increase of"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("experience. For instance, if you bring down an enemy ship, you"));
-        vw_DrawTextUTF32(X+25, Y+310, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("experience. For instance, if you bring down an enemy ship, you"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("will get 100 money units and only 65 experience units if the"));
-        vw_DrawTextUTF32(X+25, Y+345, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("will get 100 money units and only 65 experience units if the"));
-        vw_DrawTextUTF32(X+25, Y+380, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("difficulty percent is set to 65 for you."));
-
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Note: you can change your difficulty level before each"));
-        vw_DrawTextUTF32(X+25, Y+435, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: you can change your difficulty level before each"));
-        vw_DrawTextUTF32(X+25, Y+470, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("new mission."));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("It is possible to create five Pilot Profiles in the game in")));
+        vw_DrawTextUTF32(X+25, Y+ 80, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("It is possible to create five Pilot Profiles in the game in")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("order to store personal data. You can set an individual")));
+        vw_DrawTextUTF32(X+25, Y+115, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("order to store personal data. You can set an individual")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("difficulty level for each profile or delete the current")));
+        vw_DrawTextUTF32(X+25, Y+150, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("difficulty level for each profile or delete the current")));
+        vw_DrawTextUTF32(X+25, Y+185, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("profile to free space for a new profile.")));
+
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note that the current difficulty level is displayed in percent")));
+        vw_DrawTextUTF32(X+25, Y+240, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note that the current difficulty level is displayed in percent")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("for each profile. This value influences the increase of")));
+        vw_DrawTextUTF32(X+25, Y+275, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("for each profile. This value influences the increase of")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("experience. For instance, if you bring down an enemy ship, you")));
+        vw_DrawTextUTF32(X+25, Y+310, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("experience. For instance, if you bring down an enemy ship, you")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("will get 100 money units and only 65 experience units if the")));
+        vw_DrawTextUTF32(X+25, Y+345, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("will get 100 money units and only 65 experience units if the")));
+        vw_DrawTextUTF32(X+25, Y+380, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("difficulty percent is set to 65 for you.")));
+
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: you can change your difficulty level before each")));
+        vw_DrawTextUTF32(X+25, Y+435, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: you can change your difficulty level before each")));
+        vw_DrawTextUTF32(X+25, Y+470, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("new mission.")));
 
         // dialog checkbox
         bool ttt = !GameConfig().NeedShowHint[0];
-        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32("Do not show this tip again."), DialogContentTransp);
+        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32(VW_TEXT_ID("Do not show this tip again.")), DialogContentTransp);
         ChangeGameConfig().NeedShowHint[0] = !ttt;
         // dialog buttons
-        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32("CLOSE"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("CLOSE")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
     }
     case eDialogBox::ShipyardTipsAndTricks: { // hint for shipyard menu
         // dialog title
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tips and hints"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         SizeI = SizeI1 > 210 ? 17 + (WTitle-210)/2 : 17 + (WTitle-SizeI1)/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Tips and hints"));
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         // dialog text
 
         int k=28;
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("There are more than 20 spaceships with unique characteristics"));
-        vw_DrawTextUTF32(X+25, Y+80+k*0, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("There are more than 20 spaceships with unique characteristics"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("available in the game. You can use the right part of the screen"));
-        vw_DrawTextUTF32(X+25, Y+80+k*1, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("available in the game. You can use the right part of the screen"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("to see your current spaceship, its characteristics and cost and"));
-        vw_DrawTextUTF32(X+25, Y+80+k*2, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("to see your current spaceship, its characteristics and cost and"));
-        vw_DrawTextUTF32(X+25, Y+80+k*3, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("also to perform basic operations, such as repair."));
-
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("The left part of the screen contains Ship Stock where you can see"));
-        vw_DrawTextUTF32(X+25, Y+100+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("The left part of the screen contains Ship Stock where you can see"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("all available spaceships and their characteristics. Do not"));
-        vw_DrawTextUTF32(X+25, Y+100+k*5, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("all available spaceships and their characteristics. Do not"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("forget that each ship has its dimensions and, which is more"));
-        vw_DrawTextUTF32(X+25, Y+100+k*6, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("forget that each ship has its dimensions and, which is more"));
-        vw_DrawTextUTF32(X+25, Y+100+k*7, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("important, different weapon mounts."));
-
-        vw_DrawTextUTF32(X+25, Y+120+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("The basic shipbuilding concept is as follows:"));
-        vw_DrawTextUTF32(X+25, Y+120+k*9, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Scout - light, small and maneuverable ships with weak weapons."));
-        vw_DrawTextUTF32(X+25, Y+120+k*10, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Interceptor - fast ships with light weapons."));
-        vw_DrawTextUTF32(X+25, Y+120+k*11, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Fighter - main type of ships with light and semi-heavy weapons."));
-        vw_DrawTextUTF32(X+25, Y+120+k*12, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Bomber - heavy destroyers with mostly heavy attack weapons."));
-        vw_DrawTextUTF32(X+25, Y+120+k*13, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Attack Ship - heavy, large and heavily armed ships."));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("There are more than 20 spaceships with unique characteristics")));
+        vw_DrawTextUTF32(X+25, Y+80+k*0, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("There are more than 20 spaceships with unique characteristics")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("available in the game. You can use the right part of the screen")));
+        vw_DrawTextUTF32(X+25, Y+80+k*1, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("available in the game. You can use the right part of the screen")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("to see your current spaceship, its characteristics and cost and")));
+        vw_DrawTextUTF32(X+25, Y+80+k*2, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("to see your current spaceship, its characteristics and cost and")));
+        vw_DrawTextUTF32(X+25, Y+80+k*3, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("also to perform basic operations, such as repair.")));
+
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("The left part of the screen contains Ship Stock where you can see")));
+        vw_DrawTextUTF32(X+25, Y+100+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("The left part of the screen contains Ship Stock where you can see")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("all available spaceships and their characteristics. Do not")));
+        vw_DrawTextUTF32(X+25, Y+100+k*5, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("all available spaceships and their characteristics. Do not")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("forget that each ship has its dimensions and, which is more")));
+        vw_DrawTextUTF32(X+25, Y+100+k*6, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("forget that each ship has its dimensions and, which is more")));
+        vw_DrawTextUTF32(X+25, Y+100+k*7, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("important, different weapon mounts.")));
+
+        vw_DrawTextUTF32(X+25, Y+120+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("The basic shipbuilding concept is as follows:")));
+        vw_DrawTextUTF32(X+25, Y+120+k*9, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Scout - light, small and maneuverable ships with weak weapons.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*10, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Interceptor - fast ships with light weapons.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*11, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Fighter - main type of ships with light and semi-heavy weapons.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*12, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Bomber - heavy destroyers with mostly heavy attack weapons.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*13, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Attack Ship - heavy, large and heavily armed ships.")));
 
         // dialog checkbox
         bool ttt = !GameConfig().NeedShowHint[1];
-        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32("Do not show this tip again."), DialogContentTransp);
+        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32(VW_TEXT_ID("Do not show this tip again.")), DialogContentTransp);
         ChangeGameConfig().NeedShowHint[1] = !ttt;
         // dialog buttons
-        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32("CLOSE"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("CLOSE")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
     }
     case eDialogBox::SystemsTipsAndTricks: { // hint for systems shop menu
         // dialog title
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tips and hints"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         SizeI = SizeI1 > 210 ? 17 + (WTitle-210)/2 : 17 + (WTitle-SizeI1)/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Tips and hints"));
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         // dialog text
 
         int k=25;
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("A set of systems is installed on the ship you operate. All systems"));
-        vw_DrawTextUTF32(X+25, Y+80+k*0, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("A set of systems is installed on the ship you operate. All systems"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("are connected with each other and with ship weapons in one way or"));
-        vw_DrawTextUTF32(X+25, Y+80+k*1, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("are connected with each other and with ship weapons in one way or"));
-        vw_DrawTextUTF32(X+25, Y+80+k*2, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("another and play important role in the game."));
-
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("You should carefully take into account the peculiarities of each"));
-        vw_DrawTextUTF32(X+25, Y+100+k*3, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("You should carefully take into account the peculiarities of each"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("system and match their characteristics to each other to get"));
-        vw_DrawTextUTF32(X+25, Y+100+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("system and match their characteristics to each other to get"));
-        vw_DrawTextUTF32(X+25, Y+100+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("a well balanced warship that can complete combat tasks."));
-
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Engine - ship engine system. Pay attention to how this system consumes"));
-        vw_DrawTextUTF32(X+25, Y+120+k*6, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Engine - ship engine system. Pay attention to how this system consumes"));
-        vw_DrawTextUTF32(X+40, Y+120+k*7, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("energy. Otherwise you run the risk of being unable to move."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("energy. Otherwise you run the risk of being unable to move."));
-        vw_DrawTextUTF32(X+25, Y+120+k*8, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Power - ship energy source. Pay attention to the main two characte-"));
-        vw_DrawTextUTF32(X+40, Y+120+k*9, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("ristics of this system - Recharge Rate and Capacity."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("O.T.C. - Optical Target Computer. As you can see from its name,"));
-        vw_DrawTextUTF32(X+25, Y+120+k*10, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("O.T.C. - Optical Target Computer. As you can see from its name,"));
-        vw_DrawTextUTF32(X+40, Y+120+k*11, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("this system is responsible for optical targeting."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Targeting - Weapon targeting system. It depends on this system how"));
-        vw_DrawTextUTF32(X+25, Y+120+k*12, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Targeting - Weapon targeting system. It depends on this system how"));
-        vw_DrawTextUTF32(X+40, Y+120+k*13, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("fast a weapon will aim and how accurate the shot will be."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Advanced - The most advanced, but yet untested systems for"));
-        vw_DrawTextUTF32(X+25, Y+120+k*14, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Advanced - The most advanced, but yet untested systems for"));
-        vw_DrawTextUTF32(X+40, Y+120+k*15, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("enhancing ship invulnerability."));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("A set of systems is installed on the ship you operate. All systems")));
+        vw_DrawTextUTF32(X+25, Y+80+k*0, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("A set of systems is installed on the ship you operate. All systems")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("are connected with each other and with ship weapons in one way or")));
+        vw_DrawTextUTF32(X+25, Y+80+k*1, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("are connected with each other and with ship weapons in one way or")));
+        vw_DrawTextUTF32(X+25, Y+80+k*2, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("another and play important role in the game.")));
+
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("You should carefully take into account the peculiarities of each")));
+        vw_DrawTextUTF32(X+25, Y+100+k*3, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("You should carefully take into account the peculiarities of each")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("system and match their characteristics to each other to get")));
+        vw_DrawTextUTF32(X+25, Y+100+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("system and match their characteristics to each other to get")));
+        vw_DrawTextUTF32(X+25, Y+100+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("a well balanced warship that can complete combat tasks.")));
+
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Engine - ship engine system. Pay attention to how this system consumes")));
+        vw_DrawTextUTF32(X+25, Y+120+k*6, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Engine - ship engine system. Pay attention to how this system consumes")));
+        vw_DrawTextUTF32(X+40, Y+120+k*7, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("energy. Otherwise you run the risk of being unable to move.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("energy. Otherwise you run the risk of being unable to move.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*8, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power - ship energy source. Pay attention to the main two characte-")));
+        vw_DrawTextUTF32(X+40, Y+120+k*9, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("ristics of this system - Recharge Rate and Capacity.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("O.T.C. - Optical Target Computer. As you can see from its name,")));
+        vw_DrawTextUTF32(X+25, Y+120+k*10, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("O.T.C. - Optical Target Computer. As you can see from its name,")));
+        vw_DrawTextUTF32(X+40, Y+120+k*11, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("this system is responsible for optical targeting.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Targeting - Weapon targeting system. It depends on this system how")));
+        vw_DrawTextUTF32(X+25, Y+120+k*12, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Targeting - Weapon targeting system. It depends on this system how")));
+        vw_DrawTextUTF32(X+40, Y+120+k*13, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("fast a weapon will aim and how accurate the shot will be.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Advanced - The most advanced, but yet untested systems for")));
+        vw_DrawTextUTF32(X+25, Y+120+k*14, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Advanced - The most advanced, but yet untested systems for")));
+        vw_DrawTextUTF32(X+40, Y+120+k*15, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("enhancing ship invulnerability.")));
 
         // dialog checkbox
         bool ttt = !GameConfig().NeedShowHint[2];
-        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32("Do not show this tip again."), DialogContentTransp);
+        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32(VW_TEXT_ID("Do not show this tip again.")), DialogContentTransp);
         ChangeGameConfig().NeedShowHint[2] = !ttt;
         // dialog buttons
-        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32("CLOSE"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("CLOSE")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
     }
     case eDialogBox::WeaponryTipsAndTricks: { // hint for weaponry menu
         // dialog title
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tips and hints"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         SizeI = SizeI1 > 210 ? 17 + (WTitle-210)/2 : 17 + (WTitle-SizeI1)/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Tips and hints"));
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         // dialog text
 
         int k=25;
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("You can use this section to buy, sell and set up the weapons on"));
-        vw_DrawTextUTF32(X+25, Y+80+k*0, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("You can use this section to buy, sell and set up the weapons on"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("your ship. To buy a weapon, just drag its icon from Weapon Stock"));
-        vw_DrawTextUTF32(X+25, Y+80+k*1, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("your ship. To buy a weapon, just drag its icon from Weapon Stock"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("to a weapon slot on your ship. Note that each weapon has its"));
-        vw_DrawTextUTF32(X+25, Y+80+k*2, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("to a weapon slot on your ship. Note that each weapon has its"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("own level (from 1 to 5), you should see that the slot level is"));
-        vw_DrawTextUTF32(X+25, Y+80+k*3, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("own level (from 1 to 5), you should see that the slot level is"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("not less than the weapon level. To sell a weapon, perform"));
-        vw_DrawTextUTF32(X+25, Y+80+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("not less than the weapon level. To sell a weapon, perform"));
-        vw_DrawTextUTF32(X+25, Y+80+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("the reverse operation."));
-
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("The weapon is set up and recharged with the Setup button"));
-        vw_DrawTextUTF32(X+25, Y+100+k*6, SizeI > 716 ? -716 : 716, 0,1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("The weapon is set up and recharged with the Setup button"));
-        vw_DrawTextUTF32(X+25, Y+100+k*7, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("in the right part of the weapon slot panel."));
-
-        vw_DrawTextUTF32(X+25, Y+120+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Main types of weapons by their projectiles:"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Projectile - small projectiles based on bullets or energy beams."));
-        vw_DrawTextUTF32(X+25, Y+120+k*9, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Projectile - small projectiles based on bullets or energy beams."));
-        vw_DrawTextUTF32(X+40, Y+120+k*10, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("It is the main and most widespread weapon in the game."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Self-propelled projectile - missiles, torpedoes and nuclear bombs."));
-        vw_DrawTextUTF32(X+25, Y+120+k*11, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Self-propelled projectile - missiles, torpedoes and nuclear bombs."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("The disadvantages of these weapons include the low speed"));
-        vw_DrawTextUTF32(X+40, Y+120+k*12, SizeI > 701 ? -701 : 701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("The disadvantages of these weapons include the low speed"));
-        vw_DrawTextUTF32(X+40, Y+120+k*13, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("of the projectile and the possibility of bringing it down."));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Beam - Lasers and Masers. Short-range highly energy-"));
-        vw_DrawTextUTF32(X+25, Y+120+k*14, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Beam - Lasers and Masers. Short-range highly energy-"));
-        vw_DrawTextUTF32(X+40, Y+120+k*15, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("consuming weapons."));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("You can use this section to buy, sell and set up the weapons on")));
+        vw_DrawTextUTF32(X+25, Y+80+k*0, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("You can use this section to buy, sell and set up the weapons on")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("your ship. To buy a weapon, just drag its icon from Weapon Stock")));
+        vw_DrawTextUTF32(X+25, Y+80+k*1, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("your ship. To buy a weapon, just drag its icon from Weapon Stock")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("to a weapon slot on your ship. Note that each weapon has its")));
+        vw_DrawTextUTF32(X+25, Y+80+k*2, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("to a weapon slot on your ship. Note that each weapon has its")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("own level (from 1 to 5), you should see that the slot level is")));
+        vw_DrawTextUTF32(X+25, Y+80+k*3, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("own level (from 1 to 5), you should see that the slot level is")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("not less than the weapon level. To sell a weapon, perform")));
+        vw_DrawTextUTF32(X+25, Y+80+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("not less than the weapon level. To sell a weapon, perform")));
+        vw_DrawTextUTF32(X+25, Y+80+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("the reverse operation.")));
+
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("The weapon is set up and recharged with the Setup button")));
+        vw_DrawTextUTF32(X+25, Y+100+k*6, SizeI > 716 ? -716 : 716, 0,1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("The weapon is set up and recharged with the Setup button")));
+        vw_DrawTextUTF32(X+25, Y+100+k*7, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("in the right part of the weapon slot panel.")));
+
+        vw_DrawTextUTF32(X+25, Y+120+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Main types of weapons by their projectiles:")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Projectile - small projectiles based on bullets or energy beams.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*9, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Projectile - small projectiles based on bullets or energy beams.")));
+        vw_DrawTextUTF32(X+40, Y+120+k*10, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("It is the main and most widespread weapon in the game.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Self-propelled projectile - missiles, torpedoes and nuclear bombs.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*11, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Self-propelled projectile - missiles, torpedoes and nuclear bombs.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("The disadvantages of these weapons include the low speed")));
+        vw_DrawTextUTF32(X+40, Y+120+k*12, SizeI > 701 ? -701 : 701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("The disadvantages of these weapons include the low speed")));
+        vw_DrawTextUTF32(X+40, Y+120+k*13, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("of the projectile and the possibility of bringing it down.")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Beam - Lasers and Masers. Short-range highly energy-")));
+        vw_DrawTextUTF32(X+25, Y+120+k*14, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Beam - Lasers and Masers. Short-range highly energy-")));
+        vw_DrawTextUTF32(X+40, Y+120+k*15, -701, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("consuming weapons.")));
 
 
 
         // dialog checkbox
         bool ttt = !GameConfig().NeedShowHint[3];
-        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32("Do not show this tip again."), DialogContentTransp);
+        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32(VW_TEXT_ID("Do not show this tip again.")), DialogContentTransp);
         ChangeGameConfig().NeedShowHint[3] = !ttt;
         // dialog buttons
-        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32("CLOSE"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("CLOSE")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
@@ -1680,40 +1680,40 @@ void DrawDialogBox()
 
     case eDialogBox::ShortkeyTipsAndTricks: { // hint about hotkeys (right before game start)
         // dialog title
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tips and hints"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         SizeI = SizeI1 > 210 ? 17 + (WTitle-210)/2 : 17 + (WTitle-SizeI1)/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Tips and hints"));
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         // dialog text
 
         int k=23;
 
-        SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32("GAME KEYBOARD SHORTCUTS")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+80+k*0, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("GAME KEYBOARD SHORTCUTS"));
+        SizeI = (W-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("GAME KEYBOARD SHORTCUTS"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+80+k*0, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("GAME KEYBOARD SHORTCUTS")));
 
-        vw_DrawTextUTF32(X+25, Y+100+k*1, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F2 - toggle show/hide game FPS counter."));
+        vw_DrawTextUTF32(X+25, Y+100+k*1, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F2 - toggle show/hide game FPS counter.")));
 
-        vw_DrawTextUTF32(X+25, Y+120+k*2, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F5 - decrease game speed."));
-        vw_DrawTextUTF32(X+25, Y+120+k*3, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F6 - reset game speed to normal."));
-        vw_DrawTextUTF32(X+25, Y+120+k*4, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F7 - increase game speed."));
-        vw_DrawTextUTF32(X+25, Y+120+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: do not increase game speed, if you have low FPS."));
+        vw_DrawTextUTF32(X+25, Y+120+k*2, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F5 - decrease game speed.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*3, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F6 - reset game speed to normal.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*4, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F7 - increase game speed.")));
+        vw_DrawTextUTF32(X+25, Y+120+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: do not increase game speed, if you have low FPS.")));
 
-        vw_DrawTextUTF32(X+25, Y+140+k*6, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F8 - change weapon panels view."));
-        vw_DrawTextUTF32(X+25, Y+140+k*7, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F9 - change Primary weapon group fire mode."));
-        vw_DrawTextUTF32(X+25, Y+140+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F10 - change Secondary weapon group fire mode."));
+        vw_DrawTextUTF32(X+25, Y+140+k*6, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F8 - change weapon panels view.")));
+        vw_DrawTextUTF32(X+25, Y+140+k*7, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F9 - change Primary weapon group fire mode.")));
+        vw_DrawTextUTF32(X+25, Y+140+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F10 - change Secondary weapon group fire mode.")));
 
-        vw_DrawTextUTF32(X+25, Y+160+k*9, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("F12 - capture screenshot. (File will be saved on your Desktop.)"));
+        vw_DrawTextUTF32(X+25, Y+160+k*9, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("F12 - capture screenshot. (File will be saved on your Desktop.)")));
 
-        vw_DrawTextUTF32(X+25, Y+180+k*10, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Esc - show/hide game menu. (Pause.)"));
-        vw_DrawTextUTF32(X+25, Y+180+k*11, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: all changes will be saved in the game configuration file."));
+        vw_DrawTextUTF32(X+25, Y+180+k*10, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Esc - show/hide game menu. (Pause.)")));
+        vw_DrawTextUTF32(X+25, Y+180+k*11, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: all changes will be saved in the game configuration file.")));
 
 
 
         // dialog checkbox
         bool ttt = !GameConfig().NeedShowHint[4];
-        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32("Do not show this tip again."), DialogContentTransp);
+        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32(VW_TEXT_ID("Do not show this tip again.")), DialogContentTransp);
         ChangeGameConfig().NeedShowHint[4] = !ttt;
         // dialog buttons
-        if (DrawDialogButton128(X+512+90, Y+ButtonOffset, vw_GetTextUTF32("START"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+512+90, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("START")), DialogContentTransp)) {
             DragWeaponNum = 0;
             DragWeaponLevel = 0;
             DragWeapon = false;
@@ -1728,42 +1728,42 @@ void DrawDialogBox()
 
     case eDialogBox::StartMissionSecondTime: { // tip about multiple mission rerun
         // dialog title
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Tips and hints"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         SizeI = SizeI1 > 210 ? 17 + (WTitle-210)/2 : 17 + (WTitle-SizeI1)/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Tips and hints"));
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, SizeI1 > 210 ? -210 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tips and hints")));
         // dialog text
 
         int k=30;
 
-        vw_DrawTextUTF32(X+25, Y+80+k*0, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("You have already completed this mission."));
+        vw_DrawTextUTF32(X+25, Y+80+k*0, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("You have already completed this mission.")));
 
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << vw_GetText("Your previous best result:") << " "
+                  << vw_GetText(VW_TEXT_ID("Your previous best result:")) << " "
                   << GameConfig().Profile[CurrentProfile].ByMissionExperience[CurrentMission];
         vw_DrawText(X+25, Y+80+k*1, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, tmpStream.str());
 
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("You can replay this mission as many times as you like, but you"));
-        vw_DrawTextUTF32(X+25, Y+100+k*2, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("You can replay this mission as many times as you like, but you"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("should take into account that only the best result you"));
-        vw_DrawTextUTF32(X+25, Y+100+k*3, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("should take into account that only the best result you"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("number of experience points."));
-        vw_DrawTextUTF32(X+25, Y+100+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("achieve in this mission will be used to calculate the total"));
-        vw_DrawTextUTF32(X+25, Y+100+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("number of experience points."));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("You can replay this mission as many times as you like, but you")));
+        vw_DrawTextUTF32(X+25, Y+100+k*2, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("You can replay this mission as many times as you like, but you")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("should take into account that only the best result you")));
+        vw_DrawTextUTF32(X+25, Y+100+k*3, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("should take into account that only the best result you")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("number of experience points.")));
+        vw_DrawTextUTF32(X+25, Y+100+k*4, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("achieve in this mission will be used to calculate the total")));
+        vw_DrawTextUTF32(X+25, Y+100+k*5, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("number of experience points.")));
 
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("Note that each time you complete the mission again,"));
-        vw_DrawTextUTF32(X+25, Y+120+k*6, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("Note that each time you complete the mission again,"));
-        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32("the amount of money you get when you destroy the enemy"));
-        vw_DrawTextUTF32(X+25, Y+120+k*7, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("the amount of money you get when you destroy the enemy"));
-        vw_DrawTextUTF32(X+25, Y+120+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32("in this mission is reduced two times."));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note that each time you complete the mission again,")));
+        vw_DrawTextUTF32(X+25, Y+120+k*6, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note that each time you complete the mission again,")));
+        SizeI = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("the amount of money you get when you destroy the enemy")));
+        vw_DrawTextUTF32(X+25, Y+120+k*7, SizeI > 716 ? -716 : 716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("the amount of money you get when you destroy the enemy")));
+        vw_DrawTextUTF32(X+25, Y+120+k*8, -716, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("in this mission is reduced two times.")));
 
 
         // dialog checkbox
         bool ttt = !GameConfig().NeedShowHint[5];
-        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32("Do not show this tip again."), DialogContentTransp);
+        DrawCheckBox_2(X+36, Y+ButtonOffset, ttt, vw_GetTextUTF32(VW_TEXT_ID("Do not show this tip again.")), DialogContentTransp);
         ChangeGameConfig().NeedShowHint[5] = !ttt;
         // dialog buttons
-        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32("CLOSE"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+512+90-72, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("CLOSE")), DialogContentTransp)) {
             CloseDialog();
             cCommand::GetInstance().Set(eCommand::SWITCH_TO_WORKSHOP);
             CurrentWorkshop = 3;
@@ -1775,8 +1775,8 @@ void DrawDialogBox()
 
     case eDialogBox::ChoseLanguage: {
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("Language")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("Language"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Language"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Language")));
 
 
         if (DrawDialogButton128(X+34, Y+ButtonOffset-73, ConvertUTF8.from_bytes("<<<"), DialogContentTransp)) {
@@ -1815,7 +1815,7 @@ void DrawDialogBox()
         }
         ResetFontSize();
 
-        if (DrawDialogButton200(X+128+64-72/2, Y+ButtonOffset, vw_GetTextUTF32("OK"), DialogContentTransp)) {
+        if (DrawDialogButton200(X+128+64-72/2, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("OK")), DialogContentTransp)) {
             ChangeGameConfig().VoiceLanguage = GameConfig().MenuLanguage;
             CloseDialog();
         }
@@ -1824,34 +1824,34 @@ void DrawDialogBox()
 
     case eDialogBox::RestartOnAdvOptChanged:
         // dialog title
-        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32("RESTART")))/2;
-        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32("RESTART"));
+        SizeI = 17 + (WTitle-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("RESTART"))))/2;
+        vw_DrawTextUTF32(X+SizeI, Y+TitleOffset, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("RESTART")));
         // dialog text
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Are you sure you want to restart the game?"));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to restart the game?")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to restart the game?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to restart the game?")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32("Are you sure you want to restart the game?"));
+            vw_DrawTextUTF32(X+SizeI, Y+100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Are you sure you want to restart the game?")));
         }
 
-        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("Note: the current game data will be lost."));
+        SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         SizeI = (W-SizeI1)/2;
         if (SizeI1 > 470) {
             SizeI = (W - 470)/2;
-            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, -470, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         } else {
-            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32("Note: the current game data will be lost."));
+            vw_DrawTextUTF32(X+SizeI, Y+130, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.5f*DialogContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Note: the current game data will be lost.")));
         }
 
         // dialog buttons
-        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32("YES"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+94, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("YES")), DialogContentTransp)) {
             CloseDialog();
             RecreateGameWindow();
             SaveOptionsAdvMenuTmpData();
         }
-        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32("NO"), DialogContentTransp)) {
+        if (DrawDialogButton128(X+256+34, Y+ButtonOffset, vw_GetTextUTF32(VW_TEXT_ID("NO")), DialogContentTransp)) {
             CloseDialog();
         }
         break;
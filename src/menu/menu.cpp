@@ -50,6 +50,10 @@ namespace astromenace {
 namespace {
 
 std::unique_ptr<cMissionScript> MenuScript{};
+// Version and copyright draw list (static content).
+sDrawList2D CopyrightDrawList{};
+// Version and copyright draw list key (language, internal resolution, font characters generation).
+std::array<unsigned, 4> CopyrightDrawListKey{};
 
 } // unnamed namespace
 
@@ -461,7 +465,7 @@ void DrawMenu()
         && MenuStatus != eMenuStatus::CONFCONTROL
         && MenuStatus != eMenuStatus::OPTIONS_ADVANCED) {
         constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/astromenace.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, MenuContentTransp);
     }
 
     vw_End2DMode();
@@ -544,18 +548,29 @@ void DrawMenu()
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // Version and Copyright
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    vw_SetFontSize(10);
-
-    // Version
-    int VSize = vw_TextWidthUTF32(vw_GetTextUTF32("Version"));
-    vw_DrawTextUTF32(6, GameConfig().InternalHeight - 16, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.99f, vw_GetTextUTF32("Version"));
-    vw_DrawText(16 + VSize, GameConfig().InternalHeight - 16, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.99f, GAME_VERSION);
-    // Copyright
-    int CSize = vw_TextWidth("Copyright © 2007-2025, Viewizard");
-    vw_DrawText(GameConfig().InternalWidth - 6 - CSize, GameConfig().InternalHeight - 16, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.99f,
-                "Copyright © 2007-2025, Viewizard");
-
-    ResetFontSize();
+    // static content, re-create draw list only if language, resolution or font characters changed
+    std::array<unsigned, 4> tmpCopyrightKey{{GameConfig().MenuLanguage,
+                                             static_cast<unsigned>(GameConfig().InternalWidth),
+                                             static_cast<unsigned>(GameConfig().InternalHeight),
+                                             vw_GetFontCharsGeneration()}};
+    if (CopyrightDrawList.empty() || CopyrightDrawListKey != tmpCopyrightKey) {
+        CopyrightDrawListKey = tmpCopyrightKey;
+        vw_BeginDrawList2D(CopyrightDrawList);
+        vw_SetFontSize(10);
+
+        // Version
+        int VSize = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Version")));
+        vw_DrawTextUTF32(6, GameConfig().InternalHeight - 16, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.99f, vw_GetTextUTF32(VW_TEXT_ID("Version")));
+        vw_DrawText(16 + VSize, GameConfig().InternalHeight - 16, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.99f, GAME_VERSION);
+        // Copyright
+        int CSize = vw_TextWidth("Copyright © 2007-2025, Viewizard");
+        vw_DrawText(GameConfig().InternalWidth - 6 - CSize, GameConfig().InternalHeight - 16, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.99f,
+                    "Copyright © 2007-2025, Viewizard");
+
+        ResetFontSize();
+        vw_EndDrawList2D();
+    }
+    vw_AddDrawList2D(CopyrightDrawList);
     vw_End2DMode();
 
 
@@ -585,7 +600,7 @@ void DrawMenu()
         SrcRect(0, 0, 2, 2);
         DstRect(0, 0, GameConfig().InternalWidth, 768);
         constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/blackpoint.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, MenuBlackTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, MenuBlackTransp);
 
         vw_End2DMode();
     }
@@ -606,7 +621,7 @@ void DrawMenu()
         SrcRect(0, 0, 2, 2);
         DstRect(0, 0, GameConfig().InternalWidth, 768);
         constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/blackpoint.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, MenuBlackTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, MenuBlackTransp);
 
         vw_End2DMode();
     }
@@ -634,7 +649,7 @@ void MainMenu()
     int X = (GameConfig().InternalWidth - 384) / 2;
     int Y = 165;
 
-    if (DrawButton384(X,Y, vw_GetTextUTF32("START GAME"), MenuContentTransp, Button1Transp, LastButton1UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("START GAME")), MenuContentTransp, Button1Transp, LastButton1UpdateTime)) {
         // if there is no current profile - switch to profile list menu, otherwise switch to mission list menu
         if (CurrentProfile < 0) {
             cCommand::GetInstance().Set(eCommand::SWITCH_TO_PROFILE);
@@ -648,28 +663,28 @@ void MainMenu()
 
 
     Y = Y+Prir;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("TOP SCORES"), MenuContentTransp, Button2Transp, LastButton2UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("TOP SCORES")), MenuContentTransp, Button2Transp, LastButton2UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_TOP_SCORES);
     }
 
     Y = Y+Prir;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("OPTIONS"), MenuContentTransp, Button3Transp, LastButton3UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("OPTIONS")), MenuContentTransp, Button3Transp, LastButton3UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_OPTIONS);
     }
 
     Y = Y+Prir;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("INFORMATION"), MenuContentTransp, Button4Transp, LastButton4UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("INFORMATION")), MenuContentTransp, Button4Transp, LastButton4UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_INFORMATION);
     }
 
     Y = Y+Prir;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("CREDITS"), MenuContentTransp, Button5Transp, LastButton5UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("CREDITS")), MenuContentTransp, Button5Transp, LastButton5UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_CREDITS);
         PlayMusicTheme(eMusicTheme::CREDITS, 2000, 2000);
     }
 
     Y = Y+Prir;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("QUIT"), MenuContentTransp, Button6Transp, LastButton6UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("QUIT")), MenuContentTransp, Button6Transp, LastButton6UpdateTime)) {
         SetCurrentDialogBox(eDialogBox::QuitFromGame);
     }
 
@@ -254,7 +254,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
     SrcRect(0, 0, 2, 2);
     DstRect(0, 0, GameConfig().InternalWidth, 768);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.5f * ContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.5f * ContentTransp);
 
 
 
@@ -270,14 +270,14 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
 
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Joystick DeadZone"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Decrease"), ContentTransp, GameConfig().JoystickDeadZone == 0)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Joystick DeadZone")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Decrease")), ContentTransp, GameConfig().JoystickDeadZone == 0)) {
         ChangeGameConfig().JoystickDeadZone--;
         if (GameConfig().JoystickDeadZone < 0) {
             ChangeGameConfig().JoystickDeadZone = 0;
         }
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Increase"), ContentTransp, GameConfig().JoystickDeadZone == 10)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Increase")), ContentTransp, GameConfig().JoystickDeadZone == 10)) {
         ChangeGameConfig().JoystickDeadZone++;
         if (GameConfig().JoystickDeadZone > 10) {
             ChangeGameConfig().JoystickDeadZone = 10;
@@ -295,10 +295,10 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
         }
         if (GameConfig().JoystickDeadZone > i) {
             constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/perc.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, ContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, ContentTransp);
         } else {
             constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/perc_none.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, ContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, ContentTransp);
         }
     }
 
@@ -307,14 +307,14 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Control Sensitivity"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Decrease"), ContentTransp, GameConfig().ControlSensivity == 1)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Control Sensitivity")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Decrease")), ContentTransp, GameConfig().ControlSensivity == 1)) {
         ChangeGameConfig().ControlSensivity--;
         if (GameConfig().ControlSensivity < 1) {
             ChangeGameConfig().ControlSensivity = 1;
         }
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Increase"), ContentTransp, GameConfig().ControlSensivity == 10)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Increase")), ContentTransp, GameConfig().ControlSensivity == 10)) {
         ChangeGameConfig().ControlSensivity++;
         if (GameConfig().ControlSensivity > 10) {
             ChangeGameConfig().ControlSensivity = 10;
@@ -332,10 +332,10 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
         }
         if (GameConfig().ControlSensivity > i) {
             constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/perc.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, ContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, ContentTransp);
         } else {
             constexpr unsigned tmpHash5 = constexpr_hash_djb2a("menu/perc_none.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash5), true, ContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash5), true, ContentTransp);
         }
     }
 
@@ -352,19 +352,19 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     Y1 += Prir1;
-    int SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("MOUSE"));
+    int SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("MOUSE")));
     int SizeI = SizeI1 > 130 ? -15 : (100-SizeI1)/2;
-    vw_DrawTextUTF32(X1+315+SizeI, Y1, SizeI1 > 130 ? -130 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("MOUSE"));
-    SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("KEYBOARD"));
+    vw_DrawTextUTF32(X1+315+SizeI, Y1, SizeI1 > 130 ? -130 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("MOUSE")));
+    SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("KEYBOARD")));
     SizeI = SizeI1 > 130 ? 10 : (150-SizeI1)/2;
-    vw_DrawTextUTF32(X1+446+SizeI, Y1, SizeI1 > 130 ? -130 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("KEYBOARD"));
-    SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32("JOYSTICK"));
+    vw_DrawTextUTF32(X1+446+SizeI, Y1, SizeI1 > 130 ? -130 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("KEYBOARD")));
+    SizeI1 = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("JOYSTICK")));
     SizeI = SizeI1 > 130 ? 10 : (150-SizeI1)/2;
-    vw_DrawTextUTF32(X1+605+SizeI, Y1, SizeI1 > 130 ? -130 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("JOYSTICK"));
+    vw_DrawTextUTF32(X1+605+SizeI, Y1, SizeI1 > 130 ? -130 : 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("JOYSTICK")));
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Primary Attack"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Primary Attack")));
     float Transp = 1.0f;
     bool Off = false;
     std::string ButtonName = MouseButtonName(GameConfig().MousePrimary);
@@ -414,7 +414,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Secondary Attack"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Secondary Attack")));
     Transp = 1.0f;
     Off = false;
     ButtonName = MouseButtonName(GameConfig().MouseSecondary);
@@ -465,7 +465,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Move Forward"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Move Forward")));
     Transp = 1.0f;
     Off = false;
     ButtonName = SDL_GetKeyName(GameConfig().KeyBoardUp);
@@ -481,7 +481,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
     }
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Move Backward"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Move Backward")));
     Transp = 1.0f;
     Off = false;
     ButtonName = SDL_GetKeyName(GameConfig().KeyBoardDown);
@@ -497,7 +497,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
     }
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Move Left"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Move Left")));
     Transp = 1.0f;
     Off = false;
     ButtonName = SDL_GetKeyName(GameConfig().KeyBoardLeft);
@@ -513,7 +513,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
     }
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0,1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Move Right"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0,1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Move Right")));
     Transp = 1.0f;
     Off = false;
     ButtonName = SDL_GetKeyName(GameConfig().KeyBoardRight);
@@ -540,7 +540,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     X = GameConfig().InternalWidth / 2 - 366;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Advanced"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Advanced")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::OPTIONS_ADVANCED);
             GameMenuStatus = eGameMenuStatus::OPTIONS_ADVANCED;
@@ -552,7 +552,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     X = GameConfig().InternalWidth / 2 - 100;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Video & Audio"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Video & Audio")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::OPTIONS);
             GameMenuStatus = eGameMenuStatus::OPTIONS;
@@ -564,7 +564,7 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
 
 
     X = GameConfig().InternalWidth / 2 + 166;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Interface"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Interface")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::INTERFACE);
             GameMenuStatus = eGameMenuStatus::INTERFACE;
@@ -580,12 +580,12 @@ void ConfControlMenu(float ContentTransp, float &ButtonTransp1, float &LastButto
     X = (GameConfig().InternalWidth - 384) / 2;
     Y = Y+Prir;
     if (MenuStatus == eMenuStatus::GAME) {
-        if (DrawButton384(X,Y, vw_GetTextUTF32("GAME MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+        if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
             GameMenuStatus = eGameMenuStatus::GAME_MENU;
             CheckKeysBeforeExit();
         }
     } else {
-        if (DrawButton384(X,Y, vw_GetTextUTF32("MAIN MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+        if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
             cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
             CheckKeysBeforeExit();
         }
@@ -57,7 +57,7 @@ void DifficultyMenu()
     sRECT SrcRect(2, 2, 861, 482);
     sRECT DstRect(GameConfig().InternalWidth / 2 - 427, 160, GameConfig().InternalWidth / 2 + 432, 160 + 480);
     constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/panel800_444_back.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, 0.9f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, 0.9f * MenuContentTransp);
 
     int X1 = GameConfig().InternalWidth / 2 - 372;
     int Y1 = 217;
@@ -67,12 +67,12 @@ void DifficultyMenu()
 
 
 
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy Weapon Penalty"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy Weapon Penalty")));
     bool ButOff = false;
     if (GameConfig().Profile[CurrentProfile].EnemyWeaponPenalty == 1) {
         ButOff = true;
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].EnemyWeaponPenalty--;
         if (GameConfig().Profile[CurrentProfile].EnemyWeaponPenalty < 1) {
             ChangeGameConfig().Profile[CurrentProfile].EnemyWeaponPenalty = 1;
@@ -83,7 +83,7 @@ void DifficultyMenu()
     if (GameConfig().Profile[CurrentProfile].EnemyWeaponPenalty == 3) {
         ButOff = true;
     }
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].EnemyWeaponPenalty++;
         if (GameConfig().Profile[CurrentProfile].EnemyWeaponPenalty > 3) {
             ChangeGameConfig().Profile[CurrentProfile].EnemyWeaponPenalty = 3;
@@ -91,9 +91,9 @@ void DifficultyMenu()
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     if (GameConfig().Profile[CurrentProfile].EnemyWeaponPenalty == 1) {
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("None"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("None")));
         SizeI = (110-Size)/2;
-        vw_DrawTextUTF32(X1+498+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("None"));
+        vw_DrawTextUTF32(X1+498+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("None")));
     } else {
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
@@ -107,12 +107,12 @@ void DifficultyMenu()
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy Armor Penalty"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy Armor Penalty")));
     ButOff = false;
     if (GameConfig().Profile[CurrentProfile].EnemyArmorPenalty == 1) {
         ButOff = true;
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].EnemyArmorPenalty--;
         if (GameConfig().Profile[CurrentProfile].EnemyArmorPenalty < 1) {
             ChangeGameConfig().Profile[CurrentProfile].EnemyArmorPenalty = 1;
@@ -123,7 +123,7 @@ void DifficultyMenu()
     if (GameConfig().Profile[CurrentProfile].EnemyArmorPenalty == 4) {
         ButOff = true;
     }
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].EnemyArmorPenalty++;
         if (GameConfig().Profile[CurrentProfile].EnemyArmorPenalty > 4) {
             ChangeGameConfig().Profile[CurrentProfile].EnemyArmorPenalty = 4;
@@ -131,9 +131,9 @@ void DifficultyMenu()
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     if (GameConfig().Profile[CurrentProfile].EnemyArmorPenalty == 1) {
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("None"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("None")));
         SizeI = (110-Size)/2;
-        vw_DrawTextUTF32(X1+498+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("None"));
+        vw_DrawTextUTF32(X1+498+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("None")));
     } else {
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
@@ -147,12 +147,12 @@ void DifficultyMenu()
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy Targeting Penalty"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy Targeting Penalty")));
     ButOff = false;
     if (GameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty == 1) {
         ButOff = true;
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty--;
         if (GameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty < 1) {
             ChangeGameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty = 1;
@@ -163,7 +163,7 @@ void DifficultyMenu()
     if (GameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty == 4) {
         ButOff = true;
     }
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty++;
         if (GameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty > 4) {
             ChangeGameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty = 4;
@@ -171,9 +171,9 @@ void DifficultyMenu()
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     if (GameConfig().Profile[CurrentProfile].EnemyTargetingSpeedPenalty == 1) {
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("None"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("None")));
         SizeI = (110-Size)/2;
-        vw_DrawTextUTF32(X1+498+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("None"));
+        vw_DrawTextUTF32(X1+498+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("None")));
     } else {
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
@@ -188,14 +188,14 @@ void DifficultyMenu()
 
     // note, we use "Limited Ammo" option in menu, but UnlimitedAmmo variable
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Limited Ammo"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Limited Ammo")));
     ButOff = !ChangeGameConfig().Profile[CurrentProfile].UnlimitedAmmo;
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].UnlimitedAmmo = 0;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     ButOff = ChangeGameConfig().Profile[CurrentProfile].UnlimitedAmmo;
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].UnlimitedAmmo = 1;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
@@ -209,14 +209,14 @@ void DifficultyMenu()
 
     // note, we use "Destroyable Weapon" option in menu, but UndestroyableWeapon variable
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Destroyable Weapon"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Destroyable Weapon")));
     ButOff = !ChangeGameConfig().Profile[CurrentProfile].UndestroyableWeapon;
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].UndestroyableWeapon = 0;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     ButOff = ChangeGameConfig().Profile[CurrentProfile].UndestroyableWeapon;
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].UndestroyableWeapon = 1;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
@@ -229,14 +229,14 @@ void DifficultyMenu()
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon Targeting Mode"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Targeting Mode")));
     ButOff = !ChangeGameConfig().Profile[CurrentProfile].WeaponTargetingMode;
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].WeaponTargetingMode = 0;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     ButOff = ChangeGameConfig().Profile[CurrentProfile].WeaponTargetingMode;
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].WeaponTargetingMode = 1;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
@@ -253,14 +253,14 @@ void DifficultyMenu()
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("SpaceShip Control Mode"));
+    vw_DrawTextUTF32(X1, Y1, -340, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("SpaceShip Control Mode")));
     ButOff = !ChangeGameConfig().Profile[CurrentProfile].SpaceShipControlMode;
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Harder"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Harder")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].SpaceShipControlMode = 0;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
     ButOff = ChangeGameConfig().Profile[CurrentProfile].SpaceShipControlMode;
-    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32("Easier"), MenuContentTransp, ButOff)) {
+    if (DrawButton128_2(X1+360, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Easier")), MenuContentTransp, ButOff)) {
         ChangeGameConfig().Profile[CurrentProfile].SpaceShipControlMode = 1;
         ProfileDifficulty(CurrentProfile, eDifficultyAction::Update);
     }
@@ -279,7 +279,7 @@ void DifficultyMenu()
     Y1 += Prir1;
     std::ostringstream tmpStream;
     tmpStream << std::fixed << std::setprecision(0)
-              << vw_GetText("Current Profile Difficulty")
+              << vw_GetText(VW_TEXT_ID("Current Profile Difficulty"))
               << ": " << ProfileDifficulty(CurrentProfile) << "%";
     Size = vw_TextWidth(tmpStream.str());
     SizeI = (GameConfig().InternalWidth - Size) / 2;
@@ -288,7 +288,7 @@ void DifficultyMenu()
 
     int X = GameConfig().InternalWidth / 2 - 192;
     int Y = 175+95*5;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("BACK"), MenuContentTransp, Button1Transp, LastButton1UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("BACK")), MenuContentTransp, Button1Transp, LastButton1UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_PROFILE);
     }
 }
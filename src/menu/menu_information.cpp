@@ -582,592 +582,592 @@ void InformationObject3DText(int ObjectNum)
     // common for Earth fighters
     if (CreateNum>=InfoFighterStart && CreateNum<InfoFighterStart+InfoFighterQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Space Ship"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Space Ship")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Ship Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ship Type:")));
         vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(GetShipGroupTitle(ObjectNum-InfoFighterStart+1)));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Codename:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Codename:")));
         vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(GetWorkshopShipName(ObjectNum-InfoFighterStart+1)));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Earth Federation"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Ally"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ally")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
-                  << InfoObjectWeaponQuantity << " " << vw_GetText("units");
+                  << InfoObjectWeaponQuantity << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Engines:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Engines:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
-                  << InfoObjectEngineQuantity << " " << vw_GetText("units");
+                  << InfoObjectEngineQuantity << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
     }
     // weapons for Earth ships
     if (CreateNum>=InfoWeaponStart && CreateNum<InfoWeaponStart+InfoWeaponQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
         if (CreateNum < InfoWeaponStart + 15) {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon, Cannon"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon, Cannon")));
         } else {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon, Launcher"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon, Launcher")));
         }
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
         vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(GetWeaponGroupTitle(CreateNum-InfoWeaponStart+1)));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Codename:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Codename:")));
         vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(GetWeaponName(CreateNum-InfoWeaponStart+1)));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Earth Federation"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Earth Federation")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage, Kinetic:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, Kinetic:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << GetProjectileDamageKinetic(CreateNum - InfoWeaponStart + 1) << " ";
         if (CreateNum - InfoWeaponStart + 1 == 11
             || CreateNum - InfoWeaponStart + 1 == 12
             || CreateNum - InfoWeaponStart + 1 == 14) {
-            tmpStream << vw_GetText("units/sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/sec"));
         } else {
-            tmpStream << vw_GetText("units/shot");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/shot"));
         }
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage, EM:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, EM:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << GetProjectileDamageEM(CreateNum - InfoWeaponStart + 1) << " ";
         if (CreateNum - InfoWeaponStart + 1 == 11
             || CreateNum - InfoWeaponStart + 1 == 12
             || CreateNum - InfoWeaponStart + 1 == 14) {
-            tmpStream << vw_GetText("units/sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/sec"));
         } else {
-            tmpStream << vw_GetText("units/shot");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/shot"));
         }
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Energy Use:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Energy Use:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectEnergyUse << " " << vw_GetText("units per shot");
+                  << InfoObjectEnergyUse << " " << vw_GetText(VW_TEXT_ID("units per shot"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Ammo:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ammo:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
-                  << InfoObjectAmmo << " " << vw_GetText("units");
+                  << InfoObjectAmmo << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Reload:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Reload:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectReload << " " << vw_GetText("seconds");
+                  << InfoObjectReload << " " << vw_GetText(VW_TEXT_ID("seconds"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Range:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Range:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectRange << " " << vw_GetText("units");
+                  << InfoObjectRange << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
     }
     // mines
     if (CreateNum>=InfoMineStart && CreateNum<InfoMineStart+InfoMineQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Type:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Space Mine"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Space Mine")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Pirates"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirates")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage, Kinetic:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, Kinetic:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 100 << " " << vw_GetText("units");
+        tmpStream << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage, EM:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, EM:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 0 << " " << vw_GetText("units");
+        tmpStream << 0 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Targeting System") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Targeting System")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
         if (CreateNum == InfoMineStart) {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("No"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("No")));
         } else {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Yes"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Yes")));
         }
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Auto Cannon:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Auto Cannon:")));
         if (CreateNum == InfoMineStart + 2) {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Yes"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Yes")));
         } else {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("No"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("No")));
         }
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Auto Launcher:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Auto Launcher:")));
         if (CreateNum == InfoMineStart + 3) {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Yes"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Yes")));
         } else {
-            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("No"));
+            vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("No")));
         }
     }
     // common for Aliens fighters
     if (CreateNum>=InfoAlienStart && CreateNum<InfoAlienStart+InfoAlienQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Space Ship"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Space Ship")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Ship Type:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Unknown"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ship Type:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Unknown")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Unknown"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Unknown")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Unknown"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Unknown")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
-                  << 10 << " - " << 200 << " " << vw_GetText("units");
+                  << 10 << " - " << 200 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
     }
     // common for Alien MotherShips
     if (CreateNum>=InfoAlienMotherShipStart && CreateNum<InfoAlienMotherShipStart+InfoAlienMotherShipQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("MotherShip"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("MotherShip")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Ship Type:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Unknown"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ship Type:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Unknown")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Unknown"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Unknown")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Unknown"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Unknown")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(0)
-                  << 50 << " - " << 500 << " " << vw_GetText("units");
+                  << 50 << " - " << 500 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
     }
     // common for pirats
     if (CreateNum>=InfoPirateShipStart && CreateNum<InfoPirateShipStart+InfoPirateShipQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Pirate Ship"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirate Ship")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Ship Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ship Type:")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Pirates"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirates")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage:")));
     }
     // common for buildings
     if (CreateNum>=InfoBuildingStart && CreateNum<InfoBuildingStart+InfoBuildingQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Civilian Building"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Civilian Building")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Old Republic"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Old Republic")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Indestructible"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Indestructible")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
     }
     // common for ground military
     if (CreateNum>=InfoMilitaryBuildingStart && CreateNum<InfoMilitaryBuildingStart+InfoMilitaryBuildingQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Military Building"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Military Building")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Pirates"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirates")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage:")));
     }
     // common for wheeled vehicles
     if (CreateNum>=InfoWheeledStart && CreateNum<InfoWheeledStart+InfoWheeledQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Wheeled Vehicle"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Wheeled Vehicle")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Pirates"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirates")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage:")));
     }
     // common for tracked vehicle
     if (CreateNum>=InfoTrackedStart && CreateNum<InfoTrackedStart+InfoTrackedQuant) {
         Y1 += Offset+5;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Object Class:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Tracked Vehicle"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Object Class:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tracked Vehicle")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Type:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Type:")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Developer:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Pirates"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Developer:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pirates")));
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Status:"));
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Enemy"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Status:")));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Enemy")));
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Armor:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armor:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << InfoObjectArmor << " " << vw_GetText("units");
+                  << InfoObjectArmor << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Width:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Width:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectWidth << " " << vw_GetText("units");
+                  << InfoObjectWidth << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Length:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Length:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectLength << " " << vw_GetText("units");
+                  << InfoObjectLength << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Height:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Height:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << std::setprecision(1)
-                  << InfoObjectHeight << " " << vw_GetText("units");
+                  << InfoObjectHeight << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << vw_GetText("Weapons") << ":";
+        tmpStream << vw_GetText(VW_TEXT_ID("Weapons")) << ":";
         vw_DrawText(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, tmpStream.str());
 
         Y1 += Offset;
-        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Damage:"));
+        vw_DrawTextUTF32(X1, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage:")));
     }
 
 
@@ -1187,85 +1187,85 @@ void InformationObject3DText(int ObjectNum)
     case InfoPirateShipStart+2:
     case InfoPirateShipStart+3:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Marauder"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Marauder")));
         Y1 += Offset*7;
-        tmpStream << vw_GetText("Kinetic") << ", " << vw_GetText("Propelled");
+        tmpStream << vw_GetText(VW_TEXT_ID("Kinetic")) << ", " << vw_GetText(VW_TEXT_ID("Propelled"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 10 << " - " << 100 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoPirateShipStart+4:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Warder"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Warder")));
         Y1 += Offset*7;
-        tmpStream << vw_GetText("Kinetic") << ", " << vw_GetText("Propelled");
+        tmpStream << vw_GetText(VW_TEXT_ID("Kinetic")) << ", " << vw_GetText(VW_TEXT_ID("Propelled"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 10 << " - " << 200 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 200 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoPirateShipStart+5:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Raider"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Raider")));
         Y1 += Offset*7;
-        tmpStream << vw_GetText("Kinetic") << ", " << vw_GetText("Propelled");
+        tmpStream << vw_GetText(VW_TEXT_ID("Kinetic")) << ", " << vw_GetText(VW_TEXT_ID("Propelled"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 10 << " - " << 300 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 300 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoPirateShipStart+6:
     case InfoPirateShipStart+7:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Missile Carrier"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Missile Carrier")));
         Y1 += Offset*7;
-        tmpStream << vw_GetText("Kinetic") << ", " << vw_GetText("Propelled");
+        tmpStream << vw_GetText(VW_TEXT_ID("Kinetic")) << ", " << vw_GetText(VW_TEXT_ID("Propelled"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 10 << " - " << 500 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 500 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoPirateShipStart+8:
     case InfoPirateShipStart+9:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Battle Freighter"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Battle Freighter")));
         Y1 += Offset*7;
-        tmpStream << vw_GetText("Kinetic") << ", " << vw_GetText("Propelled");
+        tmpStream << vw_GetText(VW_TEXT_ID("Kinetic")) << ", " << vw_GetText(VW_TEXT_ID("Propelled"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         Y1 += Offset;
         tmpStream.clear();
         tmpStream.str(std::string{});
-        tmpStream << 10 << " - " << 300 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 300 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoPirateShipStart+10:
     case InfoPirateShipStart+11:
     case InfoPirateShipStart+12:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Missile Carrier"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Missile Carrier")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 50 << " - " << 300 << " " << vw_GetText("units");
+        tmpStream << 50 << " - " << 300 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoPirateShipStart+13:
     case InfoPirateShipStart+14:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Battle Freighter"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Battle Freighter")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 50 << " - " << 200 << " " << vw_GetText("units");
+        tmpStream << 50 << " - " << 200 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
 
@@ -1277,48 +1277,48 @@ void InformationObject3DText(int ObjectNum)
     case InfoMilitaryBuildingStart:
     case InfoMilitaryBuildingStart+5:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Cannon"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Cannon")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 30 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 30 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoMilitaryBuildingStart+3:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("MachineGun"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("MachineGun")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 50 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 50 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoMilitaryBuildingStart+1:
     case InfoMilitaryBuildingStart+6:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Turbo Cannon"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Turbo Cannon")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 100 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoMilitaryBuildingStart+2:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Missile Launcher"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Missile Launcher")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 200 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 200 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoMilitaryBuildingStart+4:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Cannon Turret"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Cannon Turret")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 100 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
 
@@ -1326,66 +1326,66 @@ void InformationObject3DText(int ObjectNum)
     // wheeled vehicles
     case InfoWheeledStart:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Armored Jeep"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armored Jeep")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 40 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 40 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoWheeledStart+1:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Jeep"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Jeep")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 100 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoWheeledStart+2:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Armored Jeep"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armored Jeep")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 40 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 40 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoWheeledStart+3:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Jeep"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Jeep")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Ion"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Ion")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 50 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 50 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoWheeledStart+4:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Armored Jeep"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Armored Jeep")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Antimatter"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Antimatter")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 100 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoWheeledStart+5:
     case InfoWheeledStart+6:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("APC"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("APC")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 40 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 40 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoWheeledStart+7:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Missile Launcher"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Missile Launcher")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 400 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 400 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
 
@@ -1397,60 +1397,60 @@ void InformationObject3DText(int ObjectNum)
     case InfoTrackedStart+6:
     case InfoTrackedStart+8:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Tank"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tank")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 50 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 50 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoTrackedStart+2:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Tank"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tank")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Plasma"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Plasma")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 100 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 100 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoTrackedStart+3:
     case InfoTrackedStart+4:
     case InfoTrackedStart+7:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Tank"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Tank")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Antimatter"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Antimatter")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 200 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 200 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoTrackedStart+9:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("APC"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("APC")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Kinetic"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Kinetic")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 50 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 50 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoTrackedStart+10:
     case InfoTrackedStart+11:
     case InfoTrackedStart+12:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Missile Launcher"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Missile Launcher")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Propelled"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Propelled")));
         Y1 += Offset;
-        tmpStream << 10 << " - " << 400 << " " << vw_GetText("units");
+        tmpStream << 10 << " - " << 400 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
     case InfoTrackedStart+13:
         Y1 += Offset+Offset+5;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Engineer"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Engineer")));
         Y1 += Offset*7;
-        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Non-combatant"));
+        vw_DrawTextUTF32(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Non-combatant")));
         Y1 += Offset;
-        tmpStream << 0 << " " << vw_GetText("units");
+        tmpStream << 0 << " " << vw_GetText(VW_TEXT_ID("units"));
         vw_DrawText(X1+Size, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
         break;
 
@@ -1476,13 +1476,13 @@ void InformationMenu()
     sRECT SrcRect{0, 0, 2, 2};
     sRECT DstRect{0, 0, static_cast<int>(GameConfig().InternalWidth), 768};
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.5f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.5f * MenuContentTransp);
 
 
     SrcRect(2,2,464-2,353-2);
     DstRect((GameConfig().InternalWidth/2-432)-8,80-8+80,(GameConfig().InternalWidth/2-432)-8+464-4, 80-8+353-4+80);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/panel444_333_back.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.9f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.9f * MenuContentTransp);
 
 
 
@@ -1538,7 +1538,7 @@ void InformationMenu()
 
 
     X = GameConfig().InternalWidth / 2 - 209;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Page Up"), MenuContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Page Up")), MenuContentTransp, false)) {
         CreateNum--;
         if (CreateNum < 1) {
             CreateNum = InfoEnd;
@@ -1555,7 +1555,7 @@ void InformationMenu()
     }
 
     X = GameConfig().InternalWidth / 2 + 9;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Page Down"), MenuContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Page Down")), MenuContentTransp, false)) {
         CreateNum++;
         if (CreateNum > InfoEnd) {
             CreateNum = 1;
@@ -1581,7 +1581,7 @@ void InformationMenu()
 
     X = (GameConfig().InternalWidth - 384) / 2;
     Y = Y + Prir;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("MAIN MENU"), MenuContentTransp, Button1Transp, LastButton1UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), MenuContentTransp, Button1Transp, LastButton1UpdateTime)) {
         DestroyInfoObject();
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
     }
@@ -1842,7 +1842,7 @@ void InformationDrawObject()
     SrcRect(2,2,482,371);
     sRECT DstRect(GameConfig().InternalWidth/2-450, 80-18+80, GameConfig().InternalWidth/2+30, 80+351+80);
     constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/panel444_333_border.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, MenuContentTransp);
 
     vw_End2DMode();
 }
@@ -69,7 +69,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
     SrcRect(0, 0, 2, 2);
     DstRect(0, 0, GameConfig().InternalWidth, 768);
     constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, 0.5f * ContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, 0.5f * ContentTransp);
 
     int X1 = GameConfig().InternalWidth / 2 - 375;
     int Y1 = 65;
@@ -78,8 +78,8 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
 
 
     // Menu Language
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Menu Language"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, false)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Menu Language")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, false)) {
         if (GameConfig().MenuLanguage == 0) {
             ChangeGameConfig().MenuLanguage = vw_GetLanguageListCount() - 1;
         } else {
@@ -91,7 +91,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
         vw_ReleaseAllFontChars();
         GenerateFonts();
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, false)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, false)) {
         if (GameConfig().MenuLanguage >= vw_GetLanguageListCount() - 1) {
             ChangeGameConfig().MenuLanguage = 0;
         } else {
@@ -114,8 +114,8 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
 
     // Voice Language
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Voice Language"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, false)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Voice Language")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, false)) {
         if (GameConfig().VoiceLanguage == 0) {
             ChangeGameConfig().VoiceLanguage = vw_GetLanguageListCount() - 1;
         } else {
@@ -123,7 +123,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
         }
         ReloadVoiceAssets();
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, false)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, false)) {
         if (GameConfig().VoiceLanguage >= vw_GetLanguageListCount() - 1) {
             ChangeGameConfig().VoiceLanguage = 0;
         } else {
@@ -140,8 +140,8 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
 
     // Menu Font
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Menu Font"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, GameConfig().FontNumber <= 0)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Menu Font")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, GameConfig().FontNumber <= 0)) {
         ChangeGameConfig().FontNumber--;
 
         // reinitialize fonts and regenerate textures (no need in vw_ShutdownFont() call)
@@ -149,7 +149,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
         vw_InitFont(GetFontMetadata(GameConfig().FontNumber).FontFileName);
         GenerateFonts();
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, (GameConfig().FontNumber + 1) >= GetFontQuantity())) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, (GameConfig().FontNumber + 1) >= GetFontQuantity())) {
         ChangeGameConfig().FontNumber++;
 
         // reinitialize fonts and regenerate textures (no need in vw_ShutdownFont() call)
@@ -171,7 +171,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
 
     // 'Tips and hints' Status
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("'Tips and hints' Status"));
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("'Tips and hints' Status")));
     // check, do we have Hints, that previously was hided
     bool NeedReset = false;
     for (int i = 0; i < 10; i++) {
@@ -179,7 +179,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
             NeedReset = true;
         }
     }
-    if (DrawButton128_2((int)X1+458, (int)Y1-6, vw_GetTextUTF32("Reset"), ContentTransp, !NeedReset)) {
+    if (DrawButton128_2((int)X1+458, (int)Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Reset")), ContentTransp, !NeedReset)) {
         if (NeedCheck == 0) {
             for (int i = 0; i < 10; i++) {
                 ChangeGameConfig().NeedShowHint[i] = true;
@@ -192,26 +192,26 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
 
     // FPS Counter
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("FPS Counter"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Off"), ContentTransp, !ChangeGameConfig().ShowFPS)
-        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("On"), ContentTransp, ChangeGameConfig().ShowFPS)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("FPS Counter")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Off")), ContentTransp, !ChangeGameConfig().ShowFPS)
+        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("On")), ContentTransp, ChangeGameConfig().ShowFPS)) {
         cFPS::GetInstance().Switch();
     }
 
-    Size = vw_TextWidthUTF32(GameConfig().ShowFPS ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+    Size = vw_TextWidthUTF32(GameConfig().ShowFPS ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
     SizeI = (170 - Size) / 2;
-    vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, GameConfig().ShowFPS ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+    vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, GameConfig().ShowFPS ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
 
 
 
 
     // Weapon Panels View
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Weapon Panels View"));
-    if (DrawButton128_2(X1 + 300, Y1 - 6, vw_GetTextUTF32("Prev"), ContentTransp, GameConfig().WeaponPanelView == eWeaponPanelView::hide)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Panels View")));
+    if (DrawButton128_2(X1 + 300, Y1 - 6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, GameConfig().WeaponPanelView == eWeaponPanelView::hide)) {
         WeaponPanelViewPrev(ChangeGameConfig().WeaponPanelView);
     }
-    if (DrawButton128_2(X1 + 616, Y1 - 6, vw_GetTextUTF32("Next"), ContentTransp, GameConfig().WeaponPanelView == eWeaponPanelView::full)) {
+    if (DrawButton128_2(X1 + 616, Y1 - 6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, GameConfig().WeaponPanelView == eWeaponPanelView::full)) {
         WeaponPanelViewNext(ChangeGameConfig().WeaponPanelView);
     }
     Size = vw_TextWidthUTF32(vw_GetTextUTF32(GetWeaponPanelViewTitle(GameConfig().WeaponPanelView)));
@@ -238,7 +238,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
 
 
     X = GameConfig().InternalWidth/2 - 366;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Advanced"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Advanced")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::OPTIONS_ADVANCED);
             GameMenuStatus = eGameMenuStatus::OPTIONS_ADVANCED;
@@ -248,7 +248,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
     }
 
     X = GameConfig().InternalWidth/2 - 100;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Video & Audio"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Video & Audio")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::OPTIONS);
             GameMenuStatus = eGameMenuStatus::OPTIONS;
@@ -258,7 +258,7 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
     }
 
     X = GameConfig().InternalWidth/2 + 166;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Config Controls"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Config Controls")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::CONFCONTROL);
             GameMenuStatus = eGameMenuStatus::CONFCONTROL;
@@ -275,11 +275,11 @@ void InterfaceMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonU
     X = (GameConfig().InternalWidth - 384) / 2;
     Y = Y+Prir;
     if (MenuStatus == eMenuStatus::GAME) {
-        if (DrawButton384(X,Y, vw_GetTextUTF32("GAME MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+        if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
             GameMenuStatus = eGameMenuStatus::GAME_MENU;
         }
     } else {
-        if (DrawButton384(X,Y, vw_GetTextUTF32("MAIN MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+        if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
             cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
         }
     }
@@ -221,7 +221,7 @@ void MissionMenu()
     SrcRect(2, 2, 863-2, 484-2);
     DstRect(GameConfig().InternalWidth/2-427, 175-15, GameConfig().InternalWidth/2-427+863-4, 175-15+484-4);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/panel800_444_back.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.9f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.9f * MenuContentTransp);
 
 
 
@@ -233,7 +233,7 @@ void MissionMenu()
 
     // display the current pilot profile
     std::ostringstream tmpStream;
-    tmpStream << vw_GetText("Pilot Profile") << ": ";
+    tmpStream << vw_GetText(VW_TEXT_ID("Pilot Profile")) << ": ";
     int Size = vw_TextWidth(tmpStream.str());
     vw_DrawText(X1, 208+12, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::green}, MenuContentTransp, tmpStream.str());
 
@@ -244,7 +244,7 @@ void MissionMenu()
         vw_DrawText(X1+Size, 208+12, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, GameConfig().Profile[CurrentProfile].Name);
     }
 
-    if (DrawButton200_2(X1+616-72, 212, vw_GetTextUTF32("Change Profile"), MenuContentTransp, false)) {
+    if (DrawButton200_2(X1+616-72, 212, vw_GetTextUTF32(VW_TEXT_ID("Change Profile")), MenuContentTransp, false)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_PROFILE);
     }
 
@@ -254,9 +254,9 @@ void MissionMenu()
     SrcRect(0,0,2,2);
     DstRect(X1-2,Y1-2,X1+2+710,Y1+2+320);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.2f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.2f*MenuContentTransp);
     DstRect(X1,Y1,X1+710,Y1+320);
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.5f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.5f*MenuContentTransp);
 
 
 
@@ -271,7 +271,7 @@ void MissionMenu()
         SrcRect(0,0,2,2);
         DstRect(X1+1,Y1 + 64*ShowLine+1,X1+709,Y1 + 64*ShowLine+63);
         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/whitepoint.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, 0.1f*MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, 0.1f*MenuContentTransp);
     }
 
 
@@ -286,7 +286,7 @@ void MissionMenu()
                 SrcRect(0,0,64,64);
                 DstRect(X1+2,Y1+2,X1+62,Y1+62);
 
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(MissionList[i].IconHash), true, 0.3f*MenuContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(MissionList[i].IconHash), true, 0.3f*MenuContentTransp);
                 vw_DrawTextUTF32(X1+20+64, Y1+9, -610, 0, 1.0f, MissionList[i].TitleColor, 0.3f*MenuContentTransp, vw_GetTextUTF32(MissionList[i].Title));
                 vw_DrawTextUTF32(X1+20+64, Y1+33, -610, 0, 1.0f, MissionList[i].DescrColor, 0.3f*MenuContentTransp, vw_GetTextUTF32(MissionList[i].Descr));
             }
@@ -317,7 +317,7 @@ void MissionMenu()
 
                     SrcRect(0,0,64,64);
                     DstRect(X1,Y1,X1+64,Y1+64);
-                    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(MissionList[i].IconHash), true, MenuContentTransp);
+                    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(MissionList[i].IconHash), true, MenuContentTransp);
                     vw_DrawTextUTF32(X1+20+64, Y1+9, -610, 0, 1.0f, MissionList[i].TitleColor, MenuContentTransp, vw_GetTextUTF32(MissionList[i].Title));
                     vw_DrawTextUTF32(X1+20+64, Y1+33, -610, 0, 1.0f, MissionList[i].DescrColor, MenuContentTransp, vw_GetTextUTF32(MissionList[i].Descr));
 
@@ -326,7 +326,7 @@ void MissionMenu()
                         SrcRect(0,0,2,2);
                         DstRect(X1+64,Y1+1,X1+709,Y1+63);
                         constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/whitepoint.tga");
-                        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, 0.1f*MenuContentTransp);
+                        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, 0.1f*MenuContentTransp);
                     }
                     if (vw_GetMouseLeftClick(true) || (InFocusByKeyboard && (vw_GetKeyStatus(SDLK_KP_ENTER) || vw_GetKeyStatus(SDLK_RETURN)))) {
 
@@ -360,7 +360,7 @@ void MissionMenu()
                 } else {
                     SrcRect(0,0,64,64);
                     DstRect(X1+2,Y1+2,X1+62,Y1+62);
-                    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(MissionList[i].IconHash), true, 0.8f*MenuContentTransp);
+                    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(MissionList[i].IconHash), true, 0.8f*MenuContentTransp);
                     vw_DrawTextUTF32(X1+20+64, Y1+9, -610, 0, 1.0f, MissionList[i].TitleColor, 0.8f*MenuContentTransp, vw_GetTextUTF32(MissionList[i].Title));
                     vw_DrawTextUTF32(X1+20+64, Y1+33, -610, 0, 1.0f, MissionList[i].DescrColor, 0.8f*MenuContentTransp, vw_GetTextUTF32(MissionList[i].Descr));
                 }
@@ -414,7 +414,7 @@ void MissionMenu()
     SrcRect(0,0,32,32);
     DstRect(X1+750-32+4,Y1+32+((320.0f-64)/AllMission)*StartMission,X1+750-4,Y1+32+((320.0f-64)/AllMission)*(EndMission+1));
     constexpr unsigned tmpHash5 = constexpr_hash_djb2a("menu/whitepoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash5), true, 0.3f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash5), true, 0.3f*MenuContentTransp);
 
     // handle dragging the slider to display the list position
     // if we stand on the slider and press the mouse button - "capture"
@@ -464,12 +464,12 @@ void MissionMenu()
 
     int X = GameConfig().InternalWidth / 2 - 284;
     int Y = 165 + 100 * 5;
-    if (DrawButton256(X,Y, vw_GetTextUTF32("MAIN MENU"), MenuContentTransp, Button10Transp, LastButton10UpdateTime)) {
+    if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), MenuContentTransp, Button10Transp, LastButton10UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
     }
 
     X = GameConfig().InternalWidth / 2 + 28;
-    if (DrawButton256(X,Y, vw_GetTextUTF32("NEXT"), MenuContentTransp, Button11Transp, LastButton11UpdateTime, !(CurrentMission >= 0))) {
+    if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("NEXT")), MenuContentTransp, Button11Transp, LastButton11UpdateTime, !(CurrentMission >= 0))) {
         if (GameConfig().Profile[CurrentProfile].MissionReplayCount[CurrentMission] > 0) {
             if (GameConfig().NeedShowHint[5]) {
                 SetCurrentDialogBox(eDialogBox::StartMissionSecondTime);
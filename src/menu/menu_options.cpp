@@ -81,22 +81,22 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
     SrcRect(0, 0, 2, 2);
     DstRect(0, 0, GameConfig().InternalWidth, 768);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.5f * ContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.5f * ContentTransp);
 
     int X1 = GameConfig().InternalWidth / 2 - 375;
     int Y1 = 65;
     int Prir1 = 55;
 
 
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Music Volume"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Decrease"), ContentTransp, !vw_GetAudioStatus() || (GameConfig().MusicVolume == 0))) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Music Volume")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Decrease")), ContentTransp, !vw_GetAudioStatus() || (GameConfig().MusicVolume == 0))) {
         ChangeGameConfig().MusicVolume--;
         if (GameConfig().MusicVolume < 0) {
             ChangeGameConfig().MusicVolume = 0;
         }
         vw_SetMusicGlobalVolume(GameConfig().MusicVolume / 10.0f);
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Increase"), ContentTransp, !vw_GetAudioStatus() || (GameConfig().MusicVolume == 10))) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Increase")), ContentTransp, !vw_GetAudioStatus() || (GameConfig().MusicVolume == 10))) {
         ChangeGameConfig().MusicVolume++;
         if (GameConfig().MusicVolume > 10) {
             ChangeGameConfig().MusicVolume = 10;
@@ -104,8 +104,8 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         vw_SetMusicGlobalVolume(GameConfig().MusicVolume / 10.0f);
     }
     if (!vw_GetAudioStatus()) {
-        int SizeI = (170-vw_TextWidthUTF32(vw_GetTextUTF32("Not available")))/2;
-        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+        int SizeI = (170-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available"))))/2;
+        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
     } else {
         for (int i = 0; i < 10; i++) {
             SrcRect(0, 0, 16, 32);
@@ -120,10 +120,10 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
             }
             if (GameConfig().MusicVolume > i) {
                 constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/perc.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, ContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, ContentTransp);
             } else {
                 constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/perc_none.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, ContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, ContentTransp);
             }
         }
     }
@@ -134,8 +134,8 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Voice Volume"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Decrease"), ContentTransp, !vw_GetAudioStatus() || (GameConfig().VoiceVolume == 0), false)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Voice Volume")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Decrease")), ContentTransp, !vw_GetAudioStatus() || (GameConfig().VoiceVolume == 0), false)) {
         ChangeGameConfig().VoiceVolume--;
         if (GameConfig().VoiceVolume < 0) {
             ChangeGameConfig().VoiceVolume = 0;
@@ -143,7 +143,7 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         ChangeVoiceGlobalVolume(GameConfig().VoiceVolume / 10.0f);
         PlayVoicePhrase(eVoicePhrase::Attention, 1.0f);
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Increase"), ContentTransp, !vw_GetAudioStatus() || (GameConfig().VoiceVolume == 10), false)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Increase")), ContentTransp, !vw_GetAudioStatus() || (GameConfig().VoiceVolume == 10), false)) {
         ChangeGameConfig().VoiceVolume++;
         if (GameConfig().VoiceVolume > 10) {
             ChangeGameConfig().VoiceVolume = 10;
@@ -152,8 +152,8 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         PlayVoicePhrase(eVoicePhrase::Attention, 1.0f);
     }
     if (!vw_GetAudioStatus()) {
-        int SizeI = (170 - vw_TextWidthUTF32(vw_GetTextUTF32("Not available"))) / 2;
-        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+        int SizeI = (170 - vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available")))) / 2;
+        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
     } else {
         for (int i = 0; i < 10; i++) {
             SrcRect(0, 0, 16, 32);
@@ -169,10 +169,10 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
             }
             if (GameConfig().VoiceVolume > i) {
                 constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/perc.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, ContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, ContentTransp);
             } else {
                 constexpr unsigned tmpHash5 = constexpr_hash_djb2a("menu/perc_none.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash5), true, ContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash5), true, ContentTransp);
             }
         }
     }
@@ -182,15 +182,15 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Sound Effects Volume"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Decrease"), ContentTransp, !vw_GetAudioStatus() || (GameConfig().SoundVolume == 0))) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Sound Effects Volume")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Decrease")), ContentTransp, !vw_GetAudioStatus() || (GameConfig().SoundVolume == 0))) {
         ChangeGameConfig().SoundVolume--;
         if (GameConfig().SoundVolume < 0) {
             ChangeGameConfig().SoundVolume = 0;
         }
         ChangeMenuSFXGlobalVolume(GameConfig().SoundVolume / 10.0f);
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Increase"), ContentTransp, !vw_GetAudioStatus() || (GameConfig().SoundVolume == 10))) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Increase")), ContentTransp, !vw_GetAudioStatus() || (GameConfig().SoundVolume == 10))) {
         ChangeGameConfig().SoundVolume++;
         if (GameConfig().SoundVolume > 10) {
             ChangeGameConfig().SoundVolume = 10;
@@ -198,8 +198,8 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         ChangeMenuSFXGlobalVolume(GameConfig().SoundVolume / 10.0f);
     }
     if (!vw_GetAudioStatus()) {
-        int SizeI = (170-vw_TextWidthUTF32(vw_GetTextUTF32("Not available")))/2;
-        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+        int SizeI = (170-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available"))))/2;
+        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
     } else {
         for (int i=0; i<10; i++) {
             SrcRect(0,0,16,32);
@@ -214,10 +214,10 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
             }
             if (GameConfig().SoundVolume > i) {
                 constexpr unsigned tmpHash6 = constexpr_hash_djb2a("menu/perc.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash6), true, ContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash6), true, ContentTransp);
             } else {
                 constexpr unsigned tmpHash7 = constexpr_hash_djb2a("menu/perc_none.tga");
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash7), true, ContentTransp);
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash7), true, ContentTransp);
             }
         }
     }
@@ -225,9 +225,9 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Full Screen"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Off"), ContentTransp, DetectWindowSizeArray().empty() || !Options_Fullscreen)
-        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("On"), ContentTransp, DetectFullscreenSize().empty() || Options_Fullscreen)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Full Screen")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Off")), ContentTransp, DetectWindowSizeArray().empty() || !Options_Fullscreen)
+        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("On")), ContentTransp, DetectFullscreenSize().empty() || Options_Fullscreen)) {
         Options_Fullscreen = !Options_Fullscreen;
         if (Options_Fullscreen) {
             Options_Width = DetectFullscreenSize().back().Width;
@@ -243,16 +243,16 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
             }
         }
     }
-    int Size = vw_TextWidthUTF32(Options_Fullscreen ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+    int Size = vw_TextWidthUTF32(Options_Fullscreen ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
     int SizeI = (170-Size)/2;
-    vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, Options_Fullscreen ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+    vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, Options_Fullscreen ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
 
 
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Window Size"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, DetectWindowSizeArray().empty() || Options_Fullscreen)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Window Size")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, DetectWindowSizeArray().empty() || Options_Fullscreen)) {
         auto iter = std::find(DetectWindowSizeArray().cbegin(),
                               DetectWindowSizeArray().cend(),
                               sViewSize{Options_Width, Options_Height});
@@ -266,7 +266,7 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         Options_Width = iter->Width;
         Options_Height = iter->Height;
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, DetectWindowSizeArray().empty() || Options_Fullscreen)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, DetectWindowSizeArray().empty() || Options_Fullscreen)) {
         auto iter = std::find(DetectWindowSizeArray().cbegin(),
                               DetectWindowSizeArray().cend(),
                               sViewSize{Options_Width, Options_Height});
@@ -293,9 +293,9 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Sync to VBlank"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Off"), ContentTransp, !Options_VSync)
-        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("On"), ContentTransp, Options_VSync)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Sync to VBlank")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Off")), ContentTransp, !Options_VSync)
+        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("On")), ContentTransp, Options_VSync)) {
         if (NeedCheck == 0) {
             if (Options_VSync == 1) {
                 Options_VSync = 0;
@@ -304,9 +304,9 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
             }
         }
     }
-    Size = vw_TextWidthUTF32(Options_VSync ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+    Size = vw_TextWidthUTF32(Options_VSync ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
     SizeI = (170-Size)/2;
-    vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, Options_VSync ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+    vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, Options_VSync ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
 
 
 
@@ -315,14 +315,14 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Brightness"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Decrease"), ContentTransp, GameConfig().Brightness <= 1)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Brightness")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Decrease")), ContentTransp, GameConfig().Brightness <= 1)) {
         ChangeGameConfig().Brightness--;
         if (GameConfig().Brightness <= 1) {
             ChangeGameConfig().Brightness = 1;
         }
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Increase"), ContentTransp, GameConfig().Brightness >= 10)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Increase")), ContentTransp, GameConfig().Brightness >= 10)) {
         ChangeGameConfig().Brightness++;
         if (GameConfig().Brightness >= 10) {
             ChangeGameConfig().Brightness = 10;
@@ -340,10 +340,10 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         }
         if (GameConfig().Brightness > i) {
             constexpr unsigned tmpHash8 = constexpr_hash_djb2a("menu/perc.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash8), true, ContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash8), true, ContentTransp);
         } else {
             constexpr unsigned tmpHash9 = constexpr_hash_djb2a("menu/perc_none.tga");
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash9), true, ContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash9), true, ContentTransp);
         }
     }
 
@@ -370,7 +370,7 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     X = GameConfig().InternalWidth / 2 - 366;
-    if (DrawButton200_2(X, Y+28, vw_GetTextUTF32("Advanced"), ContentTransp, false)) {
+    if (DrawButton200_2(X, Y+28, vw_GetTextUTF32(VW_TEXT_ID("Advanced")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::OPTIONS_ADVANCED);
             GameMenuStatus = eGameMenuStatus::OPTIONS_ADVANCED;
@@ -381,7 +381,7 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     X = GameConfig().InternalWidth / 2 - 100;
-    if (DrawButton200_2(X, Y+28, vw_GetTextUTF32("Interface"), ContentTransp, false)) {
+    if (DrawButton200_2(X, Y+28, vw_GetTextUTF32(VW_TEXT_ID("Interface")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::INTERFACE);
             GameMenuStatus = eGameMenuStatus::INTERFACE;
@@ -392,7 +392,7 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
 
 
     X = GameConfig().InternalWidth / 2 + 166;
-    if (DrawButton200_2(X, Y+28, vw_GetTextUTF32("Config Controls"), ContentTransp, false)) {
+    if (DrawButton200_2(X, Y+28, vw_GetTextUTF32(VW_TEXT_ID("Config Controls")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::CONFCONTROL);
             GameMenuStatus = eGameMenuStatus::CONFCONTROL;
@@ -414,11 +414,11 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         X = (GameConfig().InternalWidth - 384) / 2;
         Y = Y + Prir;
         if (MenuStatus == eMenuStatus::GAME) {
-            if (DrawButton384(X,Y, vw_GetTextUTF32("GAME MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 GameMenuStatus = eGameMenuStatus::GAME_MENU;
             }
         } else {
-            if (DrawButton384(X,Y, vw_GetTextUTF32("MAIN MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
             }
         }
@@ -426,16 +426,16 @@ void OptionsMenu(float ContentTransp, float &ButtonTransp1, float &LastButtonUpd
         X = GameConfig().InternalWidth / 2 - 256 - 38;
         Y = Y+Prir;
         if (MenuStatus == eMenuStatus::GAME) {
-            if (DrawButton256(X,Y, vw_GetTextUTF32("GAME MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 GameMenuStatus = eGameMenuStatus::GAME_MENU;
             }
         } else {
-            if (DrawButton256(X,Y, vw_GetTextUTF32("MAIN MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
             }
         }
         X = GameConfig().InternalWidth / 2 + 38;
-        if (DrawButton256(X,Y, vw_GetTextUTF32("APPLY"), ContentTransp, ButtonTransp2, LastButtonUpdateTime2)) {
+        if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("APPLY")), ContentTransp, ButtonTransp2, LastButtonUpdateTime2)) {
             if (GameConfig().VSync != Options_VSync) {
                 if (SDL_GL_SetSwapInterval(Options_VSync) == -1) {
                     std::cerr << __func__ << "(): " << "SDL_GL_SetSwapInterval() failed: "
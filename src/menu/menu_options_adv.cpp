@@ -98,7 +98,7 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
     sRECT SrcRect{0, 0, 2, 2};
     sRECT DstRect{0, 0, static_cast<int>(GameConfig().InternalWidth), 768};
     constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, 0.5f * ContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, 0.5f * ContentTransp);
 
 
 
@@ -115,8 +115,8 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
     // Visual Effects Quality
     // VisualEffectsQuality is inverted (0 - all effects, 2 - minimum effects)
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Visual Effects Quality"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, GameConfig().VisualEffectsQuality == 2)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Visual Effects Quality")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, GameConfig().VisualEffectsQuality == 2)) {
         ChangeGameConfig().VisualEffectsQuality++;
         if (GameConfig().VisualEffectsQuality > 2) {
             ChangeGameConfig().VisualEffectsQuality = 0;
@@ -124,7 +124,7 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
         vw_InitParticleSystems(GameConfig().UseGLSL120, GameConfig().VisualEffectsQuality+1.0f);
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, GameConfig().VisualEffectsQuality == 0)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, GameConfig().VisualEffectsQuality == 0)) {
         ChangeGameConfig().VisualEffectsQuality--;
         if (GameConfig().VisualEffectsQuality < 0) {
             ChangeGameConfig().VisualEffectsQuality = 2;
@@ -144,14 +144,14 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
     // Point Lights per Object
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Point Lights per Object"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, GameConfig().MaxPointLights == 0)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Point Lights per Object")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, GameConfig().MaxPointLights == 0)) {
         ChangeGameConfig().MaxPointLights--;
         if (GameConfig().MaxPointLights < 0) {
             ChangeGameConfig().MaxPointLights = 0;
         }
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, GameConfig().MaxPointLights == 6)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, GameConfig().MaxPointLights == 6)) {
         ChangeGameConfig().MaxPointLights++;
         if (GameConfig().MaxPointLights > 6) {
             ChangeGameConfig().MaxPointLights = 6;
@@ -167,14 +167,14 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
     // Anisotropy Level
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Anisotropy Level"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, (Options_TexturesAnisotropyLevel == 1) || !vw_DevCaps().MaxAnisotropyLevel)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Anisotropy Level")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, (Options_TexturesAnisotropyLevel == 1) || !vw_DevCaps().MaxAnisotropyLevel)) {
         Options_TexturesAnisotropyLevel >>= 1;
         if (Options_TexturesAnisotropyLevel < 1) {
             Options_TexturesAnisotropyLevel = 1;
         }
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, (Options_TexturesAnisotropyLevel == vw_DevCaps().MaxAnisotropyLevel) || !vw_DevCaps().MaxAnisotropyLevel)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, (Options_TexturesAnisotropyLevel == vw_DevCaps().MaxAnisotropyLevel) || !vw_DevCaps().MaxAnisotropyLevel)) {
         Options_TexturesAnisotropyLevel <<= 1;
         if (Options_TexturesAnisotropyLevel > vw_DevCaps().MaxAnisotropyLevel) {
             Options_TexturesAnisotropyLevel = vw_DevCaps().MaxAnisotropyLevel;
@@ -189,13 +189,13 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
         vw_DrawText(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, tmpStream.str());
     } else {
         if (vw_DevCaps().MaxAnisotropyLevel > 1) {
-            Size = vw_TextWidthUTF32(vw_GetTextUTF32("Off"));
+            Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Off")));
             SizeI = (170-Size)/2;
-            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Off"));
+            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Off")));
         } else {
-            Size = vw_TextWidthUTF32(vw_GetTextUTF32("Not available"));
+            Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available")));
             SizeI = (170-Size)/2;
-            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
         }
     }
 
@@ -204,8 +204,8 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
     //Multisample Antialiasing
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Multisample Antialiasing"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, Options_MSAA == 0 || vw_DevCaps().MultisampleCoverageModes.empty())) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Multisample Antialiasing")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, Options_MSAA == 0 || vw_DevCaps().MultisampleCoverageModes.empty())) {
         // find current mode
         int CurrentMode = 0;
         if (Options_MSAA == 0) {
@@ -239,7 +239,7 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
         TestStateButton = vw_DevCaps().MultisampleCoverageModes.back().ColorSamples == Options_MSAA
                           && vw_DevCaps().MultisampleCoverageModes.back().CoverageSamples == Options_CSAA;
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, TestStateButton || vw_DevCaps().MultisampleCoverageModes.empty())) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, TestStateButton || vw_DevCaps().MultisampleCoverageModes.empty())) {
         // find current mode
         int CurrentMode = 0;
         if (Options_MSAA == 0) {
@@ -270,13 +270,13 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
     }
     if (Options_MSAA == 0) {
         if (vw_DevCaps().MultisampleCoverageModes.empty()) {
-            Size = vw_TextWidthUTF32(vw_GetTextUTF32("Not available"));
+            Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available")));
             SizeI = (170-Size)/2;
-            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
         } else {
-            Size = vw_TextWidthUTF32(vw_GetTextUTF32("Off"));
+            Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Off")));
             SizeI = (170-Size)/2;
-            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Off"));
+            vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Off")));
         }
     } else {
         std::ostringstream tmpStream;
@@ -296,9 +296,9 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
     // OpenGL Shading Language
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("OpenGL Shading Language"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Off"), ContentTransp, !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported || !Options_UseGLSL120)
-        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("On"), ContentTransp, !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported || Options_UseGLSL120)) {
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("OpenGL Shading Language")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Off")), ContentTransp, !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported || !Options_UseGLSL120)
+        || DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("On")), ContentTransp, !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported || Options_UseGLSL120)) {
         Options_UseGLSL120 = !Options_UseGLSL120;
         // shadow feature can work only with shaders
         if (!Options_UseGLSL120) {
@@ -318,13 +318,13 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
         }
     }
     if (vw_DevCaps().OpenGL_2_0_supported && vw_DevCaps().OpenGL_2_1_supported) {
-        Size = vw_TextWidthUTF32(Options_UseGLSL120 ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+        Size = vw_TextWidthUTF32(Options_UseGLSL120 ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
         SizeI = (170-Size)/2;
-        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, Options_UseGLSL120 ? vw_GetTextUTF32("On") : vw_GetTextUTF32("Off"));
+        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, Options_UseGLSL120 ? vw_GetTextUTF32(VW_TEXT_ID("On")) : vw_GetTextUTF32(VW_TEXT_ID("Off")));
     } else {
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Not available"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available")));
         SizeI = (170-Size)/2;
-        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
     }
 
 
@@ -333,15 +333,15 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
 
     // Shadow Quality
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32("Shadow Quality"));
-    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32("Prev"), ContentTransp, Options_ShadowMap == 0 || !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported ||
+    vw_DrawTextUTF32(X1, Y1, -280, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Shadow Quality")));
+    if (DrawButton128_2(X1+300, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Prev")), ContentTransp, Options_ShadowMap == 0 || !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported ||
                         !vw_DevCaps().OpenGL_3_0_supported || !Options_UseGLSL120 || (vw_DevCaps().FramebufferObjectDepthSize < 24))) {
         Options_ShadowMap--;
         if (Options_ShadowMap < 0) {
             Options_ShadowMap = 0;
         }
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Next"), ContentTransp, Options_ShadowMap == 1 || !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported ||
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Next")), ContentTransp, Options_ShadowMap == 1 || !vw_DevCaps().OpenGL_2_0_supported || !vw_DevCaps().OpenGL_2_1_supported ||
                         !vw_DevCaps().OpenGL_3_0_supported || !Options_UseGLSL120 || (vw_DevCaps().FramebufferObjectDepthSize < 24))) {
         Options_ShadowMap++;
         if (Options_ShadowMap > 1) {
@@ -358,9 +358,9 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
         SizeI = (170-Size)/2; //High, Medium, Low
         vw_DrawTextUTF32(X1+438+SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, ContentTransp, vw_GetTextUTF32(ShadowButtonQuality[Options_ShadowMap]));
     } else {
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Not available"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Not available")));
         SizeI = (170-Size)/2;
-        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32("Not available"));
+        vw_DrawTextUTF32(X1+438+SizeI, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, ContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Not available")));
     }
 
 
@@ -376,7 +376,7 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
     int Y = 165+Prir*4;
 
     X = GameConfig().InternalWidth / 2 - 366;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Interface"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Interface")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::INTERFACE);
             GameMenuStatus = eGameMenuStatus::INTERFACE;
@@ -386,7 +386,7 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
     }
 
     X = GameConfig().InternalWidth / 2 - 100;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Video & Audio"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Video & Audio")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::OPTIONS);
             GameMenuStatus = eGameMenuStatus::OPTIONS;
@@ -396,7 +396,7 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
     }
 
     X = GameConfig().InternalWidth / 2 + 166;
-    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32("Config Controls"), ContentTransp, false)) {
+    if (DrawButton200_2(X,Y+28, vw_GetTextUTF32(VW_TEXT_ID("Config Controls")), ContentTransp, false)) {
         if (MenuStatus == eMenuStatus::GAME) {
             SetOptionsMenu(eMenuStatus::CONFCONTROL);
             GameMenuStatus = eGameMenuStatus::CONFCONTROL;
@@ -420,11 +420,11 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
         X = (GameConfig().InternalWidth - 384) / 2;
         Y = Y+Prir;
         if (MenuStatus == eMenuStatus::GAME) {
-            if (DrawButton384(X,Y, vw_GetTextUTF32("GAME MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 GameMenuStatus = eGameMenuStatus::GAME_MENU;
             }
         } else {
-            if (DrawButton384(X,Y, vw_GetTextUTF32("MAIN MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
             }
         }
@@ -432,16 +432,16 @@ void OptionsAdvMenu(float ContentTransp, float &ButtonTransp1, float &LastButton
         X = GameConfig().InternalWidth / 2 - 256 - 38;
         Y = Y+Prir;
         if (MenuStatus == eMenuStatus::GAME) {
-            if (DrawButton256(X,Y, vw_GetTextUTF32("GAME MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("GAME MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 GameMenuStatus = eGameMenuStatus::GAME_MENU;
             }
         } else {
-            if (DrawButton256(X,Y, vw_GetTextUTF32("MAIN MENU"), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
+            if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), ContentTransp, ButtonTransp1, LastButtonUpdateTime1)) {
                 cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
             }
         }
         X = GameConfig().InternalWidth / 2 + 38;
-        if (DrawButton256(X,Y, vw_GetTextUTF32("APPLY"), ContentTransp, ButtonTransp2, LastButtonUpdateTime2)) {
+        if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("APPLY")), ContentTransp, ButtonTransp2, LastButtonUpdateTime2)) {
             if (GameConfig().MSAA != Options_MSAA || GameConfig().CSAA != Options_CSAA) {
                 ChangeGameConfig().MSAA = Options_MSAA;
                 ChangeGameConfig().CSAA = Options_CSAA;
@@ -240,7 +240,7 @@ void ProfileInputText()
     sRECT SrcRect{0, 0, 2, 2};
     sRECT DstRect{X1 + Size + 2, Y1 - 2, X1 + 26 + Size, Y1 + 24};
     constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/whitepoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, CurrentProfileNameTransp * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, CurrentProfileNameTransp * MenuContentTransp);
 
     float DeltaTime = vw_GetTimeThread(0) - LastProfileNameTime;
     LastProfileNameTime = vw_GetTimeThread(0);
@@ -275,29 +275,29 @@ void ProfileMenu()
     sRECT SrcRect(2, 2, 861, 482);
     sRECT DstRect(GameConfig().InternalWidth / 2 - 427, 160, GameConfig().InternalWidth / 2 + 432, 160 + 480);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/panel800_444_back.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.9f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.9f*MenuContentTransp);
 
 
     int X1 = GameConfig().InternalWidth / 2 - 372;
     int Y1 = 200;
     int Prir1 = 24;
 
-    vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32("New Pilot Profile"));
+    vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("New Pilot Profile")));
 
 
     Y1 += 30;
     SrcRect(0,0,2,2);
     DstRect(X1-2,Y1-6,X1+2+590,Y1-2+30);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.2f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.2f*MenuContentTransp);
     DstRect(X1,Y1-4,X1+590,Y1-4+30);
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.5f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.5f*MenuContentTransp);
     // new profile creation button
     bool Off = false;
     if (NewProfileName.empty()) {
         Off = true;
     }
-    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32("Create"), MenuContentTransp, Off)) {
+    if (DrawButton128_2(X1+616, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Create")), MenuContentTransp, Off)) {
         NewRecord();
     }
 
@@ -317,41 +317,41 @@ void ProfileMenu()
 
     // profile list
     Y1 += Prir1;
-    vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32("Pilot Profiles"));
-    int Size = vw_TextWidthUTF32(vw_GetTextUTF32("Money"));
+    vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Pilot Profiles")));
+    int Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Money")));
     float WScale = 0;
     if (Size > 70) {
         Size = 70;
         WScale = -70;
     }
     int SizeI = GameConfig().InternalWidth / 2 + 2 + (130 - Size) / 2;
-    vw_DrawTextUTF32(SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32("Money"));
+    vw_DrawTextUTF32(SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Money")));
 
-    Size = vw_TextWidthUTF32(vw_GetTextUTF32("Exp"));
+    Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Exp")));
     WScale = 0;
     if (Size > 100) {
         Size = 100;
         WScale = -100;
     }
     SizeI = GameConfig().InternalWidth / 2 + 132 + (130 - Size) / 2;
-    vw_DrawTextUTF32(SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32("Exp"));
+    vw_DrawTextUTF32(SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Exp")));
 
-    Size = vw_TextWidthUTF32(vw_GetTextUTF32("Difficulty"));
+    Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Difficulty")));
     WScale = 0;
     if (Size > 100) {
         Size = 100;
         WScale = -100;
     }
     SizeI = GameConfig().InternalWidth / 2 + 262 + (130 - Size) / 2;
-    vw_DrawTextUTF32(SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32("Difficulty"));
+    vw_DrawTextUTF32(SizeI, Y1, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Difficulty")));
 
 
     Y1 += 30;
     SrcRect(0,0,2,2);
     DstRect(X1-2,Y1-6,X1+2+750,Y1-2+230);
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.2f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.2f*MenuContentTransp);
     DstRect(X1,Y1-4,X1+750,Y1-4+230);
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.5f*MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.5f*MenuContentTransp);
     Y1 += 230;
 
 
@@ -446,7 +446,7 @@ void ProfileMenu()
                     DstRect(X1+2,Y1-233+46*i,X1+748,Y1-235+46+46*i);
                     if (CurrentProfile != i) {
                         constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/whitepoint.tga");
-                        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, 0.1f*MenuContentTransp);
+                        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, 0.1f*MenuContentTransp);
                     }
                 } else {
                     if (vw_GetMouseLeftDoubleClick(true)) {
@@ -461,7 +461,7 @@ void ProfileMenu()
             tmpStream.str(std::string{});
             tmpStream << i + 1 << ".";
             vw_DrawText(X1+10, TmpY, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, transp*MenuContentTransp, tmpStream.str());
-            vw_DrawTextUTF32(X1+50, TmpY, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, transp*MenuContentTransp, vw_GetTextUTF32("empty"));
+            vw_DrawTextUTF32(X1+50, TmpY, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, transp*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("empty")));
         }
 
         TmpY += 46;
@@ -476,7 +476,7 @@ void ProfileMenu()
         SrcRect(0,0,2,2);
         DstRect(X1+2,Y1-233+46*CurrentProfile,X1+748,Y1-235+46+46*CurrentProfile);
         constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/whitepoint.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, 0.1f*MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, 0.1f*MenuContentTransp);
     }
 
 
@@ -494,7 +494,7 @@ void ProfileMenu()
     if (CurrentProfile >= 0) {
         Off = false;
     }
-    if (DrawButton200_2(X1+6, Y1-6, vw_GetTextUTF32("Duplicate"), MenuContentTransp, Off)) {
+    if (DrawButton200_2(X1+6, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Duplicate")), MenuContentTransp, Off)) {
         DuplicateRecord();
     }
 
@@ -503,7 +503,7 @@ void ProfileMenu()
     if (CurrentProfile >= 0) {
         Off = false;
     }
-    if (DrawButton128_2(X1+240, Y1-6, vw_GetTextUTF32("Delete"), MenuContentTransp, Off)) {
+    if (DrawButton128_2(X1+240, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Delete")), MenuContentTransp, Off)) {
         SetCurrentDialogBox(eDialogBox::DeleteProfile);
     }
 
@@ -513,7 +513,7 @@ void ProfileMenu()
     if (CurrentProfile >= 0) {
         Off = false;
     }
-    if (DrawButton200_2(X1+544, Y1-6, vw_GetTextUTF32("Difficulty"), MenuContentTransp, Off)) {
+    if (DrawButton200_2(X1+544, Y1-6, vw_GetTextUTF32(VW_TEXT_ID("Difficulty")), MenuContentTransp, Off)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_DIFFICULTY);
     }
 
@@ -521,7 +521,7 @@ void ProfileMenu()
 
     int X = GameConfig().InternalWidth / 2 - 284;
     int Y = 165+100*5;
-    if (DrawButton256(X,Y, vw_GetTextUTF32("MAIN MENU"), MenuContentTransp, Button10Transp, LastButton10UpdateTime)) {
+    if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), MenuContentTransp, Button10Transp, LastButton10UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
     }
 
@@ -530,7 +530,7 @@ void ProfileMenu()
         Off = false;
     }
     X = GameConfig().InternalWidth / 2 + 28;
-    if (DrawButton256(X,Y, vw_GetTextUTF32("MISSION LIST"), MenuContentTransp, Button11Transp, LastButton11UpdateTime, Off)) {
+    if (DrawButton256(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MISSION LIST")), MenuContentTransp, Button11Transp, LastButton11UpdateTime, Off)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_MISSION);
     }
 
@@ -112,15 +112,15 @@ void TopScoresMenu()
     SrcRect(0, 0, 2, 2);
     DstRect(0, 0, GameConfig().InternalWidth, 768);
     constexpr unsigned tmpHash = constexpr_hash_djb2a("menu/blackpoint.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, 0.5f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, 0.5f * MenuContentTransp);
 
 
     int X1 = GameConfig().InternalWidth / 2 - 362;
     int Y1 = 165;
     int Prir1 = 42;
 
-    vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("NAME"));
-    vw_DrawTextUTF32(X1 + 650, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("SCORE"));
+    vw_DrawTextUTF32(X1, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("NAME")));
+    vw_DrawTextUTF32(X1 + 650, Y1, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("SCORE")));
 
     Y1 += 10;
 
@@ -133,7 +133,7 @@ void TopScoresMenu()
 
     int X = (GameConfig().InternalWidth - 384) / 2;
     int Y = 165 + 100 * 5;
-    if (DrawButton384(X,Y, vw_GetTextUTF32("MAIN MENU"), MenuContentTransp, Button10Transp, LastButton10UpdateTime)) {
+    if (DrawButton384(X,Y, vw_GetTextUTF32(VW_TEXT_ID("MAIN MENU")), MenuContentTransp, Button10Transp, LastButton10UpdateTime)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_MAIN_MENU);
     }
 }
@@ -375,7 +375,7 @@ void WorkshopMenu()
 
     int X = GameConfig().InternalWidth / 2 - 482;
     int Y = 180+100*5;
-    if (DrawButton128_2(X,Y, vw_GetTextUTF32("BACK"), MenuContentTransp, false)) {
+    if (DrawButton128_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("BACK")), MenuContentTransp, false)) {
         cCommand::GetInstance().Set(eCommand::SWITCH_TO_MISSION);
         CanDrawWorkshop = false;
         // reset drag-and-drop mode
@@ -392,7 +392,7 @@ void WorkshopMenu()
     if (CurrentWorkshop == 1) {
         Off = true;
     }
-    if (DrawButton200_2(X,Y, vw_GetTextUTF32("Shipyard"), MenuContentTransp, Off)) {
+    if (DrawButton200_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("Shipyard")), MenuContentTransp, Off)) {
         CurrentWorkshop = 1;
         // for each menu we have different 3D objects rotations (for best look)
         WorkshopCreateShip(CurrentWorkshop);
@@ -414,7 +414,7 @@ void WorkshopMenu()
     if (CurrentWorkshop == 2) {
         Off = true;
     }
-    if (DrawButton200_2(X,Y, vw_GetTextUTF32("Workshop"), MenuContentTransp, Off)) {
+    if (DrawButton200_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("Workshop")), MenuContentTransp, Off)) {
         CurrentWorkshop = 2;
         // for each menu we have different 3D objects rotations (for best look)
         WorkshopCreateShip(CurrentWorkshop);
@@ -435,7 +435,7 @@ void WorkshopMenu()
     if (CurrentWorkshop == 3) {
         Off = true;
     }
-    if (DrawButton200_2(X,Y, vw_GetTextUTF32("Weaponry"), MenuContentTransp, Off)) {
+    if (DrawButton200_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("Weaponry")), MenuContentTransp, Off)) {
         CurrentWorkshop = 3;
         // for each menu we have different 3D objects rotations (for best look)
         WorkshopCreateShip(CurrentWorkshop);
@@ -454,7 +454,7 @@ void WorkshopMenu()
 
 
     X = GameConfig().InternalWidth / 2 + 354;
-    if (DrawButton128_2(X,Y, vw_GetTextUTF32("START"), MenuContentTransp, false)) {
+    if (DrawButton128_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("START")), MenuContentTransp, false)) {
         if (GameConfig().NeedShowHint[4]) {
             SetCurrentDialogBox(eDialogBox::ShortkeyTipsAndTricks);
         } else {
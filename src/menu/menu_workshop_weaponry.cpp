@@ -391,7 +391,7 @@ void ShipSlotWeapon(int SlotNum, int X, int Y)
     int Ypos = Y-36;
     sRECT DstRect(Xpos, Ypos, Xpos + 220, Ypos + 128);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/workshop_panel3.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, MenuContentTransp);
 
 
     // ammo related warning
@@ -409,9 +409,9 @@ void ShipSlotWeapon(int SlotNum, int X, int Y)
         DstRect(Xpos+23,Ypos+40+AmmoShow,Xpos+18+23,Ypos+56+40);
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/ammo.tga");
         if (AmmoShow > 0) {
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, CurrentAlert3*MenuContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, CurrentAlert3*MenuContentTransp);
         } else {
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, MenuContentTransp);
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, MenuContentTransp);
         }
 
         if (sharedWeapon->Ammo == 0) {
@@ -443,7 +443,7 @@ void ShipSlotWeapon(int SlotNum, int X, int Y)
     if (((DstRect.right >= MouseX && DstRect.left <= MouseX && DstRect.bottom >= MouseY && DstRect.top <= MouseY)
          || InFocusByKeyboard)
         && !isDialogBoxDrawing() && !DragWeapon) {
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(hash_djb2a(vw_GetText("lang/en/menu/button_weaponry_in.tga").c_str())), true, MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(hash_djb2a(vw_GetText(VW_TEXT_ID("lang/en/menu/button_weaponry_in.tga")).c_str())), true, MenuContentTransp);
         SetCursorStatus(eCursorStatus::ActionAllowed);
         if (vw_GetMouseLeftClick(true) || (InFocusByKeyboard && (vw_GetKeyStatus(SDLK_KP_ENTER) || vw_GetKeyStatus(SDLK_RETURN)))) {
             PlayMenuSFX(eMenuSFX::Click, 1.0f);
@@ -454,7 +454,7 @@ void ShipSlotWeapon(int SlotNum, int X, int Y)
             }
         }
     } else {
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(hash_djb2a(vw_GetText("lang/en/menu/button_weaponry_out.tga").c_str())), true, MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(hash_djb2a(vw_GetText(VW_TEXT_ID("lang/en/menu/button_weaponry_out.tga")).c_str())), true, MenuContentTransp);
     }
 
 
@@ -601,15 +601,15 @@ void ShipSlotWeapon(int SlotNum, int X, int Y)
             }
 
             if (NeedAlert) {
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, CurrentAlert3*MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::green});
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, CurrentAlert3*MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::green});
             } else {
-                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::green});
+                vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::green});
             }
         } else {
-            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, CurrentAlert3*MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::red});
+            vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, CurrentAlert3*MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::red});
         }
     } else {
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::orange});
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, MenuContentTransp, 0.0f, sRGBCOLOR{eRGBCOLOR::orange});
     }
 
 
@@ -620,23 +620,23 @@ void ShipSlotWeapon(int SlotNum, int X, int Y)
     if (auto sharedWeapon = sharedWorkshopFighterGame->WeaponSlots[SlotNum].Weapon.lock()) {
         SrcRect(0,0,128,64);
         DstRect(X,Y,X+128,Y+64);
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(GetWeaponIconNameHash(sharedWeapon->InternalType)), true, MenuContentTransp);
     } else {
         // empty slot
 
         DstRect(X,Y,X+128,Y+64);
 
-        int Size = vw_TextWidthUTF32(vw_GetTextUTF32("EMPTY"));
+        int Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("EMPTY")));
         float WScale = 0;
         if (Size > 88) {
             Size = 88;
             WScale = -88;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-53, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7*MenuContentTransp, vw_GetTextUTF32("EMPTY"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-53, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, 0.7*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("EMPTY")));
 
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
-                  << vw_GetText("level") << " " << sharedWorkshopFighterGame->WeaponSlots[SlotNum].Type;
+                  << vw_GetText(VW_TEXT_ID("level")) << " " << sharedWorkshopFighterGame->WeaponSlots[SlotNum].Type;
         Size = vw_TextWidth(tmpStream.str());
         WScale = 0;
         if (Size > 88) {
@@ -670,7 +670,7 @@ void ShipSlotSetupWeapon(int SlotNum)
     int Ypos = 50-10;
     DstRect(Xpos,Ypos,Xpos+404,Ypos+570);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/workshop_panel5.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, MenuContentTransp);
 
 
 
@@ -678,7 +678,7 @@ void ShipSlotSetupWeapon(int SlotNum)
         Ypos += 33;
         // draw ammo status
         Xpos = GameConfig().InternalWidth / 2 + 55 + 50;
-        vw_DrawTextUTF32(Xpos, Ypos, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon Ammo:"));
+        vw_DrawTextUTF32(Xpos, Ypos, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Ammo:")));
         std::ostringstream tmpStream;
         tmpStream << std::fixed << std::setprecision(0)
                   << sharedWeapon->Ammo << "/" << sharedWeapon->AmmoStart;
@@ -698,7 +698,7 @@ void ShipSlotSetupWeapon(int SlotNum)
         // reload cost
         Xpos = GameConfig().InternalWidth / 2 + 55 + 50;
         Ypos += 30;
-        vw_DrawTextUTF32(Xpos, Ypos, -230, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon Reload Cost:"));
+        vw_DrawTextUTF32(Xpos, Ypos, -230, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Reload Cost:")));
         int ReloadCost = GetWeaponReloadCost(sharedWeapon->InternalType,
                                              sharedWeapon->Ammo,
                                              sharedWeapon->AmmoStart);
@@ -717,7 +717,7 @@ void ShipSlotSetupWeapon(int SlotNum)
 
         // reload button
         Ypos += 40;
-        if (DrawButton200_2(GameConfig().InternalWidth / 2 + 155, Ypos, vw_GetTextUTF32("Reload"), MenuContentTransp, (ReloadCost == 0) || GameConfig().Profile[CurrentProfile].Money<ReloadCost)) {
+        if (DrawButton200_2(GameConfig().InternalWidth / 2 + 155, Ypos, vw_GetTextUTF32(VW_TEXT_ID("Reload")), MenuContentTransp, (ReloadCost == 0) || GameConfig().Profile[CurrentProfile].Money<ReloadCost)) {
             sharedWeapon->Ammo = sharedWeapon->AmmoStart;
             ChangeGameConfig().Profile[CurrentProfile].WeaponAmmo[SlotNum] = sharedWeapon->Ammo;
             ChangeGameConfig().Profile[CurrentProfile].Money -= ReloadCost;
@@ -732,7 +732,7 @@ void ShipSlotSetupWeapon(int SlotNum)
 
         Xpos = GameConfig().InternalWidth/2+55+34 + 16;
         Ypos += 60;
-        vw_DrawTextUTF32(Xpos, Ypos, -300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon Fire Control:"));
+        vw_DrawTextUTF32(Xpos, Ypos, -300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Fire Control:")));
         // primary control
         if (GameConfig().Profile[CurrentProfile].WeaponControl[SlotNum] == 1
             || GameConfig().Profile[CurrentProfile].WeaponControl[SlotNum] == 3) {
@@ -740,7 +740,7 @@ void ShipSlotSetupWeapon(int SlotNum)
         }
         Xpos = GameConfig().InternalWidth/2+55+54 + 16;
         Ypos += 30;
-        DrawCheckBox(Xpos,Ypos, Status1, vw_GetTextUTF32("Primary Attack"), MenuContentTransp);
+        DrawCheckBox(Xpos,Ypos, Status1, vw_GetTextUTF32(VW_TEXT_ID("Primary Attack")), MenuContentTransp);
         // secondary control
         if (GameConfig().Profile[CurrentProfile].WeaponControl[SlotNum] == 2
             || GameConfig().Profile[CurrentProfile].WeaponControl[SlotNum] == 3) {
@@ -748,7 +748,7 @@ void ShipSlotSetupWeapon(int SlotNum)
         }
         Xpos = GameConfig().InternalWidth/2+55+54 + 16;
         Ypos += 40;
-        DrawCheckBox(Xpos,Ypos, Status2, vw_GetTextUTF32("Secondary Attack"), MenuContentTransp);
+        DrawCheckBox(Xpos,Ypos, Status2, vw_GetTextUTF32(VW_TEXT_ID("Secondary Attack")), MenuContentTransp);
         // get data back
         ChangeGameConfig().Profile[CurrentProfile].WeaponControl[SlotNum] = 0;
         if (Status1) {
@@ -761,7 +761,7 @@ void ShipSlotSetupWeapon(int SlotNum)
         // configure custom control
         Xpos = GameConfig().InternalWidth/2+55+34 + 16;
         Ypos += 40;
-        vw_DrawTextUTF32(Xpos, Ypos, -300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Alternative Fire Control:"));
+        vw_DrawTextUTF32(Xpos, Ypos, -300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Alternative Fire Control:")));
 
         Ypos += 40;
 
@@ -785,7 +785,7 @@ void ShipSlotSetupWeapon(int SlotNum)
                     TextTmp = JoystickButtonName(GameConfig().Profile[CurrentProfile].WeaponAltControlData[SlotNum]);
                 }
             } else {
-                TextTmp = vw_GetText("Click to setup");
+                TextTmp = vw_GetText(VW_TEXT_ID("Click to setup"));
             }
         }
 
@@ -811,7 +811,7 @@ void ShipSlotSetupWeapon(int SlotNum)
             Ypos += 60;
             tmpStream.clear();
             tmpStream.str(std::string{});
-            tmpStream << vw_GetText("Weapon Angle:") << " "
+            tmpStream << vw_GetText(VW_TEXT_ID("Weapon Angle:")) << " "
                       << GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum];
             vw_DrawText(Xpos, Ypos, -300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
             Ypos += 40;
@@ -822,11 +822,11 @@ void ShipSlotSetupWeapon(int SlotNum)
 
 
             if (GameConfig().Profile[CurrentProfile].TargetingSystem <= 2) {
-                vw_DrawTextUTF32(Xpos, Ypos-15, 300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, 1.0f, vw_GetTextUTF32("Custom Weapon Angle is use-"));
-                vw_DrawTextUTF32(Xpos, Ypos+5, 300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, 1.0f, vw_GetTextUTF32("ful with optical computer"));
-                vw_DrawTextUTF32(Xpos, Ypos+25, 300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, 1.0f, vw_GetTextUTF32("system Neo or Supra only."));
+                vw_DrawTextUTF32(Xpos, Ypos-15, 300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, 1.0f, vw_GetTextUTF32(VW_TEXT_ID("Custom Weapon Angle is use-")));
+                vw_DrawTextUTF32(Xpos, Ypos+5, 300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, 1.0f, vw_GetTextUTF32(VW_TEXT_ID("ful with optical computer")));
+                vw_DrawTextUTF32(Xpos, Ypos+25, 300, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::orange}, 1.0f, vw_GetTextUTF32(VW_TEXT_ID("system Neo or Supra only.")));
             } else {
-                if (DrawButton128_2(GameConfig().InternalWidth/2+118, Ypos, vw_GetTextUTF32("Left"), MenuContentTransp, GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum] <= Min)) {
+                if (DrawButton128_2(GameConfig().InternalWidth/2+118, Ypos, vw_GetTextUTF32(VW_TEXT_ID("Left")), MenuContentTransp, GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum] <= Min)) {
                     ChangeGameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum] -= 5.0f;
                     sharedWorkshopFighterGame->WeaponSlots[SlotNum].YAngle = -GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum];
 
@@ -835,7 +835,7 @@ void ShipSlotSetupWeapon(int SlotNum)
                     NeedAngle.y += sharedWorkshopFighterGame->WeaponSlots[SlotNum].YAngle;
                     sharedWeapon->SetRotation(NeedAngle);
                 }
-                if (DrawButton128_2(GameConfig().InternalWidth/2+266, Ypos, vw_GetTextUTF32("Right"), MenuContentTransp, GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum] >= Max)) {
+                if (DrawButton128_2(GameConfig().InternalWidth/2+266, Ypos, vw_GetTextUTF32(VW_TEXT_ID("Right")), MenuContentTransp, GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum] >= Max)) {
                     ChangeGameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum] += 5.0f;
                     sharedWorkshopFighterGame->WeaponSlots[SlotNum].YAngle = -GameConfig().Profile[CurrentProfile].WeaponSlotYAngle[SlotNum];
 
@@ -853,15 +853,15 @@ void ShipSlotSetupWeapon(int SlotNum)
         SrcRect(0,0,256,256);
         DstRect(Xpos,Ypos,Xpos+256,Ypos+256);
         constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/weapon_empty_icon.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, MenuContentTransp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, MenuContentTransp);
 
-        int Size = vw_TextWidthUTF32(vw_GetTextUTF32("Empty Weapon Slot"));
+        int Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Empty Weapon Slot")));
         float WScale = 0;
         if (Size > 228) {
             Size = 228;
             WScale = -228;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-40, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Empty Weapon Slot"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-40, WScale, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Empty Weapon Slot")));
     }
 
 
@@ -951,7 +951,7 @@ void ShipSlotSetupWeapon(int SlotNum)
 
 
     // "Close" button
-    if (DrawButton200_2(GameConfig().InternalWidth / 2 + 155, 533, vw_GetTextUTF32("Close"), MenuContentTransp, false)) {
+    if (DrawButton200_2(GameConfig().InternalWidth / 2 + 155, 533, vw_GetTextUTF32(VW_TEXT_ID("Close")), MenuContentTransp, false)) {
         WeaponSetupSlot = -1;
         NeedCheck = 0;
     }
@@ -1113,10 +1113,10 @@ void Workshop_Weaponry()
     SrcRect(0,0,256,256);
     DstRect(GameConfig().InternalWidth/2-480, 100-32, GameConfig().InternalWidth/2-32, 450+32);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/back_spot2.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.45f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.45f * MenuContentTransp);
     DstRect(GameConfig().InternalWidth / 2, 0, GameConfig().InternalWidth/2+512, 622);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/back_spot.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, 0.35f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, 0.35f * MenuContentTransp);
 
 
     vw_End2DMode();
@@ -1127,46 +1127,46 @@ void Workshop_Weaponry()
 
     // current weapon name in shopfront
     vw_DrawTextUTF32(GameConfig().InternalWidth/2-438, 50+6, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(GetWeaponName(CurrentWorkshopNewWeapon)));
-    if (DrawButton128_2(GameConfig().InternalWidth/2-197, 50, vw_GetTextUTF32("Info"), MenuContentTransp, false)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2-197, 50, vw_GetTextUTF32(VW_TEXT_ID("Info")), MenuContentTransp, false)) {
         SetCurrentDialogBox(eDialogBox::ShowWeaponsInfo);
         DialogWeapon = sharedWorkshopNewWeapon.get();
     }
 
     std::ostringstream tmpStream;
     tmpStream << std::fixed << std::setprecision(0)
-              << vw_GetText("Weapon Type") << ": ";
+              << vw_GetText(VW_TEXT_ID("Weapon Type")) << ": ";
     vw_DrawText(GameConfig().InternalWidth/2-438, 110, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
     vw_DrawTextUTF32(GameConfig().InternalWidth/2-438+175, 110, -184, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(GetWeaponGroupTitle(CurrentWorkshopNewWeapon)));
 
 
     int k2 = 0;
     if (GetProjectileDamageKinetic(sharedWorkshopNewWeapon->InternalType) > 0.0f) {
-        vw_DrawTextUTF32(GameConfig().InternalWidth/2-438, 130, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Damage, Kinetic:"));
+        vw_DrawTextUTF32(GameConfig().InternalWidth/2-438, 130, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, Kinetic:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << GetProjectileDamageKinetic(sharedWorkshopNewWeapon->InternalType) << " ";
         if (sharedWorkshopNewWeapon->InternalType == 11
             || sharedWorkshopNewWeapon->InternalType == 12
             || sharedWorkshopNewWeapon->InternalType == 14) {
-            tmpStream << vw_GetText("units/sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/sec"));
         } else {
-            tmpStream << vw_GetText("units/shot");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/shot"));
         }
         vw_DrawText(GameConfig().InternalWidth/2-438+175, 130, -184, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
         k2=20;
     }
     if (GetProjectileDamageEM(sharedWorkshopNewWeapon->InternalType) > 0.0f) {
-        vw_DrawTextUTF32(GameConfig().InternalWidth/2-438, 130+k2, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Damage, EM:"));
+        vw_DrawTextUTF32(GameConfig().InternalWidth/2-438, 130+k2, -170, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Damage, EM:")));
         tmpStream.clear();
         tmpStream.str(std::string{});
         tmpStream << GetProjectileDamageEM(sharedWorkshopNewWeapon->InternalType) << " ";
         if (sharedWorkshopNewWeapon->InternalType == 11
             || sharedWorkshopNewWeapon->InternalType == 12
             || sharedWorkshopNewWeapon->InternalType == 14) {
-            tmpStream << vw_GetText("units/sec");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/sec"));
         } else {
-            tmpStream << vw_GetText("units/shot");
+            tmpStream << vw_GetText(VW_TEXT_ID("units/shot"));
         }
         vw_DrawText(GameConfig().InternalWidth/2-438+175, 130+k2, -184, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
@@ -1179,7 +1179,7 @@ void Workshop_Weaponry()
     sRGBCOLOR tmpColor{eRGBCOLOR::green};
     tmpStream.clear();
     tmpStream.str(std::string{});
-    tmpStream << vw_GetText("Weapon Level") << ": " << sharedWorkshopNewWeapon->WeaponLevel;
+    tmpStream << vw_GetText(VW_TEXT_ID("Weapon Level")) << ": " << sharedWorkshopNewWeapon->WeaponLevel;
     if (sharedWorkshopNewWeapon->WeaponLevel > GetShipWeaponsMaxSlotLevel()) {
         tmpTransp = MenuContentTransp * CurrentAlert3;
         tmpColor = sRGBCOLOR{eRGBCOLOR::orange};
@@ -1191,7 +1191,7 @@ void Workshop_Weaponry()
     tmpColor = sRGBCOLOR{eRGBCOLOR::yellow};
     tmpStream.clear();
     tmpStream.str(std::string{});
-    tmpStream << vw_GetText("Weapon Cost") << ": " << GetWeaponBaseCost(CurrentWorkshopNewWeapon);
+    tmpStream << vw_GetText(VW_TEXT_ID("Weapon Cost")) << ": " << GetWeaponBaseCost(CurrentWorkshopNewWeapon);
     if (GameConfig().Profile[CurrentProfile].Money < GetWeaponBaseCost(CurrentWorkshopNewWeapon)) {
         tmpTransp = MenuContentTransp * CurrentAlert3;
         tmpColor = sRGBCOLOR{eRGBCOLOR::red};
@@ -1204,12 +1204,12 @@ void Workshop_Weaponry()
     SrcRect(0,0,400,35 );
     DstRect(GameConfig().InternalWidth/2-457, 100-11, GameConfig().InternalWidth/2-57, 100+35-11);
     constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/workshop_panel4.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, MenuContentTransp);
 
     SrcRect(0,0,400,173 );
     DstRect(GameConfig().InternalWidth/2-457, 450-13, GameConfig().InternalWidth/2-57, 450+173-13);
     constexpr unsigned tmpHash4 = constexpr_hash_djb2a("menu/workshop_panel1.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash4), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash4), true, MenuContentTransp);
 
 
 
@@ -1236,14 +1236,14 @@ void Workshop_Weaponry()
     }
 
 
-    if (DrawButton128_2(GameConfig().InternalWidth/2-395,482, vw_GetTextUTF32("Prev"), MenuContentTransp, false)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2-395,482, vw_GetTextUTF32(VW_TEXT_ID("Prev")), MenuContentTransp, false)) {
         CurrentWorkshopNewWeapon--;
         if (CurrentWorkshopNewWeapon < 1) {
             CurrentWorkshopNewWeapon = 19;
         }
         WorkshopCreateNewWeapon();
     }
-    if (DrawButton128_2(GameConfig().InternalWidth/2-247,482, vw_GetTextUTF32("Next"), MenuContentTransp, false)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2-247,482, vw_GetTextUTF32(VW_TEXT_ID("Next")), MenuContentTransp, false)) {
         CurrentWorkshopNewWeapon++;
         if (CurrentWorkshopNewWeapon > 19) {
             CurrentWorkshopNewWeapon = 1;
@@ -1262,7 +1262,7 @@ void Workshop_Weaponry()
     }
 
     vw_SetFontSize(24);
-    vw_DrawTextUTF32(GameConfig().InternalWidth/2-445, 600, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Weapon Stock"));
+    vw_DrawTextUTF32(GameConfig().InternalWidth/2-445, 600, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Weapon Stock")));
     ResetFontSize();
 
     if (WeaponSetupSlot == -1) {
@@ -1284,7 +1284,7 @@ void Workshop_Weaponry()
                                                       sharedWeapon->AmmoStart);
                 }
             }
-            std::u32string ButtonName = ConvertUTF8.from_bytes(std::string(vw_GetText("Reload All")) + ": " + std::to_string(ReloadCost));
+            std::u32string ButtonName = ConvertUTF8.from_bytes(std::string(vw_GetText(VW_TEXT_ID("Reload All"))) + ": " + std::to_string(ReloadCost));
 
             if (DrawButton200_2(GameConfig().InternalWidth/2+153, 50, ButtonName, MenuContentTransp, (ReloadCost == 0) || (GameConfig().Profile[CurrentProfile].Money < ReloadCost))) {
                 for (unsigned i = 0; i < sharedWorkshopFighterGame->WeaponSlots.size(); i++) {
@@ -1299,7 +1299,7 @@ void Workshop_Weaponry()
     }
 
     vw_SetFontSize(24);
-    vw_DrawTextUTF32(GameConfig().InternalWidth/2+445-vw_TextWidthUTF32(vw_GetTextUTF32("Installed Weapons")), 600, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Installed Weapons"));
+    vw_DrawTextUTF32(GameConfig().InternalWidth/2+445-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Installed Weapons"))), 600, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Installed Weapons")));
     ResetFontSize();
 
     vw_SetFontSize(20);
@@ -1308,7 +1308,7 @@ void Workshop_Weaponry()
     tmpColor = sRGBCOLOR{eRGBCOLOR::yellow};
     tmpStream.clear();
     tmpStream.str(std::string{});
-    tmpStream << vw_GetText("Money") << ": "
+    tmpStream << vw_GetText(VW_TEXT_ID("Money")) << ": "
               << GameConfig().Profile[CurrentProfile].Money;
     int SizeI = (GameConfig().InternalWidth - vw_TextWidth(tmpStream.str())) / 2;
     if (GameConfig().Profile[CurrentProfile].Money < GetWeaponBaseCost(CurrentWorkshopNewWeapon)) {
@@ -1336,7 +1336,7 @@ void Workshop_Weaponry()
     }
 
     if (DragWeapon) {
-        SetCursorDraggingItemIcon(GetPreloadedTextureAsset(GetWeaponIconNameHash(DragWeaponNum)));
+        SetCursorDraggingItemIcon(GetPreloadedTextureRegion(GetWeaponIconNameHash(DragWeaponNum)));
         SetCursorStatus(eCursorStatus::DraggingItem);
     }
 }
@@ -169,11 +169,11 @@ const char *GetSystemName(int Num)
 
 
 
-GLtexture GetSystemIcon(int Num)
+sTextureRegion GetSystemIcon(int Num)
 {
     if (Num < -4 || Num > 20) {
         std::cerr << __func__ << "(): " << "wrong Num.\n";
-        return 0;
+        return sTextureRegion{};
     }
 
     static unsigned NumToFileHash[]{
@@ -210,7 +210,7 @@ GLtexture GetSystemIcon(int Num)
     };
 
     // Num range [-4; 20] -> NumToFileHash range [0, 24]
-    return GetPreloadedTextureAsset(NumToFileHash[Num + 4]);
+    return GetPreloadedTextureRegion(NumToFileHash[Num + 4]);
 }
 
 
@@ -374,7 +374,7 @@ void Workshop_Workshop()
     sRECT SrcRect(0, 0, 256, 256);
     sRECT DstRect(GameConfig().InternalWidth / 2 - 256, 0, GameConfig().InternalWidth / 2 - 256 + 512, 412);
     constexpr unsigned tmpHash1 = constexpr_hash_djb2a("menu/back_spot.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash1), true, 0.35f * MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash1), true, 0.35f * MenuContentTransp);
 
 
 
@@ -386,7 +386,7 @@ void Workshop_Workshop()
     SrcRect(0,0,210,600);
     DstRect(GameConfig().InternalWidth/2-492, 50-10, GameConfig().InternalWidth/2-492+210, 50+600-10);
     constexpr unsigned tmpHash2 = constexpr_hash_djb2a("menu/workshop_panel2.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash2), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash2), true, MenuContentTransp);
 
 
 
@@ -552,7 +552,7 @@ void Workshop_Workshop()
 
 
     vw_SetFontSize(24);
-    vw_DrawTextUTF32(GameConfig().InternalWidth/2-475, 630, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("System Stock"));
+    vw_DrawTextUTF32(GameConfig().InternalWidth/2-475, 630, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("System Stock")));
     ResetFontSize();
 
 
@@ -569,7 +569,7 @@ void Workshop_Workshop()
     SrcRect(0,0,210,600);
     DstRect(GameConfig().InternalWidth/2+282, 50-10, GameConfig().InternalWidth/2+492, 50+600-10);
     constexpr unsigned tmpHash3 = constexpr_hash_djb2a("menu/workshop_panel2+.tga");
-    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash3), true, MenuContentTransp);
+    vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash3), true, MenuContentTransp);
 
 
 
@@ -609,14 +609,14 @@ void Workshop_Workshop()
         }
 
         // text
-        int SizeI = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32("Warning! Low energy recharge rate!"))) / 2;
-        vw_DrawTextUTF32(SizeI, 60, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3 * MenuContentTransp, vw_GetTextUTF32("Warning! Low energy recharge rate!"));
+        int SizeI = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Warning! Low energy recharge rate!")))) / 2;
+        vw_DrawTextUTF32(SizeI, 60, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3 * MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Warning! Low energy recharge rate!")));
 
-        SizeI = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32("Could be problems with"))) / 2;
-        vw_DrawTextUTF32(SizeI, 80, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3 * MenuContentTransp, vw_GetTextUTF32("Could be problems with"));
+        SizeI = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Could be problems with")))) / 2;
+        vw_DrawTextUTF32(SizeI, 80, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3 * MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Could be problems with")));
 
-        SizeI = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32("systems function and/or weapons recharge!"))) / 2;
-        vw_DrawTextUTF32(SizeI, 100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3 * MenuContentTransp, vw_GetTextUTF32("systems function and/or weapons recharge!"));
+        SizeI = (GameConfig().InternalWidth - vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("systems function and/or weapons recharge!")))) / 2;
+        vw_DrawTextUTF32(SizeI, 100, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::red}, CurrentAlert3 * MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("systems function and/or weapons recharge!")));
     }
 
 
@@ -767,21 +767,21 @@ void Workshop_Workshop()
     if (GameConfig().Profile[CurrentProfile].EngineSystem <= 0) {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(-4), true, Current*MenuContentTransp);
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("empty"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("empty")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("empty"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("empty")));
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Spaceship Engine"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Spaceship Engine")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("Spaceship Engine"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Spaceship Engine")));
     } else {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(GameConfig().Profile[CurrentProfile].EngineSystem), true, Current*MenuContentTransp);
 
@@ -837,21 +837,21 @@ void Workshop_Workshop()
     if (GameConfig().Profile[CurrentProfile].PowerSystem <= 0) {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(-2), true, Current*MenuContentTransp);
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("empty"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("empty")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("empty"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("empty")));
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Power Source"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("Power Source"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Power Source")));
     } else {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(GameConfig().Profile[CurrentProfile].PowerSystem + 4), true, Current * MenuContentTransp);
 
@@ -905,21 +905,21 @@ void Workshop_Workshop()
     if (GameConfig().Profile[CurrentProfile].TargetingSystem <= 0) {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(-1), true, Current*MenuContentTransp);
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("empty"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("empty")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("empty"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("empty")));
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Optical Computer"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Optical Computer")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("Optical Computer"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Optical Computer")));
     } else {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(GameConfig().Profile[CurrentProfile].TargetingSystem + 8), true, Current * MenuContentTransp);
 
@@ -974,21 +974,21 @@ void Workshop_Workshop()
     if (GameConfig().Profile[CurrentProfile].TargetingMechanicSystem <= 0) {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(-3), true, Current*MenuContentTransp);
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("empty"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("empty")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("empty"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("empty")));
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Targeting System"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Targeting System")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("Targeting System"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Targeting System")));
     } else {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(GameConfig().Profile[CurrentProfile].TargetingMechanicSystem + 12), true, Current * MenuContentTransp);
 
@@ -1046,21 +1046,21 @@ void Workshop_Workshop()
     if (GameConfig().Profile[CurrentProfile].AdvancedProtectionSystem <= 0) {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(0), true, Current*MenuContentTransp);
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("empty"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("empty")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("empty"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.top-4, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("empty")));
 
-        Size = vw_TextWidthUTF32(vw_GetTextUTF32("Advanced System"));
+        Size = vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Advanced System")));
         WScale = 0;
         if (Size > 128) {
             Size = 128;
             WScale = -128;
         }
-        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32("Advanced System"));
+        vw_DrawTextUTF32(DstRect.left+(DstRect.right-DstRect.left-Size)/2, DstRect.bottom-20, WScale, 0, 1.0f, tmpColor, Current*MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Advanced System")));
 
     } else {
         vw_Draw2D(DstRect, SrcRect, GetSystemIcon(GameConfig().Profile[CurrentProfile].AdvancedProtectionSystem + 16), true, Current*MenuContentTransp);
@@ -1077,18 +1077,18 @@ void Workshop_Workshop()
 
 
     vw_SetFontSize(24);
-    vw_DrawTextUTF32(GameConfig().InternalWidth/2+475-vw_TextWidthUTF32(vw_GetTextUTF32("Installed Systems")), 630, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32("Installed Systems"));
+    vw_DrawTextUTF32(GameConfig().InternalWidth/2+475-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Installed Systems"))), 630, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Installed Systems")));
     ResetFontSize();
 
     // current system
-    vw_DrawTextUTF32(GameConfig().InternalWidth/2-250, 430, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Selected System"));
-    vw_DrawTextUTF32(GameConfig().InternalWidth/2+250-vw_TextWidthUTF32(vw_GetTextUTF32("Installed System")), 430, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32("Installed System"));
+    vw_DrawTextUTF32(GameConfig().InternalWidth/2-250, 430, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Selected System")));
+    vw_DrawTextUTF32(GameConfig().InternalWidth/2+250-vw_TextWidthUTF32(vw_GetTextUTF32(VW_TEXT_ID("Installed System"))), 430, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::yellow}, MenuContentTransp, vw_GetTextUTF32(VW_TEXT_ID("Installed System")));
 
     float tmpTransp{MenuContentTransp};
     tmpColor = sRGBCOLOR{eRGBCOLOR::white};
     std::ostringstream tmpStream;
     tmpStream << std::fixed << std::setprecision(0)
-              << vw_GetText("Cost") << ": " << GetSystemCost(CurrentSystemStockNum);
+              << vw_GetText(VW_TEXT_ID("Cost")) << ": " << GetSystemCost(CurrentSystemStockNum);
     if (!CanBuy) {
         tmpTransp = MenuContentTransp * CurrentAlert3;
         tmpColor = sRGBCOLOR{eRGBCOLOR::orange};
@@ -1097,16 +1097,16 @@ void Workshop_Workshop()
 
     tmpStream.clear();
     tmpStream.str(std::string{});
-    tmpStream << vw_GetText("Cost") << ": " << Cost;
+    tmpStream << vw_GetText(VW_TEXT_ID("Cost")) << ": " << Cost;
     vw_DrawText(GameConfig().InternalWidth/2+250-vw_TextWidth(tmpStream.str()), 485, 0, 0, 1.0f, sRGBCOLOR{eRGBCOLOR::white}, MenuContentTransp, tmpStream.str());
 
 
-    if (DrawButton128_2(GameConfig().InternalWidth/2-250,580-55, vw_GetTextUTF32("Info"), MenuContentTransp, false)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2-250,580-55, vw_GetTextUTF32(VW_TEXT_ID("Info")), MenuContentTransp, false)) {
         SetCurrentDialogBox(eDialogBox::ShowSystemsInfo);
         DialogSystem = CurrentSystemStockNum;
     }
 
-    if (DrawButton128_2(GameConfig().InternalWidth/2+250-128, 580-55, vw_GetTextUTF32("Info"), MenuContentTransp, !CanSell)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2+250-128, 580-55, vw_GetTextUTF32(VW_TEXT_ID("Info")), MenuContentTransp, !CanSell)) {
         SetCurrentDialogBox(eDialogBox::ShowSystemsInfo);
 
         NeedMoreEnergyDialog = NeedMoreEnergy;
@@ -1129,7 +1129,7 @@ void Workshop_Workshop()
     }
 
 
-    if (DrawButton128_2(GameConfig().InternalWidth/2-250, 50+580-55, vw_GetTextUTF32("Buy"), MenuContentTransp, !CanBuy)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2-250, 50+580-55, vw_GetTextUTF32(VW_TEXT_ID("Buy")), MenuContentTransp, !CanBuy)) {
         BuyCurrentSystem();
     }
     // buy at double click on icon
@@ -1140,7 +1140,7 @@ void Workshop_Workshop()
 
 
 
-    if (DrawButton128_2(GameConfig().InternalWidth/2+250-128, 50+580-55, vw_GetTextUTF32("Sell"), MenuContentTransp, !CanSell)) {
+    if (DrawButton128_2(GameConfig().InternalWidth/2+250-128, 50+580-55, vw_GetTextUTF32(VW_TEXT_ID("Sell")), MenuContentTransp, !CanSell)) {
         SellCurrentSystem();
     }
 
@@ -1152,7 +1152,7 @@ void Workshop_Workshop()
     tmpColor = sRGBCOLOR{eRGBCOLOR::yellow};
     tmpStream.clear();
     tmpStream.str(std::string{});
-    tmpStream << vw_GetText("Money") << ": "
+    tmpStream << vw_GetText(VW_TEXT_ID("Money")) << ": "
               << GameConfig().Profile[CurrentProfile].Money;
     int SizeI = (GameConfig().InternalWidth - vw_TextWidth(tmpStream.str())) / 2;
     if (!CanBuy) {
@@ -0,0 +1,202 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+// NOTE static objects only (buildings), objects are not moving, so, we could rebuild whole
+//      hierarchy on any change, since changes are rare (objects appear and leave scene on scroll)
+
+#include "bounding_volume_hierarchy.h"
+#include <algorithm>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+// max objects quantity in leaf
+constexpr unsigned LeafObjectsCount{4};
+
+} // unnamed namespace
+
+
+/*
+ * Get object's AABB min point in world coordinates.
+ */
+static inline sVECTOR3D GetMinPoint(const cObject3D &Object)
+{
+    return Object.Location + Object.AABB[6];
+}
+
+/*
+ * Get object's AABB max point in world coordinates.
+ */
+static inline sVECTOR3D GetMaxPoint(const cObject3D &Object)
+{
+    return Object.Location + Object.AABB[0];
+}
+
+/*
+ * Rebuild hierarchy for objects (objects' AABB should be actual).
+ */
+void cBoundingVolumeHierarchy::Build(const std::vector<cObject3D *> &Objects)
+{
+    Clear();
+    if (Objects.empty()) {
+        return;
+    }
+
+    Objects_ = Objects;
+    Nodes_.reserve(2 * Objects_.size());
+    BuildNode(0, static_cast<unsigned>(Objects_.size()));
+}
+
+/*
+ * Release hierarchy.
+ */
+void cBoundingVolumeHierarchy::Clear()
+{
+    Nodes_.clear();
+    Objects_.clear();
+}
+
+/*
+ * Build node (and all subtree) for objects range, split by median of largest centroids axis.
+ */
+void cBoundingVolumeHierarchy::BuildNode(unsigned First, unsigned Count)
+{
+    unsigned NodeNum = static_cast<unsigned>(Nodes_.size());
+    Nodes_.emplace_back();
+    Nodes_[NodeNum].First = First;
+    Nodes_[NodeNum].Count = Count;
+
+    sVECTOR3D MinPoint{GetMinPoint(*Objects_[First])};
+    sVECTOR3D MaxPoint{GetMaxPoint(*Objects_[First])};
+    sVECTOR3D MinCenter{(MinPoint + MaxPoint) ^ 0.5f};
+    sVECTOR3D MaxCenter{MinCenter};
+    for (unsigned i = First + 1; i < First + Count; i++) {
+        sVECTOR3D ObjectMinPoint{GetMinPoint(*Objects_[i])};
+        sVECTOR3D ObjectMaxPoint{GetMaxPoint(*Objects_[i])};
+        sVECTOR3D ObjectCenter{(ObjectMinPoint + ObjectMaxPoint) ^ 0.5f};
+
+        MinPoint(std::min(MinPoint.x, ObjectMinPoint.x),
+                 std::min(MinPoint.y, ObjectMinPoint.y),
+                 std::min(MinPoint.z, ObjectMinPoint.z));
+        MaxPoint(std::max(MaxPoint.x, ObjectMaxPoint.x),
+                 std::max(MaxPoint.y, ObjectMaxPoint.y),
+                 std::max(MaxPoint.z, ObjectMaxPoint.z));
+        MinCenter(std::min(MinCenter.x, ObjectCenter.x),
+                  std::min(MinCenter.y, ObjectCenter.y),
+                  std::min(MinCenter.z, ObjectCenter.z));
+        MaxCenter(std::max(MaxCenter.x, ObjectCenter.x),
+                  std::max(MaxCenter.y, ObjectCenter.y),
+                  std::max(MaxCenter.z, ObjectCenter.z));
+    }
+    Nodes_[NodeNum].MinPoint = MinPoint;
+    Nodes_[NodeNum].MaxPoint = MaxPoint;
+
+    if (Count <= LeafObjectsCount) {
+        return;
+    }
+
+    sVECTOR3D Extent{MaxCenter - MinCenter};
+    int Axis{0};
+    if (Extent.y > Extent.x && Extent.y >= Extent.z) {
+        Axis = 1;
+    } else if (Extent.z > Extent.x && Extent.z > Extent.y) {
+        Axis = 2;
+    }
+
+    auto GetCenter = [Axis] (const cObject3D *Object) {
+        sVECTOR3D Center{(GetMinPoint(*Object) + GetMaxPoint(*Object)) ^ 0.5f};
+        switch (Axis) {
+        case 1:
+            return Center.y;
+        case 2:
+            return Center.z;
+        }
+        return Center.x;
+    };
+
+    unsigned Middle = First + Count / 2;
+    std::nth_element(Objects_.begin() + First, Objects_.begin() + Middle, Objects_.begin() + First + Count,
+                     [&GetCenter] (const cObject3D *A, const cObject3D *B) {
+        return GetCenter(A) < GetCenter(B);
+    });
+
+    BuildNode(First, Middle - First);
+    Nodes_[NodeNum].Right = static_cast<unsigned>(Nodes_.size());
+    BuildNode(Middle, First + Count - Middle);
+}
+
+/*
+ * Traverse hierarchy, call Visible() for each object with AABB, that pass BoxVisible() test,
+ * and Culled() for all other objects (whole subtrees are culled by node's AABB).
+ */
+void cBoundingVolumeHierarchy::Cull(cFunctionRef<bool (const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)> BoxVisible,
+                                    cFunctionRef<void (cObject3D &Object)> Visible,
+                                    cFunctionRef<void (cObject3D &Object)> Culled) const
+{
+    if (Nodes_.empty()) {
+        return;
+    }
+
+    CullNode(0, BoxVisible, Visible, Culled);
+}
+
+/*
+ * Cull node (and all subtree).
+ */
+void cBoundingVolumeHierarchy::CullNode(unsigned NodeNum,
+                                        cFunctionRef<bool (const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)> BoxVisible,
+                                        cFunctionRef<void (cObject3D &Object)> Visible,
+                                        cFunctionRef<void (cObject3D &Object)> Culled) const
+{
+    const sNode &Node = Nodes_[NodeNum];
+
+    if (!BoxVisible(Node.MinPoint, Node.MaxPoint)) {
+        for (unsigned i = Node.First; i < Node.First + Node.Count; i++) {
+            Culled(*Objects_[i]);
+        }
+        return;
+    }
+
+    if (!Node.Right) {
+        for (unsigned i = Node.First; i < Node.First + Node.Count; i++) {
+            if (BoxVisible(GetMinPoint(*Objects_[i]), GetMaxPoint(*Objects_[i]))) {
+                Visible(*Objects_[i]);
+            } else {
+                Culled(*Objects_[i]);
+            }
+        }
+        return;
+    }
+
+    CullNode(NodeNum + 1, BoxVisible, Visible, Culled);
+    CullNode(Node.Right, BoxVisible, Visible, Culled);
+}
+
+} // astromenace namespace
+} // viewizard namespace
@@ -0,0 +1,75 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+#ifndef OBJECT3D_BOUNDINGVOLUMEHIERARCHY_H
+#define OBJECT3D_BOUNDINGVOLUMEHIERARCHY_H
+
+#include "../core/core.h"
+#include "object3d.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+// Bounding volume hierarchy (AABB tree) for static objects culling.
+// Note, hierarchy don't own objects, caller should rebuild it on any object add, move or remove.
+class cBoundingVolumeHierarchy {
+public:
+    // Rebuild hierarchy for objects (objects' AABB should be actual).
+    void Build(const std::vector<cObject3D *> &Objects);
+    // Release hierarchy.
+    void Clear();
+    // Traverse hierarchy, call Visible() for each object with AABB, that pass BoxVisible() test,
+    // and Culled() for all other objects (whole subtrees are culled by node's AABB).
+    void Cull(cFunctionRef<bool (const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)> BoxVisible,
+              cFunctionRef<void (cObject3D &Object)> Visible,
+              cFunctionRef<void (cObject3D &Object)> Culled) const;
+
+private:
+    struct sNode {
+        sVECTOR3D MinPoint{0.0f, 0.0f, 0.0f};
+        sVECTOR3D MaxPoint{0.0f, 0.0f, 0.0f};
+        // subtree's objects range in Objects_
+        unsigned First{0};
+        unsigned Count{0};
+        // right child, 0 for leaf (left child is always next node)
+        unsigned Right{0};
+    };
+
+    void BuildNode(unsigned First, unsigned Count);
+    void CullNode(unsigned NodeNum,
+                  cFunctionRef<bool (const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint)> BoxVisible,
+                  cFunctionRef<void (cObject3D &Object)> Visible,
+                  cFunctionRef<void (cObject3D &Object)> Culled) const;
+
+    std::vector<sNode> Nodes_{};
+    std::vector<cObject3D *> Objects_{};
+};
+
+} // astromenace namespace
+} // viewizard namespace
+
+#endif // OBJECT3D_BOUNDINGVOLUMEHIERARCHY_H
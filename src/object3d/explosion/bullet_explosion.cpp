@@ -673,6 +673,11 @@ cBulletExplosion::cBulletExplosion(const cObject3D *Object, cProjectile &Project
             Chunks[i].IBO = 0;
             Chunks[i].VAO = 0;
             Chunks[i].NeedReleaseOpenGLBuffers = true; // this one should be released on destroy
+            // LOD related to source geometry, we change it here
+            Chunks[i].LODIndexArray.reset();
+            Chunks[i].LODIndexArrayCount = 0;
+            Chunks[i].LODIBO = 0;
+            Chunks[i].LODVAO = 0;
             Chunks[i].RangeStart = 0;
 
             if (GameConfig().UseGLSL120) {
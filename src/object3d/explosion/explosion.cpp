@@ -37,14 +37,116 @@
 namespace viewizard {
 namespace astromenace {
 
+enum class eExplosionGFXResize {
+    None,
+    Shrink, // exponentially shrink creation size and dead zone
+    Grow    // linearly grow creation size and dead zone
+};
+
+// Explosion type's per-frame behaviour, described once for each explosion type,
+// in order to avoid explosion type checks in each explosion update.
+struct sExplosionBehaviour {
+    int ExplosionTypeByClass;
+    int ExplosionType;
+    // suppress particle systems, when explosion's lifetime less than particles life
+    bool SuppressGFX;
+    // don't release particle systems on explosion end, but leave them to dissolve
+    bool KeepGFX;
+    // GraphicFX[0] and GraphicFX[1] resize
+    eExplosionGFXResize ResizeGFX[2];
+    // move GraphicFX[1] system location only, without particles
+    bool MoveSecondGFXLocationOnly;
+};
+
 namespace {
 
 // all explosion list
 std::list<std::unique_ptr<cExplosion, std::function<void (cExplosion *p)>>> ExplosionList{};
 
+// explosion type's behaviour records, types not listed here use class default
+const sExplosionBehaviour ExplosionBehaviours[]{
+    // space explosions
+    {1, 2, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, true},
+    // bullet explosions, missiles
+    {2, 16, true, true, {eExplosionGFXResize::Shrink, eExplosionGFXResize::None}, false},
+    {2, 17, true, true, {eExplosionGFXResize::Shrink, eExplosionGFXResize::None}, false},
+    {2, 18, true, true, {eExplosionGFXResize::Shrink, eExplosionGFXResize::None}, false},
+    {2, 19, true, true, {eExplosionGFXResize::Grow, eExplosionGFXResize::Shrink}, false},
+    {2, 205, true, true, {eExplosionGFXResize::Shrink, eExplosionGFXResize::None}, false},
+    {2, 206, true, true, {eExplosionGFXResize::Shrink, eExplosionGFXResize::None}, false},
+    {2, 209, true, true, {eExplosionGFXResize::Shrink, eExplosionGFXResize::None}, false},
+    {2, 210, true, true, {eExplosionGFXResize::Grow, eExplosionGFXResize::Shrink}, false},
+    // bullet explosions, mines
+    {2, 214, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, 215, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, 216, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, 217, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    // bullet explosions, missiles and mines end of life (negative type)
+    {2, -16, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -17, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -18, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -19, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -205, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -206, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -209, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -210, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -214, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -215, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -216, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false},
+    {2, -217, true, false, {eExplosionGFXResize::None, eExplosionGFXResize::None}, false}
+};
+
+// class defaults
+const sExplosionBehaviour SpaceExplosionBehaviour{1, 0, true, false,
+                                                  {eExplosionGFXResize::None, eExplosionGFXResize::None}, false};
+const sExplosionBehaviour DefaultExplosionBehaviour{0, 0, false, false,
+                                                    {eExplosionGFXResize::None, eExplosionGFXResize::None}, false};
+
 } // unnamed namespace
 
 
+/*
+ * Find explosion type's behaviour record.
+ */
+static const sExplosionBehaviour &FindExplosionBehaviour(int ExplosionTypeByClass, int ExplosionType)
+{
+    for (auto &tmpBehaviour : ExplosionBehaviours) {
+        if (tmpBehaviour.ExplosionTypeByClass == ExplosionTypeByClass
+            && tmpBehaviour.ExplosionType == ExplosionType) {
+            return tmpBehaviour;
+        }
+    }
+
+    if (ExplosionTypeByClass == 1) {
+        return SpaceExplosionBehaviour;
+    }
+    return DefaultExplosionBehaviour;
+}
+
+/*
+ * Resize explosion's particle system creation size and dead zone.
+ */
+static void ResizeExplosionGFX(cParticleSystem &ParticleSystem, eExplosionGFXResize Resize, float TimeDelta)
+{
+    switch (Resize) {
+    case eExplosionGFXResize::None:
+        break;
+
+    case eExplosionGFXResize::Shrink:
+        ParticleSystem.CreationSize.x -= ParticleSystem.CreationSize.x * TimeDelta;
+        ParticleSystem.CreationSize.z -= ParticleSystem.CreationSize.z * TimeDelta;
+        ParticleSystem.DeadZone -= ParticleSystem.DeadZone * TimeDelta;
+        break;
+
+    case eExplosionGFXResize::Grow:
+        ParticleSystem.CreationSize.x += 10.0f * TimeDelta;
+        ParticleSystem.CreationSize.z += 10.0f * TimeDelta;
+        ParticleSystem.DeadZone += 10.0f * TimeDelta;
+        break;
+    }
+}
+
+
 /*
  * Create cBulletExplosion object.
  */
@@ -460,16 +562,16 @@ cExplosion::~cExplosion()
  */
 bool cExplosion::Update(float Time)
 {
+    // resolved on first update, since explosion type is setup by derived class constructor
+    if (!Behaviour) {
+        Behaviour = &FindExplosionBehaviour(ExplosionTypeByClass, ExplosionType);
+    }
+
     if (!cObject3D::Update(Time)) {
         for (auto &tmpGFX : GraphicFX) {
             if (auto sharedGFX = tmpGFX.lock()) {
                 sharedGFX->StopAllParticles();
-
-                // FIXME why we need this in update? should be moved to initialization?
-                if (!(ExplosionTypeByClass == 2 && (ExplosionType == 16 || ExplosionType == 17
-                                                    || ExplosionType == 18 || ExplosionType == 19
-                                                    || ExplosionType == 205 || ExplosionType == 206
-                                                    || ExplosionType == 209 || ExplosionType == 210))) {
+                if (!Behaviour->KeepGFX) {
                     vw_ReleaseParticleSystem(sharedGFX);
                 }
             }
@@ -477,94 +579,6 @@ bool cExplosion::Update(float Time)
         return false;
     }
 
-    if (ExplosionTypeByClass == 1) { // FIXME why we need this on each update? should be moved to initialization?
-        for (auto &tmpGFX : GraphicFX) {
-            if (auto sharedGFX = tmpGFX.lock()) {
-                if (Lifetime < sharedGFX->Life) {
-                    sharedGFX->IsSuppressed = true;
-                }
-            }
-        }
-    }
-    if (ExplosionTypeByClass == 2) { // FIXME why we need this on each update? should be moved to initialization?
-        switch (ExplosionType) {
-        case -16:
-        case -17:
-        case -18:
-        case -19:
-        case -205:
-        case -206:
-        case -209:
-        case -210:
-        case -214:
-        case -215:
-        case -216:
-        case -217:
-        case 16:
-        case 17:
-        case 18:
-        case 19:
-        case 205:
-        case 206:
-        case 209:
-        case 210:
-        case 214:
-        case 215:
-        case 216:
-        case 217:
-            for (auto &tmpGFX : GraphicFX) {
-                if (auto sharedGFX = tmpGFX.lock()) {
-                    if (Lifetime < sharedGFX->Life) {
-                        sharedGFX->IsSuppressed = true;
-                    }
-                }
-            }
-            break;
-
-        default:
-            break;
-        }
-
-        switch (ExplosionType) {
-        case 16:
-        case 17:
-        case 205:
-        case 206:
-            if (auto sharedGFX = GraphicFX[0].lock()) {
-                sharedGFX->CreationSize.x -= sharedGFX->CreationSize.x * TimeDelta;
-                sharedGFX->CreationSize.z -= sharedGFX->CreationSize.z * TimeDelta;
-                sharedGFX->DeadZone -= sharedGFX->DeadZone * TimeDelta;
-            }
-            break;
-
-        case 18:
-        case 209:
-            if (auto sharedGFX = GraphicFX[0].lock()) {
-                sharedGFX->CreationSize.x -= sharedGFX->CreationSize.x * TimeDelta;
-                sharedGFX->CreationSize.z -= sharedGFX->CreationSize.z * TimeDelta;
-                sharedGFX->DeadZone -= sharedGFX->DeadZone * TimeDelta;
-            }
-            break;
-
-        case 19:
-        case 210:
-            if (auto sharedGFX = GraphicFX[0].lock()) {
-                sharedGFX->CreationSize.x += 10.0f * TimeDelta;
-                sharedGFX->CreationSize.z += 10.0f * TimeDelta;
-                sharedGFX->DeadZone += 10.0f * TimeDelta;
-            }
-            if (auto sharedGFX = GraphicFX[1].lock()) {
-                sharedGFX->CreationSize.x -= sharedGFX->CreationSize.x * TimeDelta;
-                sharedGFX->CreationSize.z -= sharedGFX->CreationSize.z * TimeDelta;
-                sharedGFX->DeadZone -= sharedGFX->DeadZone * TimeDelta;
-            }
-            break;
-
-        default:
-            break;
-        }
-    }
-
     if (!GameConfig().UseGLSL120) {
         if (ExplosionGeometryMoveLastTime == -1.0f) {
             ExplosionGeometryMoveLastTime = Time;
@@ -683,15 +697,18 @@ bool cExplosion::Update(float Time)
 
     for (unsigned int i = 0; i < GraphicFX.size(); i++) {
         if (auto sharedGFX = GraphicFX[i].lock()) {
+            if (Behaviour->SuppressGFX && Lifetime < sharedGFX->Life) {
+                sharedGFX->IsSuppressed = true;
+            }
+            if (i < 2) {
+                ResizeExplosionGFX(*sharedGFX, Behaviour->ResizeGFX[i], TimeDelta);
+            }
+
             sVECTOR3D tmpLocation{sharedGFX->GetLocation()};
             tmpLocation += TMP2;
 
-            if ((ExplosionTypeByClass == 1) && (ExplosionType == 2)) {
-                if (i == 1) {
-                    sharedGFX->MoveSystemLocation(tmpLocation);
-                } else {
-                    sharedGFX->MoveSystem(tmpLocation);
-                }
+            if (i == 1 && Behaviour->MoveSecondGFXLocationOnly) {
+                sharedGFX->MoveSystemLocation(tmpLocation);
             } else {
                 sharedGFX->MoveSystem(tmpLocation);
             }
@@ -40,6 +40,7 @@ namespace astromenace {
 
 class cProjectile;
 class cGroundObject;
+struct sExplosionBehaviour;
 
 struct sExplosionPiece {
     sVECTOR3D Velocity{};
@@ -52,6 +53,9 @@ protected:
     cExplosion();
     ~cExplosion();
 
+    cExplosion(const cExplosion &) = delete;
+    void operator = (const cExplosion &) = delete;
+
     // should be called in UpdateWithTimeSheetList() only
     virtual bool Update(float Time) override;
 
@@ -73,6 +77,10 @@ public:
     float AABBResizeSpeed{0.0f};
 
     std::vector<std::weak_ptr<cParticleSystem>> GraphicFX{};
+
+protected:
+    // explosion type's per-frame behaviour record
+    const sExplosionBehaviour *Behaviour{nullptr};
 };
 
 class cBulletExplosion final : public cExplosion {
@@ -451,6 +451,11 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
             Chunks[i].IBO = 0;
             Chunks[i].VAO = 0;
             Chunks[i].NeedReleaseOpenGLBuffers = true;
+            // LOD related to source geometry, we change it here
+            Chunks[i].LODIndexArray.reset();
+            Chunks[i].LODIndexArrayCount = 0;
+            Chunks[i].LODIBO = 0;
+            Chunks[i].LODVAO = 0;
             Chunks[i].RangeStart = 0;
             Chunks[i].IndexArray.reset();
             Chunks[i].VertexArrayWithSmallTriangles.reset();
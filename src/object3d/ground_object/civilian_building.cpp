@@ -61,6 +61,18 @@ const std::vector<sBuildingData> PresetBuildingData{
 } // unnamed namespace
 
 
+/*
+ * Get cCivilianBuilding model3d file name hash (0, if BuildingNum is wrong).
+ */
+unsigned GetCivilianBuildingModel3DHash(const int BuildingNum)
+{
+    if (BuildingNum <= 0 || static_cast<unsigned>(BuildingNum) > PresetBuildingData.size()) {
+        return 0;
+    }
+
+    return PresetBuildingData[BuildingNum - 1].Model3DFileNameHash;
+}
+
 /*
  * Constructor.
  */
@@ -75,6 +87,7 @@ cCivilianBuilding::cCivilianBuilding(const int BuildingNum)
     InternalType = BuildingNum;
     ShowStatus = false;
     PromptDrawDist2 = 100.0f;
+    StaticShadowCaster = true;
 
     LoadObjectData(PresetBuildingData[BuildingNum - 1].Model3DFileNameHash, *this);
 
@@ -26,9 +26,11 @@
 *****************************************************************************/
 
 #include "ground_object.h"
+#include "../bounding_volume_hierarchy.h"
 #include "../weapon/functions.h" // TODO code should be revised, weapon-related code should be in 'weapon' sources only
 #include "../../script/script.h"
 #include "../../config/config.h"
+#include "../../gfx/shadow_map.h"
 #include <cmath>
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
@@ -42,6 +44,12 @@ constexpr float Epsilon{0.0001f};
 
 // all ground object list
 std::list<std::shared_ptr<cGroundObject>> GroundObjectList{};
+// static shadow casters revision
+unsigned StaticGroundObjectsRevision{0};
+// hierarchy for static ground objects culling
+cBoundingVolumeHierarchy StaticGroundObjectsBVH{};
+// static shadow casters revision, hierarchy was built for
+unsigned StaticGroundObjectsBVHRevision{0};
 
 } // unnamed namespace
 
@@ -54,6 +62,9 @@ std::weak_ptr<cGroundObject> CreateCivilianBuilding(const int BuildingNum)
     // NOTE emplace_front() return reference to the inserted element (since C++17)
     //      this two lines could be combined
     GroundObjectList.emplace_front(new cCivilianBuilding{BuildingNum}, [](cCivilianBuilding *p) {delete p;});
+    if (GroundObjectList.front()->StaticShadowCaster) {
+        StaticGroundObjectsRevision++;
+    }
     return GroundObjectList.front();
 }
 
@@ -105,16 +116,97 @@ void UpdateAllGroundObjects(float Time)
     }
 }
 
+/*
+ * Rebuild static ground objects hierarchy, if static objects were added, moved or removed.
+ */
+static void UpdateStaticGroundObjectsBVH()
+{
+    if (StaticGroundObjectsBVHRevision == StaticGroundObjectsRevision) {
+        return;
+    }
+
+    std::vector<cObject3D *> StaticObjects{};
+    for (auto &tmpObject : GroundObjectList) {
+        if (tmpObject.get()->StaticShadowCaster) {
+            tmpObject.get()->UpdateBounds();
+            StaticObjects.push_back(tmpObject.get());
+        }
+    }
+    StaticGroundObjectsBVH.Build(StaticObjects);
+    StaticGroundObjectsBVHRevision = StaticGroundObjectsRevision;
+}
+
+/*
+ * Draw static ground objects, culled by hierarchy (light's frustum for vertex only pass).
+ */
+static void DrawStaticGroundObjects(bool VertexOnlyPass, bool ShadowMap)
+{
+    UpdateStaticGroundObjectsBVH();
+
+    if (VertexOnlyPass) {
+        StaticGroundObjectsBVH.Cull([] (const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint) {
+                                        return ShadowMap_BoxInLightFrustum(MinPoint, MaxPoint);
+                                    },
+                                    [] (cObject3D &Object) {
+                                        Object.Draw(true, false);
+                                    },
+                                    [] (cObject3D &) {});
+        return;
+    }
+
+    StaticGroundObjectsBVH.Cull([] (const sVECTOR3D &MinPoint, const sVECTOR3D &MaxPoint) {
+                                    return vw_BoxInFrustum(MinPoint, MaxPoint);
+                                },
+                                [&ShadowMap] (cObject3D &Object) {
+                                    Object.Draw(false, ShadowMap);
+                                },
+                                [] (cObject3D &Object) {
+                                    Object.CulledByFrustum();
+                                });
+}
+
 /*
  * Draw all ground objects.
  */
 void DrawAllGroundObjects(bool VertexOnlyPass, unsigned int ShadowMap)
 {
+    DrawStaticGroundObjects(VertexOnlyPass, ShadowMap);
+
     for (auto &tmpObject : GroundObjectList) {
-        tmpObject.get()->Draw(VertexOnlyPass, ShadowMap);
+        if (!tmpObject.get()->StaticShadowCaster) {
+            tmpObject.get()->Draw(VertexOnlyPass, ShadowMap);
+        }
     }
 }
 
+/*
+ * Draw ground objects for shadow map (vertex only pass).
+ */
+void DrawAllGroundObjectsShadowCasters(eGroundCasters Casters)
+{
+    if (Casters != eGroundCasters::Dynamic) {
+        DrawStaticGroundObjects(true, false);
+    }
+
+    if (Casters == eGroundCasters::Static) {
+        return;
+    }
+
+    for (auto &tmpObject : GroundObjectList) {
+        if (!tmpObject.get()->StaticShadowCaster) {
+            tmpObject.get()->Draw(true, false);
+        }
+    }
+}
+
+/*
+ * Get static shadow casters revision (changed on any static shadow caster add, move or remove).
+ */
+unsigned GetStaticGroundObjectsRevision()
+{
+    return StaticGroundObjectsRevision;
+}
+
 /*
  * Release particular ground object.
  */
@@ -140,13 +232,14 @@ void ReleaseGroundObject(std::weak_ptr<cGroundObject> &Object)
 void ReleaseAllGroundObjects()
 {
     GroundObjectList.clear();
+    StaticGroundObjectsBVH.Clear();
 }
 
 /*
  * Cycle for each ground object.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachGroundObject(std::function<void (cGroundObject &Object)> function)
+void ForEachGroundObject(cFunctionRef<void (cGroundObject &Object)> function)
 {
     for (auto &tmpGround : GroundObjectList) {
         function(*tmpGround);
@@ -157,7 +250,7 @@ void ForEachGroundObject(std::function<void (cGroundObject &Object)> function)
  * Managed cycle for each ground object.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachGroundObject(std::function<void (cGroundObject &Object, eGroundCycle &Command)> function)
+void ForEachGroundObject(cFunctionRef<void (cGroundObject &Object, eGroundCycle &Command)> function)
 {
     // NOTE use std::erase_if here (since C++20)
     for (auto iter = GroundObjectList.begin(); iter != GroundObjectList.end();) {
@@ -200,6 +293,17 @@ std::weak_ptr<cObject3D> GetGroundObjectPtr(const cGroundObject &Object)
 cGroundObject::cGroundObject()
 {
     ObjectStatus = eObjectStatus::Enemy;
+    CanDeferBoundsUpdate = true;
+}
+
+/*
+ * Destructor.
+ */
+cGroundObject::~cGroundObject()
+{
+    if (StaticShadowCaster) {
+        StaticGroundObjectsRevision++;
+    }
 }
 
 /*
@@ -209,6 +313,10 @@ void cGroundObject::SetLocation(const sVECTOR3D &NewLocation)
 {
     cObject3D::SetLocation(NewLocation);
 
+    if (StaticShadowCaster) {
+        StaticGroundObjectsRevision++;
+    }
+
     if (!WeaponSlots.empty()) {
         for (auto &tmpWeaponSlot : WeaponSlots) {
             if (auto sharedWeapon = tmpWeaponSlot.Weapon.lock()) {
@@ -225,6 +333,10 @@ void cGroundObject::SetRotation(const sVECTOR3D &NewRotation)
 {
     cObject3D::SetRotation(NewRotation);
 
+    if (StaticShadowCaster) {
+        StaticGroundObjectsRevision++;
+    }
+
     sVECTOR3D RotationBase = Rotation;
     sVECTOR3D BaseBoundTMP = BaseBound;
     vw_RotatePoint(BaseBoundTMP, RotationBase);
@@ -271,19 +383,17 @@ bool cGroundObject::Update(float Time)
         return false;
     }
 
-    if (!TimeSheetList.empty() && !TimeSheetList.front().InUse) {
-        TimeSheetList.front().InUse = true;
-
-        NeedSpeed = TimeSheetList.front().Speed;
-        NeedAcceler = TimeSheetList.front().Acceler;
-        NeedRotate = TimeSheetList.front().Rotation;
-        RotationSpeed = TimeSheetList.front().RotationAcceler;
-        WeaponTargeting = TimeSheetList.front().Targeting;
+    if (const sTimeSheet *TimeSheet = GetNewTimeSheet()) {
+        NeedSpeed = TimeSheet->Speed;
+        NeedAcceler = TimeSheet->Acceler;
+        NeedRotate = TimeSheet->Rotation;
+        RotationSpeed = TimeSheet->RotationAcceler;
+        WeaponTargeting = TimeSheet->Targeting;
 
         if (!WeaponSlots.empty()) {
             for (auto &tmpWeaponSlot : WeaponSlots) {
                 if (!tmpWeaponSlot.Weapon.expired()) {
-                    tmpWeaponSlot.SetFire = TimeSheetList.front().Fire;
+                    tmpWeaponSlot.SetFire = TimeSheet->Fire;
                 }
             }
         }
@@ -44,6 +44,12 @@
 namespace viewizard {
 namespace astromenace {
 
+enum class eGroundCasters {
+    All,
+    Static,     // static shadow casters only
+    Dynamic     // all, except static shadow casters
+};
+
 enum class eGroundCycle {
     Continue,
     Break,
@@ -78,7 +84,7 @@ class cGroundObject : public cObject3D {
 protected:
     // don't allow object of this class creation
     cGroundObject();
-    ~cGroundObject() = default;
+    ~cGroundObject();
 
     // should be called in UpdateWithTimeSheetList() only
     virtual bool Update(float Time) override;
@@ -87,6 +93,9 @@ public:
     virtual void SetLocation(const sVECTOR3D &NewLocation) override;
     virtual void SetRotation(const sVECTOR3D &NewRotation) override;
 
+    // object never move, so, could be cached in shadow map static casters depth
+    bool StaticShadowCaster{false};
+
     // rotary speed (deg/sec) for all wheels (for both, wheeled and tracked)
     float WheelRotarySpeed{0.0f};
     float SpeedToWheelRotarySpeedFactor{0.0f};
@@ -183,20 +192,32 @@ std::weak_ptr<cGroundObject> CreateMilitaryBuilding(const int MilitaryBuildingNu
 std::weak_ptr<cGroundObject> CreateTracked(const int TrackedNum);
 // Create cWheeled object.
 std::weak_ptr<cGroundObject> CreateWheeled(const int WheeledNum);
+// Get cCivilianBuilding model3d file name hash (0, if BuildingNum is wrong).
+unsigned GetCivilianBuildingModel3DHash(const int BuildingNum);
+// Get cMilitaryBuilding model3d file name hash (0, if MilitaryBuildingNum is wrong).
+unsigned GetMilitaryBuildingModel3DHash(const int MilitaryBuildingNum);
+// Get cTracked model3d file name hash (0, if TrackedNum is wrong).
+unsigned GetTrackedModel3DHash(const int TrackedNum);
+// Get cWheeled model3d file name hash (0, if WheeledNum is wrong).
+unsigned GetWheeledModel3DHash(const int WheeledNum);
 // Update and remove (erase) dead objects.
 void UpdateAllGroundObjects(float Time);
 // Draw all ground objects.
 void DrawAllGroundObjects(bool VertexOnlyPass, unsigned int ShadowMap);
+// Draw ground objects for shadow map (vertex only pass).
+void DrawAllGroundObjectsShadowCasters(eGroundCasters Casters);
+// Get static shadow casters revision (changed on any static shadow caster add, move or remove).
+unsigned GetStaticGroundObjectsRevision();
 // Release particular ground object.
 void ReleaseGroundObject(std::weak_ptr<cGroundObject> &Object);
 // Release all ground objects.
 void ReleaseAllGroundObjects();
 // Cycle for each ground object.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachGroundObject(std::function<void (cGroundObject &Object)> function);
+void ForEachGroundObject(cFunctionRef<void (cGroundObject &Object)> function);
 // Managed cycle for each ground object.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachGroundObject(std::function<void (cGroundObject &Object, eGroundCycle &Command)> function);
+void ForEachGroundObject(cFunctionRef<void (cGroundObject &Object, eGroundCycle &Command)> function);
 // Get object ptr by reference.
 std::weak_ptr<cObject3D> GetGroundObjectPtr(const cGroundObject &Object);
 
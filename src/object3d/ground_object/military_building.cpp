@@ -50,6 +50,18 @@ const std::vector<sMilitaryBuildingData> PresetMilitaryBuildingData {
 };
 
 
+/*
+ * Get cMilitaryBuilding model3d file name hash (0, if MilitaryBuildingNum is wrong).
+ */
+unsigned GetMilitaryBuildingModel3DHash(const int MilitaryBuildingNum)
+{
+    if (MilitaryBuildingNum <= 0 || static_cast<unsigned>(MilitaryBuildingNum) > PresetMilitaryBuildingData.size()) {
+        return 0;
+    }
+
+    return PresetMilitaryBuildingData[MilitaryBuildingNum - 1].Model3DFileNameHash;
+}
+
 /*
  * Constructor.
  */
@@ -58,6 +58,18 @@ const std::vector<sTrackedData> PresetTrackedData{
 };
 
 
+/*
+ * Get cTracked model3d file name hash (0, if TrackedNum is wrong).
+ */
+unsigned GetTrackedModel3DHash(const int TrackedNum)
+{
+    if (TrackedNum <= 0 || static_cast<unsigned>(TrackedNum) > PresetTrackedData.size()) {
+        return 0;
+    }
+
+    return PresetTrackedData[TrackedNum - 1].Model3DFileNameHash;
+}
+
 /*
  * Constructor.
  */
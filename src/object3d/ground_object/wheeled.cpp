@@ -52,6 +52,18 @@ const std::vector<sWheeledData> PresetWheeledData {
 };
 
 
+/*
+ * Get cWheeled model3d file name hash (0, if WheeledNum is wrong).
+ */
+unsigned GetWheeledModel3DHash(const int WheeledNum)
+{
+    if (WheeledNum <= 0 || static_cast<unsigned>(WheeledNum) > PresetWheeledData.size()) {
+        return 0;
+    }
+
+    return PresetWheeledData[WheeledNum - 1].Model3DFileNameHash;
+}
+
 /*
  * Constructor.
  */
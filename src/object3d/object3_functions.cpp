@@ -119,6 +119,10 @@ void LoadObjectData(unsigned FileNameHash, cObject3D &Object3D)
     Object3D.GlobalIndexArrayCount = sharedModel->GlobalIndexArrayCount;
     Object3D.GlobalIBO = sharedModel->GlobalIBO;
     Object3D.GlobalVAO = sharedModel->GlobalVAO;
+    Object3D.GlobalLODIndexArray = sharedModel->GlobalLODIndexArray;
+    Object3D.GlobalLODIndexArrayCount = sharedModel->GlobalLODIndexArrayCount;
+    Object3D.GlobalLODIBO = sharedModel->GlobalLODIBO;
+    Object3D.GlobalLODVAO = sharedModel->GlobalLODVAO;
     Object3D.Chunks = sharedModel->Chunks;
 
     Object3D.Texture.resize(Object3D.Chunks.size(), 0);
@@ -44,6 +44,14 @@ namespace astromenace {
 namespace {
 
 eRenderBoundingBoxes BBRenderMode{eRenderBoundingBoxes::None};
+// current simulation step number, 0 reserved for objects without location changes
+unsigned SimulationStepNumber{1};
+// interpolation factor between previous and current simulation steps, 1.0f - current step only
+float InterpolationFactor{1.0f};
+// projected on screen radius (in pixels), below which objects are rendered with LOD
+constexpr float LODScreenRadius{24.0f};
+// 1/tan(fovy/2), we use 45 degree field of view for all 3D scenes (see vw_ResizeScene() calls)
+constexpr float ProjectionScale{2.4142135f};
 
 } // unnamed namespace
 
@@ -54,249 +62,225 @@ extern std::weak_ptr<cGLSL> GLSLShaderType3;
 
 
 /*
- * Set chunk location.
+ * Calculate AABB by OBB.
  */
-void cObject3D::SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum)
+static void CalculateAABB(const sOBB &OBB, bounding_box &AABB)
 {
-    if (!HitBB.empty()) {
-        float OldInvRotationMatTmp[9];
-        memcpy(OldInvRotationMatTmp, CurrentRotationMat, 9 * sizeof(CurrentRotationMat[0]));
-        vw_Matrix33InverseRotate(OldInvRotationMatTmp);
-
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, OldInvRotationMatTmp);
-        HitBB[ChunkNum].Location -= Chunks[ChunkNum].Location - NewLocation;
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, CurrentRotationMat);
+    float MinX = 10000.0f;
+    float MaxX = -10000.0f;
+    float MinY = 10000.0f;
+    float MaxY = -10000.0f;
+    float MinZ = 10000.0f;
+    float MaxZ = -10000.0f;
+    for (int j = 0; j < 8; j++) {
+        if (MinX > OBB.Box[j].x + OBB.Location.x) {
+            MinX = OBB.Box[j].x + OBB.Location.x;
+        }
+        if (MinY > OBB.Box[j].y + OBB.Location.y) {
+            MinY = OBB.Box[j].y + OBB.Location.y;
+        }
+        if (MinZ > OBB.Box[j].z + OBB.Location.z) {
+            MinZ = OBB.Box[j].z + OBB.Location.z;
+        }
+        if (MaxX < OBB.Box[j].x + OBB.Location.x) {
+            MaxX = OBB.Box[j].x + OBB.Location.x;
+        }
+        if (MaxY < OBB.Box[j].y + OBB.Location.y) {
+            MaxY = OBB.Box[j].y + OBB.Location.y;
+        }
+        if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
+            MaxZ = OBB.Box[j].z + OBB.Location.z;
+        }
+    }
+    AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
+    AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
+    AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
+    AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
+    AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
+    AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
+    AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
+    AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
+}
 
-        float MinX = 10000.0f;
-        float MaxX = -10000.0f;
-        float MinY = 10000.0f;
-        float MaxY = -10000.0f;
-        float MinZ = 10000.0f;
-        float MaxZ = -10000.0f;
+/*
+ * Rotate bounding box by matrix.
+ */
+static void RotateBoundingBox(bounding_box &Box, sVECTOR3D &Location, const float (&Matrix33)[9])
+{
+    vw_Matrix33CalcPoint(Location, Matrix33);
+    for (auto &tmpPoint : Box) {
+        vw_Matrix33CalcPoint(tmpPoint, Matrix33);
+    }
+}
 
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            vw_Matrix33CalcPoint(HitBB[i].Location, OldInvRotationMatTmp);
+/*
+ * Update chunks' HitBB with pending chunks' location and rotation changes,
+ * recalculate OBB by HitBB. All bounding boxes should be in object's local space.
+ */
+void cObject3D::UpdateChunksBounds()
+{
+    for (unsigned int i = 0; i < Chunks.size(); i++) {
+        sBoundsChunk &tmpBoundsChunk = BoundsChunks_[i];
+        if (tmpBoundsChunk.Location == Chunks[i].Location &&
+            tmpBoundsChunk.Rotation == Chunks[i].Rotation) {
+            continue;
+        }
 
-            for (int j = 0; j < 8; j++) {
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], OldInvRotationMatTmp);
+        float OldInvRotationMatTmp[9];
+        vw_Matrix33CreateRotate(OldInvRotationMatTmp, tmpBoundsChunk.Rotation);
+        vw_Matrix33InverseRotate(OldInvRotationMatTmp);
+        float CurrentRotationMatTmp[9];
+        vw_Matrix33CreateRotate(CurrentRotationMatTmp, Chunks[i].Rotation);
 
-                if (MinX > HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MinX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MaxX < HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MaxX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MinY > HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MinY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MaxY < HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MaxY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MinZ > HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MinZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
-                if (MaxZ < HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MaxZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
+        // rotate HitBB around chunk's location
+        HitBB[i].Location -= tmpBoundsChunk.Location;
+        RotateBoundingBox(HitBB[i].Box, HitBB[i].Location, OldInvRotationMatTmp);
+        RotateBoundingBox(HitBB[i].Box, HitBB[i].Location, CurrentRotationMatTmp);
+        HitBB[i].Location += Chunks[i].Location;
 
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], CurrentRotationMat);
-            }
-            vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
-        }
+        tmpBoundsChunk.Location = Chunks[i].Location;
+        tmpBoundsChunk.Rotation = Chunks[i].Rotation;
+    }
 
-        OBB.Box[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        OBB.Box[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        OBB.Box[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        OBB.Box[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        OBB.Box[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        OBB.Box[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        OBB.Box[6] = sVECTOR3D{MinX, MinY, MinZ};
-        OBB.Box[7] = sVECTOR3D{MaxX, MinY, MinZ};
-
-        Width = fabsf(MaxX - MinX);
-        Height = fabsf(MaxY - MinY);
-        Length = fabsf(MaxZ - MinZ);
-
-        float Width2 = Width / 2.0f;
-        float Length2 = Length / 2.0f;
-        float Height2 = Height / 2.0f;
-        Radius = vw_sqrtf(Width2 * Width2 + Length2 * Length2 + Height2 * Height2);
-
-        OBB.Location.x = (MaxX + MinX) / 2.0f;
-        OBB.Location.y = (MaxY + MinY) / 2.0f;
-        OBB.Location.z = (MaxZ + MinZ) / 2.0f;
-
-        for (int k = 0; k < 8; k++) {
-            OBB.Box[k] -= OBB.Location;
-            vw_Matrix33CalcPoint(OBB.Box[k], CurrentRotationMat);
-        }
-        vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
+    float MinX = 10000.0f;
+    float MaxX = -10000.0f;
+    float MinY = 10000.0f;
+    float MaxY = -10000.0f;
+    float MinZ = 10000.0f;
+    float MaxZ = -10000.0f;
 
-        MinX = MaxX = OBB.Box[0].x + OBB.Location.x;
-        MinY = MaxY = OBB.Box[0].y + OBB.Location.y;
-        MinZ = MaxZ = OBB.Box[0].z + OBB.Location.z;
+    for (unsigned int i = 0; i < Chunks.size(); i++) {
         for (int j = 0; j < 8; j++) {
-            if (MinX > OBB.Box[j].x + OBB.Location.x) {
-                MinX = OBB.Box[j].x + OBB.Location.x;
+            if (MinX > HitBB[i].Box[j].x + HitBB[i].Location.x) {
+                MinX = HitBB[i].Box[j].x + HitBB[i].Location.x;
             }
-            if (MinY > OBB.Box[j].y + OBB.Location.y) {
-                MinY = OBB.Box[j].y + OBB.Location.y;
+            if (MaxX < HitBB[i].Box[j].x + HitBB[i].Location.x) {
+                MaxX = HitBB[i].Box[j].x + HitBB[i].Location.x;
             }
-            if (MinZ > OBB.Box[j].z + OBB.Location.z) {
-                MinZ = OBB.Box[j].z + OBB.Location.z;
+            if (MinY > HitBB[i].Box[j].y + HitBB[i].Location.y) {
+                MinY = HitBB[i].Box[j].y + HitBB[i].Location.y;
             }
-            if (MaxX < OBB.Box[j].x + OBB.Location.x) {
-                MaxX = OBB.Box[j].x + OBB.Location.x;
+            if (MaxY < HitBB[i].Box[j].y + HitBB[i].Location.y) {
+                MaxY = HitBB[i].Box[j].y + HitBB[i].Location.y;
             }
-            if (MaxY < OBB.Box[j].y + OBB.Location.y) {
-                MaxY = OBB.Box[j].y + OBB.Location.y;
+            if (MinZ > HitBB[i].Box[j].z + HitBB[i].Location.z) {
+                MinZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
             }
-            if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
-                MaxZ = OBB.Box[j].z + OBB.Location.z;
+            if (MaxZ < HitBB[i].Box[j].z + HitBB[i].Location.z) {
+                MaxZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
             }
         }
-        AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
-        AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
     }
 
-    Chunks[ChunkNum].Location = NewLocation;
+    OBB.Box[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
+    OBB.Box[1] = sVECTOR3D{MinX, MaxY, MaxZ};
+    OBB.Box[2] = sVECTOR3D{MinX, MaxY, MinZ};
+    OBB.Box[3] = sVECTOR3D{MaxX, MaxY, MinZ};
+    OBB.Box[4] = sVECTOR3D{MaxX, MinY, MaxZ};
+    OBB.Box[5] = sVECTOR3D{MinX, MinY, MaxZ};
+    OBB.Box[6] = sVECTOR3D{MinX, MinY, MinZ};
+    OBB.Box[7] = sVECTOR3D{MaxX, MinY, MinZ};
+
+    Width = fabsf(MaxX - MinX);
+    Height = fabsf(MaxY - MinY);
+    Length = fabsf(MaxZ - MinZ);
+
+    float Width2 = Width / 2.0f;
+    float Length2 = Length / 2.0f;
+    float Height2 = Height / 2.0f;
+    Radius = vw_sqrtf(Width2 * Width2 + Length2 * Length2 + Height2 * Height2);
+
+    OBB.Location.x = (MaxX + MinX) / 2.0f;
+    OBB.Location.y = (MaxY + MinY) / 2.0f;
+    OBB.Location.z = (MaxZ + MinZ) / 2.0f;
+
+    for (int k = 0; k < 8; k++) {
+        OBB.Box[k] -= OBB.Location;
+    }
 }
 
 /*
- * Set chunk rotation.
+ * Update bounding boxes (OBB, HitBB and AABB) with pending object's and chunks' changes.
+ * Bounding boxes are moved into object's local space by rotation matrix they were calculated
+ * with, so, any number of rotation changes cost one bounding boxes recalculation.
  */
-void cObject3D::SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum)
+void cObject3D::UpdateBounds()
 {
-    if (!HitBB.empty()) {
-        float CurrentRotationMatTmp2[9];
-        vw_Matrix33CreateRotate(CurrentRotationMatTmp2, NewRotation);
+    if (!BoundsDirty_) {
+        return;
+    }
+    BoundsDirty_ = false;
 
-        float OldInvRotationMatTmp2[9];
-        vw_Matrix33CreateRotate(OldInvRotationMatTmp2, Chunks[ChunkNum].Rotation);
-        vw_Matrix33InverseRotate(OldInvRotationMatTmp2);
+    float InvBoundsRotationMat[9];
+    memcpy(InvBoundsRotationMat, BoundsRotationMat_, 9 * sizeof(BoundsRotationMat_[0]));
+    vw_Matrix33InverseRotate(InvBoundsRotationMat);
 
-        float OldInvRotationMatTmp[9];
-        memcpy(OldInvRotationMatTmp, CurrentRotationMat, 9 * sizeof(CurrentRotationMat[0]));
-        vw_Matrix33InverseRotate(OldInvRotationMatTmp);
+    for (auto &tmpHitBB : HitBB) {
+        RotateBoundingBox(tmpHitBB.Box, tmpHitBB.Location, InvBoundsRotationMat);
+    }
+    RotateBoundingBox(OBB.Box, OBB.Location, InvBoundsRotationMat);
 
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, OldInvRotationMatTmp);
-        HitBB[ChunkNum].Location -= Chunks[ChunkNum].Location;
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, OldInvRotationMatTmp2);
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, CurrentRotationMatTmp2);
-        HitBB[ChunkNum].Location += Chunks[ChunkNum].Location;
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, CurrentRotationMat);
-        for (int j = 0; j < 8; j++) {
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], OldInvRotationMatTmp);
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], OldInvRotationMatTmp2);
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], CurrentRotationMatTmp2);
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], CurrentRotationMat);
-        }
+    if (ChunksBoundsDirty_) {
+        ChunksBoundsDirty_ = false;
+        UpdateChunksBounds();
+    }
 
-        float MinX = 10000.0f;
-        float MaxX = -10000.0f;
-        float MinY = 10000.0f;
-        float MaxY = -10000.0f;
-        float MinZ = 10000.0f;
-        float MaxZ = -10000.0f;
+    for (auto &tmpHitBB : HitBB) {
+        RotateBoundingBox(tmpHitBB.Box, tmpHitBB.Location, CurrentRotationMat);
+    }
+    RotateBoundingBox(OBB.Box, OBB.Location, CurrentRotationMat);
 
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            vw_Matrix33CalcPoint(HitBB[i].Location, OldInvRotationMatTmp);
+    CalculateAABB(OBB, AABB);
 
-            for (int j = 0; j < 8; j++) {
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], OldInvRotationMatTmp);
+    memcpy(BoundsRotationMat_, CurrentRotationMat, 9 * sizeof(CurrentRotationMat[0]));
+}
 
-                if (MinX > HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MinX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MaxX < HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MaxX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MinY > HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MinY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MaxY < HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MaxY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MinZ > HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MinZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
-                if (MaxZ < HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MaxZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
+/*
+ * Mark chunks' bounding boxes as changed.
+ */
+void cObject3D::MarkChunksBoundsDirty()
+{
+    if (HitBB.empty()) {
+        return;
+    }
 
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], CurrentRotationMat);
-            }
-            vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
+    // HitBB are related to current chunks' location and rotation
+    if (BoundsChunks_.empty()) {
+        BoundsChunks_.resize(Chunks.size());
+        for (unsigned int i = 0; i < Chunks.size(); i++) {
+            BoundsChunks_[i].Location = Chunks[i].Location;
+            BoundsChunks_[i].Rotation = Chunks[i].Rotation;
         }
+    }
 
-        OBB.Box[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        OBB.Box[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        OBB.Box[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        OBB.Box[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        OBB.Box[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        OBB.Box[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        OBB.Box[6] = sVECTOR3D{MinX, MinY, MinZ};
-        OBB.Box[7] = sVECTOR3D{MaxX, MinY, MinZ};
-
-        Width = fabsf(MaxX - MinX);
-        Height = fabsf(MaxY - MinY);
-        Length = fabsf(MaxZ - MinZ);
-
-        float Width2 = Width / 2.0f;
-        float Length2 = Length / 2.0f;
-        float Height2 = Height / 2.0f;
-        Radius = vw_sqrtf(Width2 * Width2 + Length2 * Length2 + Height2 * Height2);
-
-        OBB.Location.x = (MaxX + MinX) / 2.0f;
-        OBB.Location.y = (MaxY + MinY) / 2.0f;
-        OBB.Location.z = (MaxZ + MinZ) / 2.0f;
-
-        for (int k = 0; k < 8; k++) {
-            OBB.Box[k] -= OBB.Location;
-            vw_Matrix33CalcPoint(OBB.Box[k], CurrentRotationMat);
-        }
-        vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
+    ChunksBoundsDirty_ = true;
+    BoundsDirty_ = true;
+}
 
-        MinX = MaxX = OBB.Box[0].x + OBB.Location.x;
-        MinY = MaxY = OBB.Box[0].y + OBB.Location.y;
-        MinZ = MaxZ = OBB.Box[0].z + OBB.Location.z;
-        for (int j = 0; j < 8; j++) {
-            if (MinX > OBB.Box[j].x + OBB.Location.x) {
-                MinX = OBB.Box[j].x + OBB.Location.x;
-            }
-            if (MinY > OBB.Box[j].y + OBB.Location.y) {
-                MinY = OBB.Box[j].y + OBB.Location.y;
-            }
-            if (MinZ > OBB.Box[j].z + OBB.Location.z) {
-                MinZ = OBB.Box[j].z + OBB.Location.z;
-            }
-            if (MaxX < OBB.Box[j].x + OBB.Location.x) {
-                MaxX = OBB.Box[j].x + OBB.Location.x;
-            }
-            if (MaxY < OBB.Box[j].y + OBB.Location.y) {
-                MaxY = OBB.Box[j].y + OBB.Location.y;
-            }
-            if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
-                MaxZ = OBB.Box[j].z + OBB.Location.z;
-            }
-        }
-        AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
-        AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
+/*
+ * Set chunk location.
+ */
+void cObject3D::SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum)
+{
+    MarkChunksBoundsDirty();
+    Chunks[ChunkNum].Location = NewLocation;
+
+    if (!DeferBoundsUpdate_) {
+        UpdateBounds();
     }
+}
 
+/*
+ * Set chunk rotation.
+ */
+void cObject3D::SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum)
+{
+    MarkChunksBoundsDirty();
     Chunks[ChunkNum].Rotation = NewRotation;
+
+    if (!DeferBoundsUpdate_) {
+        UpdateBounds();
+    }
 }
 
 /*
@@ -304,6 +288,13 @@ void cObject3D::SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum
  */
 void cObject3D::SetLocation(const sVECTOR3D &NewLocation)
 {
+    // store location before first change in this simulation step, for new object
+    // don't interpolate from default location
+    if (StepStartNumber != SimulationStepNumber) {
+        StepStartLocation = StepStartNumber ? Location : NewLocation;
+        StepStartNumber = SimulationStepNumber;
+    }
+
     PrevLocation = Location;
     Location = NewLocation;
 }
@@ -323,60 +314,10 @@ void cObject3D::SetRotation(const sVECTOR3D &NewRotation)
     vw_Matrix33CalcPoint(Orientation, OldInvRotationMat);
     vw_Matrix33CalcPoint(Orientation, CurrentRotationMat);
 
-    if (!HitBB.empty()) {
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            vw_Matrix33CalcPoint(HitBB[i].Location, OldInvRotationMat);
-            vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
-
-            for (int j = 0; j < 8; j++) {
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], OldInvRotationMat);
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], CurrentRotationMat);
-            }
-        }
-    }
-
-    vw_Matrix33CalcPoint(OBB.Location, OldInvRotationMat);
-    vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
-    for (int j = 0; j < 8; j++) {
-        vw_Matrix33CalcPoint(OBB.Box[j], OldInvRotationMat);
-        vw_Matrix33CalcPoint(OBB.Box[j], CurrentRotationMat);
+    BoundsDirty_ = true;
+    if (!DeferBoundsUpdate_) {
+        UpdateBounds();
     }
-
-    float MinX = 10000.0f;
-    float MaxX = -10000.0f;
-    float MinY = 10000.0f;
-    float MaxY = -10000.0f;
-    float MinZ = 10000.0f;
-    float MaxZ = -10000.0f;
-    for (int j = 0; j < 8; j++) {
-        if (MinX > OBB.Box[j].x + OBB.Location.x) {
-            MinX = OBB.Box[j].x + OBB.Location.x;
-        }
-        if (MinY > OBB.Box[j].y + OBB.Location.y) {
-            MinY = OBB.Box[j].y + OBB.Location.y;
-        }
-        if (MinZ > OBB.Box[j].z + OBB.Location.z) {
-            MinZ = OBB.Box[j].z + OBB.Location.z;
-        }
-        if (MaxX < OBB.Box[j].x + OBB.Location.x) {
-            MaxX = OBB.Box[j].x + OBB.Location.x;
-        }
-        if (MaxY < OBB.Box[j].y + OBB.Location.y) {
-            MaxY = OBB.Box[j].y + OBB.Location.y;
-        }
-        if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
-            MaxZ = OBB.Box[j].z + OBB.Location.z;
-        }
-    }
-    AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-    AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-    AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
-    AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-    AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-    AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
-    AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
-    AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
-
 }
 
 /*
@@ -459,6 +400,46 @@ void SetObjectsBBRenderMode(eRenderBoundingBoxes Mode)
     BBRenderMode = Mode;
 }
 
+/*
+ * Begin new fixed simulation step (for rendering interpolation).
+ */
+void BeginObject3DSimulationStep()
+{
+    SimulationStepNumber++;
+    // care about overflow, 0 reserved
+    if (!SimulationStepNumber) {
+        SimulationStepNumber = 1;
+    }
+}
+
+/*
+ * Set interpolation factor between previous and current simulation steps for rendering.
+ */
+void SetObject3DInterpolationFactor(float Factor)
+{
+    // NOTE in future, use std::clamp (since C++17)
+    if (Factor < 0.0f) {
+        Factor = 0.0f;
+    } else if (Factor > 1.0f) {
+        Factor = 1.0f;
+    }
+    InterpolationFactor = Factor;
+}
+
+/*
+ * Get location interpolated between previous and current simulation steps.
+ */
+sVECTOR3D cObject3D::GetInterpolatedLocation() const
+{
+    // location was not changed in current simulation step
+    if (StepStartNumber != SimulationStepNumber
+        || InterpolationFactor == 1.0f) {
+        return Location;
+    }
+
+    return StepStartLocation + ((Location - StepStartLocation) ^ InterpolationFactor);
+}
+
 /*
  * Fill status draw array for line.
  */
@@ -515,23 +496,62 @@ static void DrawObjectStatus(const sVECTOR3D &Location, float Width, const sRGBC
 }
 
 /*
- * Draw.
+ * Check, if object with given radius is small enough on screen for LOD usage.
+ */
+static bool NeedLevelOfDetail(float ObjectRadius, float CameraDistance2)
+{
+    // real view size in pixels (not virtual internal resolution), don't call vw_GetViewport()
+    // here, since glGet*() for each drawn object could stall rendering pipeline
+    float ScreenRadius = ObjectRadius * ProjectionScale * static_cast<float>(GameConfig().Height) / 2.0f;
+    return ScreenRadius * ScreenRadius < LODScreenRadius * LODScreenRadius * CameraDistance2;
+}
+
+/*
+ * Draw object, main pass could be submitted into render queue (if render queue recording started).
  */
 void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
+{
+    if (!VertexOnlyPass && SubmitToObject3DRenderQueue(*this, ShadowMap)) {
+        return;
+    }
+
+    DrawImmediate(VertexOnlyPass, ShadowMap);
+}
+
+/*
+ * Object was culled by camera's frustum before draw (care about DeleteAfterLeaveScene).
+ */
+void cObject3D::CulledByFrustum()
+{
+    if (DeleteAfterLeaveScene == eDeleteAfterLeaveScene::showed) {
+        DeleteAfterLeaveScene = eDeleteAfterLeaveScene::need_delete;
+    }
+}
+
+/*
+ * Draw object immediately, bypass render queue.
+ */
+void cObject3D::DrawImmediate(bool VertexOnlyPass, bool ShadowMap)
 {
     if (Chunks.empty()) {
         return;
     }
 
+    // interpolated between simulation steps location for rendering
+    sVECTOR3D DrawLocation{GetInterpolatedLocation()};
+
+    sVECTOR3D CurrentCameraLocation;
+    vw_GetCameraLocation(&CurrentCameraLocation);
+    float PromptDrawRealDist2 = (DrawLocation.x - CurrentCameraLocation.x) * (DrawLocation.x - CurrentCameraLocation.x) +
+                                (DrawLocation.y - CurrentCameraLocation.y) * (DrawLocation.y - CurrentCameraLocation.y) +
+                                (DrawLocation.z - CurrentCameraLocation.z) * (DrawLocation.z - CurrentCameraLocation.z);
+
+    // explosion shader works with unique for each object geometry, don't use LOD for it
+    bool NeedLOD = (ShaderType != 2) && NeedLevelOfDetail(Radius, PromptDrawRealDist2);
+
     bool NeedOnePieceDraw{false};
     if (PromptDrawDist2 >= 0.0f) {
-        sVECTOR3D CurrentCameraLocation;
-        vw_GetCameraLocation(&CurrentCameraLocation);
-        float PromptDrawRealDist2 = (Location.x - CurrentCameraLocation.x) * (Location.x - CurrentCameraLocation.x) +
-                                    (Location.y - CurrentCameraLocation.y) * (Location.y - CurrentCameraLocation.y) +
-                                    (Location.z - CurrentCameraLocation.z) * (Location.z - CurrentCameraLocation.z);
-
-        int LightsCount = vw_CalculateAllPointLightsAttenuation(Location, Radius * Radius, nullptr);
+        int LightsCount = vw_CalculateAllPointLightsAttenuation(DrawLocation, Radius * Radius, nullptr);
 
         if (PromptDrawRealDist2 > PromptDrawDist2) {
             if (LightsCount <= GameConfig().MaxPointLights) {
@@ -554,22 +574,33 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
     // make sure, we call this one _before_ any camera/frustum checks, since not visible
     // for us 3D model could also drop the shadow on visible for us part of scene
     if (VertexOnlyPass) {
+        // but we still could cull objects, that are not in light's frustum
+        if (!ShadowMap_BoxInLightFrustum(DrawLocation + AABB[6], DrawLocation + AABB[0])) {
+            return;
+        }
+
         vw_PushMatrix();
 
-        vw_Translate(Location);
+        vw_Translate(DrawLocation);
         vw_Rotate(Rotation.z, 0.0f, 0.0f, 1.0f);
         vw_Rotate(Rotation.y, 0.0f, 1.0f, 0.0f);
         vw_Rotate(Rotation.x, 1.0f, 0.0f, 0.0f);
 
         if (NeedOnePieceDraw) {
-            unsigned DrawVertexCount{GlobalIndexArrayCount};
-            if (!DrawVertexCount) {
-                DrawVertexCount = GlobalVertexArrayCount;
-            }
+            if (NeedLOD && GlobalLODIndexArrayCount) {
+                vw_Draw3D(ePrimitiveType::TRIANGLES, GlobalLODIndexArrayCount, RI_3f_XYZ, GlobalVertexArray.get(),
+                          Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
+                          GlobalLODIndexArray.get(), GlobalLODIBO, GlobalLODVAO);
+            } else {
+                unsigned DrawVertexCount{GlobalIndexArrayCount};
+                if (!DrawVertexCount) {
+                    DrawVertexCount = GlobalVertexArrayCount;
+                }
 
-            vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, RI_3f_XYZ, GlobalVertexArray.get(),
-                      Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
-                      GlobalIndexArray.get(), GlobalIBO, GlobalVAO);
+                vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, RI_3f_XYZ, GlobalVertexArray.get(),
+                          Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
+                          GlobalIndexArray.get(), GlobalIBO, GlobalVAO);
+            }
         } else {
 
             if (ShaderType == 2) {
@@ -595,9 +626,15 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
                     vw_Rotate(tmpChunk.GeometryAnimation.x, 1.0f, 0.0f, 0.0f);
                 }
 
-                vw_Draw3D(ePrimitiveType::TRIANGLES, tmpChunk.VertexQuantity, RI_3f_XYZ, tmpChunk.VertexArray.get(),
-                          tmpChunk.VertexStride * sizeof(float), tmpChunk.VBO,
-                          tmpChunk.RangeStart, tmpChunk.IndexArray.get(), tmpChunk.IBO, tmpChunk.VAO);
+                if (NeedLOD && tmpChunk.LODIndexArrayCount) {
+                    vw_Draw3D(ePrimitiveType::TRIANGLES, tmpChunk.LODIndexArrayCount, RI_3f_XYZ, tmpChunk.VertexArray.get(),
+                              tmpChunk.VertexStride * sizeof(float), tmpChunk.VBO,
+                              0, tmpChunk.LODIndexArray.get(), tmpChunk.LODIBO, tmpChunk.LODVAO);
+                } else {
+                    vw_Draw3D(ePrimitiveType::TRIANGLES, tmpChunk.VertexQuantity, RI_3f_XYZ, tmpChunk.VertexArray.get(),
+                              tmpChunk.VertexStride * sizeof(float), tmpChunk.VBO,
+                              tmpChunk.RangeStart, tmpChunk.IndexArray.get(), tmpChunk.IBO, tmpChunk.VAO);
+                }
 
                 vw_PopMatrix();
             }
@@ -611,10 +648,8 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
         return;
     }
 
-    if (!vw_BoxInFrustum(Location + AABB[6], Location + AABB[0])) {
-        if (DeleteAfterLeaveScene == eDeleteAfterLeaveScene::showed) {
-            DeleteAfterLeaveScene = eDeleteAfterLeaveScene::need_delete;
-        }
+    if (!vw_BoxInFrustum(DrawLocation + AABB[6], DrawLocation + AABB[0])) {
+        CulledByFrustum();
         return;
     }
 
@@ -633,7 +668,7 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
 
     vw_PushMatrix();
 
-    vw_Translate(Location);
+    vw_Translate(DrawLocation);
     vw_Rotate(Rotation.z, 0.0f, 0.0f, 1.0f);
     vw_Rotate(Rotation.y, 0.0f, 1.0f, 0.0f);
     vw_Rotate(Rotation.x, 1.0f, 0.0f, 0.0f);
@@ -673,7 +708,7 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             vw_BindTexture(3, CurrentNormalMap);
         }
 
-        vw_CheckAndActivateAllLights(Location, Radius*Radius, 1, GameConfig().MaxPointLights, Matrix);
+        vw_CheckAndActivateAllLights(DrawLocation, Radius*Radius, 1, GameConfig().MaxPointLights, Matrix);
 
         if (GameConfig().UseGLSL120) {
             std::weak_ptr<cGLSL> CurrentObject3DGLSL{};
@@ -742,14 +777,20 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             }
         }
 
-        unsigned DrawVertexCount{GlobalIndexArrayCount};
-        if (!DrawVertexCount) {
-            DrawVertexCount = GlobalVertexArrayCount;
-        }
+        if (NeedLOD && GlobalLODIndexArrayCount) {
+            vw_Draw3D(ePrimitiveType::TRIANGLES, GlobalLODIndexArrayCount, Chunks[0].VertexFormat, GlobalVertexArray.get(),
+                      Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
+                      GlobalLODIndexArray.get(), GlobalLODIBO, GlobalLODVAO);
+        } else {
+            unsigned DrawVertexCount{GlobalIndexArrayCount};
+            if (!DrawVertexCount) {
+                DrawVertexCount = GlobalVertexArrayCount;
+            }
 
-        vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, Chunks[0].VertexFormat, GlobalVertexArray.get(),
-                  Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
-                  GlobalIndexArray.get(), GlobalIBO, GlobalVAO);
+            vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, Chunks[0].VertexFormat, GlobalVertexArray.get(),
+                      Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
+                      GlobalIndexArray.get(), GlobalIBO, GlobalVAO);
+        }
 
         vw_DeActivateAllLights();
     } else {
@@ -849,7 +890,7 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
                     }
                 }
 
-                if (!vw_BoxInFrustum(Location + Min, Location + Max)) {
+                if (!vw_BoxInFrustum(DrawLocation + Min, DrawLocation + Max)) {
                     continue;
                 }
             }
@@ -899,9 +940,9 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             }
 
             if (!HitBB.empty()) {
-                vw_CheckAndActivateAllLights(Location + HitBB[i].Location, HitBB[i].Radius2, 1, GameConfig().MaxPointLights, Matrix);
+                vw_CheckAndActivateAllLights(DrawLocation + HitBB[i].Location, HitBB[i].Radius2, 1, GameConfig().MaxPointLights, Matrix);
             } else {
-                vw_CheckAndActivateAllLights(Location, Radius * Radius, 1, GameConfig().MaxPointLights, Matrix);
+                vw_CheckAndActivateAllLights(DrawLocation, Radius * Radius, 1, GameConfig().MaxPointLights, Matrix);
             }
 
             // for planet's clouds
@@ -929,9 +970,15 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
                 }
             }
 
-            vw_Draw3D(ePrimitiveType::TRIANGLES, Chunks[i].VertexQuantity, Chunks[i].VertexFormat, Chunks[i].VertexArray.get(),
-                      Chunks[i].VertexStride * sizeof(float), Chunks[i].VBO,
-                      Chunks[i].RangeStart, Chunks[i].IndexArray.get(), Chunks[i].IBO, Chunks[i].VAO);
+            if (NeedLOD && Chunks[i].LODIndexArrayCount) {
+                vw_Draw3D(ePrimitiveType::TRIANGLES, Chunks[i].LODIndexArrayCount, Chunks[i].VertexFormat, Chunks[i].VertexArray.get(),
+                          Chunks[i].VertexStride * sizeof(float), Chunks[i].VBO,
+                          0, Chunks[i].LODIndexArray.get(), Chunks[i].LODIBO, Chunks[i].LODVAO);
+            } else {
+                vw_Draw3D(ePrimitiveType::TRIANGLES, Chunks[i].VertexQuantity, Chunks[i].VertexFormat, Chunks[i].VertexArray.get(),
+                          Chunks[i].VertexStride * sizeof(float), Chunks[i].VBO,
+                          Chunks[i].RangeStart, Chunks[i].IndexArray.get(), Chunks[i].IBO, Chunks[i].VAO);
+            }
 
             if (Chunks[i].DrawType == eModel3DDrawType::Blend) {
                 vw_SetTextureAlphaTest(false, eCompareFunc::ALWAYS, 0);
@@ -973,11 +1020,11 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
 #ifndef NDEBUG
     // debug info, line number in script file
     if (!ScriptLineNumberUTF32.empty()) {
-        vw_DrawText3DUTF32(Location.x, Location.y + AABB[0].y, Location.z, ScriptLineNumberUTF32);
+        vw_DrawText3DUTF32(DrawLocation.x, DrawLocation.y + AABB[0].y, DrawLocation.z, ScriptLineNumberUTF32);
     }
 #endif // NDEBUG
 
-    DrawBoundingBoxes(Location, AABB, OBB, HitBB);
+    DrawBoundingBoxes(DrawLocation, AABB, OBB, HitBB);
 
     // TODO why we need ShowStatus if we could use ArmorInitialStatus < 0.0f for this?
     if (!ShowStatus
@@ -991,15 +1038,55 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
     // even if shield recharged - don't hide object's status any more
     ShowStatusAllTime = true;
 
-    DrawObjectStatus(sVECTOR3D{Location.x, Location.y + AABB[0].y + 0.7f, Location.z},
+    DrawObjectStatus(sVECTOR3D{DrawLocation.x, DrawLocation.y + AABB[0].y + 0.7f, DrawLocation.z},
                      Width, sRGBCOLOR{eRGBCOLOR::red}, ArmorCurrentStatus, ArmorInitialStatus);
     if (ShieldInitialStatus > 0.0f) {
-        DrawObjectStatus(sVECTOR3D{Location.x, Location.y + AABB[0].y + 1.75f, Location.z},
+        DrawObjectStatus(sVECTOR3D{DrawLocation.x, DrawLocation.y + AABB[0].y + 1.75f, DrawLocation.z},
                          Width, sRGBCOLOR{0.1f, 0.7f, 1.0f}, ShieldCurrentStatus, ShieldInitialStatus);
     }
     vw_BindTexture(0, 0);
 }
 
+/*
+ * Set TimeSheets program and start it from the beginning.
+ */
+void cObject3D::SetTimeSheetProgram(const std::shared_ptr<const sTimeSheetProgram> &Program)
+{
+    TimeSheetProgram = Program;
+    TimeSheetCursor = 0;
+    TimeSheetApplied = false;
+    if (TimeSheetProgram && !TimeSheetProgram->TimeSheets.empty()) {
+        TimeSheetTimeLeft = TimeSheetProgram->TimeSheets.front().Time;
+    }
+}
+
+/*
+ * Get current TimeSheet if it was not applied yet, and mark it as applied.
+ */
+const sTimeSheet *cObject3D::GetNewTimeSheet()
+{
+    if (TimeSheetApplied
+        || !TimeSheetProgram
+        || TimeSheetCursor >= TimeSheetProgram->TimeSheets.size()) {
+        return nullptr;
+    }
+
+    TimeSheetApplied = true;
+    return &TimeSheetProgram->TimeSheets[TimeSheetCursor];
+}
+
+/*
+ * Update object, bounding boxes update could be deferred till the end of Update() call.
+ */
+bool cObject3D::UpdateWithDeferredBounds(float Time)
+{
+    DeferBoundsUpdate_ = CanDeferBoundsUpdate;
+    bool Result = Update(Time);
+    DeferBoundsUpdate_ = false;
+    UpdateBounds();
+    return Result;
+}
+
 /*
  * Update with TimeSheetList.
  */
@@ -1012,40 +1099,44 @@ bool cObject3D::UpdateWithTimeSheetList(float Time)
 
     float tmpTimeDelta = Time - TimeLastUpdate;
     while (tmpTimeDelta > 0.0f) {
-        // no TimeSheet in list
-        if (TimeSheetList.empty()) {
+        // no TimeSheet in program
+        if (!TimeSheetProgram || TimeSheetCursor >= TimeSheetProgram->TimeSheets.size()) {
             TimeDelta = tmpTimeDelta;
             TimeLastUpdate = Time;
-            return Update(Time);
-        }
-
-        // if AIMode, should be unpacked first (note, we may have nested AIMode)
-        while (TimeSheetList.front().AI_Mode != 0) {
-            UnpackAIMode(TimeSheetList);
+            return UpdateWithDeferredBounds(Time);
         }
 
         // infinity looped action
-        if (TimeSheetList.front().Time == -1.0f) {
+        if (TimeSheetTimeLeft == -1.0f) {
             TimeDelta = tmpTimeDelta;
             TimeLastUpdate = Time;
-            return Update(Time);
+            return UpdateWithDeferredBounds(Time);
         }
 
         // action will take all time we have
-        if (TimeSheetList.front().Time > tmpTimeDelta) {
+        if (TimeSheetTimeLeft > tmpTimeDelta) {
             TimeDelta = tmpTimeDelta;
             TimeLastUpdate = Time;
-            TimeSheetList.front().Time -= TimeDelta;
-            return Update(Time);
+            TimeSheetTimeLeft -= TimeDelta;
+            return UpdateWithDeferredBounds(Time);
         }
 
-        TimeDelta = TimeSheetList.front().Time;
+        TimeDelta = TimeSheetTimeLeft;
         tmpTimeDelta -= TimeDelta;
         TimeLastUpdate += TimeDelta;
-        if (!Update(TimeLastUpdate)) {
+        if (!UpdateWithDeferredBounds(TimeLastUpdate)) {
             return false;
         }
-        TimeSheetList.pop_front();
+
+        // move to the next TimeSheet, program could be looped
+        TimeSheetCursor++;
+        if (TimeSheetCursor == TimeSheetProgram->TimeSheets.size()) {
+            TimeSheetCursor = TimeSheetProgram->LoopStart;
+        }
+        if (TimeSheetCursor < TimeSheetProgram->TimeSheets.size()) {
+            TimeSheetTimeLeft = TimeSheetProgram->TimeSheets[TimeSheetCursor].Time;
+            TimeSheetApplied = false;
+        }
     }
 
     return true;
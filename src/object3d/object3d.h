@@ -187,17 +187,57 @@ protected:
 
     // should be called in UpdateWithTimeSheetList() only
     virtual bool Update(float Time);
+    // Get current TimeSheet if it was not applied yet, and mark it as applied.
+    const sTimeSheet *GetNewTimeSheet();
+
+    // Allow bounding boxes (OBB, HitBB, AABB) update deferring till the end of Update() call,
+    // object's Update() should not use own bounding boxes after rotation changes.
+    bool CanDeferBoundsUpdate{false};
+
+private:
+    // Chunk's location and rotation, that HitBB were calculated with.
+    struct sBoundsChunk {
+        sVECTOR3D Location{0.0f, 0.0f, 0.0f};
+        sVECTOR3D Rotation{0.0f, 0.0f, 0.0f};
+    };
+
+    // Update object, bounding boxes update could be deferred till the end of Update() call.
+    bool UpdateWithDeferredBounds(float Time);
+    // Mark chunks' bounding boxes as changed.
+    void MarkChunksBoundsDirty();
+    // Update chunks' HitBB with pending chunks' changes, recalculate OBB by HitBB.
+    void UpdateChunksBounds();
+
+    bool DeferBoundsUpdate_{false};
+    bool BoundsDirty_{false};
+    bool ChunksBoundsDirty_{false};
+    // object's rotation matrix, that bounding boxes were calculated with
+    float BoundsRotationMat_[9]{1.0f, 0.0f, 0.0f,
+                                0.0f, 1.0f, 0.0f,
+                                0.0f, 0.0f, 1.0f};
+    // empty, until first chunk's location or rotation change
+    std::vector<sBoundsChunk> BoundsChunks_{};
 
 public:
+    // Draw object, main pass could be submitted into render queue (if render queue recording started).
     virtual void Draw(bool VertexOnlyPass, bool ShadowMap = false);
+    // Draw object immediately, bypass render queue.
+    void DrawImmediate(bool VertexOnlyPass, bool ShadowMap);
+    // Object was culled by camera's frustum before draw (care about DeleteAfterLeaveScene).
+    void CulledByFrustum();
     bool NeedCullFaces{true};
     bool NeedAlphaTest{false};
     bool UpdateWithTimeSheetList(float Time);
+    void SetTimeSheetProgram(const std::shared_ptr<const sTimeSheetProgram> &Program);
 
     void SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum);
     void SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum);
     virtual void SetLocation(const sVECTOR3D &NewLocation);
     virtual void SetRotation(const sVECTOR3D &NewRotation);
+    // Update bounding boxes (OBB, HitBB and AABB) with pending object's and chunks' changes.
+    void UpdateBounds();
+    // Get location interpolated between previous and current simulation steps.
+    sVECTOR3D GetInterpolatedLocation() const;
 
     // in-game object's status relatively to player
     eObjectStatus ObjectStatus{eObjectStatus::none};
@@ -216,6 +256,9 @@ public:
     sVECTOR3D OldRotationInv{0.0f, 0.0f, 0.0f};
     sVECTOR3D Location{0.0f, 0.0f, 0.0f};
     sVECTOR3D PrevLocation{0.0f, 0.0f, 0.0f};
+    // location before first change in current simulation step (for rendering interpolation)
+    sVECTOR3D StepStartLocation{0.0f, 0.0f, 0.0f};
+    unsigned StepStartNumber{0};
 
     float TimeLastUpdate{-1.0f};
     float TimeDelta{0.0f};
@@ -252,7 +295,11 @@ public:
 
     std::u32string ScriptLineNumberUTF32{}; // debug info, line number in script file
 
-    std::list<sTimeSheet> TimeSheetList{};
+    // TimeSheets program could be shared by many objects, object only care about position in program
+    std::shared_ptr<const sTimeSheetProgram> TimeSheetProgram{};
+    unsigned TimeSheetCursor{0};
+    float TimeSheetTimeLeft{0.0f};
+    bool TimeSheetApplied{false};
 
     // GLSL-related
     int ShaderType{1};
@@ -271,6 +318,10 @@ enum class eRenderBoundingBoxes : int {
 
 // Set bounding boxes render mode.
 void SetObjectsBBRenderMode(eRenderBoundingBoxes Mode);
+// Begin new fixed simulation step (for rendering interpolation).
+void BeginObject3DSimulationStep();
+// Set interpolation factor between previous and current simulation steps for rendering.
+void SetObject3DInterpolationFactor(float Factor);
 
 
 /*
@@ -284,6 +335,18 @@ void UpdateAllObject3D(float Time);
 // Release all oblect3d.
 void ReleaseAllObject3D();
 
+/*
+ * render_queue
+ */
+
+// Begin render queue recording, main pass cObject3D::Draw() calls will be submitted into queue.
+void BeginObject3DRenderQueue();
+// Submit object into render queue.
+// Return false, if render queue recording was not started (object should be drawn immediately).
+bool SubmitToObject3DRenderQueue(cObject3D &Object, bool ShadowMap);
+// End render queue recording, sort and draw all submitted objects.
+void FlushObject3DRenderQueue();
+
 /*
  * object3d_collision
  */
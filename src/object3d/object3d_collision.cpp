@@ -264,7 +264,7 @@ static void DamageAllNearObjectsByShockWave(const cObject3D &DontTouchObject, co
             && &DontTouchObject != &tmpSpace
             && CheckDistanceBetweenPoints(tmpSpace.Location, Epicenter, Radius2, Distance2Factor)) {
             // debris is a part of scene, don't let them all explode by only one shock wave
-            if (tmpSpace.ObjectType == eObjectType::SpaceDebris && vw_fRand() > 0.5f) {
+            if (tmpSpace.ObjectType == eObjectType::SpaceDebris && vw_fRand(eRandStream::Gameplay) > 0.5f) {
                 return; // eSpaceCycle::Continue;
             }
 
@@ -530,12 +530,12 @@ void DetectCollisionAllObject3D()
 
                 tmpShip.ArmorCurrentStatus -= Damage.Kinetic();
                 // let EM occasionally corrupt armor in some way
-                tmpShip.ArmorCurrentStatus -= Damage.EM() * vw_fRand();
+                tmpShip.ArmorCurrentStatus -= Damage.EM() * vw_fRand(eRandStream::Gameplay);
 
                 // since AlienFighter is "energy", we have a chance kill it by EM
                 if (Damage.EM() > 0.0f
                     && tmpShip.ObjectType == eObjectType::AlienFighter
-                    && vw_fRand() > 0.7f) {
+                    && vw_fRand(eRandStream::Gameplay) > 0.7f) {
                     tmpShip.ArmorCurrentStatus = 0.0f;
                 }
 
@@ -551,7 +551,7 @@ void DetectCollisionAllObject3D()
                            && tmpShip.ObjectType != eObjectType::AlienMotherShip
                            && Damage.EM() > 0.0f) {
 
-                    float Rand = vw_fRand();
+                    float Rand = vw_fRand(eRandStream::Gameplay);
 
                     if (Rand > 0.7f) {
                         tmpShip.MaxSpeed = tmpShip.MaxSpeed / 2.0f;
@@ -40,6 +40,7 @@
 #include "explosion/explosion.h"
 #include "../gfx/star_system.h"
 #include "../gfx/shadow_map.h"
+#include "../game/camera.h"
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -104,6 +105,76 @@ static void ApplyBrightness()
     vw_BindTexture(0, 0);
 }
 
+/*
+ * Add object's AABB to shadow receivers bounds, if object visible.
+ */
+static void AddShadowReceiverBounds(const cObject3D &Object, sVECTOR3D &MinPoint, sVECTOR3D &MaxPoint)
+{
+    sVECTOR3D ObjectMinPoint = Object.Location + Object.AABB[6];
+    sVECTOR3D ObjectMaxPoint = Object.Location + Object.AABB[0];
+    if (!vw_BoxInFrustum(ObjectMinPoint, ObjectMaxPoint)) {
+        return;
+    }
+
+    MinPoint(std::min(MinPoint.x, ObjectMinPoint.x),
+             std::min(MinPoint.y, ObjectMinPoint.y),
+             std::min(MinPoint.z, ObjectMinPoint.z));
+    MaxPoint(std::max(MaxPoint.x, ObjectMaxPoint.x),
+             std::max(MaxPoint.y, ObjectMaxPoint.y),
+             std::max(MaxPoint.z, ObjectMaxPoint.z));
+}
+
+/*
+ * Draw shadow map for game (light's frustum fitted to visible shadow receivers,
+ * static ground objects cached in separate depth map, while camera moving).
+ * Return false, if shadow map should not be used for final render.
+ */
+static bool DrawGameShadowMap()
+{
+    // camera movement for next few seconds, in order to prevent light's frustum refit on each frame
+    constexpr float PredictionTime{5.0f};
+
+    sVECTOR3D MinPoint{1e9f, 1e9f, 1e9f};
+    sVECTOR3D MaxPoint{-1e9f, -1e9f, -1e9f};
+    ForEachSpaceShip([&] (const cSpaceShip &Object) {
+        AddShadowReceiverBounds(Object, MinPoint, MaxPoint);
+    });
+    ForEachGroundObject([&] (const cGroundObject &Object) {
+        AddShadowReceiverBounds(Object, MinPoint, MaxPoint);
+    });
+    ForEachSpaceObject([&] (const cSpaceObject &Object) {
+        // planets and planetoids are background, they don't receive shadows
+        if (Object.ObjectType != eObjectType::Planet
+            && Object.ObjectType != eObjectType::Planetoid) {
+            AddShadowReceiverBounds(Object, MinPoint, MaxPoint);
+        }
+    });
+
+    if (!ShadowMap_FitLightFrustum(MinPoint, MaxPoint,
+                                   GetCameraMovementDirection() ^ (GetCameraSpeed() * PredictionTime))) {
+        return false;
+    }
+
+    if (ShadowMap_NeedUpdateStaticCasters(GetStaticGroundObjectsRevision())) {
+        ShadowMap_StartRenderStaticCastersToFBO(GetStaticGroundObjectsRevision());
+        DrawAllGroundObjectsShadowCasters(eGroundCasters::Static);
+        ShadowMap_EndRenderToFBO();
+    }
+
+    ShadowMap_StartRenderToFBO();
+
+    DrawAllSpaceShips(true, 0);
+    DrawAllWeapons(true, 0);
+    DrawAllGroundObjectsShadowCasters(ShadowMap_StaticCastersCached() ?
+                                      eGroundCasters::Dynamic : eGroundCasters::All);
+    DrawAllProjectiles(true, 0);
+    DrawAllExplosions(true);
+    DrawAllSpaceObjects(true, 0);
+
+    ShadowMap_EndRenderToFBO();
+    return true;
+}
+
 /*
  * Draw all oblect3d.
  */
@@ -117,32 +188,39 @@ void DrawAllObject3D(eDrawType DrawType)
         switch (DrawType) {
         case eDrawType::MENU:
             ShadowMap_StartRenderToFBO(sVECTOR3D{50.0f, -5.0f, -120.0f}, 120.0f, 500.0f);
+
+            DrawAllSpaceShips(true, 0);
+            DrawAllWeapons(true, 0);
+            DrawAllGroundObjects(true, 0);
+            DrawAllProjectiles(true, 0);
+            DrawAllExplosions(true);
+            DrawAllSpaceObjects(true, 0);
+
+            ShadowMap_EndRenderToFBO();
+            ShadowMap = true;
             break;
+
         case eDrawType::GAME:
-            ShadowMap_StartRenderToFBO(sVECTOR3D{0.0f, 0.0f, 160.0f}, 600.0f, 800.0f);
+            ShadowMap = DrawGameShadowMap();
             break;
         }
 
-        DrawAllSpaceShips(true, 0);
-        DrawAllWeapons(true, 0);
-        DrawAllGroundObjects(true, 0);
-        DrawAllProjectiles(true, 0);
-        DrawAllExplosions(true);
-        DrawAllSpaceObjects(true, 0);
-
-        ShadowMap_EndRenderToFBO();
-
-        ShadowMap = true;
-        ShadowMap_StartFinalRender();
+        if (ShadowMap) {
+            ShadowMap_StartFinalRender();
+        }
     }
 
+    // opaque objects sorted by shader and texture (front-to-back for same material),
+    // blended objects drawn after all opaque objects (back-to-front)
+    BeginObject3DRenderQueue();
     DrawAllSpaceObjects(false, ShadowMap);
     DrawAllSpaceShips(false, ShadowMap);
     DrawAllWeapons(false, ShadowMap);
     DrawAllGroundObjects(false, ShadowMap);
     DrawAllProjectiles(false, ShadowMap);
+    FlushObject3DRenderQueue();
 
-    if (GameConfig().ShadowMap > 0) {
+    if (ShadowMap) {
         ShadowMap_EndFinalRender();
     }
 
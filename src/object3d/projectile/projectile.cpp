@@ -29,8 +29,6 @@
 
 // TODO don't call GetPreloadedTextureAsset() all the time, use cached texture instead
 
-// TODO remove goto statement
-
 // TODO codestyle should be fixed
 
 // NOTE we use ReleaseProjectile() in weapon code for beam, since we use beam weapon for
@@ -55,6 +53,31 @@ will not kill their speed and maneuverability and we will have nice difficulty m
 namespace viewizard {
 namespace astromenace {
 
+enum class eProjectileGFXRotation {
+    None,
+    SystemAndParticles, // rotate particle system with particles
+    Particles           // rotate particles only
+};
+
+// Projectile's particle system per-frame behaviour.
+struct sProjectileGFXBehaviour {
+    unsigned GFX; // GraphicFX index
+    eProjectileGFXRotation Rotation;
+    sVECTOR3D RotationSpeed; // degrees per second
+    // suppress emission at the end of projectile's lifetime
+    bool Suppress;
+};
+
+// Projectile type's per-frame behaviour, described once for each projectile type,
+// in order to avoid projectile number checks in each projectile update.
+struct sProjectileBehaviour {
+    int Num;
+    // homing missile rotation speed (degrees per second), 0.0f for non homing projectiles
+    float MissileRotationSpeed;
+    unsigned GFXCount;
+    sProjectileGFXBehaviour GFX[2];
+};
+
 namespace {
 
 struct sProjectileData {
@@ -170,7 +193,94 @@ const std::vector<sProjectileData> PresetPirateProjectileData{
     {1.2f, 200, 0,  4, 0, -1, 1}
 };
 
-std::list<std::shared_ptr<cProjectile>> ProjectileList{};
+// projectile type's behaviour records, types not listed here don't have per-frame behaviour
+const sProjectileBehaviour ProjectileBehaviours[]{
+    // Plasma
+    {9, 0.0f, 2, {{1, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false},
+                  {2, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false}}},
+    {109, 0.0f, 2, {{1, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false},
+                    {2, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false}}},
+    {10, 0.0f, 2, {{0, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false},
+                   {1, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false}}},
+    {108, 0.0f, 2, {{0, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false},
+                    {1, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false}}},
+    {213, 0.0f, 2, {{0, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false},
+                    {1, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{-360.0f, 0.0f, 0.0f}, false}}},
+    // Maser
+    {11, 0.0f, 1, {{0, eProjectileGFXRotation::Particles, sVECTOR3D{0.0f, 0.0f, 360.0f * 3.0f}, true},
+                   {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {12, 0.0f, 2, {{0, eProjectileGFXRotation::Particles, sVECTOR3D{0.0f, 0.0f, 360.0f * 4.0f}, true},
+                   {1, eProjectileGFXRotation::Particles, sVECTOR3D{0.0f, 0.0f, -360.0f * 2.0f}, true}}},
+    // Antimatter
+    {13, 0.0f, 1, {{0, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{0.0f, -360.0f * 2.0f, 0.0f}, false},
+                   {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {208, 0.0f, 1, {{0, eProjectileGFXRotation::SystemAndParticles, sVECTOR3D{0.0f, -360.0f * 2.0f, 0.0f}, false},
+                    {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    // Laser
+    {14, 0.0f, 1, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, true},
+                   {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {110, 0.0f, 1, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, true},
+                    {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    // Gauss
+    {15, 0.0f, 1, {{0, eProjectileGFXRotation::Particles, sVECTOR3D{0.0f, 0.0f, 360.0f * 6.0f}, false},
+                   {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    // missiles
+    {16, 50.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                    {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {17, 60.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                    {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {18, 35.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                    {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {19, 20.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                    {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    // aliens missiles
+    {102, 50.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                     {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {104, 60.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                     {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    // pirate missiles
+    {205, 50.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                     {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {206, 60.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                     {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {209, 50.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                     {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}},
+    {210, 30.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                     {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}}
+};
+
+const sProjectileBehaviour DefaultProjectileBehaviour{0, 0.0f, 0, {{0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false},
+                                                                {0, eProjectileGFXRotation::None, sVECTOR3D{0.0f, 0.0f, 0.0f}, false}}};
+
+// list nodes and projectiles are pooled, since projectiles are created and released all the time
+std::list<std::shared_ptr<cProjectile>, cPoolAllocator<std::shared_ptr<cProjectile>>> ProjectileList{};
+
+// Projectile's particle system prefab, configured once and copied into pooled particle systems.
+struct sProjectileGFXPrefab {
+    std::shared_ptr<cParticleSystem> ParticleSystem{};
+
+    // point light, should be created for each particle system instance
+    bool Light{false};
+    float LightR{0.0f};
+    float LightG{0.0f};
+    float LightB{0.0f};
+    float LightLinear{0.0f};
+    float LightQuadratic{0.0f};
+
+    void SetLight(float R, float G, float B, float Linear, float Quadratic)
+    {
+        Light = true;
+        LightR = R;
+        LightG = G;
+        LightB = B;
+        LightLinear = Linear;
+        LightQuadratic = Quadratic;
+    }
+};
+
+// prefabs, indexed by GFXNum, built on first usage and released with all projectiles
+// (since prefab's texture could be changed between missions)
+std::unordered_map<int, sProjectileGFXPrefab> ProjectileGFXPrefabs{};
 
 } // unnamed namespace
 
@@ -182,7 +292,13 @@ std::weak_ptr<cProjectile> CreateProjectile(const int ProjectileNum)
 {
     // NOTE emplace_front() return reference to the inserted element (since C++17)
     //      this two lines could be combined
-    ProjectileList.emplace_front(new cProjectile{ProjectileNum}, [](cProjectile *p) {delete p;});
+    // both, projectile object and shared_ptr's control block, are allocated from pools
+    ProjectileList.emplace_front(new (cObjectPool<cProjectile>::Allocate()) cProjectile{ProjectileNum},
+                                 [](cProjectile *p) {
+                                     p->~cProjectile();
+                                     cObjectPool<cProjectile>::Deallocate(p);
+                                 },
+                                 cPoolAllocator<cProjectile>{});
     return ProjectileList.front();
 }
 
@@ -236,13 +352,14 @@ void ReleaseProjectile(std::weak_ptr<cProjectile> &Object)
 void ReleaseAllProjectiles()
 {
     ProjectileList.clear();
+    ProjectileGFXPrefabs.clear();
 }
 
 /*
  * Cycle for each projectile.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachProjectile(std::function<void (cProjectile &Object)> function)
+void ForEachProjectile(cFunctionRef<void (cProjectile &Object)> function)
 {
     for (auto &tmpProjectile : ProjectileList) {
         function(*tmpProjectile);
@@ -253,7 +370,7 @@ void ForEachProjectile(std::function<void (cProjectile &Object)> function)
  * Managed cycle for each projectile.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachProjectile(std::function<void (cProjectile &Object, eProjectileCycle &Command)> function)
+void ForEachProjectile(cFunctionRef<void (cProjectile &Object, eProjectileCycle &Command)> function)
 {
     // NOTE use std::erase_if here (since C++20)
     for (auto iter = ProjectileList.begin(); iter != ProjectileList.end();) {
@@ -280,7 +397,7 @@ void ForEachProjectile(std::function<void (cProjectile &Object, eProjectileCycle
  * Managed cycle for each projectile pair.
  * Note, caller must guarantee, that 'FirstObject' and 'SecondObject' will not released in callback function call.
  */
-void ForEachProjectilePair(std::function<void (cProjectile &FirstObject,
+void ForEachProjectilePair(cFunctionRef<void (cProjectile &FirstObject,
                            cProjectile &SecondObject,
                            eProjectilePairCycle &Command)> function)
 {
@@ -417,10 +534,16 @@ float GetProjectileSpeed(int Num)
 }
 
 /*
- * Setup gfx.
+ * Build gfx prefab.
+ * Note, prefabs are built lazily on first usage, so, don't use random numbers here
+ * (this will break simulation determinism), all random variants should be chosen in
+ * SetProjectileGFX() for each instance.
  */
-static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, int GFXNum)
+static void BuildProjectileGFXPrefab(sProjectileGFXPrefab &Prefab, int GFXNum)
 {
+    Prefab.ParticleSystem = vw_CreateParticleSystemPrefab();
+    std::shared_ptr<cParticleSystem> &ParticleSystem = Prefab.ParticleSystem;
+
     {
         constexpr unsigned tmpHash = constexpr_hash_djb2a("gfx/flare1.tga");
         ParticleSystem->Texture = GetPreloadedTextureAsset(tmpHash);
@@ -444,7 +567,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 0.00f;
         ParticleSystem->Life = 0.15f;
         ParticleSystem->ParticlesPerSec = 300;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.2f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.2f);
         break;
 
     case 2: // Kinetic
@@ -464,7 +587,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.30f;
         ParticleSystem->ParticlesPerSec = 200;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.15f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.15f);
         break;
 
     case 3: // Kinetic
@@ -484,7 +607,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 200;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.1f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.1f);
         break;
 
     case 4: // Kinetic
@@ -504,7 +627,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 0.00f;
         ParticleSystem->Life  = 0.20f;
         ParticleSystem->ParticlesPerSec = 300;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.17f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.17f);
         break;
 
     case 5: // Ion
@@ -530,7 +653,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->AlphaShowHide = true;
         ParticleSystem->IsMagnet = true;
         ParticleSystem->MagnetFactor = 25.0f;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.5f, 0.35f, 0.0f, 0.1f);
+        Prefab.SetLight(0.35f, 0.5f, 0.35f, 0.0f, 0.1f);
         break;
 
     case 6: // Ion
@@ -574,7 +697,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->IsMagnet = true;
         ParticleSystem->NeedStop = true;
         ParticleSystem->AlphaShowHide = true;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.75f, 1.0f, 0.0f, 0.15f);
+        Prefab.SetLight(0.35f, 0.75f, 1.0f, 0.0f, 0.15f);
         break;
 
     case 8: // Plasma
@@ -641,7 +764,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 30;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.75f, 1.0f, 0.0f, 0.10f);
+        Prefab.SetLight(0.35f, 0.75f, 1.0f, 0.0f, 0.10f);
         break;
 
     case 11: // Plasma
@@ -661,7 +784,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.20f;
         ParticleSystem->ParticlesPerSec = 150;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.75f, 1.0f, 0.0f, 0.08f);
+        Prefab.SetLight(0.35f, 0.75f, 1.0f, 0.0f, 0.08f);
         break;
 
     case 12: // Ion
@@ -700,7 +823,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.40f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.1f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.1f);
         break;
 
     case 14: // Torpedo
@@ -720,7 +843,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 1.0f, 0.15f, 0.0f, 0.075f);
+        Prefab.SetLight(0.35f, 1.0f, 0.15f, 0.0f, 0.075f);
         break;
 
     case 15: // Nuke
@@ -740,7 +863,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.15f, 0.35f, 1.0f, 0.0f, 0.05f);
+        Prefab.SetLight(0.15f, 0.35f, 1.0f, 0.0f, 0.05f);
         break;
 
     case 16: // Swarm
@@ -760,7 +883,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.30f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.2f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.2f);
         break;
 
     case 17: // maser
@@ -826,7 +949,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->AlphaShowHide = true;
         ParticleSystem->IsMagnet = true;
         ParticleSystem->MagnetFactor = -20.0f;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.5f, 1.0f, 0.0f, 0.0f, 0.05f);
+        Prefab.SetLight(0.5f, 1.0f, 0.0f, 0.0f, 0.05f);
         break;
 
     case 20: // Laser
@@ -888,7 +1011,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 0.00f;
         ParticleSystem->Life = 0.15f;
         ParticleSystem->ParticlesPerSec = 300;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.85f, 1.0f, 0.0f, 0.2f);
+        Prefab.SetLight(0.35f, 0.85f, 1.0f, 0.0f, 0.2f);
         break;
 
     case 23: // alien weapon 2
@@ -908,7 +1031,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.30f;
         ParticleSystem->ParticlesPerSec = 200;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.85f, 1.0f, 0.0f, 0.1f);
+        Prefab.SetLight(0.35f, 0.85f, 1.0f, 0.0f, 0.1f);
         break;
 
     case 24: // alien weapon 2
@@ -928,7 +1051,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 200;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.85f, 1.0f, 0.0f, 0.1f);
+        Prefab.SetLight(0.35f, 0.85f, 1.0f, 0.0f, 0.1f);
         break;
 
     case 25: // flares
@@ -954,7 +1077,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
             constexpr unsigned tmpHash = constexpr_hash_djb2a("gfx/flare1.tga");
             ParticleSystem->Texture = GetPreloadedTextureAsset(tmpHash);
         }
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.5f, 0.25f, 0.05f, 0.0f, 0.05f);
+        Prefab.SetLight(0.5f, 0.25f, 0.05f, 0.0f, 0.05f);
         break;
 
     case 26: // pirate 1, like Kinetic
@@ -974,7 +1097,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 0.00f;
         ParticleSystem->Life = 0.15f;
         ParticleSystem->ParticlesPerSec = 300;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.45f, 0.8f, 0.3f, 0.0f, 0.2f);
+        Prefab.SetLight(0.45f, 0.8f, 0.3f, 0.0f, 0.2f);
         break;
 
     case 27: // pirate 2, like Kinetic
@@ -994,7 +1117,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.40f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.45f, 0.8f, 0.3f, 0.0f, 0.1f);
+        Prefab.SetLight(0.45f, 0.8f, 0.3f, 0.0f, 0.1f);
         break;
 
     case 28: // mine 2
@@ -1017,7 +1140,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->ParticlesPerSec = 100;
         ParticleSystem->AlphaShowHide= true;
         ParticleSystem->Direction = sVECTOR3D{0.0f, -1.0f, 0.0f};
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.2f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.2f);
         break;
 
     case 29: // mine 3
@@ -1040,7 +1163,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->ParticlesPerSec = 100;
         ParticleSystem->AlphaShowHide= true;
         ParticleSystem->Direction = sVECTOR3D{0.0f, -1.0f, 0.0f};
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.15f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.15f);
         break;
 
     case 30: // mine 4
@@ -1065,7 +1188,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->CreationType = eParticleCreationType::Sphere;
         ParticleSystem->CreationSize = sVECTOR3D{1.5f, 0.1f, 1.5f};
         ParticleSystem->Direction = sVECTOR3D{0.0f, -1.0f, 0.0f};
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.35f, 0.15f, 0.0f, 0.1f);
+        Prefab.SetLight(1.0f, 0.35f, 0.15f, 0.0f, 0.1f);
         break;
 
     case 31: // pirate missile swarm
@@ -1085,7 +1208,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.30f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.45f, 0.8f, 0.3f, 0.0f, 0.2f);
+        Prefab.SetLight(0.45f, 0.8f, 0.3f, 0.0f, 0.2f);
         break;
 
     case 32: // pirate torpedo
@@ -1105,7 +1228,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 1.0f, 0.15f, 0.0f, 0.075f);
+        Prefab.SetLight(0.35f, 1.0f, 0.15f, 0.0f, 0.075f);
         break;
 
     case 33: // pirate bomb
@@ -1125,7 +1248,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 250;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.15f, 0.35f, 1.0f, 0.0f, 0.05f);
+        Prefab.SetLight(0.15f, 0.35f, 1.0f, 0.0f, 0.05f);
         break;
 
     case 34: // pirate, like Kinetic2
@@ -1145,7 +1268,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.30f;
         ParticleSystem->ParticlesPerSec = 200;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.45f, 0.8f, 0.3f, 0.0f, 0.15f);
+        Prefab.SetLight(0.45f, 0.8f, 0.3f, 0.0f, 0.15f);
         break;
 
     case 35: // pirate, like Kinetic3
@@ -1165,7 +1288,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->Theta = 360.00f;
         ParticleSystem->Life = 0.50f;
         ParticleSystem->ParticlesPerSec = 200;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.45f, 0.8f, 0.3f, 0.0f, 0.1f);
+        Prefab.SetLight(0.45f, 0.8f, 0.3f, 0.0f, 0.1f);
         break;
 
     case 36: // alien, energy mine 1
@@ -1190,7 +1313,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->DeadZone = 1.9f;
         ParticleSystem->IsMagnet = true;
         ParticleSystem->MagnetFactor = 25.0f;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 0.35f, 0.75f, 1.0f, 0.0f, 0.1f);
+        Prefab.SetLight(0.35f, 0.75f, 1.0f, 0.0f, 0.1f);
         break;
 
     case 37: // alien, energy mine 2
@@ -1215,7 +1338,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->DeadZone = 1.9f;
         ParticleSystem->IsMagnet = true;
         ParticleSystem->MagnetFactor = 2.0f;
-        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, 1.0f, 0.2f, 0.2f, 0.0f, 0.1f);
+        Prefab.SetLight(1.0f, 0.2f, 0.2f, 0.0f, 0.1f);
         break;
 
     case 38: // alien mothership, Laser
@@ -1239,8 +1362,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->AlphaShowHide = true;
         break;
 
-    case 101: // earth/pirate missile trail
-        ParticleSystem->Texture = GetPreloadedTextureAsset(MissileTrailTexturesHash[vw_uRandNum(4)]);
+    case 101: // earth/pirate missile trail (random texture is chosen in SetProjectileGFX())
         ParticleSystem->ColorStart.r = 1.00f;
         ParticleSystem->ColorStart.g = 1.00f;
         ParticleSystem->ColorStart.b = 1.00f;
@@ -1261,8 +1383,7 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
         ParticleSystem->TextureBlend = true;
         break;
 
-    case 102: // alien missile trail
-        ParticleSystem->Texture = GetPreloadedTextureAsset(MissileTrailTexturesHash[vw_uRandNum(4)]);
+    case 102: // alien missile trail (random texture is chosen in SetProjectileGFX())
         ParticleSystem->ColorStart.r = 0.00f;
         ParticleSystem->ColorStart.g = 0.70f;
         ParticleSystem->ColorStart.b = 1.00f;
@@ -1289,10 +1410,50 @@ static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, i
     }
 }
 
+/*
+ * Find projectile type's behaviour record.
+ */
+static const sProjectileBehaviour &FindProjectileBehaviour(int ProjectileNum)
+{
+    for (auto &tmpBehaviour : ProjectileBehaviours) {
+        if (tmpBehaviour.Num == ProjectileNum) {
+            return tmpBehaviour;
+        }
+    }
+
+    return DefaultProjectileBehaviour;
+}
+
+/*
+ * Setup gfx.
+ */
+static void SetProjectileGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, int GFXNum)
+{
+    auto iter = ProjectileGFXPrefabs.find(GFXNum);
+    if (iter == ProjectileGFXPrefabs.end()) {
+        iter = ProjectileGFXPrefabs.emplace(GFXNum, sProjectileGFXPrefab{}).first;
+        BuildProjectileGFXPrefab(iter->second, GFXNum);
+    }
+    const sProjectileGFXPrefab &Prefab = iter->second;
+
+    ParticleSystem->CopySettings(*Prefab.ParticleSystem);
+
+    // missile trails should have random texture, don't freeze it in prefab
+    if (GFXNum == 101 || GFXNum == 102) {
+        ParticleSystem->Texture = GetPreloadedTextureAsset(MissileTrailTexturesHash[vw_uRandNum(4)]);
+    }
+
+    if (Prefab.Light) {
+        ParticleSystem->Light = vw_CreatePointLight(sVECTOR3D{0.0f, 0.0f, 0.0f}, Prefab.LightR, Prefab.LightG,
+                                                    Prefab.LightB, Prefab.LightLinear, Prefab.LightQuadratic);
+    }
+}
+
 /*
  * Constructor.
  */
-cProjectile::cProjectile(const int ProjectileNum)
+cProjectile::cProjectile(const int ProjectileNum) :
+    Behaviour{&FindProjectileBehaviour(ProjectileNum)}
 {
     ObjectStatus = eObjectStatus::Ally;
     ObjectType = eObjectType::Projectile;
@@ -2455,186 +2616,98 @@ bool cProjectile::Update(float Time)
         CurrentPenalty = static_cast<float>(GameEnemyWeaponPenalty);
     }
 
-    float RotationSpeed;
-
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // Additional actions (for example, rotate homing missile to target)
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    switch (Num) {
-    // Plasma
-    case 9:
-    case 109:
-        if (auto sharedGFX = GraphicFX[1].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        if (auto sharedGFX = GraphicFX[2].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        break;
-    case 10:
-    case 108:
-    case 213:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        if (auto sharedGFX = GraphicFX[1].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
+    // particle systems per-frame behaviour
+    for (unsigned i = 0; i < Behaviour->GFXCount; i++) {
+        const sProjectileGFXBehaviour &GFXBehaviour = Behaviour->GFX[i];
+        if (GFXBehaviour.GFX >= GraphicFX.size()) {
+            continue;
         }
-        break;
 
-    // Maser
-    case 11:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 3.0f});
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
-            }
-        }
-        break;
-    case 12:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 4.0f});
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
-            }
-        }
-        if (auto sharedGFX = GraphicFX[1].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, -360.0f * TimeDelta * 2.0f});
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
+        if (auto sharedGFX = GraphicFX[GFXBehaviour.GFX].lock()) {
+            switch (GFXBehaviour.Rotation) {
+            case eProjectileGFXRotation::None:
+                break;
+            case eProjectileGFXRotation::SystemAndParticles:
+                sharedGFX->RotateSystemAndParticlesByAngle(sharedGFX->Angle + (GFXBehaviour.RotationSpeed ^ TimeDelta));
+                break;
+            case eProjectileGFXRotation::Particles:
+                sharedGFX->RotateParticlesByAngle(GFXBehaviour.RotationSpeed ^ TimeDelta);
+                break;
             }
-        }
-        break;
 
-    // Antimatter
-    case 13:
-    case 208:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x,
-                                                                 sharedGFX->Angle.y - 360.0f * TimeDelta * 2.0f,
-                                                                 sharedGFX->Angle.z});
-        }
-        break;
-
-    // Laser
-    case 14:
-    case 110:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
+            if (GFXBehaviour.Suppress && Lifetime <= sharedGFX->Life / 1.5f) {
                 sharedGFX->IsSuppressed = true;
             }
         }
-        break;
-
-    // Gauss
-    case 15:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 6.0f});
-        }
-        break;
+    }
 
-    // missile
-    case 16:
-        RotationSpeed = 50.0f;
-        goto missile;
-    case 17:
-        RotationSpeed = 60.0f;
-        goto missile;
-    case 18:
-        RotationSpeed = 35.0f;
-        goto missile;
-    case 19:
-        RotationSpeed = 20.0f;
-        goto missile;
-    // Aliens missile
-    case 102:
-        RotationSpeed = 50.0f;
-        goto missile;
-    case 104:
-        RotationSpeed = 60.0f;
-        goto missile;
-    // Pirate missile
-    case 205:
-        RotationSpeed = 50.0f;
-        goto missile;
-    case 206:
-        RotationSpeed = 60.0f;
-        goto missile;
-    case 209:
-        RotationSpeed = 50.0f;
-        goto missile;
-    case 210:
-        RotationSpeed = 30.0f;
-        {
-missile:
-            RotationSpeed /= CurrentPenalty;
+    // homing missile
+    if (Behaviour->MissileRotationSpeed > 0.0f) {
+        float MissileRotationSpeed = Behaviour->MissileRotationSpeed / CurrentPenalty;
 
-            sVECTOR3D NeedAngle = Rotation;
+        sVECTOR3D NeedAngle = Rotation;
 
-            float EffectiveRange = 1000000.0f;
-            if (ObjectStatus == eObjectStatus::Player) {
-                EffectiveRange = Lifetime * Speed;
-            }
+        float EffectiveRange = 1000000.0f;
+        if (ObjectStatus == eObjectStatus::Player) {
+            EffectiveRange = Lifetime * Speed;
+        }
 
-            if (Target.expired()) {
-                Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                      CurrentRotationMat, NeedAngle, EffectiveRange);
-            } else {
-                if (CheckMissileTarget(Target, Location, CurrentRotationMat)) {
-                    if (!CorrectTargetInterceptCourse(Location, Rotation, CurrentRotationMat, Target, NeedAngle)) {
-                        Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                              CurrentRotationMat, NeedAngle, EffectiveRange);
-                    }
-                } else {
+        if (Target.expired()) {
+            Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                  CurrentRotationMat, NeedAngle, EffectiveRange);
+        } else {
+            if (CheckMissileTarget(Target, Location, CurrentRotationMat)) {
+                if (!CorrectTargetInterceptCourse(Location, Rotation, CurrentRotationMat, Target, NeedAngle)) {
                     Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
                                                           CurrentRotationMat, NeedAngle, EffectiveRange);
                 }
+            } else {
+                Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                      CurrentRotationMat, NeedAngle, EffectiveRange);
             }
+        }
 
-            if (Rotation.y < NeedAngle.y) {
-                float NeedAngle_y = Rotation.y + RotationSpeed * TimeDelta;
-                if (NeedAngle_y > NeedAngle.y) {
-                    NeedAngle_y = NeedAngle.y;
-                }
-                NeedAngle.y = NeedAngle_y;
-
+        if (Rotation.y < NeedAngle.y) {
+            float NeedAngle_y = Rotation.y + MissileRotationSpeed * TimeDelta;
+            if (NeedAngle_y > NeedAngle.y) {
+                NeedAngle_y = NeedAngle.y;
             }
-            if (Rotation.y > NeedAngle.y) {
-                float NeedAngle_y = Rotation.y - RotationSpeed * TimeDelta;
-                if (NeedAngle_y < NeedAngle.y) {
-                    NeedAngle_y = NeedAngle.y;
-                }
-                NeedAngle.y = NeedAngle_y;
-            }
-
-            if (Rotation.x < NeedAngle.x) {
-                float NeedAngle_x = Rotation.x + RotationSpeed * TimeDelta;
-                if (NeedAngle_x > NeedAngle.x) {
-                    NeedAngle_x = NeedAngle.x;
-                }
-                NeedAngle.x = NeedAngle_x;
+            NeedAngle.y = NeedAngle_y;
 
+        }
+        if (Rotation.y > NeedAngle.y) {
+            float NeedAngle_y = Rotation.y - MissileRotationSpeed * TimeDelta;
+            if (NeedAngle_y < NeedAngle.y) {
+                NeedAngle_y = NeedAngle.y;
             }
-            if (Rotation.x > NeedAngle.x) {
-                float NeedAngle_x = Rotation.x - RotationSpeed * TimeDelta;
-                if (NeedAngle_x < NeedAngle.x) {
-                    NeedAngle_x = NeedAngle.x;
-                }
-                NeedAngle.x = NeedAngle_x;
+            NeedAngle.y = NeedAngle_y;
+        }
+
+        if (Rotation.x < NeedAngle.x) {
+            float NeedAngle_x = Rotation.x + MissileRotationSpeed * TimeDelta;
+            if (NeedAngle_x > NeedAngle.x) {
+                NeedAngle_x = NeedAngle.x;
             }
+            NeedAngle.x = NeedAngle_x;
 
-            SetRotation(NeedAngle - Rotation);
         }
-        break;
+        if (Rotation.x > NeedAngle.x) {
+            float NeedAngle_x = Rotation.x - MissileRotationSpeed * TimeDelta;
+            if (NeedAngle_x < NeedAngle.x) {
+                NeedAngle_x = NeedAngle.x;
+            }
+            NeedAngle.x = NeedAngle_x;
+        }
+
+        SetRotation(NeedAngle - Rotation);
+    }
 
+    float RotationSpeed;
+
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Additional actions (for example, mines behaviour)
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    switch (Num) {
     // pirate, mine 1
     case 214:
         MineIData += TimeDelta;
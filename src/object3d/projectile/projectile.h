@@ -41,6 +41,8 @@
 namespace viewizard {
 namespace astromenace {
 
+struct sProjectileBehaviour;
+
 enum class eProjectileCycle {
     Continue,
     Break,
@@ -64,9 +66,15 @@ private:
     explicit cProjectile(const int ProjectileNum);
     ~cProjectile();
 
+    cProjectile(const cProjectile &) = delete;
+    void operator = (const cProjectile &) = delete;
+
     // should be called in UpdateWithTimeSheetList() only
     virtual bool Update(float Time) override;
 
+    // projectile type's per-frame behaviour record
+    const sProjectileBehaviour *Behaviour{nullptr};
+
 public:
     virtual void SetRotation(const sVECTOR3D &NewRotation) override;
     virtual void SetLocation(const sVECTOR3D &NewLocation) override;
@@ -120,13 +128,13 @@ void ReleaseProjectile(std::weak_ptr<cProjectile> &Object);
 void ReleaseAllProjectiles();
 // Cycle for each projectile.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachProjectile(std::function<void (cProjectile &Object)> function);
+void ForEachProjectile(cFunctionRef<void (cProjectile &Object)> function);
 // Managed cycle for each projectile.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachProjectile(std::function<void (cProjectile &Object, eProjectileCycle &Command)> function);
+void ForEachProjectile(cFunctionRef<void (cProjectile &Object, eProjectileCycle &Command)> function);
 // Managed cycle for each projectile pair.
 // Note, caller must guarantee, that 'FirstObject' and 'SecondObject' will not released in callback function call.
-void ForEachProjectilePair(std::function<void (cProjectile &FirstObject,
+void ForEachProjectilePair(cFunctionRef<void (cProjectile &FirstObject,
                            cProjectile &SecondObject,
                            eProjectilePairCycle &Command)> function);
 // Get object ptr by reference.
@@ -0,0 +1,166 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE only main pass (not vertex only pass) objects are submitted into render queue,
+//      shadow map pass don't switch textures/shaders, so, there is nothing to sort
+
+#include "object3d.h"
+#include "../config/config.h"
+#include <algorithm>
+#include <cstring>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+struct sRenderQueueEntry {
+    uint64_t Key{0};
+    cObject3D *Object{nullptr};
+    bool ShadowMap{false};
+
+    sRenderQueueEntry() = default;
+    explicit sRenderQueueEntry(uint64_t _Key, cObject3D *_Object, bool _ShadowMap) :
+        Key{_Key},
+        Object{_Object},
+        ShadowMap{_ShadowMap}
+    {}
+};
+
+// note, we don't release memory, queue's capacity reused from frame to frame
+std::vector<sRenderQueueEntry> RenderQueue{};
+bool RenderQueueRecording{false};
+
+} // unnamed namespace
+
+
+/*
+ * Convert positive float into unsigned integer with same order (bitwise, no conversion).
+ */
+static uint32_t DepthToUint(float Depth)
+{
+    static_assert(sizeof(uint32_t) == sizeof(float), "uint32_t and float should have same size.");
+
+    uint32_t tmpDepth{0};
+    memcpy(&tmpDepth, &Depth, sizeof(tmpDepth));
+    return tmpDepth;
+}
+
+/*
+ * Calculate 64-bit sort key for object.
+ * Opaque objects: [pass:1][shader:7][texture:24][depth:32], front-to-back.
+ * Blended objects: [pass:1][inverted depth:32][shader:7][texture:24], back-to-front.
+ */
+static uint64_t CalculateSortKey(const cObject3D &Object, bool ShadowMap)
+{
+    bool Blended{false};
+    for (auto &tmpChunk : Object.Chunks) {
+        if (tmpChunk.DrawType == eModel3DDrawType::Blend) {
+            Blended = true;
+            break;
+        }
+    }
+
+    // same shader selection, as cObject3D::DrawImmediate() have
+    uint64_t Shader{0};
+    if (GameConfig().UseGLSL120) {
+        Shader = static_cast<uint64_t>(Object.ShaderType) & 0x7f;
+        if (ShadowMap && Shader == 1) {
+            Shader = 3;
+        } else if (!ShadowMap && Shader == 3) {
+            Shader = 1;
+        }
+    }
+
+    uint64_t Texture{0};
+    if (!Object.Texture.empty()) {
+        Texture = static_cast<uint64_t>(Object.Texture[0]) & 0xffffff;
+    }
+
+    sVECTOR3D CurrentCameraLocation;
+    vw_GetCameraLocation(&CurrentCameraLocation);
+    sVECTOR3D DrawLocation{Object.GetInterpolatedLocation()};
+    // squared distance is always positive, so, its bitwise representation have same order
+    uint64_t Depth = DepthToUint((DrawLocation.x - CurrentCameraLocation.x) * (DrawLocation.x - CurrentCameraLocation.x) +
+                                 (DrawLocation.y - CurrentCameraLocation.y) * (DrawLocation.y - CurrentCameraLocation.y) +
+                                 (DrawLocation.z - CurrentCameraLocation.z) * (DrawLocation.z - CurrentCameraLocation.z));
+
+    if (Blended) {
+        return (uint64_t{1} << 63) | ((~Depth & 0xffffffff) << 31) | (Shader << 24) | Texture;
+    }
+
+    return (Shader << 56) | (Texture << 32) | Depth;
+}
+
+/*
+ * Begin render queue recording, main pass cObject3D::Draw() calls will be submitted into queue.
+ */
+void BeginObject3DRenderQueue()
+{
+    RenderQueue.clear();
+    RenderQueueRecording = true;
+}
+
+/*
+ * Submit object into render queue.
+ * Return false, if render queue recording was not started (object should be drawn immediately).
+ */
+bool SubmitToObject3DRenderQueue(cObject3D &Object, bool ShadowMap)
+{
+    if (!RenderQueueRecording) {
+        return false;
+    }
+
+    if (!Object.Chunks.empty()) {
+        RenderQueue.emplace_back(CalculateSortKey(Object, ShadowMap), &Object, ShadowMap);
+    }
+    return true;
+}
+
+/*
+ * End render queue recording, sort and draw all submitted objects.
+ */
+void FlushObject3DRenderQueue()
+{
+    RenderQueueRecording = false;
+
+    auto comparison = [] (const sRenderQueueEntry &A, const sRenderQueueEntry &B) {
+        return A.Key < B.Key;
+    };
+    std::sort(RenderQueue.begin(), RenderQueue.end(), comparison);
+
+    for (auto &tmpEntry : RenderQueue) {
+        tmpEntry.Object->DrawImmediate(false, tmpEntry.ShadowMap);
+    }
+
+    // objects could be released before next frame
+    RenderQueue.clear();
+}
+
+} // astromenace namespace
+} // viewizard namespace
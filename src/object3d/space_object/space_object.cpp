@@ -38,6 +38,10 @@ namespace {
 
 // all space object list
 std::list<std::shared_ptr<cSpaceObject>> SpaceObjectList{};
+// planets and planetoids buckets (background objects, drawn by star system),
+// objects are owned by SpaceObjectList, released objects are removed on buckets cycle
+std::vector<std::weak_ptr<cSpaceObject>> PlanetList{};
+std::vector<std::weak_ptr<cSpaceObject>> PlanetoidList{};
 
 } // unnamed namespace
 
@@ -72,6 +76,7 @@ std::weak_ptr<cSpaceObject> CreatePlanet(const int PlanetNum)
     // NOTE emplace_front() return reference to the inserted element (since C++17)
     //      this two lines could be combined
     SpaceObjectList.emplace_front(new cPlanet{PlanetNum}, [](cPlanet *p) {delete p;});
+    PlanetList.emplace_back(SpaceObjectList.front());
     return SpaceObjectList.front();
 }
 
@@ -83,6 +88,7 @@ std::weak_ptr<cSpaceObject> CreatePlanetoid(const int PlanetoidNum)
     // NOTE emplace_front() return reference to the inserted element (since C++17)
     //      this two lines could be combined
     SpaceObjectList.emplace_front(new cPlanetoid{PlanetoidNum}, [](cPlanetoid *p) {delete p;});
+    PlanetoidList.emplace_back(SpaceObjectList.front());
     return SpaceObjectList.front();
 }
 
@@ -162,13 +168,50 @@ void ReleaseSpaceObject(std::weak_ptr<cSpaceObject> &Object)
 void ReleaseAllSpaceObjects()
 {
     SpaceObjectList.clear();
+    PlanetList.clear();
+    PlanetoidList.clear();
+}
+
+/*
+ * Cycle for each object in bucket, remove released objects from bucket.
+ */
+static void ForEachInBucket(std::vector<std::weak_ptr<cSpaceObject>> &Bucket,
+                            cFunctionRef<void (cSpaceObject &Object)> function)
+{
+    // NOTE use std::erase_if here (since C++20)
+    for (auto iter = Bucket.begin(); iter != Bucket.end();) {
+        if (auto sharedObject = iter->lock()) {
+            function(*sharedObject);
+            ++iter;
+        } else {
+            iter = Bucket.erase(iter);
+        }
+    }
+}
+
+/*
+ * Cycle for each planet.
+ * Note, caller must guarantee, that 'Object' will not released in callback function call.
+ */
+void ForEachPlanet(cFunctionRef<void (cSpaceObject &Object)> function)
+{
+    ForEachInBucket(PlanetList, function);
+}
+
+/*
+ * Cycle for each planetoid.
+ * Note, caller must guarantee, that 'Object' will not released in callback function call.
+ */
+void ForEachPlanetoid(cFunctionRef<void (cSpaceObject &Object)> function)
+{
+    ForEachInBucket(PlanetoidList, function);
 }
 
 /*
  * Cycle for each space object.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachSpaceObject(std::function<void (cSpaceObject &Object)> function)
+void ForEachSpaceObject(cFunctionRef<void (cSpaceObject &Object)> function)
 {
     for (auto &tmpSpace : SpaceObjectList) {
         function(*tmpSpace);
@@ -179,7 +222,7 @@ void ForEachSpaceObject(std::function<void (cSpaceObject &Object)> function)
  * Managed cycle for each space object.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachSpaceObject(std::function<void (cSpaceObject &Object, eSpaceCycle &Command)> function)
+void ForEachSpaceObject(cFunctionRef<void (cSpaceObject &Object, eSpaceCycle &Command)> function)
 {
     // NOTE use std::erase_if here (since C++20)
     for (auto iter = SpaceObjectList.begin(); iter != SpaceObjectList.end();) {
@@ -206,7 +249,7 @@ void ForEachSpaceObject(std::function<void (cSpaceObject &Object, eSpaceCycle &C
  * Managed cycle for each space object pair.
  * Note, caller must guarantee, that 'FirstObject' and 'SecondObject' will not released in callback function call.
  */
-void ForEachSpaceObjectPair(std::function<void (cSpaceObject &FirstObject,
+void ForEachSpaceObjectPair(cFunctionRef<void (cSpaceObject &FirstObject,
                             cSpaceObject &SecondObject,
                             eSpacePairCycle &Command)> function)
 {
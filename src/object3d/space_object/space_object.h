@@ -165,13 +165,19 @@ void ReleaseSpaceObject(std::weak_ptr<cSpaceObject> &Object);
 void ReleaseAllSpaceObjects();
 // Cycle for each space object.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachSpaceObject(std::function<void (cSpaceObject &Object)> function);
+void ForEachSpaceObject(cFunctionRef<void (cSpaceObject &Object)> function);
 // Managed cycle for each space object.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachSpaceObject(std::function<void (cSpaceObject &Object, eSpaceCycle &Command)> function);
+void ForEachSpaceObject(cFunctionRef<void (cSpaceObject &Object, eSpaceCycle &Command)> function);
+// Cycle for each planet.
+// Note, caller must guarantee, that 'Object' will not released in callback function call.
+void ForEachPlanet(cFunctionRef<void (cSpaceObject &Object)> function);
+// Cycle for each planetoid.
+// Note, caller must guarantee, that 'Object' will not released in callback function call.
+void ForEachPlanetoid(cFunctionRef<void (cSpaceObject &Object)> function);
 // Managed cycle for each space object pair.
 // Note, caller must guarantee, that 'FirstObject' and 'SecondObject' will not released in callback function call.
-void ForEachSpaceObjectPair(std::function<void (cSpaceObject &FirstObject,
+void ForEachSpaceObjectPair(cFunctionRef<void (cSpaceObject &FirstObject,
                             cSpaceObject &SecondObject,
                             eSpacePairCycle &Command)> function);
 // Get object ptr by reference.
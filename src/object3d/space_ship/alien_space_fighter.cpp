@@ -223,6 +223,18 @@ static void SetupGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, const eGF
     }
 }
 
+/*
+ * Get cAlienSpaceFighter model3d file name hash (0, if SpaceShipNum is wrong).
+ */
+unsigned GetAlienSpaceFighterModel3DHash(const int SpaceShipNum)
+{
+    if (SpaceShipNum <= 0 || static_cast<unsigned>(SpaceShipNum) > PresetAlienSpaceFighterData.size()) {
+        return 0;
+    }
+
+    return PresetAlienSpaceFighterData[SpaceShipNum - 1].NameHash;
+}
+
 /*
  * Constructor.
  */
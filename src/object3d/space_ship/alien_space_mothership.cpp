@@ -466,6 +466,18 @@ static void SetupGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, const eGF
     }
 }
 
+/*
+ * Get cAlienSpaceMotherShip model3d file name hash (0, if SpaceShipNum is wrong).
+ */
+unsigned GetAlienSpaceMotherShipModel3DHash(const int SpaceShipNum)
+{
+    if (SpaceShipNum <= 0 || static_cast<unsigned>(SpaceShipNum) > PresetAlienSpaceMotherShipData.size()) {
+        return 0;
+    }
+
+    return PresetAlienSpaceMotherShipData[SpaceShipNum - 1].NameHash;
+}
+
 /*
  * Constructor.
  */
@@ -198,6 +198,18 @@ static void SetupEngineGFX(std::shared_ptr<cParticleSystem> &ParticleSystem, con
     }
 }
 
+/*
+ * Get cPirateShip model3d file name hash (0, if SpaceShipNum is wrong).
+ */
+unsigned GetPirateShipModel3DHash(const int SpaceShipNum)
+{
+    if (SpaceShipNum <= 0 || static_cast<unsigned>(SpaceShipNum) > PresetPirateShipData.size()) {
+        return 0;
+    }
+
+    return PresetPirateShipData[SpaceShipNum - 1].NameHash;
+}
+
 /*
  * Constructor.
  */
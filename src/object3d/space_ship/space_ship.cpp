@@ -169,7 +169,7 @@ void ReleaseAllSpaceShips()
  * Cycle for each space ship.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachSpaceShip(std::function<void (cSpaceShip &Object)> function)
+void ForEachSpaceShip(cFunctionRef<void (cSpaceShip &Object)> function)
 {
     for (auto &tmpShip : ShipList) {
         function(*tmpShip);
@@ -180,7 +180,7 @@ void ForEachSpaceShip(std::function<void (cSpaceShip &Object)> function)
  * Managed cycle for each space ship.
  * Note, caller must guarantee, that 'Object' will not released in callback function call.
  */
-void ForEachSpaceShip(std::function<void (cSpaceShip &Object, eShipCycle &Command)> function)
+void ForEachSpaceShip(cFunctionRef<void (cSpaceShip &Object, eShipCycle &Command)> function)
 {
     // NOTE use std::erase_if here (since C++20)
     for (auto iter = ShipList.begin(); iter != ShipList.end();) {
@@ -207,7 +207,7 @@ void ForEachSpaceShip(std::function<void (cSpaceShip &Object, eShipCycle &Comman
  * Managed cycle for each space ship pair.
  * Note, caller must guarantee, that 'FirstObject' and 'SecondObject' will not released in callback function call.
  */
-void ForEachSpaceShipPair(std::function<void (cSpaceShip &FirstObject,
+void ForEachSpaceShipPair(cFunctionRef<void (cSpaceShip &FirstObject,
                           cSpaceShip &SecondObject,
                           eShipPairCycle &Command)> function)
 {
@@ -257,6 +257,14 @@ std::weak_ptr<cObject3D> GetSpaceShipPtr(const cSpaceShip &Object)
     return std::weak_ptr<cObject3D>{};
 }
 
+/*
+ * Constructor.
+ */
+cSpaceShip::cSpaceShip()
+{
+    CanDeferBoundsUpdate = true;
+}
+
 /*
  * Destructor.
  */
@@ -507,41 +515,39 @@ bool cSpaceShip::Update(float Time)
         return false;
     }
 
-    if (!TimeSheetList.empty() && !TimeSheetList.front().InUse) {
-        TimeSheetList.front().InUse = true;
-
-        NeedSpeed = TimeSheetList.front().Speed;
-        NeedAcceler = TimeSheetList.front().Acceler;
-        NeedSpeedLR = TimeSheetList.front().SpeedLR;
-        NeedAccelerLR = TimeSheetList.front().AccelerLR;
-        NeedSpeedUD = TimeSheetList.front().SpeedUD;
-        NeedAccelerUD = TimeSheetList.front().AccelerUD;
+    if (const sTimeSheet *TimeSheet = GetNewTimeSheet()) {
+        NeedSpeed = TimeSheet->Speed;
+        NeedAcceler = TimeSheet->Acceler;
+        NeedSpeedLR = TimeSheet->SpeedLR;
+        NeedAccelerLR = TimeSheet->AccelerLR;
+        NeedSpeedUD = TimeSheet->SpeedUD;
+        NeedAccelerUD = TimeSheet->AccelerUD;
 
-        NeedSpeedByCamFB = TimeSheetList.front().SpeedByCamFB;
-        NeedAccelerByCamFB = TimeSheetList.front().AccelerByCamFB;
-        NeedSpeedByCamLR = TimeSheetList.front().SpeedByCamLR;
-        NeedAccelerByCamLR = TimeSheetList.front().AccelerByCamLR;
-        NeedSpeedByCamUD = TimeSheetList.front().SpeedByCamUD;
-        NeedAccelerByCamUD = TimeSheetList.front().AccelerByCamUD;
+        NeedSpeedByCamFB = TimeSheet->SpeedByCamFB;
+        NeedAccelerByCamFB = TimeSheet->AccelerByCamFB;
+        NeedSpeedByCamLR = TimeSheet->SpeedByCamLR;
+        NeedAccelerByCamLR = TimeSheet->AccelerByCamLR;
+        NeedSpeedByCamUD = TimeSheet->SpeedByCamUD;
+        NeedAccelerByCamUD = TimeSheet->AccelerByCamUD;
 
-        NeedRotate = TimeSheetList.front().Rotation;
-        RotationSpeed = TimeSheetList.front().RotationAcceler;
+        NeedRotate = TimeSheet->Rotation;
+        RotationSpeed = TimeSheet->RotationAcceler;
 
-        if (TimeSheetList.front().NeedSetAngle) {
-            SetRotation(TimeSheetList.front().SetAngle);
+        if (TimeSheet->NeedSetAngle) {
+            SetRotation(TimeSheet->SetAngle);
         }
 
         if (!WeaponSlots.empty()) {
             for (auto &tmpWeaponSlot : WeaponSlots) {
                 if (!tmpWeaponSlot.Weapon.expired()) {
-                    tmpWeaponSlot.SetFire = TimeSheetList.front().Fire;
+                    tmpWeaponSlot.SetFire = TimeSheet->Fire;
                 }
             }
         }
         if (!BossWeaponSlots.empty()) {
             for (auto &tmpBossWeaponSlot : BossWeaponSlots) {
                 if (!tmpBossWeaponSlot.Weapon.expired()) {
-                    tmpBossWeaponSlot.SetFire = TimeSheetList.front().BossFire;
+                    tmpBossWeaponSlot.SetFire = TimeSheet->BossFire;
                 }
             }
         }
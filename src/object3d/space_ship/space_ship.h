@@ -85,7 +85,7 @@ struct sShipWeaponSlot {
 class cSpaceShip : public cObject3D {
 protected:
     // don't allow object of this class creation
-    cSpaceShip() = default;
+    cSpaceShip();
     ~cSpaceShip();
 
     // should be called in UpdateTimUpdateWithTimeSheetListeSheet() only
@@ -212,6 +212,12 @@ std::weak_ptr<cSpaceShip> CreateAlienSpaceMotherShip(const int SpaceShipNum);
 std::weak_ptr<cSpaceShip> CreateEarthSpaceFighter(const int SpaceShipNum);
 // Create cPirateShip object.
 std::weak_ptr<cSpaceShip> CreatePirateShip(const int SpaceShipNum);
+// Get cAlienSpaceFighter model3d file name hash (0, if SpaceShipNum is wrong).
+unsigned GetAlienSpaceFighterModel3DHash(const int SpaceShipNum);
+// Get cAlienSpaceMotherShip model3d file name hash (0, if SpaceShipNum is wrong).
+unsigned GetAlienSpaceMotherShipModel3DHash(const int SpaceShipNum);
+// Get cPirateShip model3d file name hash (0, if SpaceShipNum is wrong).
+unsigned GetPirateShipModel3DHash(const int SpaceShipNum);
 
 // Update and remove (erase) dead objects.
 void UpdateAllSpaceShip(float Time);
@@ -223,13 +229,13 @@ void ReleaseSpaceShip(std::weak_ptr<cSpaceShip> &Ship);
 void ReleaseAllSpaceShips();
 // Cycle for each space ship.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachSpaceShip(std::function<void (cSpaceShip &Object)> function);
+void ForEachSpaceShip(cFunctionRef<void (cSpaceShip &Object)> function);
 // Managed cycle for each space ship.
 // Note, caller must guarantee, that 'Object' will not released in callback function call.
-void ForEachSpaceShip(std::function<void (cSpaceShip &Object, eShipCycle &Command)> function);
+void ForEachSpaceShip(cFunctionRef<void (cSpaceShip &Object, eShipCycle &Command)> function);
 // Managed cycle for each space ship pair.
 // Note, caller must guarantee, that 'FirstObject' and 'SecondObject' will not released in callback function call.
-void ForEachSpaceShipPair(std::function<void (cSpaceShip &FirstObject,
+void ForEachSpaceShipPair(cFunctionRef<void (cSpaceShip &FirstObject,
                           cSpaceShip &SecondObject,
                           eShipPairCycle &Command)> function);
 // Get object ptr by reference.
@@ -157,6 +157,18 @@ const std::vector<sWeaponData> PresetPirateWeaponData {
     {eGameSFX::WeaponFire_Bomb,         false,  1.0f,   1,    1,    2500,   4.0f, sVECTOR3D{0.0f, 0.0f, 0.0f}, sVECTOR3D{0.0f, 0.0f, 0.0f}, 0, 0, 0}
 };
 
+// missile swarm fire locations, indexed by missiles left in swarm (SwarmNum)
+const std::array<sVECTOR3D, 10> SwarmFireLocation{{sVECTOR3D{0.0f, 0.0f, 0.0f}, // not used
+                                                   sVECTOR3D{0.2f, -0.3f, 2.6f},
+                                                   sVECTOR3D{0.2f, -0.65f, 2.6f},
+                                                   sVECTOR3D{-0.2f, -0.3f, 2.6f},
+                                                   sVECTOR3D{0.2f, -0.65f, 2.6f},
+                                                   sVECTOR3D{-0.2f, -0.95f, 2.6f},
+                                                   sVECTOR3D{0.5f, -0.5f, 2.6f},
+                                                   sVECTOR3D{-0.5f, -0.8f, 2.6f},
+                                                   sVECTOR3D{0.5f, -0.8f, 2.6f},
+                                                   sVECTOR3D{-0.5f, -0.5f, 2.6f}}};
+
 } // unnamed namespace
 
 
@@ -874,34 +886,8 @@ bool cWeapon::Update(float Time)
             CurrentPenalty = static_cast<float>(GameEnemyWeaponPenalty);
         }
 
-        switch (SwarmNum) {
-        case 9:
-            FireLocation(-0.5f, -0.5f, 2.6f);
-            break;
-        case 8:
-            FireLocation(0.5f, -0.8f, 2.6f);
-            break;
-        case 7:
-            FireLocation(-0.5f, -0.8f, 2.6f);
-            break;
-        case 6:
-            FireLocation(0.5f, -0.5f, 2.6f);
-            break;
-        case 5:
-            FireLocation(-0.2f, -0.95f, 2.6f);
-            break;
-        case 4:
-            FireLocation(0.2f, -0.65f, 2.6f);
-            break;
-        case 3:
-            FireLocation(-0.2f, -0.3f, 2.6f);
-            break;
-        case 2:
-            FireLocation(0.2f, -0.65f, 2.6f);
-            break;
-        case 1:
-            FireLocation(0.2f, -0.3f, 2.6f);
-            break;
+        if (static_cast<unsigned>(SwarmNum) < SwarmFireLocation.size()) {
+            FireLocation = SwarmFireLocation[SwarmNum];
         }
         vw_Matrix33CalcPoint(FireLocation, CurrentRotationMat);
 
@@ -51,6 +51,7 @@ Z = 0 at the level start, and increased during level.
 
 #include "../core/core.h"
 #include "script.h"
+#include "script_program.h"
 #include "../config/config.h"
 #include "../ui/game/stopwatch.h"
 #include "../assets/audio.h"
@@ -74,79 +75,65 @@ void SetGameMissionComplete();
 
 
 /*
- * Set TimeSheet's AI_Mode.
+ * Set object's TimeSheets program.
  */
-static void SetAIMode(std::list<sTimeSheet> &TimeSheetList, const sXMLEntry &xmlEntry,
-                      const std::unique_ptr<cXMLDocument> &xmlDoc, const std::shared_ptr<cXMLDocument> &xmlAI)
+static void SetTimeSheets(cObject3D &Object, sScriptObject &ScriptObject,
+                          const std::shared_ptr<const sAIProgram> &AI)
 {
-    int tmpAI_Mode{0};
-    if (xmlDoc->iGetEntryAttribute(xmlEntry, "aimode", tmpAI_Mode)) {
-        TimeSheetList.emplace_back();
-        TimeSheetList.back().Time = -1;
-        TimeSheetList.back().AI_Mode = tmpAI_Mode;
-        TimeSheetList.back().xmlAI = xmlAI;
+    if (ScriptObject.TimeSheets.empty()) {
+        return;
+    }
+
+    // program depends on AI file, that could be changed by script
+    if (!ScriptObject.TimeSheetProgram || ScriptObject.TimeSheetProgramAI != AI) {
+        ScriptObject.TimeSheetProgram = CompileTimeSheetProgram(ScriptObject.TimeSheets, AI.get());
+        ScriptObject.TimeSheetProgramAI = AI;
     }
+    Object.SetTimeSheetProgram(ScriptObject.TimeSheetProgram);
 }
 
 /*
  * Set object location.
  */
-static void SetLocation(cObject3D &Object, const sXMLEntry &xmlEntry,
-                        const std::unique_ptr<cXMLDocument> &xmlDoc, float TimeOpLag)
+static void SetLocation(cObject3D &Object, const sScriptObject &ScriptObject, float TimeOpLag)
 {
     sVECTOR3D tmpPosition(0.0f, 0.0f, 0.0f);
 
     // absolute coordinates
-    xmlDoc->fGetEntryAttribute(xmlEntry, "posax", tmpPosition.x);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "posay", tmpPosition.y);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "posaz", tmpPosition.z);
+    if (ScriptObject.AbsoluteLocation[0].Set) {
+        tmpPosition.x = ScriptObject.AbsoluteLocation[0].Value;
+    }
+    if (ScriptObject.AbsoluteLocation[1].Set) {
+        tmpPosition.y = ScriptObject.AbsoluteLocation[1].Value;
+    }
+    if (ScriptObject.AbsoluteLocation[2].Set) {
+        tmpPosition.z = ScriptObject.AbsoluteLocation[2].Value;
+    }
 
     // camera-related coordinates
     sVECTOR3D PosWithLag(0.0f,0.0f,0.0f);
     PosWithLag = GetCameraMovementDirection() ^ (-GetCameraSpeed() * TimeOpLag);
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "posx", tmpPosition.x)) {
-        tmpPosition.x += GetCameraCoveredDistance().x + PosWithLag.x;
+    if (ScriptObject.RelativeLocation[0].Set) {
+        tmpPosition.x = ScriptObject.RelativeLocation[0].Value + GetCameraCoveredDistance().x + PosWithLag.x;
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "posy", tmpPosition.y)) {
-        tmpPosition.y += GetCameraCoveredDistance().y + PosWithLag.y;
+    if (ScriptObject.RelativeLocation[1].Set) {
+        tmpPosition.y = ScriptObject.RelativeLocation[1].Value + GetCameraCoveredDistance().y + PosWithLag.y;
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "posz", tmpPosition.z)) {
-        tmpPosition.z += GetCameraCoveredDistance().z + PosWithLag.z;
+    if (ScriptObject.RelativeLocation[2].Set) {
+        tmpPosition.z = ScriptObject.RelativeLocation[2].Value + GetCameraCoveredDistance().z + PosWithLag.z;
     }
 
     Object.SetLocation(tmpPosition);
 }
 
-/*
- * Set object rotation.
- */
-static void SetRotation(cObject3D &Object, const sXMLEntry &xmlEntry,
-                        const std::unique_ptr<cXMLDocument> &xmlDoc)
-{
-    sVECTOR3D tmpAngle(0.0f, 0.0f, 0.0f);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "anglax", tmpAngle.x);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "anglay", tmpAngle.y);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "anglaz", tmpAngle.z);
-
-    // absolute and camera-related angles are the same for now
-    xmlDoc->fGetEntryAttribute(xmlEntry, "anglx", tmpAngle.x);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "angly", tmpAngle.y);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "anglz", tmpAngle.z);
-
-    Object.SetRotation(tmpAngle);
-}
-
 /*
  * Set object's DeleteAfterLeaveScene field.
  */
-static void SetDeleteAfterLeaveScene(cObject3D &Object, const sXMLEntry &xmlEntry,
-                                     const std::unique_ptr<cXMLDocument> &xmlDoc)
+static void SetDeleteAfterLeaveScene(cObject3D &Object, const sScriptObject &ScriptObject)
 {
-    Object.DeleteAfterLeaveScene = eDeleteAfterLeaveScene::enabled;
-    int tmpStatus{0};
-    if (xmlDoc->iGetEntryAttribute(xmlEntry, "onhide", tmpStatus) && tmpStatus <= 0) {
-        Object.DeleteAfterLeaveScene = eDeleteAfterLeaveScene::disabled;
-    }
+    Object.DeleteAfterLeaveScene = ScriptObject.DeleteAfterLeaveScene ?
+                                   eDeleteAfterLeaveScene::enabled :
+                                   eDeleteAfterLeaveScene::disabled;
 }
 
 /*
@@ -154,22 +141,51 @@ static void SetDeleteAfterLeaveScene(cObject3D &Object, const sXMLEntry &xmlEntr
  */
 #ifdef NDEBUG
 static void SetDebugInformation([[gnu::unused, maybe_unused]] cObject3D &Object,
-                                [[gnu::unused, maybe_unused]] const sXMLEntry &xmlEntry,
+                                [[gnu::unused, maybe_unused]] int LineNumber,
                                 [[gnu::unused, maybe_unused]] bool ShowLineNumber)
 {
     return;
 }
 #else
-static void SetDebugInformation(cObject3D &Object, const sXMLEntry &xmlEntry, bool ShowLineNumber)
+static void SetDebugInformation(cObject3D &Object, int LineNumber, bool ShowLineNumber)
 {
     if (!ShowLineNumber) {
         return;
     }
 
-    Object.ScriptLineNumberUTF32 = ConvertUTF8.from_bytes(std::to_string(xmlEntry.LineNumber).data());
+    Object.ScriptLineNumberUTF32 = ConvertUTF8.from_bytes(std::to_string(LineNumber).data());
 }
 #endif // NDEBUG
 
+/*
+ * Set float value, if present in script.
+ */
+static bool SetValue(const sScriptValue<float> &Value, float &Result)
+{
+    if (!Value.Set) {
+        return false;
+    }
+
+    Result = Value.Value;
+    return true;
+}
+
+/*
+ * Set bool value, if present in script.
+ */
+static void SetValue(const sScriptValue<bool> &Value, bool &Result)
+{
+    if (Value.Set) {
+        Result = Value.Value;
+    }
+}
+
+/*
+ * Constructor and destructor should be defined here, since sMissionProgram is incomplete in header.
+ */
+cMissionScript::cMissionScript() = default;
+cMissionScript::~cMissionScript() = default;
+
 /*
  * Load and run script.
  */
@@ -204,21 +220,13 @@ bool cMissionScript::RunScript(const std::string &FileName, float InitTime)
     ShowLineNumber = false;
     SetObjectsBBRenderMode(eRenderBoundingBoxes::None);
 
-    xmlDoc.reset(new cXMLDocument(FileName, true));
-
-    if (!xmlDoc->GetRootEntry() || xmlDoc->GetRootEntry()->Name != "AstroMenaceScript") {
-        std::cerr << __func__ << "(): " << "Can't find AstroMenaceScript element in the: " << FileName << "\n";
-        xmlDoc.reset();
+    Program.reset(new sMissionProgram);
+    if (!CompileMissionScript(FileName, *Program)) {
+        Program.reset();
         return false;
     }
-
-    if (xmlDoc->GetRootEntry()->ChildrenList.empty()) {
-        std::cerr << __func__ << "(): " << "Can't find element's children in the: " << FileName << "\n";
-        xmlDoc.reset();
-        return false;
-    }
-
-    xmlEntryIter = xmlDoc->GetRootEntry()->ChildrenList.begin();
+    OpIndex = 0;
+    AI.reset();
 
     // check all tags for 0 time
     Update(StartTime);
@@ -230,7 +238,7 @@ bool cMissionScript::RunScript(const std::string &FileName, float InitTime)
  */
 bool cMissionScript::Update(float Time)
 {
-    if (!xmlDoc) {
+    if (!Program) {
         return false;
     }
 
@@ -252,21 +260,21 @@ bool cMissionScript::Update(float Time)
             std::weak_ptr<cSpaceObject> CreateAsteroid = CreateSmallAsteroid();
             if (auto sharedCreateAsteroid = CreateAsteroid.lock()) {
                 if (AsterFastCount != 20) {
-                    sharedCreateAsteroid->Speed = AsterMaxSpeed * vw_fRand();
+                    sharedCreateAsteroid->Speed = AsterMaxSpeed * vw_fRand(eRandStream::Gameplay);
                 } else {
-                    sharedCreateAsteroid->Speed = AsterMinFastSpeed + AsterMaxSpeed * vw_fRand();
+                    sharedCreateAsteroid->Speed = AsterMinFastSpeed + AsterMaxSpeed * vw_fRand(eRandStream::Gameplay);
                 }
                 sharedCreateAsteroid->DeleteAfterLeaveScene = eDeleteAfterLeaveScene::enabled;
                 sharedCreateAsteroid->SetRotation(sVECTOR3D{0.0f, 180.0f, 0.0f});
 
                 if (AsterFastCount != 20) {
-                    sharedCreateAsteroid->SetLocation(sVECTOR3D{AsterXPos + AsterW * vw_fRand0(),
-                                                      AsterYPos * 2 + AsterH * vw_fRand(),
+                    sharedCreateAsteroid->SetLocation(sVECTOR3D{AsterXPos + AsterW * vw_fRand0(eRandStream::Gameplay),
+                                                      AsterYPos * 2 + AsterH * vw_fRand(eRandStream::Gameplay),
                                                       AsterZPos + 20.0f} +
                                                       GetCameraCoveredDistance());
                 } else {
-                    sharedCreateAsteroid->SetLocation(sVECTOR3D{AsterXPos + AsterW * vw_fRand0(),
-                                                      AsterYPos * 2 + AsterH * vw_fRand(),
+                    sharedCreateAsteroid->SetLocation(sVECTOR3D{AsterXPos + AsterW * vw_fRand0(eRandStream::Gameplay),
+                                                      AsterYPos * 2 + AsterH * vw_fRand(eRandStream::Gameplay),
                                                       AsterZPos} +
                                                       GetCameraCoveredDistance());
                 }
@@ -326,219 +334,135 @@ bool cMissionScript::Update(float Time)
         return true;
     }
 
-    // we don't check GetRootEntry() result, since we checked it in RunScript()
-    // constexpr_hash_djb2a() could generate error at compile-time, make sure hashes is unique
-    for (; xmlEntryIter != xmlDoc->GetRootEntry()->ChildrenList.end(); ++xmlEntryIter) {
-        sXMLEntry &xmlEntry = *xmlEntryIter;
-        switch (xmlEntry.NameHash) {
-        case constexpr_hash_djb2a("TimeLine"): {
-            float onTime{0.0f};
-            xmlDoc->fGetEntryAttribute(xmlEntry, "value", onTime);
-
-            if (onTime > TimeDelta) {
+    for (; OpIndex < Program->Ops.size(); ++OpIndex) {
+        const sScriptOp &Op = Program->Ops[OpIndex];
+        switch (Op.Code) {
+        case eScriptOp::TimeLine:
+            if (Op.Time > TimeDelta) {
                 return true;
             }
 
-            TimeOpLag = TimeDelta - onTime;
-            UpdateTimeLine();
+            TimeOpLag = TimeDelta - Op.Time;
+            UpdateTimeLine(Op);
 
             TimeLastOp = Time - TimeOpLag;
             TimeDelta = TimeOpLag;
-        }
-        break;
-
-        case constexpr_hash_djb2a("AIFile"):
-            if (!xmlEntry.Content.empty()) {
-                xmlAI.reset(new cXMLDocument(xmlEntry.Content));
-                if (!xmlAI->GetRootEntry()) {
-                    xmlAI.reset();
-                    std::cerr << __func__ << "(): " << "AIFile not loaded.\n";
-                }
-            }
             break;
 
-        case constexpr_hash_djb2a("Debug"): {
-            ShowLineNumber = false;
-            xmlDoc->bGetEntryAttribute(xmlEntry, "showline", ShowLineNumber);
+        case eScriptOp::AIFile:
+            AI = Program->AIPrograms[Op.Index];
+            break;
 
-            {
-                int tmpBBRenderMode{0};
-                if (xmlDoc->iGetEntryAttribute(xmlEntry, "showbb", tmpBBRenderMode) && tmpBBRenderMode >= 0) {
-                    SetObjectsBBRenderMode(static_cast<eRenderBoundingBoxes>(tmpBBRenderMode));
-                }
+        case eScriptOp::Debug: {
+            const sScriptDebug &Debug = Program->Debugs[Op.Index];
+            ShowLineNumber = Debug.ShowLineNumber;
+            if (Debug.BBRenderMode.Set) {
+                SetObjectsBBRenderMode(static_cast<eRenderBoundingBoxes>(Debug.BBRenderMode.Value));
             }
-
-            bool tmpStopwatchStatus{false};
-            xmlDoc->bGetEntryAttribute(xmlEntry, "time", tmpStopwatchStatus);
-            cStopwatch::GetInstance().Reset(tmpStopwatchStatus);
+            cStopwatch::GetInstance().Reset(Debug.Stopwatch);
         }
         break;
 
-        case constexpr_hash_djb2a("StarSystem"): {
-            int SystemNum{0};
-            if (xmlDoc->iGetEntryAttribute(xmlEntry, "system", SystemNum)) {
-                sVECTOR3D TmpBaseRotation(0.0f, 0.0f, 0.0f);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "anglex", TmpBaseRotation.x);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "angley", TmpBaseRotation.y);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "anglez", TmpBaseRotation.z);
-                StarSystemInit(SystemNum, TmpBaseRotation);
+        case eScriptOp::StarSystem: {
+            const sScriptStarSystem &StarSystem = Program->StarSystems[Op.Index];
+            if (StarSystem.System.Set) {
+                StarSystemInit(StarSystem.System.Value, StarSystem.BaseRotation);
             }
         }
         break;
 
-        case constexpr_hash_djb2a("LayersTransp"): {
-            float Layer1TranspStart{0.2f};
-            float Layer1TranspEnd{0.7f};
-            float Layer2TranspStart{0.9f};
-            float Layer2TranspEnd{0.7f};
-
-            xmlDoc->fGetEntryAttribute(xmlEntry, "FirstStart", Layer1TranspStart);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "FirstEnd", Layer1TranspEnd);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "SecondStart", Layer2TranspStart);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "SecondEnd", Layer2TranspEnd);
-
-            StarSystemLayer1Transp(Layer1TranspStart, Layer1TranspEnd);
-            StarSystemLayer3Transp(Layer2TranspStart, Layer2TranspEnd);
+        case eScriptOp::LayersTransp: {
+            const sScriptLayersTransp &LayersTransp = Program->LayersTransps[Op.Index];
+            StarSystemLayer1Transp(LayersTransp.Layer1TranspStart, LayersTransp.Layer1TranspEnd);
+            StarSystemLayer3Transp(LayersTransp.Layer2TranspStart, LayersTransp.Layer2TranspEnd);
         }
         break;
 
-        case constexpr_hash_djb2a("Music"):
+        case eScriptOp::Music:
             // change music only if player's ship still alive, otherwise we are playing 'fail' theme
             if (auto sharedPlayerFighter = PlayerFighter.lock()) {
                 if (sharedPlayerFighter->ArmorCurrentStatus > 0.0f) {
-                    int Theme{0};
-                    if (xmlDoc->iGetEntryAttribute(xmlEntry, "theme", Theme)) {
-                        if (Theme == 1) {
-                            PlayMusicTheme(eMusicTheme::GAME, 2000, 2000);
-                        }
-                        if (Theme == 2) {
-                            PlayMusicTheme(eMusicTheme::BOSS, 1500, 2000);
-                        }
+                    if (Op.Value == 1) {
+                        PlayMusicTheme(eMusicTheme::GAME, 2000, 2000);
+                    }
+                    if (Op.Value == 2) {
+                        PlayMusicTheme(eMusicTheme::BOSS, 1500, 2000);
                     }
                 }
             }
             break;
 
-        case constexpr_hash_djb2a("CreatePlanet"): {
-            int tmpType{0};
-            if (xmlDoc->iGetEntryAttribute(xmlEntry, "type", tmpType)) {
-                std::weak_ptr<cSpaceObject> Planet = CreatePlanet(tmpType);
-                if (auto sharedPlanet = Planet.lock()) {
-                    SetRotation(*sharedPlanet, xmlEntry, xmlDoc);
-                    SetLocation(*sharedPlanet, xmlEntry, xmlDoc, 0.0f);
-                    sharedPlanet->DeleteAfterLeaveScene = eDeleteAfterLeaveScene::enabled;
-                    xmlDoc->fGetEntryAttribute(xmlEntry, "speed", sharedPlanet->Speed);
-                }
+        case eScriptOp::CreatePlanet:
+        case eScriptOp::CreatePlanetoid: {
+            const sScriptObject &ScriptObject = Program->Objects[Op.Index];
+            std::weak_ptr<cSpaceObject> SpaceObject = (Op.Code == eScriptOp::CreatePlanet) ?
+                                                      CreatePlanet(ScriptObject.ObjectType.Value) :
+                                                      CreatePlanetoid(ScriptObject.ObjectType.Value);
+            if (auto sharedSpaceObject = SpaceObject.lock()) {
+                sharedSpaceObject->SetRotation(ScriptObject.Rotation);
+                SetLocation(*sharedSpaceObject, ScriptObject, 0.0f);
+                sharedSpaceObject->DeleteAfterLeaveScene = eDeleteAfterLeaveScene::enabled;
+                SetValue(ScriptObject.Speed, sharedSpaceObject->Speed);
             }
         }
         break;
 
-        case constexpr_hash_djb2a("CreatePlanetoid"): {
-            int tmpType{0};
-            // we could create random planetoid, or provide particular planetoid id
-            xmlDoc->iGetEntryAttribute(xmlEntry, "type", tmpType);
-            std::weak_ptr<cSpaceObject> Planetoid = CreatePlanetoid(tmpType);
-            if (auto sharedPlanetoid = Planetoid.lock()) {
-                SetRotation(*sharedPlanetoid, xmlEntry, xmlDoc);
-                SetLocation(*sharedPlanetoid, xmlEntry, xmlDoc, 0.0f);
-                sharedPlanetoid->DeleteAfterLeaveScene = eDeleteAfterLeaveScene::enabled;
-                xmlDoc->fGetEntryAttribute(xmlEntry, "speed", sharedPlanetoid->Speed);
-            }
+        case eScriptOp::AsteroidField: {
+            const sScriptAsteroidField &AsteroidField = Program->AsteroidFields[Op.Index];
+            SetValue(AsteroidField.On, AsterOn);
+            SetValue(AsteroidField.Quant, AsterQuant);
+            SetValue(AsteroidField.W, AsterW);
+            SetValue(AsteroidField.H, AsterH);
+            SetValue(AsteroidField.XPos, AsterXPos);
+            SetValue(AsteroidField.YPos, AsterYPos);
+            SetValue(AsteroidField.ZPos, AsterZPos);
+            SetValue(AsteroidField.MaxSpeed, AsterMaxSpeed);
+            SetValue(AsteroidField.MinFastSpeed, AsterMinFastSpeed);
         }
         break;
 
-        case constexpr_hash_djb2a("AsteroidField"):
-            xmlDoc->bGetEntryAttribute(xmlEntry, "status", AsterOn);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "persec", AsterQuant);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "w", AsterW);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "h", AsterH);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "posx", AsterXPos);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "posy", AsterYPos);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "posz", AsterZPos);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "slow", AsterMaxSpeed);
-            xmlDoc->fGetEntryAttribute(xmlEntry, "fast", AsterMinFastSpeed);
-            break;
-
-        case constexpr_hash_djb2a("Light"): {
-            eLightType LightType{eLightType::Directional};
-            int tmpType{0};
-            if (xmlDoc->iGetEntryAttribute(xmlEntry, "type", tmpType) && tmpType == 1) {
-                LightType = eLightType::Point;
-            }
-
-            std::weak_ptr<cLight> NewLight = vw_CreateLight(LightType);
+        case eScriptOp::Light: {
+            const sScriptLight &Light = Program->Lights[Op.Index];
+            std::weak_ptr<cLight> NewLight = vw_CreateLight(Light.Type);
             if (auto sharedLight = NewLight.lock()) {
-                xmlDoc->fGetEntryAttribute(xmlEntry, "diffr", sharedLight->Diffuse[0]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "diffg", sharedLight->Diffuse[1]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "diffb", sharedLight->Diffuse[2]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "diffa", sharedLight->Diffuse[3]);
-
-                xmlDoc->fGetEntryAttribute(xmlEntry, "specr", sharedLight->Specular[0]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "specg", sharedLight->Specular[1]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "specb", sharedLight->Specular[2]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "speca", sharedLight->Specular[3]);
-
-                xmlDoc->fGetEntryAttribute(xmlEntry, "ambir", sharedLight->Ambient[0]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "ambig", sharedLight->Ambient[1]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "ambib", sharedLight->Ambient[2]);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "ambia", sharedLight->Ambient[3]);
-
-                xmlDoc->fGetEntryAttribute(xmlEntry, "dirx", sharedLight->Direction.x);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "diry", sharedLight->Direction.y);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "dirz", sharedLight->Direction.z);
+                for (unsigned i = 0; i < 4; i++) {
+                    SetValue(Light.Diffuse[i], sharedLight->Diffuse[i]);
+                    SetValue(Light.Specular[i], sharedLight->Specular[i]);
+                    SetValue(Light.Ambient[i], sharedLight->Ambient[i]);
+                }
+
+                SetValue(Light.Direction[0], sharedLight->Direction.x);
+                SetValue(Light.Direction[1], sharedLight->Direction.y);
+                SetValue(Light.Direction[2], sharedLight->Direction.z);
                 sharedLight->Direction.Normalize();
 
-                xmlDoc->fGetEntryAttribute(xmlEntry, "posx", sharedLight->Location.x);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "posy", sharedLight->Location.y);
-                xmlDoc->fGetEntryAttribute(xmlEntry, "posz", sharedLight->Location.z);
+                SetValue(Light.Location[0], sharedLight->Location.x);
+                SetValue(Light.Location[1], sharedLight->Location.y);
+                SetValue(Light.Location[2], sharedLight->Location.z);
 
-                xmlDoc->bGetEntryAttribute(xmlEntry, "status", sharedLight->On);
+                SetValue(Light.On, sharedLight->On);
             }
         }
         break;
 
-        case constexpr_hash_djb2a("Label"):
+        case eScriptOp::Label:
             break;
 
-        case constexpr_hash_djb2a("Goto"): {
-            std::string tmpLabel{};
-            if (xmlDoc->GetEntryAttribute(xmlEntry, "label", tmpLabel)) {
-                // we don't check GetRootEntry() result, since we checked it in RunScript()
-                sXMLEntry *tmpCycle = xmlDoc->GetRootEntry();
-                for (auto iter = tmpCycle->ChildrenList.begin(); iter != tmpCycle->ChildrenList.end(); ++iter) {
-                    sXMLEntry &tmpEntry = *iter;
-                    if (tmpEntry.Name == "Label") {
-                        std::string tmpName{};
-                        if (xmlDoc->GetEntryAttribute(tmpEntry, "name", tmpName) && tmpLabel == tmpName) {
-                            xmlEntryIter = iter;
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-        break;
+        case eScriptOp::Goto:
+            OpIndex = Op.Index;
+            return true;
 
-        case constexpr_hash_djb2a("MissionComplete"):
+        case eScriptOp::MissionComplete:
             SetGameMissionComplete();
             break;
 
-        case constexpr_hash_djb2a("MissionCompleteAtNoEnemy"): {
-            bool SetGameMissionFlag{false};
-            NeedCheckSpaceShip = false;
-            if (xmlDoc->bGetEntryAttribute(xmlEntry, "ships", NeedCheckSpaceShip)) {
-                SetGameMissionFlag = true;
-            }
-            NeedCheckGroundObject = false;
-            if (xmlDoc->bGetEntryAttribute(xmlEntry, "grounds", NeedCheckGroundObject)) {
-                SetGameMissionFlag = true;
-            }
-            EndDelayMissionComplete = 0.0f;
-            if (xmlDoc->fGetEntryAttribute(xmlEntry, "delay", EndDelayMissionComplete)) {
-                SetGameMissionFlag = true;
-            }
+        case eScriptOp::MissionCompleteAtNoEnemy: {
+            const sScriptMissionComplete &MissionComplete = Program->MissionCompletes[Op.Index];
+            NeedCheckSpaceShip = MissionComplete.CheckSpaceShip;
+            NeedCheckGroundObject = MissionComplete.CheckGroundObject;
+            EndDelayMissionComplete = MissionComplete.Delay;
 
-            if (!SetGameMissionFlag) {
+            if (!MissionComplete.Conditional) {
                 // if no flags set up, act as "MissionComplete"
                 SetGameMissionComplete();
             } else {
@@ -547,97 +471,17 @@ bool cMissionScript::Update(float Time)
             }
         }
         break;
-
-        default:
-            std::cerr << __func__ << "(): " << "tag " << xmlEntry.Name
-                      << " not found, line " << xmlEntry.LineNumber << "\n";
-            break;
         }
     }
 
     return false;
 }
 
-/*
- * Load TimeSheet related script data.
- */
-static void LoadTimeSheetData(cXMLDocument &xmlDoc, const sXMLEntry &XMLEntry,
-                              sTimeSheet &TimeSheet, const std::shared_ptr<cXMLDocument> &xmlAI)
-{
-    if (xmlDoc.iGetEntryAttribute(XMLEntry, "aimode", TimeSheet.AI_Mode)) {
-        xmlDoc.fGetEntryAttribute(XMLEntry, "time", TimeSheet.Time);
-        TimeSheet.xmlAI = xmlAI;
-        return;
-    }
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "time", TimeSheet.Time);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "speed", TimeSheet.Speed);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "acceler", TimeSheet.Acceler);
-    vw_Clamp(TimeSheet.Acceler, 0.0f, 1.0f);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "speedlr", TimeSheet.SpeedLR);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerlr", TimeSheet.AccelerLR);
-    vw_Clamp(TimeSheet.AccelerLR, 0.0f, 1.0f);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "speedud", TimeSheet.SpeedUD);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerud", TimeSheet.AccelerUD);
-    vw_Clamp(TimeSheet.AccelerUD, 0.0f, 1.0f);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "speedbycamfb", TimeSheet.SpeedByCamFB);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerbycamfb", TimeSheet.AccelerByCamFB);
-    vw_Clamp(TimeSheet.AccelerByCamFB, 0.0f, 1.0f);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "speedbycamlr", TimeSheet.SpeedByCamLR);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerbycamlr", TimeSheet.AccelerByCamLR);
-    vw_Clamp(TimeSheet.AccelerByCamLR, 0.0f, 1.0f);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "speedbycamud", TimeSheet.SpeedByCamUD);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerbycamud", TimeSheet.AccelerByCamUD);
-    vw_Clamp(TimeSheet.AccelerByCamUD, 0.0f, 1.0f);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "rotx", TimeSheet.Rotation.x);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "roty", TimeSheet.Rotation.y);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "rotz", TimeSheet.Rotation.z);
-
-    xmlDoc.fGetEntryAttribute(XMLEntry, "rotacx", TimeSheet.RotationAcceler.x);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "rotacy", TimeSheet.RotationAcceler.y);
-    xmlDoc.fGetEntryAttribute(XMLEntry, "rotacz", TimeSheet.RotationAcceler.z);
-    vw_Clamp(TimeSheet.RotationAcceler.x, 0.0f, 1.0f);
-    vw_Clamp(TimeSheet.RotationAcceler.y, 0.0f, 1.0f);
-    vw_Clamp(TimeSheet.RotationAcceler.z, 0.0f, 1.0f);
-    if (xmlDoc.fGetEntryAttribute(XMLEntry, "anglx", TimeSheet.SetAngle.x)) {
-        TimeSheet.NeedSetAngle = true;
-    }
-    if (xmlDoc.fGetEntryAttribute(XMLEntry, "angly", TimeSheet.SetAngle.y)) {
-        TimeSheet.NeedSetAngle = true;
-    }
-    if (xmlDoc.fGetEntryAttribute(XMLEntry, "anglz", TimeSheet.SetAngle.z)) {
-        TimeSheet.NeedSetAngle = true;
-    }
-
-    int tmpFire{0};
-    if (xmlDoc.iGetEntryAttribute(XMLEntry, "fire", tmpFire) && tmpFire > 0) {
-        TimeSheet.Fire = true;
-    }
-
-    int tmpBossFire{0};
-    if (xmlDoc.iGetEntryAttribute(XMLEntry, "bossfire", tmpBossFire) && tmpBossFire > 0) {
-        TimeSheet.BossFire = true;
-    }
-
-    int tmpTargeting{0};
-    if (xmlDoc.iGetEntryAttribute(XMLEntry, "targeting", tmpTargeting) && tmpTargeting != 0) {
-        TimeSheet.Targeting = true;
-    }
-}
-
 /*
  * Load SpaceShip related script data.
  */
-static void LoadSpaceShipScript(std::weak_ptr<cSpaceShip> &SpaceShip, const std::unique_ptr<cXMLDocument> &xmlDoc,
-                                const sXMLEntry &xmlEntry, bool ShowLineNumber, float TimeOpLag,
-                                const std::shared_ptr<cXMLDocument> &xmlAI)
+static void LoadSpaceShipScript(std::weak_ptr<cSpaceShip> &SpaceShip, sScriptObject &ScriptObject,
+                                bool ShowLineNumber, float TimeOpLag, const std::shared_ptr<const sAIProgram> &AI)
 {
     auto sharedSpaceShip = SpaceShip.lock();
     if (!sharedSpaceShip) {
@@ -645,49 +489,40 @@ static void LoadSpaceShipScript(std::weak_ptr<cSpaceShip> &SpaceShip, const std:
     }
 
     if (ShowLineNumber) {
-        SetDebugInformation(*sharedSpaceShip, xmlEntry, ShowLineNumber);
+        SetDebugInformation(*sharedSpaceShip, ScriptObject.LineNumber, ShowLineNumber);
     }
 
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speed", sharedSpaceShip->NeedSpeed)) {
+    if (SetValue(ScriptObject.Speed, sharedSpaceShip->NeedSpeed)) {
         sharedSpaceShip->Speed = sharedSpaceShip->NeedSpeed;
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speedlr", sharedSpaceShip->NeedSpeedLR)) {
+    if (SetValue(ScriptObject.SpeedLR, sharedSpaceShip->NeedSpeedLR)) {
         sharedSpaceShip->SpeedLR = sharedSpaceShip->NeedSpeedLR;
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speedud", sharedSpaceShip->NeedSpeedUD)) {
+    if (SetValue(ScriptObject.SpeedUD, sharedSpaceShip->NeedSpeedUD)) {
         sharedSpaceShip->SpeedUD = sharedSpaceShip->NeedSpeedUD;
     }
 
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speedbycamfb", sharedSpaceShip->NeedSpeedByCamFB)) {
+    if (SetValue(ScriptObject.SpeedByCamFB, sharedSpaceShip->NeedSpeedByCamFB)) {
         sharedSpaceShip->SpeedByCamFB = sharedSpaceShip->NeedSpeedByCamFB;
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speedbycamlr", sharedSpaceShip->NeedSpeedByCamLR)) {
+    if (SetValue(ScriptObject.SpeedByCamLR, sharedSpaceShip->NeedSpeedByCamLR)) {
         sharedSpaceShip->SpeedByCamLR = sharedSpaceShip->NeedSpeedByCamLR;
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speedbycamud", sharedSpaceShip->NeedSpeedByCamUD)) {
+    if (SetValue(ScriptObject.SpeedByCamUD, sharedSpaceShip->NeedSpeedByCamUD)) {
         sharedSpaceShip->SpeedByCamUD = sharedSpaceShip->NeedSpeedByCamUD;
     }
 
-    SetDeleteAfterLeaveScene(*sharedSpaceShip, xmlEntry, xmlDoc);
-    SetAIMode(sharedSpaceShip->TimeSheetList, xmlEntry, xmlDoc, xmlAI);
-    SetRotation(*sharedSpaceShip, xmlEntry, xmlDoc);
-    SetLocation(*sharedSpaceShip, xmlEntry, xmlDoc, TimeOpLag);
-
-    for (const auto &tmpXMLEntry : xmlEntry.ChildrenList) {
-        if (tmpXMLEntry.Name == "TimeSheet") {
-            sharedSpaceShip->TimeSheetList.emplace_back();
-            LoadTimeSheetData(*xmlDoc.get(), tmpXMLEntry, sharedSpaceShip->TimeSheetList.back(), xmlAI);
-        }
-    }
+    SetDeleteAfterLeaveScene(*sharedSpaceShip, ScriptObject);
+    sharedSpaceShip->SetRotation(ScriptObject.Rotation);
+    SetLocation(*sharedSpaceShip, ScriptObject, TimeOpLag);
+    SetTimeSheets(*sharedSpaceShip, ScriptObject, AI);
 }
 
 /*
  * Load GroundObject related script data.
  */
-static void LoadGroundObjectScript(std::weak_ptr<cGroundObject> &GroundObject,
-                                   const std::unique_ptr<cXMLDocument> &xmlDoc,
-                                   const sXMLEntry &xmlEntry, bool ShowLineNumber, float TimeOpLag,
-                                   const std::shared_ptr<cXMLDocument> &xmlAI)
+static void LoadGroundObjectScript(std::weak_ptr<cGroundObject> &GroundObject, sScriptObject &ScriptObject,
+                                   bool ShowLineNumber, float TimeOpLag, const std::shared_ptr<const sAIProgram> &AI)
 {
     auto sharedGroundObject = GroundObject.lock();
     if (!sharedGroundObject) {
@@ -695,31 +530,23 @@ static void LoadGroundObjectScript(std::weak_ptr<cGroundObject> &GroundObject,
     }
 
     if (ShowLineNumber) {
-        SetDebugInformation(*sharedGroundObject, xmlEntry, ShowLineNumber);
+        SetDebugInformation(*sharedGroundObject, ScriptObject.LineNumber, ShowLineNumber);
     }
-    if (xmlDoc->fGetEntryAttribute(xmlEntry, "speed", sharedGroundObject->NeedSpeed)) {
+    if (SetValue(ScriptObject.Speed, sharedGroundObject->NeedSpeed)) {
         sharedGroundObject->Speed = sharedGroundObject->NeedSpeed;
     }
 
-    SetDeleteAfterLeaveScene(*sharedGroundObject, xmlEntry, xmlDoc);
-    SetAIMode(sharedGroundObject->TimeSheetList, xmlEntry, xmlDoc, xmlAI);
-    SetRotation(*sharedGroundObject, xmlEntry, xmlDoc);
-    SetLocation(*sharedGroundObject, xmlEntry, xmlDoc, TimeOpLag);
-
-    for (const auto &tmpXMLEntry : xmlEntry.ChildrenList) {
-        if (tmpXMLEntry.Name == "TimeSheet") {
-            sharedGroundObject->TimeSheetList.emplace_back();
-            LoadTimeSheetData(*xmlDoc.get(), tmpXMLEntry, sharedGroundObject->TimeSheetList.back(), xmlAI);
-        }
-    }
+    SetDeleteAfterLeaveScene(*sharedGroundObject, ScriptObject);
+    sharedGroundObject->SetRotation(ScriptObject.Rotation);
+    SetLocation(*sharedGroundObject, ScriptObject, TimeOpLag);
+    SetTimeSheets(*sharedGroundObject, ScriptObject, AI);
 }
 
 /*
  * Load SpaceObject related script data.
  */
-static void LoadSpaceObjectScript(std::weak_ptr<cSpaceObject> &SpaceObject,
-                                  const std::unique_ptr<cXMLDocument> &xmlDoc,
-                                  const sXMLEntry &xmlEntry, bool ShowLineNumber, float TimeOpLag)
+static void LoadSpaceObjectScript(std::weak_ptr<cSpaceObject> &SpaceObject, const sScriptObject &ScriptObject,
+                                  bool ShowLineNumber, float TimeOpLag)
 {
     auto sharedSpaceObject = SpaceObject.lock();
     if (!sharedSpaceObject) {
@@ -727,159 +554,111 @@ static void LoadSpaceObjectScript(std::weak_ptr<cSpaceObject> &SpaceObject,
     }
 
     if (ShowLineNumber) {
-        SetDebugInformation(*sharedSpaceObject, xmlEntry, ShowLineNumber);
+        SetDebugInformation(*sharedSpaceObject, ScriptObject.LineNumber, ShowLineNumber);
     }
-    xmlDoc->fGetEntryAttribute(xmlEntry, "speed", sharedSpaceObject->Speed);
-    SetDeleteAfterLeaveScene(*sharedSpaceObject, xmlEntry, xmlDoc);
+    SetValue(ScriptObject.Speed, sharedSpaceObject->Speed);
+    SetDeleteAfterLeaveScene(*sharedSpaceObject, ScriptObject);
 
-    SetRotation(*sharedSpaceObject, xmlEntry, xmlDoc);
-    SetLocation(*sharedSpaceObject, xmlEntry, xmlDoc, TimeOpLag);
+    sharedSpaceObject->SetRotation(ScriptObject.Rotation);
+    SetLocation(*sharedSpaceObject, ScriptObject, TimeOpLag);
 
-    xmlDoc->fGetEntryAttribute(xmlEntry, "rotx", sharedSpaceObject->RotationSpeed.x);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "roty", sharedSpaceObject->RotationSpeed.y);
-    xmlDoc->fGetEntryAttribute(xmlEntry, "rotz", sharedSpaceObject->RotationSpeed.z);
+    SetValue(ScriptObject.RotationSpeed[0], sharedSpaceObject->RotationSpeed.x);
+    SetValue(ScriptObject.RotationSpeed[1], sharedSpaceObject->RotationSpeed.y);
+    SetValue(ScriptObject.RotationSpeed[2], sharedSpaceObject->RotationSpeed.z);
 }
 
 /*
  * Update TimeLine.
  */
-void cMissionScript::UpdateTimeLine()
+void cMissionScript::UpdateTimeLine(const sScriptOp &Op)
 {
-    for (auto &TL : xmlEntryIter->ChildrenList) {
+    for (unsigned i = Op.Index; i < Op.Index + Op.Count; i++) {
+        sScriptObject &TL = Program->Objects[i];
+        const int tmpType = TL.ObjectType.Value;
 
-        int tmpType{0};
+        switch (TL.Type) {
+        case eScriptObject::EarthFighter: {
+            std::weak_ptr<cSpaceShip> SpaceShip = CreateEarthSpaceFighter(tmpType);
+            LoadSpaceShipScript(SpaceShip, TL, ShowLineNumber, TimeOpLag, AI);
 
-        // constexpr_hash_djb2a() could generate error at compile-time, make sure hashes is unique
-        switch (TL.NameHash) {
-        case constexpr_hash_djb2a("EarthFighter"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cSpaceShip> SpaceShip = CreateEarthSpaceFighter(tmpType);
-                LoadSpaceShipScript(SpaceShip, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-
-                int tmpInteger{0};
-                if (xmlDoc->iGetEntryAttribute(TL, "armor", tmpInteger)) {
-                    SetEarthSpaceFighterArmor(SpaceShip, tmpInteger);
-                }
+            if (TL.Armor.Set) {
+                SetEarthSpaceFighterArmor(SpaceShip, TL.Armor.Value);
+            }
 
-                for (unsigned int i = 1; i <= config::MAX_WEAPONS; i++) {
-                    if (xmlDoc->iGetEntryAttribute(TL, "weapon" + std::to_string(i), tmpInteger)) {
-                        SetEarthSpaceFighterWeapon(SpaceShip, i, tmpInteger);
-                    }
+            for (unsigned int j = 0; j < config::MAX_WEAPONS; j++) {
+                if (TL.Weapons[j].Set) {
+                    SetEarthSpaceFighterWeapon(SpaceShip, j + 1, TL.Weapons[j].Value);
                 }
             }
-            break;
+        }
+        break;
 
-        case constexpr_hash_djb2a("AlienFighter"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cSpaceShip> SpaceShip = CreateAlienSpaceFighter(tmpType);
-                LoadSpaceShipScript(SpaceShip, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
+        case eScriptObject::AlienFighter: {
+            std::weak_ptr<cSpaceShip> SpaceShip = CreateAlienSpaceFighter(tmpType);
+            LoadSpaceShipScript(SpaceShip, TL, ShowLineNumber, TimeOpLag, AI);
+        }
+        break;
 
-        case constexpr_hash_djb2a("AlienMotherShip"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cSpaceShip> SpaceShip = CreateAlienSpaceMotherShip(tmpType);
-                LoadSpaceShipScript(SpaceShip, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
+        case eScriptObject::AlienMotherShip: {
+            std::weak_ptr<cSpaceShip> SpaceShip = CreateAlienSpaceMotherShip(tmpType);
+            LoadSpaceShipScript(SpaceShip, TL, ShowLineNumber, TimeOpLag, AI);
+        }
+        break;
 
-        case constexpr_hash_djb2a("PirateShip"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cSpaceShip> SpaceShip = CreatePirateShip(tmpType);
-                LoadSpaceShipScript(SpaceShip, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
+        case eScriptObject::PirateShip: {
+            std::weak_ptr<cSpaceShip> SpaceShip = CreatePirateShip(tmpType);
+            LoadSpaceShipScript(SpaceShip, TL, ShowLineNumber, TimeOpLag, AI);
+        }
+        break;
 
-        case constexpr_hash_djb2a("CreateAsteroid"): {
+        case eScriptObject::Asteroid: {
             std::weak_ptr<cSpaceObject> SpaceObject = CreateSmallAsteroid();
-            LoadSpaceObjectScript(SpaceObject, xmlDoc, TL, ShowLineNumber, TimeOpLag);
+            LoadSpaceObjectScript(SpaceObject, TL, ShowLineNumber, TimeOpLag);
         }
         break;
 
-        case constexpr_hash_djb2a("CreateBasePart"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cSpaceObject> SpaceObject = CreateBasePart(tmpType);
-                LoadSpaceObjectScript(SpaceObject, xmlDoc, TL, ShowLineNumber, TimeOpLag);
-            }
-            break;
+        case eScriptObject::BasePart: {
+            std::weak_ptr<cSpaceObject> SpaceObject = CreateBasePart(tmpType);
+            LoadSpaceObjectScript(SpaceObject, TL, ShowLineNumber, TimeOpLag);
+        }
+        break;
 
-        case constexpr_hash_djb2a("CreateBigAsteroid"): {
+        case eScriptObject::BigAsteroid: {
             // we could create random asteroid, or provide particular asteroid id
-            xmlDoc->iGetEntryAttribute(TL, "type", tmpType);
             std::weak_ptr<cSpaceObject> SpaceObject = CreateBigAsteroid(tmpType);
-            LoadSpaceObjectScript(SpaceObject, xmlDoc, TL, ShowLineNumber, TimeOpLag);
-            break;
+            LoadSpaceObjectScript(SpaceObject, TL, ShowLineNumber, TimeOpLag);
         }
+        break;
 
-        case constexpr_hash_djb2a("CreateMBuilding"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cGroundObject> GroundObject = CreateMilitaryBuilding(tmpType);
-                LoadGroundObjectScript(GroundObject, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
-
-        case constexpr_hash_djb2a("CreateBuilding"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cGroundObject> GroundObject = CreateCivilianBuilding(tmpType);
-                LoadGroundObjectScript(GroundObject, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
-
-        case constexpr_hash_djb2a("CreateTracked"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cGroundObject> GroundObject = CreateTracked(tmpType);
-                LoadGroundObjectScript(GroundObject, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
-
-        case constexpr_hash_djb2a("CreateWheeled"):
-            if (xmlDoc->iGetEntryAttribute(TL, "type", tmpType)) {
-                std::weak_ptr<cGroundObject> GroundObject = CreateWheeled(tmpType);
-                LoadGroundObjectScript(GroundObject, xmlDoc, TL, ShowLineNumber, TimeOpLag, xmlAI);
-            }
-            break;
+        case eScriptObject::MilitaryBuilding: {
+            std::weak_ptr<cGroundObject> GroundObject = CreateMilitaryBuilding(tmpType);
+            LoadGroundObjectScript(GroundObject, TL, ShowLineNumber, TimeOpLag, AI);
+        }
+        break;
 
-        default:
-            std::cerr << __func__ << "(): " << "tag " << TL.Name
-                      << " not found, line " << TL.LineNumber << "\n";
-            break;
+        case eScriptObject::CivilianBuilding: {
+            std::weak_ptr<cGroundObject> GroundObject = CreateCivilianBuilding(tmpType);
+            LoadGroundObjectScript(GroundObject, TL, ShowLineNumber, TimeOpLag, AI);
         }
-    }
-}
+        break;
 
-/*
- * Unpack TimeSheet to the list.
- */
-void UnpackAIMode(std::list<sTimeSheet> &TimeSheetList)
-{
-    auto iter = TimeSheetList.begin();
-
-    for (auto &xmlEntry : TimeSheetList.front().xmlAI->GetRootEntry()->ChildrenList) {
-        int tmpAI_Mode{0};
-        if (TimeSheetList.front().xmlAI->iGetEntryAttribute(xmlEntry, "num", tmpAI_Mode)
-            && tmpAI_Mode == TimeSheetList.front().AI_Mode) {
-
-            // "unpack" all the elements
-            for (auto &tmpChildEntry : xmlEntry.ChildrenList) {
-                if (tmpChildEntry.Name == "TimeSheet") {
-                    iter = TimeSheetList.emplace(++iter);
-                    LoadTimeSheetData(*TimeSheetList.front().xmlAI.get(), tmpChildEntry,
-                                      *iter, TimeSheetList.front().xmlAI);
-                }
-            }
+        case eScriptObject::Tracked: {
+            std::weak_ptr<cGroundObject> GroundObject = CreateTracked(tmpType);
+            LoadGroundObjectScript(GroundObject, TL, ShowLineNumber, TimeOpLag, AI);
+        }
+        break;
 
-            // for cycled, create duplicate at the end of unpacked elements
-            if (TimeSheetList.front().Time == -1.0f) {
-                TimeSheetList.emplace(++iter, TimeSheetList.front());
-            }
+        case eScriptObject::Wheeled: {
+            std::weak_ptr<cGroundObject> GroundObject = CreateWheeled(tmpType);
+            LoadGroundObjectScript(GroundObject, TL, ShowLineNumber, TimeOpLag, AI);
+        }
+        break;
 
-            // since we already unpack this entry, remove it
-            TimeSheetList.pop_front();
-            return;
+        case eScriptObject::Planet:
+        case eScriptObject::Planetoid:
+            break;
         }
     }
-
-    std::cerr << __func__ << "(): " << "AI_Mode " << TimeSheetList.front().AI_Mode << " not found.\n";
 }
 
 } // astromenace namespace
@@ -38,12 +38,14 @@
 namespace viewizard {
 namespace astromenace {
 
+struct sAIProgram;
+struct sMissionProgram;
+struct sScriptOp;
+
 struct sTimeSheet {
-    bool InUse{false};
     float Time{0.0f};
 
     int AI_Mode{0}; // packed TimeSheet
-    std::shared_ptr<cXMLDocument> xmlAI{}; // xml with packed TimeSheets
 
     float Speed{0.0f};
     float Acceler{1.0f}; // [0.0f, 1.0f]
@@ -68,19 +70,29 @@ struct sTimeSheet {
     bool Targeting{false};
 };
 
+// TimeSheets with all AI modes unpacked, shared by objects (read only).
+struct sTimeSheetProgram {
+    std::vector<sTimeSheet> TimeSheets{};
+    // continue from this TimeSheet after the last one, if equal to TimeSheets size - stop
+    unsigned LoopStart{0};
+};
+
 class cMissionScript
 {
 public:
+    cMissionScript();
+    ~cMissionScript();
+
     bool RunScript(const std::string &FileName, float InitTime);
     bool Update(float Time);
-    void UpdateTimeLine();
+    void UpdateTimeLine(const sScriptOp &Op);
 
     float TimeLastOp{0}; // last operational time
     float StartTime{0}; // script start time
     float TimeOpLag{0}; // care about time lag
 
-    std::unique_ptr<cXMLDocument> xmlDoc{};
-    std::list<sXMLEntry>::iterator xmlEntryIter{};
+    std::unique_ptr<sMissionProgram> Program{};
+    unsigned OpIndex{0}; // current instruction
 
     bool ShowLineNumber{false};
 
@@ -103,15 +115,9 @@ public:
     bool AsterOn{false};
 
 private:
-    std::shared_ptr<cXMLDocument> xmlAI{};
+    std::shared_ptr<const sAIProgram> AI{};
 };
 
-
-/*
- * Unpack TimeSheet to the list.
- */
-void UnpackAIMode(std::list<sTimeSheet> &TimeSheetList);
-
 } // astromenace namespace
 } // viewizard namespace
 
@@ -0,0 +1,639 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#include "script_program.h"
+#include <algorithm>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+// compiled AI files, shared by all scripts and objects
+std::unordered_map<std::string, std::weak_ptr<const sAIProgram>> AIProgramsCache{};
+// nested AI modes limit, in order to prevent infinite recursion
+constexpr unsigned MaxAIModeDepth{8};
+
+} // unnamed namespace
+
+
+/*
+ * Read optional integer attribute.
+ */
+static void ReadValue(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                      const std::string &Name, sScriptValue<int> &Value)
+{
+    Value.Set = xmlDoc.iGetEntryAttribute(xmlEntry, Name, Value.Value);
+}
+
+/*
+ * Read optional float attribute.
+ */
+static void ReadValue(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                      const std::string &Name, sScriptValue<float> &Value)
+{
+    Value.Set = xmlDoc.fGetEntryAttribute(xmlEntry, Name, Value.Value);
+}
+
+/*
+ * Read optional bool attribute.
+ */
+static void ReadValue(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                      const std::string &Name, sScriptValue<bool> &Value)
+{
+    Value.Set = xmlDoc.bGetEntryAttribute(xmlEntry, Name, Value.Value);
+}
+
+/*
+ * Read optional 'x', 'y' and 'z' attributes with same prefix.
+ */
+static void ReadValues(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                       const std::string &Prefix, std::array<sScriptValue<float>, 3> &Values)
+{
+    ReadValue(xmlDoc, xmlEntry, Prefix + "x", Values[0]);
+    ReadValue(xmlDoc, xmlEntry, Prefix + "y", Values[1]);
+    ReadValue(xmlDoc, xmlEntry, Prefix + "z", Values[2]);
+}
+
+/*
+ * Read optional 'r', 'g', 'b' and 'a' attributes with same prefix.
+ */
+static void ReadValues(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                       const std::string &Prefix, std::array<sScriptValue<float>, 4> &Values)
+{
+    ReadValue(xmlDoc, xmlEntry, Prefix + "r", Values[0]);
+    ReadValue(xmlDoc, xmlEntry, Prefix + "g", Values[1]);
+    ReadValue(xmlDoc, xmlEntry, Prefix + "b", Values[2]);
+    ReadValue(xmlDoc, xmlEntry, Prefix + "a", Values[3]);
+}
+
+/*
+ * Load TimeSheet related script data.
+ */
+static void LoadTimeSheetData(cXMLDocument &xmlDoc, const sXMLEntry &XMLEntry, sTimeSheet &TimeSheet)
+{
+    if (xmlDoc.iGetEntryAttribute(XMLEntry, "aimode", TimeSheet.AI_Mode)) {
+        xmlDoc.fGetEntryAttribute(XMLEntry, "time", TimeSheet.Time);
+        return;
+    }
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "time", TimeSheet.Time);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "speed", TimeSheet.Speed);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "acceler", TimeSheet.Acceler);
+    vw_Clamp(TimeSheet.Acceler, 0.0f, 1.0f);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "speedlr", TimeSheet.SpeedLR);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerlr", TimeSheet.AccelerLR);
+    vw_Clamp(TimeSheet.AccelerLR, 0.0f, 1.0f);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "speedud", TimeSheet.SpeedUD);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerud", TimeSheet.AccelerUD);
+    vw_Clamp(TimeSheet.AccelerUD, 0.0f, 1.0f);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "speedbycamfb", TimeSheet.SpeedByCamFB);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerbycamfb", TimeSheet.AccelerByCamFB);
+    vw_Clamp(TimeSheet.AccelerByCamFB, 0.0f, 1.0f);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "speedbycamlr", TimeSheet.SpeedByCamLR);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerbycamlr", TimeSheet.AccelerByCamLR);
+    vw_Clamp(TimeSheet.AccelerByCamLR, 0.0f, 1.0f);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "speedbycamud", TimeSheet.SpeedByCamUD);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "accelerbycamud", TimeSheet.AccelerByCamUD);
+    vw_Clamp(TimeSheet.AccelerByCamUD, 0.0f, 1.0f);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "rotx", TimeSheet.Rotation.x);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "roty", TimeSheet.Rotation.y);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "rotz", TimeSheet.Rotation.z);
+
+    xmlDoc.fGetEntryAttribute(XMLEntry, "rotacx", TimeSheet.RotationAcceler.x);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "rotacy", TimeSheet.RotationAcceler.y);
+    xmlDoc.fGetEntryAttribute(XMLEntry, "rotacz", TimeSheet.RotationAcceler.z);
+    vw_Clamp(TimeSheet.RotationAcceler.x, 0.0f, 1.0f);
+    vw_Clamp(TimeSheet.RotationAcceler.y, 0.0f, 1.0f);
+    vw_Clamp(TimeSheet.RotationAcceler.z, 0.0f, 1.0f);
+    if (xmlDoc.fGetEntryAttribute(XMLEntry, "anglx", TimeSheet.SetAngle.x)) {
+        TimeSheet.NeedSetAngle = true;
+    }
+    if (xmlDoc.fGetEntryAttribute(XMLEntry, "angly", TimeSheet.SetAngle.y)) {
+        TimeSheet.NeedSetAngle = true;
+    }
+    if (xmlDoc.fGetEntryAttribute(XMLEntry, "anglz", TimeSheet.SetAngle.z)) {
+        TimeSheet.NeedSetAngle = true;
+    }
+
+    int tmpFire{0};
+    if (xmlDoc.iGetEntryAttribute(XMLEntry, "fire", tmpFire) && tmpFire > 0) {
+        TimeSheet.Fire = true;
+    }
+
+    int tmpBossFire{0};
+    if (xmlDoc.iGetEntryAttribute(XMLEntry, "bossfire", tmpBossFire) && tmpBossFire > 0) {
+        TimeSheet.BossFire = true;
+    }
+
+    int tmpTargeting{0};
+    if (xmlDoc.iGetEntryAttribute(XMLEntry, "targeting", tmpTargeting) && tmpTargeting != 0) {
+        TimeSheet.Targeting = true;
+    }
+}
+
+/*
+ * Find AI mode by number.
+ */
+const sAIMode *sAIProgram::FindMode(int Num) const
+{
+    auto iter = std::lower_bound(Modes.begin(), Modes.end(), Num,
+                                 [] (const sAIMode &Mode, int tmpNum) {return Mode.Num < tmpNum;});
+    if (iter == Modes.end() || iter->Num != Num) {
+        return nullptr;
+    }
+    return &(*iter);
+}
+
+/*
+ * Unpack all AI modes into program. Return false, if TimeSheets looped (rest are unreachable).
+ */
+static bool UnpackTimeSheets(const std::vector<sTimeSheet> &TimeSheets, const sAIProgram &AIProgram,
+                             sTimeSheetProgram &Program, unsigned Depth)
+{
+    for (const auto &tmpTimeSheet : TimeSheets) {
+        if (tmpTimeSheet.AI_Mode == 0) {
+            Program.TimeSheets.push_back(tmpTimeSheet);
+            continue;
+        }
+
+        const sAIMode *AIMode = AIProgram.FindMode(tmpTimeSheet.AI_Mode);
+        if (!AIMode || Depth >= MaxAIModeDepth) {
+            std::cerr << __func__ << "(): " << "AI_Mode " << tmpTimeSheet.AI_Mode << " not found.\n";
+            continue;
+        }
+
+        unsigned LoopStart = static_cast<unsigned>(Program.TimeSheets.size());
+        if (!UnpackTimeSheets(AIMode->TimeSheets, AIProgram, Program, Depth + 1)) {
+            return false;
+        }
+        // cycled AI mode, loop to the beginning of unpacked elements (if we have them)
+        if (tmpTimeSheet.Time == -1.0f) {
+            Program.LoopStart = LoopStart;
+            return false;
+        }
+    }
+
+    Program.LoopStart = static_cast<unsigned>(Program.TimeSheets.size());
+    return true;
+}
+
+/*
+ * Compile TimeSheets program, unpack all AI modes.
+ */
+std::shared_ptr<const sTimeSheetProgram> CompileTimeSheetProgram(const std::vector<sTimeSheet> &TimeSheets,
+                                                                 const sAIProgram *AIProgram)
+{
+    if (TimeSheets.empty()) {
+        return std::shared_ptr<const sTimeSheetProgram>{};
+    }
+
+    // only one looped AI mode, use AI file's shared program
+    if (AIProgram
+        && TimeSheets.size() == 1
+        && TimeSheets.front().AI_Mode != 0
+        && TimeSheets.front().Time == -1.0f) {
+        if (const sAIMode *AIMode = AIProgram->FindMode(TimeSheets.front().AI_Mode)) {
+            return AIMode->Program;
+        }
+    }
+
+    std::shared_ptr<sTimeSheetProgram> Program = std::make_shared<sTimeSheetProgram>();
+    if (AIProgram) {
+        UnpackTimeSheets(TimeSheets, *AIProgram, *Program, 0);
+    } else {
+        // without AI file, we could use only regular TimeSheets
+        for (const auto &tmpTimeSheet : TimeSheets) {
+            if (tmpTimeSheet.AI_Mode == 0) {
+                Program->TimeSheets.push_back(tmpTimeSheet);
+            } else {
+                std::cerr << __func__ << "(): " << "AI_Mode " << tmpTimeSheet.AI_Mode << " not found.\n";
+            }
+        }
+        Program->LoopStart = static_cast<unsigned>(Program->TimeSheets.size());
+    }
+    return Program;
+}
+
+/*
+ * Compile AI file.
+ */
+std::shared_ptr<const sAIProgram> CompileAIProgram(const std::string &FileName)
+{
+    auto CacheIter = AIProgramsCache.find(FileName);
+    if (CacheIter != AIProgramsCache.end()) {
+        if (auto sharedAIProgram = CacheIter->second.lock()) {
+            return sharedAIProgram;
+        }
+    }
+
+    cXMLDocument xmlAI{FileName};
+    if (!xmlAI.GetRootEntry()) {
+        return std::shared_ptr<const sAIProgram>{};
+    }
+
+    std::shared_ptr<sAIProgram> AIProgram = std::make_shared<sAIProgram>();
+    for (const auto &xmlEntry : xmlAI.GetRootEntry()->ChildrenList) {
+        int tmpAI_Mode{0};
+        if (!xmlAI.iGetEntryAttribute(xmlEntry, "num", tmpAI_Mode)) {
+            continue;
+        }
+
+        AIProgram->Modes.emplace_back();
+        AIProgram->Modes.back().Num = tmpAI_Mode;
+        for (const auto &tmpChildEntry : xmlEntry.ChildrenList) {
+            if (tmpChildEntry.Name == "TimeSheet") {
+                AIProgram->Modes.back().TimeSheets.emplace_back();
+                LoadTimeSheetData(xmlAI, tmpChildEntry, AIProgram->Modes.back().TimeSheets.back());
+            }
+        }
+    }
+    // stable, since first mode with same number should be used
+    std::stable_sort(AIProgram->Modes.begin(), AIProgram->Modes.end(),
+                     [] (const sAIMode &A, const sAIMode &B) {return A.Num < B.Num;});
+
+    // objects usually use only one looped AI mode, prepare shared programs for them
+    for (auto &tmpAIMode : AIProgram->Modes) {
+        std::shared_ptr<sTimeSheetProgram> tmpProgram = std::make_shared<sTimeSheetProgram>();
+        sTimeSheet tmpPackedTimeSheet{};
+        tmpPackedTimeSheet.Time = -1.0f;
+        tmpPackedTimeSheet.AI_Mode = tmpAIMode.Num;
+        UnpackTimeSheets(std::vector<sTimeSheet>{tmpPackedTimeSheet}, *AIProgram, *tmpProgram, 0);
+        tmpAIMode.Program = tmpProgram;
+    }
+
+    AIProgramsCache[FileName] = AIProgram;
+    return AIProgram;
+}
+
+/*
+ * Compile object's location and rotation.
+ */
+static void CompilePlacement(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry, sScriptObject &Object)
+{
+    // absolute and camera-related angles are the same for now
+    xmlDoc.fGetEntryAttribute(xmlEntry, "anglax", Object.Rotation.x);
+    xmlDoc.fGetEntryAttribute(xmlEntry, "anglay", Object.Rotation.y);
+    xmlDoc.fGetEntryAttribute(xmlEntry, "anglaz", Object.Rotation.z);
+    xmlDoc.fGetEntryAttribute(xmlEntry, "anglx", Object.Rotation.x);
+    xmlDoc.fGetEntryAttribute(xmlEntry, "angly", Object.Rotation.y);
+    xmlDoc.fGetEntryAttribute(xmlEntry, "anglz", Object.Rotation.z);
+
+    ReadValues(xmlDoc, xmlEntry, "posa", Object.AbsoluteLocation);
+    ReadValues(xmlDoc, xmlEntry, "pos", Object.RelativeLocation);
+}
+
+/*
+ * Compile object, created by script.
+ */
+static bool CompileObject(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                          eScriptObject Type, sMissionProgram &Program)
+{
+    sScriptObject Object{};
+    ReadValue(xmlDoc, xmlEntry, "type", Object.ObjectType);
+    // we could create random planetoid or asteroid, for all other objects type is mandatory
+    if (!Object.ObjectType.Set
+        && Type != eScriptObject::Planetoid
+        && Type != eScriptObject::Asteroid
+        && Type != eScriptObject::BigAsteroid) {
+        return false;
+    }
+
+    Object.Type = Type;
+    Object.LineNumber = xmlEntry.LineNumber;
+
+    ReadValue(xmlDoc, xmlEntry, "armor", Object.Armor);
+    for (unsigned i = 0; i < config::MAX_WEAPONS; i++) {
+        ReadValue(xmlDoc, xmlEntry, "weapon" + std::to_string(i + 1), Object.Weapons[i]);
+    }
+
+    ReadValue(xmlDoc, xmlEntry, "speed", Object.Speed);
+    ReadValue(xmlDoc, xmlEntry, "speedlr", Object.SpeedLR);
+    ReadValue(xmlDoc, xmlEntry, "speedud", Object.SpeedUD);
+    ReadValue(xmlDoc, xmlEntry, "speedbycamfb", Object.SpeedByCamFB);
+    ReadValue(xmlDoc, xmlEntry, "speedbycamlr", Object.SpeedByCamLR);
+    ReadValue(xmlDoc, xmlEntry, "speedbycamud", Object.SpeedByCamUD);
+    ReadValues(xmlDoc, xmlEntry, "rot", Object.RotationSpeed);
+
+    int tmpStatus{0};
+    if (xmlDoc.iGetEntryAttribute(xmlEntry, "onhide", tmpStatus) && tmpStatus <= 0) {
+        Object.DeleteAfterLeaveScene = false;
+    }
+
+    CompilePlacement(xmlDoc, xmlEntry, Object);
+
+    int tmpAI_Mode{0};
+    if (xmlDoc.iGetEntryAttribute(xmlEntry, "aimode", tmpAI_Mode)) {
+        Object.TimeSheets.emplace_back();
+        Object.TimeSheets.back().Time = -1;
+        Object.TimeSheets.back().AI_Mode = tmpAI_Mode;
+    }
+    for (const auto &tmpXMLEntry : xmlEntry.ChildrenList) {
+        if (tmpXMLEntry.Name == "TimeSheet") {
+            Object.TimeSheets.emplace_back();
+            LoadTimeSheetData(xmlDoc, tmpXMLEntry, Object.TimeSheets.back());
+        }
+    }
+
+    Program.Objects.push_back(std::move(Object));
+    return true;
+}
+
+/*
+ * Compile TimeLine's children.
+ */
+static void CompileTimeLine(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry,
+                            sScriptOp &Op, sMissionProgram &Program)
+{
+    Op.Index = static_cast<unsigned>(Program.Objects.size());
+
+    for (const auto &TL : xmlEntry.ChildrenList) {
+        eScriptObject Type{eScriptObject::Asteroid};
+        // constexpr_hash_djb2a() could generate error at compile-time, make sure hashes is unique
+        switch (TL.NameHash) {
+        case constexpr_hash_djb2a("EarthFighter"):
+            Type = eScriptObject::EarthFighter;
+            break;
+        case constexpr_hash_djb2a("AlienFighter"):
+            Type = eScriptObject::AlienFighter;
+            break;
+        case constexpr_hash_djb2a("AlienMotherShip"):
+            Type = eScriptObject::AlienMotherShip;
+            break;
+        case constexpr_hash_djb2a("PirateShip"):
+            Type = eScriptObject::PirateShip;
+            break;
+        case constexpr_hash_djb2a("CreateAsteroid"):
+            Type = eScriptObject::Asteroid;
+            break;
+        case constexpr_hash_djb2a("CreateBasePart"):
+            Type = eScriptObject::BasePart;
+            break;
+        case constexpr_hash_djb2a("CreateBigAsteroid"):
+            Type = eScriptObject::BigAsteroid;
+            break;
+        case constexpr_hash_djb2a("CreateMBuilding"):
+            Type = eScriptObject::MilitaryBuilding;
+            break;
+        case constexpr_hash_djb2a("CreateBuilding"):
+            Type = eScriptObject::CivilianBuilding;
+            break;
+        case constexpr_hash_djb2a("CreateTracked"):
+            Type = eScriptObject::Tracked;
+            break;
+        case constexpr_hash_djb2a("CreateWheeled"):
+            Type = eScriptObject::Wheeled;
+            break;
+        default:
+            std::cerr << __func__ << "(): " << "tag " << TL.Name
+                      << " not found, line " << TL.LineNumber << "\n";
+            continue;
+        }
+
+        CompileObject(xmlDoc, TL, Type, Program);
+    }
+
+    Op.Count = static_cast<unsigned>(Program.Objects.size()) - Op.Index;
+}
+
+/*
+ * Compile Light.
+ */
+static void CompileLight(cXMLDocument &xmlDoc, const sXMLEntry &xmlEntry, sScriptLight &Light)
+{
+    int tmpType{0};
+    if (xmlDoc.iGetEntryAttribute(xmlEntry, "type", tmpType) && tmpType == 1) {
+        Light.Type = eLightType::Point;
+    }
+
+    ReadValues(xmlDoc, xmlEntry, "diff", Light.Diffuse);
+    ReadValues(xmlDoc, xmlEntry, "spec", Light.Specular);
+    ReadValues(xmlDoc, xmlEntry, "ambi", Light.Ambient);
+    ReadValues(xmlDoc, xmlEntry, "dir", Light.Direction);
+    ReadValues(xmlDoc, xmlEntry, "pos", Light.Location);
+    ReadValue(xmlDoc, xmlEntry, "status", Light.On);
+}
+
+/*
+ * Compile mission script.
+ */
+bool CompileMissionScript(const std::string &FileName, sMissionProgram &Program)
+{
+    cXMLDocument xmlDoc{FileName, true};
+
+    if (!xmlDoc.GetRootEntry() || xmlDoc.GetRootEntry()->Name != "AstroMenaceScript") {
+        std::cerr << __func__ << "(): " << "Can't find AstroMenaceScript element in the: " << FileName << "\n";
+        return false;
+    }
+
+    if (xmlDoc.GetRootEntry()->ChildrenList.empty()) {
+        std::cerr << __func__ << "(): " << "Can't find element's children in the: " << FileName << "\n";
+        return false;
+    }
+
+    // labels and Goto's labels, resolved after all ops compiled
+    std::vector<std::pair<std::string, unsigned>> Labels{};
+    std::vector<std::pair<std::string, unsigned>> Gotos{};
+
+    // constexpr_hash_djb2a() could generate error at compile-time, make sure hashes is unique
+    for (const auto &xmlEntry : xmlDoc.GetRootEntry()->ChildrenList) {
+        sScriptOp Op{};
+        Op.LineNumber = xmlEntry.LineNumber;
+
+        switch (xmlEntry.NameHash) {
+        case constexpr_hash_djb2a("TimeLine"):
+            Op.Code = eScriptOp::TimeLine;
+            xmlDoc.fGetEntryAttribute(xmlEntry, "value", Op.Time);
+            CompileTimeLine(xmlDoc, xmlEntry, Op, Program);
+            break;
+
+        case constexpr_hash_djb2a("AIFile"):
+            if (xmlEntry.Content.empty()) {
+                continue;
+            }
+            Op.Code = eScriptOp::AIFile;
+            Op.Index = static_cast<unsigned>(Program.AIPrograms.size());
+            Program.AIPrograms.emplace_back(CompileAIProgram(xmlEntry.Content));
+            if (!Program.AIPrograms.back()) {
+                std::cerr << __func__ << "(): " << "AIFile not loaded.\n";
+            }
+            break;
+
+        case constexpr_hash_djb2a("Debug"): {
+            Op.Code = eScriptOp::Debug;
+            Op.Index = static_cast<unsigned>(Program.Debugs.size());
+            Program.Debugs.emplace_back();
+            sScriptDebug &Debug = Program.Debugs.back();
+            xmlDoc.bGetEntryAttribute(xmlEntry, "showline", Debug.ShowLineNumber);
+            ReadValue(xmlDoc, xmlEntry, "showbb", Debug.BBRenderMode);
+            Debug.BBRenderMode.Set = Debug.BBRenderMode.Set && (Debug.BBRenderMode.Value >= 0);
+            xmlDoc.bGetEntryAttribute(xmlEntry, "time", Debug.Stopwatch);
+        }
+        break;
+
+        case constexpr_hash_djb2a("StarSystem"): {
+            Op.Code = eScriptOp::StarSystem;
+            Op.Index = static_cast<unsigned>(Program.StarSystems.size());
+            Program.StarSystems.emplace_back();
+            sScriptStarSystem &StarSystem = Program.StarSystems.back();
+            ReadValue(xmlDoc, xmlEntry, "system", StarSystem.System);
+            xmlDoc.fGetEntryAttribute(xmlEntry, "anglex", StarSystem.BaseRotation.x);
+            xmlDoc.fGetEntryAttribute(xmlEntry, "angley", StarSystem.BaseRotation.y);
+            xmlDoc.fGetEntryAttribute(xmlEntry, "anglez", StarSystem.BaseRotation.z);
+        }
+        break;
+
+        case constexpr_hash_djb2a("LayersTransp"): {
+            Op.Code = eScriptOp::LayersTransp;
+            Op.Index = static_cast<unsigned>(Program.LayersTransps.size());
+            Program.LayersTransps.emplace_back();
+            sScriptLayersTransp &LayersTransp = Program.LayersTransps.back();
+            xmlDoc.fGetEntryAttribute(xmlEntry, "FirstStart", LayersTransp.Layer1TranspStart);
+            xmlDoc.fGetEntryAttribute(xmlEntry, "FirstEnd", LayersTransp.Layer1TranspEnd);
+            xmlDoc.fGetEntryAttribute(xmlEntry, "SecondStart", LayersTransp.Layer2TranspStart);
+            xmlDoc.fGetEntryAttribute(xmlEntry, "SecondEnd", LayersTransp.Layer2TranspEnd);
+        }
+        break;
+
+        case constexpr_hash_djb2a("Music"):
+            Op.Code = eScriptOp::Music;
+            xmlDoc.iGetEntryAttribute(xmlEntry, "theme", Op.Value);
+            break;
+
+        case constexpr_hash_djb2a("CreatePlanet"):
+            Op.Code = eScriptOp::CreatePlanet;
+            Op.Index = static_cast<unsigned>(Program.Objects.size());
+            if (!CompileObject(xmlDoc, xmlEntry, eScriptObject::Planet, Program)) {
+                continue;
+            }
+            break;
+
+        case constexpr_hash_djb2a("CreatePlanetoid"):
+            Op.Code = eScriptOp::CreatePlanetoid;
+            Op.Index = static_cast<unsigned>(Program.Objects.size());
+            CompileObject(xmlDoc, xmlEntry, eScriptObject::Planetoid, Program);
+            break;
+
+        case constexpr_hash_djb2a("AsteroidField"): {
+            Op.Code = eScriptOp::AsteroidField;
+            Op.Index = static_cast<unsigned>(Program.AsteroidFields.size());
+            Program.AsteroidFields.emplace_back();
+            sScriptAsteroidField &AsteroidField = Program.AsteroidFields.back();
+            ReadValue(xmlDoc, xmlEntry, "status", AsteroidField.On);
+            ReadValue(xmlDoc, xmlEntry, "persec", AsteroidField.Quant);
+            ReadValue(xmlDoc, xmlEntry, "w", AsteroidField.W);
+            ReadValue(xmlDoc, xmlEntry, "h", AsteroidField.H);
+            ReadValue(xmlDoc, xmlEntry, "posx", AsteroidField.XPos);
+            ReadValue(xmlDoc, xmlEntry, "posy", AsteroidField.YPos);
+            ReadValue(xmlDoc, xmlEntry, "posz", AsteroidField.ZPos);
+            ReadValue(xmlDoc, xmlEntry, "slow", AsteroidField.MaxSpeed);
+            ReadValue(xmlDoc, xmlEntry, "fast", AsteroidField.MinFastSpeed);
+        }
+        break;
+
+        case constexpr_hash_djb2a("Light"):
+            Op.Code = eScriptOp::Light;
+            Op.Index = static_cast<unsigned>(Program.Lights.size());
+            Program.Lights.emplace_back();
+            CompileLight(xmlDoc, xmlEntry, Program.Lights.back());
+            break;
+
+        case constexpr_hash_djb2a("Label"): {
+            Op.Code = eScriptOp::Label;
+            std::string tmpName{};
+            if (xmlDoc.GetEntryAttribute(xmlEntry, "name", tmpName)) {
+                Labels.emplace_back(tmpName, static_cast<unsigned>(Program.Ops.size()));
+            }
+        }
+        break;
+
+        case constexpr_hash_djb2a("Goto"): {
+            std::string tmpLabel{};
+            if (!xmlDoc.GetEntryAttribute(xmlEntry, "label", tmpLabel)) {
+                continue;
+            }
+            Op.Code = eScriptOp::Goto;
+            Gotos.emplace_back(tmpLabel, static_cast<unsigned>(Program.Ops.size()));
+        }
+        break;
+
+        case constexpr_hash_djb2a("MissionComplete"):
+            Op.Code = eScriptOp::MissionComplete;
+            break;
+
+        case constexpr_hash_djb2a("MissionCompleteAtNoEnemy"): {
+            Op.Code = eScriptOp::MissionCompleteAtNoEnemy;
+            Op.Index = static_cast<unsigned>(Program.MissionCompletes.size());
+            Program.MissionCompletes.emplace_back();
+            sScriptMissionComplete &MissionComplete = Program.MissionCompletes.back();
+            if (xmlDoc.bGetEntryAttribute(xmlEntry, "ships", MissionComplete.CheckSpaceShip)) {
+                MissionComplete.Conditional = true;
+            }
+            if (xmlDoc.bGetEntryAttribute(xmlEntry, "grounds", MissionComplete.CheckGroundObject)) {
+                MissionComplete.Conditional = true;
+            }
+            if (xmlDoc.fGetEntryAttribute(xmlEntry, "delay", MissionComplete.Delay)) {
+                MissionComplete.Conditional = true;
+            }
+        }
+        break;
+
+        default:
+            std::cerr << __func__ << "(): " << "tag " << xmlEntry.Name
+                      << " not found, line " << xmlEntry.LineNumber << "\n";
+            continue;
+        }
+
+        Program.Ops.push_back(Op);
+    }
+
+    // Goto without label act as Label (do nothing)
+    for (const auto &tmpGoto : Gotos) {
+        auto iter = std::find_if(Labels.begin(), Labels.end(),
+                                 [&tmpGoto] (const std::pair<std::string, unsigned> &tmpLabel) {
+            return tmpLabel.first == tmpGoto.first;
+        });
+        if (iter != Labels.end()) {
+            Program.Ops[tmpGoto.second].Index = iter->second;
+        } else {
+            Program.Ops[tmpGoto.second].Code = eScriptOp::Label;
+        }
+    }
+
+    return true;
+}
+
+} // astromenace namespace
+} // viewizard namespace
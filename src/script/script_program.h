@@ -0,0 +1,215 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE in future, use std::optional for sScriptValue (since C++17)
+
+#ifndef SCRIPT_SCRIPTPROGRAM_H
+#define SCRIPT_SCRIPTPROGRAM_H
+
+#include "script.h"
+#include "../config/config.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+/*
+ * Mission scripts and AI files are compiled once, on load, into typed programs.
+ * All tags and attributes are parsed and checked by compiler, interpreter deals
+ * with instructions and pre-parsed values only, without any string processing.
+ */
+
+// Script attribute value, Set is true only if attribute present in script.
+template <typename T>
+struct sScriptValue {
+    T Value{};
+    bool Set{false};
+};
+
+// Packed TimeSheets for one AI mode.
+struct sAIMode {
+    int Num{0};
+    std::vector<sTimeSheet> TimeSheets{};
+    // unpacked and looped TimeSheets, shared by all objects with this AI mode
+    std::shared_ptr<const sTimeSheetProgram> Program{};
+};
+
+// Compiled AI file, modes sorted by number.
+struct sAIProgram {
+    std::vector<sAIMode> Modes{};
+
+    // Find AI mode by number, nullptr if not found.
+    const sAIMode *FindMode(int Num) const;
+};
+
+enum class eScriptOp {
+    TimeLine,
+    AIFile,
+    Debug,
+    StarSystem,
+    LayersTransp,
+    Music,
+    CreatePlanet,
+    CreatePlanetoid,
+    AsteroidField,
+    Light,
+    Label,
+    Goto,
+    MissionComplete,
+    MissionCompleteAtNoEnemy
+};
+
+enum class eScriptObject {
+    Planet,
+    Planetoid,
+    EarthFighter,
+    AlienFighter,
+    AlienMotherShip,
+    PirateShip,
+    Asteroid,
+    BasePart,
+    BigAsteroid,
+    MilitaryBuilding,
+    CivilianBuilding,
+    Tracked,
+    Wheeled
+};
+
+// Object, created by script.
+struct sScriptObject {
+    eScriptObject Type{eScriptObject::Asteroid};
+    int LineNumber{0};
+
+    sScriptValue<int> ObjectType{};
+    sScriptValue<int> Armor{};
+    std::array<sScriptValue<int>, config::MAX_WEAPONS> Weapons{};
+
+    sScriptValue<float> Speed{};
+    sScriptValue<float> SpeedLR{};
+    sScriptValue<float> SpeedUD{};
+    sScriptValue<float> SpeedByCamFB{};
+    sScriptValue<float> SpeedByCamLR{};
+    sScriptValue<float> SpeedByCamUD{};
+    std::array<sScriptValue<float>, 3> RotationSpeed{};
+
+    bool DeleteAfterLeaveScene{true};
+
+    std::array<sScriptValue<float>, 3> AbsoluteLocation{};
+    std::array<sScriptValue<float>, 3> RelativeLocation{};
+    sVECTOR3D Rotation{0.0f, 0.0f, 0.0f};
+
+    // object's own aimode (if any) first, then TimeSheet children
+    std::vector<sTimeSheet> TimeSheets{};
+    // unpacked TimeSheets, shared by all objects created by this script line,
+    // created on first use, since depends on AI file in use
+    std::shared_ptr<const sTimeSheetProgram> TimeSheetProgram{};
+    std::shared_ptr<const sAIProgram> TimeSheetProgramAI{};
+};
+
+struct sScriptDebug {
+    bool ShowLineNumber{false};
+    sScriptValue<int> BBRenderMode{};
+    bool Stopwatch{false};
+};
+
+struct sScriptStarSystem {
+    sScriptValue<int> System{};
+    sVECTOR3D BaseRotation{0.0f, 0.0f, 0.0f};
+};
+
+struct sScriptLayersTransp {
+    float Layer1TranspStart{0.2f};
+    float Layer1TranspEnd{0.7f};
+    float Layer2TranspStart{0.9f};
+    float Layer2TranspEnd{0.7f};
+};
+
+struct sScriptAsteroidField {
+    sScriptValue<bool> On{};
+    sScriptValue<float> Quant{};
+    sScriptValue<float> W{};
+    sScriptValue<float> H{};
+    sScriptValue<float> XPos{};
+    sScriptValue<float> YPos{};
+    sScriptValue<float> ZPos{};
+    sScriptValue<float> MaxSpeed{};
+    sScriptValue<float> MinFastSpeed{};
+};
+
+struct sScriptLight {
+    eLightType Type{eLightType::Directional};
+    std::array<sScriptValue<float>, 4> Diffuse{};
+    std::array<sScriptValue<float>, 4> Specular{};
+    std::array<sScriptValue<float>, 4> Ambient{};
+    std::array<sScriptValue<float>, 3> Direction{};
+    std::array<sScriptValue<float>, 3> Location{};
+    sScriptValue<bool> On{};
+};
+
+struct sScriptMissionComplete {
+    bool CheckSpaceShip{false};
+    bool CheckGroundObject{false};
+    float Delay{0.0f};
+    bool Conditional{false}; // if no conditions, act as "MissionComplete"
+};
+
+// Instruction. Index points to the op's table, or to instruction for Goto.
+struct sScriptOp {
+    eScriptOp Code{eScriptOp::Label};
+    int LineNumber{0};
+    float Time{0.0f}; // TimeLine only
+    unsigned Index{0};
+    unsigned Count{0}; // TimeLine objects count
+    int Value{0}; // Music theme
+};
+
+// Compiled mission script.
+struct sMissionProgram {
+    std::vector<sScriptOp> Ops{};
+
+    std::vector<sScriptObject> Objects{};
+    std::vector<std::shared_ptr<const sAIProgram>> AIPrograms{};
+    std::vector<sScriptDebug> Debugs{};
+    std::vector<sScriptStarSystem> StarSystems{};
+    std::vector<sScriptLayersTransp> LayersTransps{};
+    std::vector<sScriptAsteroidField> AsteroidFields{};
+    std::vector<sScriptLight> Lights{};
+    std::vector<sScriptMissionComplete> MissionCompletes{};
+};
+
+// Compile mission script.
+bool CompileMissionScript(const std::string &FileName, sMissionProgram &Program);
+// Compile AI file (compiled AI files are shared while in use).
+std::shared_ptr<const sAIProgram> CompileAIProgram(const std::string &FileName);
+// Compile TimeSheets program, unpack all AI modes.
+std::shared_ptr<const sTimeSheetProgram> CompileTimeSheetProgram(const std::vector<sTimeSheet> &TimeSheets,
+                                                                 const sAIProgram *AIProgram);
+
+} // astromenace namespace
+} // viewizard namespace
+
+#endif // SCRIPT_SCRIPTPROGRAM_H
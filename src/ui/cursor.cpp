@@ -52,9 +52,9 @@ eCursorStatus CursorStatus{eCursorStatus::Undefined};
 float CursorBlinking{1.0f};
 float CursorBlinkingLastTime{0.0f};
 
-GLtexture CursorFront{0};
-GLtexture CursorShadow{0};
-GLtexture DraggingItemIcon{0};
+sTextureRegion CursorFront{};
+sTextureRegion CursorShadow{};
+sTextureRegion DraggingItemIcon{};
 
 } // unnamed namespace
 
@@ -72,9 +72,9 @@ void CursorInit(bool ShowSystemCursor)
     CursorBlinkingLastTime = vw_GetTimeThread(0);
 
     constexpr unsigned tmpCursorFrontHash = constexpr_hash_djb2a("menu/cursor.tga");
-    CursorFront = GetPreloadedTextureAsset(tmpCursorFrontHash);
+    CursorFront = GetPreloadedTextureRegion(tmpCursorFrontHash);
     constexpr unsigned tmpCursorShadowHash = constexpr_hash_djb2a("menu/cursor_shadow.tga");
-    CursorShadow = GetPreloadedTextureAsset(tmpCursorShadowHash);
+    CursorShadow = GetPreloadedTextureRegion(tmpCursorShadowHash);
 }
 
 /*
@@ -106,7 +106,7 @@ void CursorUpdate()
  */
 static void DrawDraggingItemIcon(int X, int Y)
 {
-    if (!DraggingItemIcon) {
+    if (!DraggingItemIcon.Texture) {
         return;
     }
 
@@ -179,7 +179,7 @@ eCursorStatus GetCursorStatus()
 /*
  * Set cursor dragging item icon texture.
  */
-void SetCursorDraggingItemIcon(GLtexture Icon)
+void SetCursorDraggingItemIcon(const sTextureRegion &Icon)
 {
     DraggingItemIcon = Icon;
 }
@@ -55,7 +55,7 @@ void SetCursorStatus(eCursorStatus Status);
 // Get cursor status.
 eCursorStatus GetCursorStatus();
 // Set cursor dragging item icon texture.
-void SetCursorDraggingItemIcon(GLtexture Icon);
+void SetCursorDraggingItemIcon(const sTextureRegion &Icon);
 // Toggle whether or not the cursor is shown.
 void SetShowGameCursor(bool Toggle);
 // Get is cursor shown or not.
@@ -117,27 +117,27 @@ void GenerateFonts()
 
     // 10
     std::string tmpSymbols10{"Copyright © 2007-2025, Viewizard"};
-    tmpSymbols10 += vw_GetText("Version");
+    tmpSymbols10 += vw_GetText(VW_TEXT_ID("Version"));
     tmpSymbols10 += GAME_VERSION;
     GenerateFont(128, 128, 10, tmpSymbols10);
 
     // 24
     std::string tmpSymbols24{};
-    tmpSymbols24 += vw_GetText("System Stock");
-    tmpSymbols24 += vw_GetText("Installed Systems");
-    tmpSymbols24 += vw_GetText("Weapon Stock");
-    tmpSymbols24 += vw_GetText("Installed Weapons");
-    tmpSymbols24 += vw_GetText("Ship Stock");
-    tmpSymbols24 += vw_GetText("Player Ship");
-    tmpSymbols24 += vw_GetText("English");
-    tmpSymbols24 += vw_GetText("Missile Detected");
-    tmpSymbols24 += vw_GetText("Collision Course Detected");
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("System Stock"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Installed Systems"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Weapon Stock"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Installed Weapons"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Ship Stock"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Player Ship"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("English"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Missile Detected"));
+    tmpSymbols24 += vw_GetText(VW_TEXT_ID("Collision Course Detected"));
     GenerateFont(256, 256, 24, tmpSymbols24);
 
     // 20
     std::string tmpSymbols20{"0123456789x."};
-    tmpSymbols20 += vw_GetText("Money");
-    tmpSymbols20 += vw_GetText("Game Speed:");
+    tmpSymbols20 += vw_GetText(VW_TEXT_ID("Money"));
+    tmpSymbols20 += vw_GetText(VW_TEXT_ID("Game Speed:"));
     GenerateFont(128, 128, 20, tmpSymbols20);
 }
 
@@ -46,7 +46,7 @@ cFPS::cFPS()
  */
 void cFPS::ClearDrawString()
 {
-    DrawStringUTF32_ = ConvertUTF8.from_bytes(vw_GetText("fps") + std::string{" ..."});
+    DrawStringUTF32_ = ConvertUTF8.from_bytes(vw_GetText(VW_TEXT_ID("fps")) + std::string{" ..."});
 }
 
 /*
@@ -116,11 +116,11 @@ void cFPS::Update()
         if (TicksDelta >= TicksInSecond) {
             // ostringstream is not so fast, but we use it one time per second
             std::ostringstream tmpStream;
-            tmpStream << vw_GetText("fps") << " "
+            tmpStream << vw_GetText(VW_TEXT_ID("fps")) << " "
                       << std::fixed << std::setprecision(1)
                       << static_cast<float>(CurrentFrame_ * TicksInSecond) / TicksDelta;
             if (GameConfig().VSync) {
-                tmpStream << " (VSync - " << vw_GetText("On") << ")";
+                tmpStream << " (VSync - " << vw_GetText(VW_TEXT_ID("On")) << ")";
             }
 
             DrawStringUTF32_ = ConvertUTF8.from_bytes(tmpStream.str());
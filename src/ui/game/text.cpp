@@ -42,11 +42,11 @@ namespace {
 float MissionNumberLifeTime{0.0f};
 float MissionNumberLastUpdateTime{0.0f};
 std::string MissionNumberString{};
-GLtexture MissionNumberTexture{0};
+sTextureRegion MissionNumberTexture{};
 
 float MissionFailedLifeTime{0.0f};
 float MissionFailedLastUpdateTime{0.0f};
-GLtexture MissionFailedTexture{0};
+sTextureRegion MissionFailedTexture{};
 
 } // unnamed namespace
 
@@ -63,7 +63,7 @@ void SetupMissionNumberText(float NotificationTime, int Number)
 
     MissionNumberLastUpdateTime = vw_GetTimeThread(0);
     MissionNumberString = std::to_string(Number);
-    MissionNumberTexture = GetPreloadedTextureAsset(hash_djb2a(vw_GetText("lang/en/game/mission.tga").c_str()));
+    MissionNumberTexture = GetPreloadedTextureRegion(hash_djb2a(vw_GetText(VW_TEXT_ID("lang/en/game/mission.tga")).c_str()));
 }
 
 /*
@@ -124,7 +124,7 @@ static void DrawNumberString(int X, int Y, float Transp)
         sRECT DstRect{XStart, Y,
                       XStart + (SrcRect.right - SrcRect.left), Y + (SrcRect.bottom - SrcRect.top)};
         constexpr unsigned tmpHash = constexpr_hash_djb2a("game/nums.tga");
-        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureAsset(tmpHash), true, Transp);
+        vw_Draw2D(DstRect, SrcRect, GetPreloadedTextureRegion(tmpHash), true, Transp);
         XStart += SrcRect.right - SrcRect.left;
     }
 }
@@ -169,7 +169,7 @@ void SetupMissionFailedText(float NotificationTime)
     }
 
     MissionFailedLastUpdateTime = vw_GetTimeThread(0);
-    MissionFailedTexture = GetPreloadedTextureAsset(hash_djb2a(vw_GetText("lang/en/game/missionfailed.tga").c_str()));
+    MissionFailedTexture = GetPreloadedTextureRegion(hash_djb2a(vw_GetText(VW_TEXT_ID("lang/en/game/missionfailed.tga")).c_str()));
 
     SetShowGameCursor(true);
     vw_GetMouseLeftClick(true);
@@ -213,12 +213,12 @@ void DrawMissionFailedText()
 
     constexpr int Y{180 + 270};
     int X = GameConfig().InternalWidth / 2 - 230;
-    if (DrawButton200_2(X,Y, vw_GetTextUTF32("QUIT"), 1.0f, false)) {
+    if (DrawButton200_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("QUIT")), 1.0f, false)) {
         ExitGame(eCommand::SWITCH_FROM_GAME_TO_MAIN_MENU);
     }
 
     X = GameConfig().InternalWidth / 2 + 30;
-    if (DrawButton200_2(X,Y, vw_GetTextUTF32("RESTART"), 1.0f, false)) {
+    if (DrawButton200_2(X,Y, vw_GetTextUTF32(VW_TEXT_ID("RESTART")), 1.0f, false)) {
         ExitGame(eCommand::SWITCH_FROM_MENU_TO_GAME);
     }
 }
@@ -77,7 +77,7 @@ void cGameSpeed::SetSpeed(float Speed)
 
     std::ostringstream tmpStream;
     tmpStream << std::fixed << std::setprecision(1)
-              << vw_GetText("Game Speed:") << " " << Speed;
+              << vw_GetText(VW_TEXT_ID("Game Speed:")) << " " << Speed;
     DrawStringUTF32_ = ConvertUTF8.from_bytes(tmpStream.str());
 }
 
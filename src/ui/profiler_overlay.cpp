@@ -0,0 +1,103 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+#include "profiler_overlay.h"
+#include "../config/config.h"
+#include "SDL2/SDL.h"
+#include <sstream>
+#include <iomanip>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+/*
+ * Draw profiler overlay.
+ * Note, caller should setup 2D mode rendering first.
+ */
+void cProfilerOverlay::Draw()
+{
+    if (!GameConfig().ShowProfiler) {
+        return;
+    }
+
+    // first line reserved for fps counter
+    constexpr int LineHeight{20};
+    int Y{5 + LineHeight};
+    for (auto &tmpString : DrawStringsUTF32_) {
+        vw_DrawTextUTF32(6, Y, 0, 0, 1.0f, TextColor_, 1.0f, tmpString);
+        Y += LineHeight;
+    }
+}
+
+/*
+ * Update profiler overlay.
+ */
+void cProfilerOverlay::Update()
+{
+    vw_ProfilerEnable(GameConfig().ShowProfiler);
+
+    if (!GameConfig().ShowProfiler) {
+        DrawStringsUTF32_.clear();
+        return;
+    }
+
+    uint32_t CurrentTick = SDL_GetTicks();
+    // update text two times per second, since ostringstream is not so fast
+    constexpr uint32_t UpdateTicks{500}; // connected to SDL_GetTicks()
+    if (LastTick_ <= CurrentTick && CurrentTick - LastTick_ < UpdateTicks) {
+        return;
+    }
+    LastTick_ = CurrentTick;
+
+    DrawStringsUTF32_.clear();
+    for (auto &tmpScope : vw_ProfilerGetFrameResults()) {
+        std::ostringstream tmpStream;
+        tmpStream << std::string(tmpScope.Depth * 2, ' ') << tmpScope.Name << " "
+                  << std::fixed << std::setprecision(2) << tmpScope.CPUTime << " ms";
+        if (tmpScope.GPUTime >= 0.0f) {
+            tmpStream << " (GPU " << tmpScope.GPUTime << " ms)";
+        }
+        DrawStringsUTF32_.emplace_back(ConvertUTF8.from_bytes(tmpStream.str()));
+    }
+
+    std::ostringstream tmpStream;
+    tmpStream << "GL state cache: " << vw_GetStateCacheSkippedCalls() << " calls skipped";
+    DrawStringsUTF32_.emplace_back(ConvertUTF8.from_bytes(tmpStream.str()));
+
+    tmpStream.str("");
+    tmpStream << "Frame arena: " << vw_GetFrameArenaUsage() / 1024 << " KB";
+    DrawStringsUTF32_.emplace_back(ConvertUTF8.from_bytes(tmpStream.str()));
+
+#ifdef COUNT_HEAP_ALLOCATIONS
+    tmpStream.str("");
+    tmpStream << "Heap allocations: " << vw_GetFrameHeapAllocations();
+    DrawStringsUTF32_.emplace_back(ConvertUTF8.from_bytes(tmpStream.str()));
+#endif // COUNT_HEAP_ALLOCATIONS
+}
+
+} // astromenace namespace
+} // viewizard namespace
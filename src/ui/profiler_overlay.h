@@ -0,0 +1,64 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (C) 2006-2025 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+*****************************************************************************/
+
+// TODO this is temporary code, should be revised to be a part of new 'menu' window class hierarchy instead of singleton
+
+#ifndef UI_PROFILEROVERLAY_H
+#define UI_PROFILEROVERLAY_H
+
+#include "../core/core.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+class cProfilerOverlay {
+private:
+    cProfilerOverlay() = default;
+    ~cProfilerOverlay() = default;
+
+    uint32_t LastTick_{0};
+    std::vector<std::u32string> DrawStringsUTF32_{};
+    sRGBCOLOR TextColor_{eRGBCOLOR::white};
+
+public:
+    cProfilerOverlay(const cProfilerOverlay &) = delete;
+    void operator = (const cProfilerOverlay &) = delete;
+
+    static cProfilerOverlay &GetInstance()
+    {
+        static cProfilerOverlay Instance;
+        return Instance;
+    }
+
+    void Draw();
+    void Update();
+};
+
+} // astromenace namespace
+} // viewizard namespace
+
+#endif // UI_PROFILEROVERLAY_H